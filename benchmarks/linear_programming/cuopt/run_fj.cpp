@@ -0,0 +1,197 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#include "mip_test_instances.hpp"
+
+#include <branch_and_bound/feasibility_jump.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/tic_toc.hpp>
+#include <pdlp/cpu_translate.hpp>
+#include <utilities/logger.hpp>
+
+#include <cuopt/linear_programming/cpu_optimization_problem.hpp>
+#include <cuopt/linear_programming/optimization_problem_utils.hpp>
+#include <mps_parser/parser.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Time to the first feasible solution of the CPU feasibility jump heuristic on a set of MIPs,
+// e.g. MIPLIB. Only the heuristic runs, without presolve or B&B.
+//
+// Usage:
+//   solve_FJ --path <mps file or directory> [--climbers <n>] [--time-limit <s>] [--out-dir <dir>]
+
+namespace {
+
+using i_t = int;
+using f_t = double;
+
+namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+
+struct fj_result_t {
+  std::string name;
+  bool found;
+  f_t first_time;
+  f_t best_objective;
+  i_t num_solutions;
+  int64_t num_moves;
+};
+
+dual_simplex::user_problem_t<i_t, f_t> read_problem(const std::string& path)
+{
+  constexpr bool input_mps_strict = false;
+  auto mps_data_model             = cuopt::mps_parser::parse_mps<i_t, f_t>(path, input_mps_strict);
+  cuopt::linear_programming::cpu_optimization_problem_t<i_t, f_t> problem;
+  cuopt::linear_programming::populate_from_mps_data_model(&problem, mps_data_model);
+  return cuopt::linear_programming::cpu_problem_to_simplex_problem(problem);
+}
+
+fj_result_t run_single_file(const std::string& path,
+                            i_t num_climbers,
+                            f_t time_limit,
+                            bool stop_at_first)
+{
+  const auto problem = read_problem(path);
+  dual_simplex::simplex_solver_settings_t<i_t, f_t> settings;
+  settings.time_limit = time_limit;
+  settings.log.log    = false;
+
+  fj_result_t result{std::filesystem::path(path).filename().string(), false, time_limit, 0, 0, 0};
+  const f_t start_time = dual_simplex::tic();
+  dual_simplex::feasibility_jump_t<i_t, f_t> feasibility_jump(problem, settings, start_time);
+  std::atomic<bool> found{false};
+  feasibility_jump.start(num_climbers, [&](const std::vector<f_t>&) {
+    if (!found) {
+      result.first_time = dual_simplex::toc(start_time);
+      found             = true;
+    }
+  });
+  while (dual_simplex::toc(start_time) < time_limit && !(stop_at_first && found)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  feasibility_jump.stop();
+
+  result.found          = found;
+  result.best_objective = feasibility_jump.get_best_objective();
+  result.num_solutions  = feasibility_jump.num_solutions();
+  result.num_moves      = feasibility_jump.get_num_moves();
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  argparse::ArgumentParser program("solve_FJ");
+
+  program.add_argument("--path").help("MPS file or directory of MPS files").required();
+
+  program.add_argument("--run-selected")
+    .help("only run the instances of mip_test_instances.hpp in the directory (t/f)")
+    .default_value(std::string("f"));
+
+  program.add_argument("--climbers")
+    .help("number of feasibility jump climbers")
+    .scan<'i', int>()
+    .default_value(4);
+
+  program.add_argument("--time-limit")
+    .help("time limit per instance in seconds")
+    .scan<'g', double>()
+    .default_value(10.0);
+
+  program.add_argument("--stop-at-first")
+    .help("stop at the first feasible solution (t/f)")
+    .default_value(std::string("t"));
+
+  program.add_argument("--out-dir").help("output directory for the results");
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  const std::string path   = program.get<std::string>("--path");
+  const bool run_selected  = program.get<std::string>("--run-selected")[0] == 't';
+  const i_t num_climbers   = program.get<int>("--climbers");
+  const f_t time_limit     = program.get<double>("--time-limit");
+  const bool stop_at_first = program.get<std::string>("--stop-at-first")[0] == 't';
+
+  std::vector<std::string> paths;
+  if (std::filesystem::is_directory(path)) {
+    if (run_selected) {
+      for (const auto& instance : instances) {
+        paths.push_back(path + "/" + instance);
+      }
+    } else {
+      for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        paths.push_back(entry.path());
+      }
+    }
+  } else {
+    paths.push_back(path);
+  }
+
+  cuopt::init_logger_t log("", true);
+
+  std::vector<fj_result_t> results;
+  for (const auto& file : paths) {
+    try {
+      results.push_back(run_single_file(file, num_climbers, time_limit, stop_at_first));
+    } catch (const std::exception& e) {
+      CUOPT_LOG_ERROR("Error on %s: %s", file.c_str(), e.what());
+      continue;
+    }
+    const auto& result = results.back();
+    CUOPT_LOG_INFO("%-40s %s first %8.3fs best %+.6e solutions %4d moves %ld",
+                   result.name.c_str(),
+                   result.found ? "feasible  " : "infeasible",
+                   result.first_time,
+                   result.best_objective,
+                   result.num_solutions,
+                   result.num_moves);
+  }
+
+  // Shifted geometric mean of the time to the first feasible solution, with the time limit for
+  // the instances without a solution
+  constexpr f_t shift = 1.0;
+  f_t log_sum         = 0.0;
+  i_t num_found       = 0;
+  for (const auto& result : results) {
+    log_sum += std::log(result.first_time + shift);
+    num_found += result.found;
+  }
+  const f_t sgm = results.empty() ? 0.0 : std::exp(log_sum / results.size()) - shift;
+  CUOPT_LOG_INFO("Feasible %d/%zu, shifted geometric mean of the time to first feasible %.3fs",
+                 num_found,
+                 results.size(),
+                 sgm);
+
+  if (program.is_used("--out-dir")) {
+    std::ofstream out(program.get<std::string>("--out-dir") + "/fj_results.csv");
+    out << "instance,feasible,first_time,best_objective,num_solutions,num_moves\n";
+    for (const auto& result : results) {
+      out << result.name << "," << result.found << "," << result.first_time << ","
+          << result.best_objective << "," << result.num_solutions << "," << result.num_moves
+          << "\n";
+    }
+  }
+  return 0;
+}
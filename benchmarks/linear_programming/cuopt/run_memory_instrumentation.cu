@@ -0,0 +1,189 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuopt/linear_programming/mip/solver_settings.hpp>
+#include <cuopt/linear_programming/solve.hpp>
+#include <mip_heuristics/feasibility_jump/feasibility_jump.cuh>
+#include <mip_heuristics/feasibility_jump/fj_cpu.cuh>
+#include <mip_heuristics/solution/solution.cuh>
+#include <mip_heuristics/solver.cuh>
+#include <pdlp/pdlp.cuh>
+#include <utilities/logger.hpp>
+#include <utilities/memory_instrumentation.hpp>
+#include <utilities/timer.hpp>
+
+#include <mps_parser/parser.hpp>
+
+#include <raft/core/handle.hpp>
+
+#include <thrust/fill.h>
+
+#include <argparse/argparse.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Cost per iteration of the memory instrumentation of ins_vector in the CPU feasibility jump
+// climbers (mip_heuristics/feasibility_jump/fj_cpu.cu). fj_t::create_cpu_climber builds a
+// climber with the counting and with the passthrough policy on the same problem and starting
+// point. Both run the same number of iterations from the same seed, so they make exactly the same
+// moves.
+//
+// Usage:
+//   solve_memory_instrumentation --path <mps file> [--iterations <n>] [--repeats <n>]
+
+namespace {
+
+using i_t = int;
+using f_t = double;
+
+namespace detail = cuopt::linear_programming::detail;
+
+using cuopt::memory_counting_t;
+using cuopt::memory_passthrough_t;
+
+struct run_result_t {
+  f_t ns_per_iteration;
+  f_t work_units;
+  f_t best_objective;
+  int64_t num_iterations;
+  bool feasible_found;
+};
+
+template <typename memory_policy_t>
+run_result_t run_climber(detail::fj_t<i_t, f_t>& fj,
+                         detail::solution_t<i_t, f_t>& solution,
+                         int64_t iterations,
+                         int seed)
+{
+  const std::vector<f_t> weights(solution.problem_ptr->n_constraints, 1.);
+  std::atomic<bool> preemption_flag{false};
+  detail::fj_settings_t settings;
+  settings.iteration_limit = static_cast<int>(iterations);
+
+  auto climber = fj.template create_cpu_climber<memory_policy_t>(
+    solution, weights, weights, 0., preemption_flag, settings);
+  // create_cpu_climber draws the seed from the generator, fix it so that both policies match
+  climber->settings.seed = seed;
+
+  const auto start = std::chrono::steady_clock::now();
+  fj.cpu_solve(*climber);
+  const auto end = std::chrono::steady_clock::now();
+
+  const f_t elapsed_ns         = std::chrono::duration<f_t, std::nano>(end - start).count();
+  const int64_t num_iterations = std::max<int64_t>(climber->iterations, 1);
+  return {elapsed_ns / num_iterations,
+          climber->work_units_elapsed.load(),
+          climber->h_best_objective,
+          climber->iterations,
+          climber->feasible_found};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  argparse::ArgumentParser program("solve_memory_instrumentation");
+
+  program.add_argument("--path").help("MPS file").required();
+
+  program.add_argument("--iterations")
+    .help("number of climber iterations")
+    .scan<'i', int>()
+    .default_value(1000000);
+
+  program.add_argument("--repeats")
+    .help("number of runs of each variant, the fastest one is reported")
+    .scan<'i', int>()
+    .default_value(5);
+
+  program.add_argument("--seed").help("random seed").scan<'i', int>().default_value(0);
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  const int64_t iterations = program.get<int>("--iterations");
+  const int repeats        = program.get<int>("--repeats");
+  const int seed           = program.get<int>("--seed");
+
+  cuopt::init_logger_t log("", true);
+  const raft::handle_t handle{};
+
+  constexpr bool input_mps_strict = false;
+  const auto mps_problem =
+    cuopt::mps_parser::parse_mps<i_t, f_t>(program.get<std::string>("--path"), input_mps_strict);
+  auto op_problem =
+    cuopt::linear_programming::mps_data_model_to_optimization_problem(&handle, mps_problem);
+
+  // Same setup as the MIP solver before the heuristics start: standardized bounds and a solver
+  // context for fj_t
+  detail::problem_t<i_t, f_t> problem(op_problem);
+  problem.preprocess_problem();
+  detail::pdhg_solver_t<i_t, f_t> pdhg_solver(problem.handle_ptr, problem);
+  detail::pdlp_initial_scaling_strategy_t<i_t, f_t> scaling(&handle,
+                                                            problem,
+                                                            10,
+                                                            1.0,
+                                                            pdhg_solver,
+                                                            problem.reverse_coefficients,
+                                                            problem.reverse_offsets,
+                                                            problem.reverse_constraints,
+                                                            true);
+  cuopt::linear_programming::mip_solver_settings_t<i_t, f_t> settings;
+  detail::mip_solver_t<i_t, f_t> solver(
+    problem, settings, scaling, cuopt::timer_t(std::numeric_limits<f_t>::infinity()));
+  detail::fj_t<i_t, f_t> fj(solver.context);
+
+  detail::solution_t<i_t, f_t> solution(*solver.context.problem_ptr);
+  thrust::fill(solution.handle_ptr->get_thrust_policy(),
+               solution.assignment.begin(),
+               solution.assignment.end(),
+               0.0);
+  solution.clamp_within_bounds();
+  solution.handle_ptr->sync_stream();
+
+  CUOPT_LOG_INFO("%d rows, %d columns, %d nonzeros",
+                 problem.n_constraints,
+                 problem.n_variables,
+                 problem.nnz);
+
+  run_result_t counting{std::numeric_limits<f_t>::infinity()};
+  run_result_t passthrough{std::numeric_limits<f_t>::infinity()};
+  for (int r = 0; r < repeats; ++r) {
+    const auto c = run_climber<memory_counting_t>(fj, solution, iterations, seed);
+    const auto p = run_climber<memory_passthrough_t>(fj, solution, iterations, seed);
+    if (c.num_iterations != p.num_iterations || c.best_objective != p.best_objective ||
+        c.feasible_found != p.feasible_found) {
+      CUOPT_LOG_ERROR("The counting and passthrough climbers diverged");
+      return 1;
+    }
+    if (c.ns_per_iteration < counting.ns_per_iteration) { counting = c; }
+    if (p.ns_per_iteration < passthrough.ns_per_iteration) { passthrough = p; }
+  }
+
+  CUOPT_LOG_INFO("counting    %10.1f ns/iteration, %.3f work units",
+                 counting.ns_per_iteration,
+                 counting.work_units);
+  CUOPT_LOG_INFO("passthrough %10.1f ns/iteration", passthrough.ns_per_iteration);
+  CUOPT_LOG_INFO("instrumentation overhead %.1f%%, %ld iterations, %s",
+                 100.0 * (counting.ns_per_iteration / passthrough.ns_per_iteration - 1.0),
+                 counting.num_iterations,
+                 counting.feasible_found ? "feasible" : "infeasible");
+  return 0;
+}
@@ -0,0 +1,183 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_trace.hpp>
+
+#include <cuopt/error.hpp>
+#include <cuopt/version_config.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file cuopt_bb_trace_profile.cpp
+ * @brief Summarizes a branch-and-bound trace written by the MIP solver
+ *
+ * The trace is written when the CUOPT_MIP_TREE_TRACE_FILE setting names a file. The profiler
+ * reports the shape of the search tree, the busy and idle time of each worker, the success rate
+ * of the dives per diving heuristic and the progress of the global bound and of the incumbent.
+ *
+ * Usage:
+ * ```
+ * cuopt_bb_trace_profile <trace file> [--bound-samples <n>]
+ * ```
+ */
+
+namespace {
+
+namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+
+constexpr const char* node_type_names[] = {
+  "branched", "fathomed", "integer", "infeasible", "numerical"};
+
+void print_tree(const dual_simplex::bb_trace_profile_t& profile)
+{
+  std::printf("Tree\n");
+  int64_t total = 0;
+  for (int t = 0; t < 5; ++t) {
+    std::printf("  %-12s %12ld\n", node_type_names[t], profile.nodes_by_type[t]);
+    total += profile.nodes_by_type[t];
+  }
+  std::printf("  %-12s %12ld (%ld best first, %ld diving)\n",
+              "total",
+              total,
+              profile.tree_nodes,
+              profile.dive_nodes);
+  std::printf("  max depth    %12zu\n",
+              profile.tree_nodes_per_depth.empty() ? 0 : profile.tree_nodes_per_depth.size() - 1);
+  std::printf("  depth        nodes\n");
+  for (size_t d = 0; d < profile.tree_nodes_per_depth.size(); ++d) {
+    if (profile.tree_nodes_per_depth[d] == 0) { continue; }
+    std::printf("  %5zu %12ld\n", d, profile.tree_nodes_per_depth[d]);
+  }
+}
+
+void print_workers(const dual_simplex::bb_trace_profile_t& profile)
+{
+  std::printf("\nWorkers (search time %.3fs)\n", profile.search_time);
+  std::printf("  worker    tasks      nodes   LP iters  LP time(s)  busy(s)  idle(s)  idle(%%)\n");
+  for (size_t w = 0; w < profile.workers.size(); ++w) {
+    const auto& worker = profile.workers[w];
+    if (worker.tasks == 0 && worker.nodes == 0) { continue; }
+    const double idle_pct =
+      profile.search_time > 0 ? 100.0 * worker.idle_time / profile.search_time : 0.0;
+    std::printf("  %6zu %8ld %10ld %10ld %11.3f %8.3f %8.3f %8.1f\n",
+                w,
+                worker.tasks,
+                worker.nodes,
+                worker.lp_iterations,
+                worker.lp_time,
+                worker.busy_time,
+                worker.idle_time,
+                idle_pct);
+  }
+}
+
+void print_dives(const dual_simplex::bb_trace_profile_t& profile)
+{
+  std::printf("\nDives\n");
+  std::printf("  %-20s %8s %10s %10s %12s\n",
+              "strategy",
+              "dives",
+              "successful",
+              "success(%)",
+              "nodes/dive");
+  for (size_t s = 0; s < profile.dives_per_strategy.size(); ++s) {
+    const auto& dives = profile.dives_per_strategy[s];
+    if (dives.dives == 0) { continue; }
+    std::printf("  %-20s %8ld %10ld %10.1f %12.1f\n",
+                dual_simplex::bb_trace_strategy_name(s),
+                dives.dives,
+                dives.successful,
+                100.0 * dives.successful / dives.dives,
+                static_cast<double>(dives.nodes) / dives.dives);
+  }
+}
+
+// Prints the bound and the incumbent at evenly spaced times of the search
+void print_bound_curve(const dual_simplex::bb_trace_header_t& header,
+                       const dual_simplex::bb_trace_profile_t& profile,
+                       int num_samples)
+{
+  std::printf("\nBound progress\n");
+  if (profile.bound_curve.empty()) {
+    std::printf("  no bounds recorded\n");
+    return;
+  }
+  std::printf("  %10s %12s %16s %16s\n", "time(s)", "work", "bound", "incumbent");
+  num_samples = std::max(num_samples, 2);
+  size_t next = 0;
+  for (int k = 0; k < num_samples; ++k) {
+    const double time = header.search_start_time + profile.search_time * k / (num_samples - 1);
+    while (next + 1 < profile.bound_curve.size() &&
+           profile.bound_curve[next + 1].wall_time <= time) {
+      ++next;
+    }
+    const auto& sample = profile.bound_curve[next];
+    if (sample.wall_time > time) { continue; }
+    std::printf("  %10.3f %12.3f %+16.8e %+16.8e\n",
+                time,
+                sample.work_timestamp,
+                sample.bound,
+                sample.incumbent);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::string version_string = std::string("cuOpt ") + std::to_string(CUOPT_VERSION_MAJOR) +
+                                     "." + std::to_string(CUOPT_VERSION_MINOR) + "." +
+                                     std::to_string(CUOPT_VERSION_PATCH);
+
+  argparse::ArgumentParser program("cuopt_bb_trace_profile", version_string);
+  program.add_argument("trace").help("branch-and-bound trace written by the MIP solver");
+  program.add_argument("--bound-samples")
+    .help("number of points of the bound progress curve")
+    .default_value(20)
+    .scan<'i', int>();
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  dual_simplex::bb_trace_header_t header;
+  std::vector<dual_simplex::bb_trace_record_t> records;
+  try {
+    dual_simplex::read_bb_trace(program.get<std::string>("trace"), header, records);
+  } catch (const cuopt::logic_error& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  const auto profile = dual_simplex::profile_bb_trace(header, records);
+  std::printf("%s: %zu records, %d workers, %s mode\n\n",
+              program.get<std::string>("trace").c_str(),
+              records.size(),
+              header.num_workers,
+              header.deterministic ? "deterministic" : "opportunistic");
+  if (profile.skipped_records > 0) {
+    std::printf("Skipped %ld records with a worker outside the header\n\n",
+                profile.skipped_records);
+  }
+  print_tree(profile);
+  print_workers(profile);
+  print_dives(profile);
+  print_bound_curve(header, profile, program.get<int>("--bound-samples"));
+  return 0;
+}
@@ -0,0 +1,104 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/remote/remote_server.hpp>
+#include <utilities/logger.hpp>
+
+#include <cuopt/error.hpp>
+#include <cuopt/version_config.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <csignal>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file cuopt_remote_server.cpp
+ * @brief Reference server for cuOpt remote execution
+ *
+ * Serves the requests sent by solve_lp_remote / solve_mip_remote when a client sets
+ * CUOPT_REMOTE_HOST and CUOPT_REMOTE_PORT. Problems are solved on the host with the dual
+ * simplex, CPU barrier and branch and bound solvers, so the server does not need a GPU.
+ *
+ * Usage:
+ * ```
+ * cuopt_remote_server [--host <address>] [--port <port>] [--max-concurrent-solves <n>]
+ *                     [--max-request-size-mb <mb>]
+ * ```
+ *
+ * The server does not authenticate its clients, so it listens on the loopback interface by
+ * default. Pass --host 0.0.0.0 (or ::) only on a trusted network.
+ *
+ * The server runs until it receives SIGINT or SIGTERM.
+ */
+
+int main(int argc, char* argv[])
+{
+  const std::string version_string = std::string("cuOpt ") + std::to_string(CUOPT_VERSION_MAJOR) +
+                                     "." + std::to_string(CUOPT_VERSION_MINOR) + "." +
+                                     std::to_string(CUOPT_VERSION_PATCH);
+
+  argparse::ArgumentParser program("cuopt_remote_server", version_string);
+  program.add_argument("--host")
+    .help("address to listen on; clients are not authenticated, so use 0.0.0.0 or :: to accept "
+          "remote clients only on a trusted network")
+    .default_value(std::string(cuopt::linear_programming::remote::remote_server_t::default_host));
+  program.add_argument("--port")
+    .help("TCP port to listen on (0 picks a free port)")
+    .default_value(8765)
+    .scan<'i', int>();
+  program.add_argument("--max-concurrent-solves")
+    .help("number of requests solved at the same time; other requests wait for a free slot")
+    .default_value(1)
+    .scan<'i', int>();
+  program.add_argument("--max-request-size-mb")
+    .help("largest request accepted, in MiB; larger requests are rejected before they are read")
+    .default_value(16384)
+    .scan<'i', int>();
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  cuopt::init_logger_t log("", true);
+
+  // Block the termination signals in every thread and wait for them on the main thread
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  const int max_request_size_mb = program.get<int>("--max-request-size-mb");
+  if (max_request_size_mb <= 0) {
+    std::cerr << "--max-request-size-mb must be positive" << std::endl;
+    return 1;
+  }
+  cuopt::linear_programming::remote::remote_server_t server(
+    program.get<int>("--port"),
+    program.get<int>("--max-concurrent-solves"),
+    static_cast<uint64_t>(max_request_size_mb) << 20,
+    program.get<std::string>("--host"));
+  try {
+    server.start();
+  } catch (const cuopt::logic_error& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  int signal = 0;
+  sigwait(&signals, &signal);
+  CUOPT_LOG_INFO("Received signal %d, shutting down", signal);
+  server.stop();
+  return 0;
+}
@@ -0,0 +1,151 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/work_unit_calibration.hpp>
+#include <pdlp/cpu_translate.hpp>
+#include <utilities/logger.hpp>
+#include <utilities/work_unit_model.hpp>
+
+#include <cuopt/error.hpp>
+#include <cuopt/linear_programming/cpu_optimization_problem.hpp>
+#include <cuopt/linear_programming/optimization_problem_utils.hpp>
+#include <cuopt/version_config.hpp>
+#include <mps_parser/parser.hpp>
+
+#include <argparse/argparse.hpp>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file cuopt_work_unit_calibrate.cpp
+ * @brief Fits the work unit model of the deterministic mode to the local machine
+ *
+ * Solves LPs with the dual simplex method, measures the wall time spent between the points where
+ * the solver records work, and fits one weight per counted kernel so that work units follow the
+ * measured time. The weights are written to a profile file; deterministic runs load it when the
+ * CUOPT_WORK_UNIT_PROFILE environment variable names it. Runs using the same profile stay
+ * reproducible. Without MPS files, random LPs of a few sizes are used.
+ *
+ * Usage:
+ * ```
+ * cuopt_work_unit_calibrate --output <profile> [--seed <seed>] [--repeats <n>] [mps files...]
+ * ```
+ */
+
+namespace {
+
+using i_t = int;
+using f_t = double;
+
+namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+
+dual_simplex::user_problem_t<i_t, f_t> read_problem(const std::string& path)
+{
+  constexpr bool input_mps_strict = false;
+  auto mps_data_model             = cuopt::mps_parser::parse_mps<i_t, f_t>(path, input_mps_strict);
+  cuopt::linear_programming::cpu_optimization_problem_t<i_t, f_t> problem;
+  cuopt::linear_programming::populate_from_mps_data_model(&problem, mps_data_model);
+  return cuopt::linear_programming::cpu_problem_to_simplex_problem(problem);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const std::string version_string = std::string("cuOpt ") + std::to_string(CUOPT_VERSION_MAJOR) +
+                                     "." + std::to_string(CUOPT_VERSION_MINOR) + "." +
+                                     std::to_string(CUOPT_VERSION_PATCH);
+
+  argparse::ArgumentParser program("cuopt_work_unit_calibrate", version_string);
+  program.add_argument("--output").help("path of the work unit profile to write").required();
+  program.add_argument("--seed")
+    .help("seed of the random LPs used when no MPS file is given")
+    .default_value(1)
+    .scan<'i', int>();
+  program.add_argument("--repeats")
+    .help("number of times each problem is solved")
+    .default_value(3)
+    .scan<'i', int>();
+  program.add_argument("files").help("MPS files of representative LPs").remaining();
+
+  try {
+    program.parse_args(argc, argv);
+  } catch (const std::runtime_error& err) {
+    std::cerr << err.what() << std::endl;
+    std::cerr << program;
+    return 1;
+  }
+
+  cuopt::init_logger_t log("", true);
+
+  std::vector<dual_simplex::user_problem_t<i_t, f_t>> problems;
+  try {
+    const auto files = program.present<std::vector<std::string>>("files");
+    if (files) {
+      for (const auto& file : *files) {
+        CUOPT_LOG_INFO("Reading file %s", file.c_str());
+        problems.push_back(read_problem(file));
+      }
+    } else {
+      const int seed = program.get<int>("--seed");
+      for (i_t size : {500, 1000, 2000, 4000}) {
+        problems.push_back(
+          dual_simplex::random_calibration_problem<i_t, f_t>(size, 2 * size, 0.01, seed + size));
+      }
+    }
+  } catch (const std::exception& e) {
+    CUOPT_LOG_ERROR("Error: %s", e.what());
+    return 1;
+  }
+
+  dual_simplex::simplex_solver_settings_t<i_t, f_t> settings;
+  settings.log.log = false;
+  dual_simplex::work_unit_calibration_t<i_t, f_t> calibration;
+  const int repeats = program.get<int>("--repeats");
+  for (int r = 0; r < repeats; ++r) {
+    for (const auto& problem : problems) {
+      const auto status = calibration.add_problem(problem, settings);
+      CUOPT_LOG_INFO("Solved %s (%d rows, %d columns): %s, %zu samples",
+                     problem.problem_name.c_str(),
+                     problem.num_rows,
+                     problem.num_cols,
+                     dual_simplex::lp_status_to_string(status).c_str(),
+                     calibration.num_samples());
+    }
+  }
+  if (calibration.num_samples() == 0) {
+    CUOPT_LOG_ERROR("No work was recorded, nothing to calibrate");
+    return 1;
+  }
+
+  const cuopt::work_unit_model_t default_model;
+  const cuopt::work_unit_model_t model = calibration.fit();
+  for (int k = 0; k < cuopt::num_work_kernels; ++k) {
+    const auto kernel = static_cast<cuopt::work_kernel_t>(k);
+    CUOPT_LOG_INFO("%-20s weight %.3e (default %.3e)",
+                   cuopt::work_kernel_name(kernel),
+                   model.weight(kernel),
+                   default_model.weight(kernel));
+  }
+  CUOPT_LOG_INFO("Measured %.3fs, relative error %.3f calibrated, %.3f default",
+                 calibration.total_seconds(),
+                 calibration.relative_error(model),
+                 calibration.relative_error(default_model));
+
+  try {
+    model.save(program.get<std::string>("--output"));
+  } catch (const cuopt::logic_error& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  CUOPT_LOG_INFO("Wrote %s", program.get<std::string>("--output").c_str());
+  return 0;
+}
@@ -41,10 +41,12 @@
 #define CUOPT_LOG_FILE                        "log_file"
 #define CUOPT_LOG_TO_CONSOLE                  "log_to_console"
 #define CUOPT_CROSSOVER                       "crossover"
+#define CUOPT_PARALLEL_CROSSOVER              "parallel_crossover"
 #define CUOPT_FOLDING                         "folding"
 #define CUOPT_AUGMENTED                       "augmented"
 #define CUOPT_DUALIZE                         "dualize"
 #define CUOPT_ORDERING                        "ordering"
+#define CUOPT_CPU_BARRIER                     "cpu_barrier"
 #define CUOPT_BARRIER_DUAL_INITIAL_POINT      "barrier_dual_initial_point"
 #define CUOPT_ELIMINATE_DENSE_COLUMNS         "eliminate_dense_columns"
 #define CUOPT_CUDSS_DETERMINISTIC             "cudss_deterministic"
@@ -64,11 +66,17 @@
 #define CUOPT_MIP_MIXED_INTEGER_ROUNDING_CUTS "mip_mixed_integer_rounding_cuts"
 #define CUOPT_MIP_MIXED_INTEGER_GOMORY_CUTS   "mip_mixed_integer_gomory_cuts"
 #define CUOPT_MIP_KNAPSACK_CUTS               "mip_knapsack_cuts"
+#define CUOPT_MIP_FLOW_COVER_CUTS             "mip_flow_cover_cuts"
 #define CUOPT_MIP_STRONG_CHVATAL_GOMORY_CUTS  "mip_strong_chvatal_gomory_cuts"
 #define CUOPT_MIP_REDUCED_COST_STRENGTHENING  "mip_reduced_cost_strengthening"
 #define CUOPT_MIP_CUT_CHANGE_THRESHOLD        "mip_cut_change_threshold"
 #define CUOPT_MIP_CUT_MIN_ORTHOGONALITY       "mip_cut_min_orthogonality"
 #define CUOPT_MIP_BATCH_PDLP_STRONG_BRANCHING "mip_batch_pdlp_strong_branching"
+#define CUOPT_MIP_TREE_TRACE_FILE             "mip_tree_trace_file"
+#define CUOPT_MIP_NODE_MEMORY_LIMIT           "mip_node_memory_limit"
+#define CUOPT_MIP_CHECKPOINT_FILE             "mip_checkpoint_file"
+#define CUOPT_MIP_CHECKPOINT_INTERVAL         "mip_checkpoint_interval"
+#define CUOPT_MIP_RESUME_FILE                 "mip_resume_file"
 #define CUOPT_SOLUTION_FILE                   "solution_file"
 #define CUOPT_NUM_CPU_THREADS                 "num_cpu_threads"
 #define CUOPT_NUM_GPUS                        "num_gpus"
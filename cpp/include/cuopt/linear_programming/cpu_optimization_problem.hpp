@@ -10,6 +10,7 @@
 #include <cuopt/linear_programming/optimization_problem_interface.hpp>
 
 #include <raft/core/handle.hpp>
+#include <raft/core/host_span.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <cstdint>
@@ -41,6 +42,46 @@ class mip_solution_interface_t;
 template <typename i_t, typename f_t>
 class cpu_optimization_problem_t : public optimization_problem_interface_t<i_t, f_t> {
  public:
+  /**
+   * @brief Non-owning host view of the problem data. Unlike the host getters, which return
+   *        copies, the spans point into the storage of the problem and stay valid while the
+   *        problem is alive and not modified. Arrays that were never set are empty.
+   *
+   * The view is read when the problem is serialized and when it is converted to the dual
+   * simplex input, where the CSC matrix is built once from the borrowed CSR arrays. The solvers
+   * do not share that CSC matrix: they copy the constraint matrix into their own LP.
+   */
+  struct view_t {
+    /** number of variables */
+    i_t n_vars;
+    /** number of constraints */
+    i_t n_constraints;
+    /**
+     * constraint matrix in the CSR format
+     * @{
+     */
+    raft::host_span<const f_t> A;
+    raft::host_span<const i_t> A_indices;
+    raft::host_span<const i_t> A_offsets;
+    /** @} */
+    /** RHS of the constraints */
+    raft::host_span<const f_t> b;
+    /** row types of the constraints */
+    raft::host_span<const char> row_types;
+    /** array of weights used in the objective function */
+    raft::host_span<const f_t> c;
+    /** array of lower bounds for the variables */
+    raft::host_span<const f_t> variable_lower_bounds;
+    /** array of upper bounds for the variables */
+    raft::host_span<const f_t> variable_upper_bounds;
+    /** variable types */
+    raft::host_span<const var_t> variable_types;
+    /** array of lower bounds for the constraint */
+    raft::host_span<const f_t> constraint_lower_bounds;
+    /** array of upper bounds for the constraint */
+    raft::host_span<const f_t> constraint_upper_bounds;
+  };  // struct view_t
+
   cpu_optimization_problem_t();
 
   // Setters
@@ -126,6 +167,12 @@ class cpu_optimization_problem_t : public optimization_problem_interface_t<i_t,
   std::vector<char> get_row_types_host() const override;
   std::vector<var_t> get_variable_types_host() const override;
 
+  /**
+   * @brief Gets the host-side view (with borrowed spans), so the problem can be serialized or
+   *        converted to the solver input without copying the arrays first
+   */
+  view_t view() const;
+
   /**
    * @brief Convert this CPU optimization problem to an optimization_problem_t
    *        by copying CPU data to GPU (requires GPU memory transfer).
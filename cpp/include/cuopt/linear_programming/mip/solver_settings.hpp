@@ -93,17 +93,23 @@ class mip_solver_settings_t {
   i_t mir_cuts                  = -1;
   i_t mixed_integer_gomory_cuts = -1;
   i_t knapsack_cuts             = -1;
+  i_t flow_cover_cuts           = -1;
   i_t strong_chvatal_gomory_cuts      = -1;
   i_t reduced_cost_strengthening      = -1;
   f_t cut_change_threshold            = 1e-3;
   f_t cut_min_orthogonality           = 0.5;
   i_t mip_batch_pdlp_strong_branching = 0;
   i_t num_gpus                        = 1;
+  f_t node_memory_limit               = std::numeric_limits<f_t>::infinity();  // in MB
+  f_t checkpoint_interval             = 600.0;                                 // in seconds
   bool log_to_console                 = true;
 
   std::string log_file;
   std::string sol_file;
   std::string user_problem_file;
+  std::string tree_trace_file;
+  std::string checkpoint_file;
+  std::string resume_file;
 
   /** Initial primal solutions */
   std::vector<std::shared_ptr<rmm::device_uvector<f_t>>> initial_solutions;
@@ -247,11 +247,13 @@ class pdlp_solver_settings_t {
   std::string user_problem_file{""};
   bool per_constraint_residual{false};
   bool crossover{false};
+  i_t parallel_crossover{0};
   bool cudss_deterministic{false};
   i_t folding{-1};
   i_t augmented{-1};
   i_t dualize{-1};
   i_t ordering{-1};
+  i_t cpu_barrier{-1};
   i_t barrier_dual_initial_point{-1};
   bool eliminate_dense_columns{true};
   pdlp_precision_t pdlp_precision{pdlp_precision_t::DefaultPrecision};
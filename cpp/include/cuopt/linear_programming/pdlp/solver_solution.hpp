@@ -88,6 +88,9 @@ class optimization_problem_solution_t : public base_solution_t {
     /** Solve time in seconds */
     double solve_time{std::numeric_limits<double>::signaling_NaN()};
 
+    /** Time spent in crossover in seconds (included in solve_time, 0 if crossover was not run) */
+    double crossover_time{0.0};
+
     /** Whether the problem was solved by PDLP or Dual Simplex */
     bool solved_by_pdlp{false};
   };
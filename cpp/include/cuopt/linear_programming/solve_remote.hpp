@@ -30,6 +30,10 @@ struct mip_solver_settings_t;
 
 /**
  * @brief Solve LP problem remotely (CPU backend)
+ *
+ * Sends the problem and settings to the server at CUOPT_REMOTE_HOST:CUOPT_REMOTE_PORT (for
+ * example cuopt_remote_server) and waits for the solution. Server log lines are forwarded to the
+ * cuOpt logger. Connection and server errors are reported through the solution's error status.
  */
 template <typename i_t, typename f_t>
 std::unique_ptr<lp_solution_interface_t<i_t, f_t>> solve_lp_remote(
@@ -40,6 +44,9 @@ std::unique_ptr<lp_solution_interface_t<i_t, f_t>> solve_lp_remote(
 
 /**
  * @brief Solve MIP problem remotely (CPU backend)
+ *
+ * Same as solve_lp_remote. Incumbents found by the server are passed to the GET_SOLUTION
+ * callbacks registered in the settings while the solve is running.
  */
 template <typename i_t, typename f_t>
 std::unique_ptr<mip_solution_interface_t<i_t, f_t>> solve_mip_remote(
@@ -17,6 +17,55 @@
 namespace cuopt {
 namespace distance_engine {
 
+template <typename i_t, typename f_t>
+class waypoint_matrix_t;
+
+/**
+ * @brief Streams the waypoint sequence of a route chunk by chunk.
+ *
+ * Gives the same waypoints as waypoint_matrix_t::compute_waypoint_sequence, a bounded number of
+ * legs at a time, so a service can forward waypoints to its clients without materializing the
+ * full path of the route. A leg is the path between two consecutive locations; leg i goes from
+ * locations[i - 1] to locations[i], i in [1, L) (L: n_locations).
+ *
+ * Created by waypoint_matrix_t::stream_waypoint_sequence. The waypoint matrix it was created from
+ * must outlive it and compute_cost_matrix must not be called again while it is in use.
+ */
+template <typename i_t, typename f_t>
+class waypoint_sequence_stream_t {
+ public:
+  struct chunk_t {
+    // Index in locations of the arrival of the first leg of the chunk
+    i_t first_location{0};
+    // Offsets of the legs in waypoints, of size (number of legs in the chunk + 1) and starting at 0
+    std::vector<i_t> offsets{};
+    // Host waypoints (graph vertex ids) of the legs of the chunk, both ends included
+    std::vector<i_t> waypoints{};
+  };
+
+  /**
+   * @brief Fill the next chunk of legs.
+   *
+   * @param[out] chunk Reused between calls to avoid reallocations.
+   * @return false when every leg has already been returned, chunk is then left untouched.
+   */
+  bool next(chunk_t& chunk);
+
+ private:
+  friend class waypoint_matrix_t<i_t, f_t>;
+
+  waypoint_sequence_stream_t(waypoint_matrix_t<i_t, f_t> const& waypoint_matrix,
+                             i_t const* target_locations,
+                             std::vector<i_t>&& locations,
+                             i_t legs_per_chunk);
+
+  waypoint_matrix_t<i_t, f_t> const* waypoint_matrix_;
+  i_t const* target_locations_;
+  std::vector<i_t> locations_;
+  i_t legs_per_chunk_;
+  i_t next_leg_{1};
+};
+
 /**
  * @brief A waypoint matrix.
  *
@@ -87,6 +136,65 @@ class waypoint_matrix_t {
    */
   void compute_cost_matrix(f_t* d_cost_matrix, i_t const* target_locations, i_t n_target_locations);
 
+  /**
+   * @brief Compute the cost matrix and, during the same shortest path searches, one additional
+   * matrix per extra weight set (for example time or tolls).
+   *
+   * The additional matrices are accumulated along the shortest paths found for the cost matrix
+   * while the paths are searched, so k metrics cost one traversal instead of k + 1. The result is
+   * the same as calling compute_cost_matrix followed by compute_shortest_path_costs for each
+   * weight set.
+   *
+   * @note Giving an edge ordering for secondary weights different from the one given
+   * during waypoint matrix instanciation will lead to incorrect results.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   *
+   * @param[out] d_cost_matrix Device memory pointer of size T*T (T: n_target_locations)
+   * where the cost matrix will be written.
+   * @param[in] target_locations Host memory pointer of size T (T: n_target_locations)
+   * representing the target locations indices with respect to the graph.
+   * Target locations indices must be in the range [0, V) (V: number of vertices).
+   * @param n_target_locations Number of target locations.
+   * @param[in] secondary_weights Host array of n_secondary_weights host memory pointers, each of
+   * size E (E: number of edges). cuOpt does not own or copy this data.
+   * @param[out] d_secondary_matrices Host array of n_secondary_weights device memory pointers,
+   * each of size T*T, where the matrix of the matching weight set will be written.
+   * @param n_secondary_weights Number of additional weight sets.
+   */
+  void compute_cost_matrix(f_t* d_cost_matrix,
+                           i_t const* target_locations,
+                           i_t n_target_locations,
+                           f_t const* const* secondary_weights,
+                           f_t* const* d_secondary_matrices,
+                           i_t n_secondary_weights);
+
+  /**
+   * @brief Update the cost matrix of the previous compute_cost_matrix or update_cost_matrix call
+   * for a new set of target locations.
+   *
+   * Entries between target locations that were already present are kept, targets that are no
+   * longer present are dropped, and only the added target locations are searched: one shortest
+   * path search per added target for its row, and one search on the reverse graph for its column
+   * that stops once the other targets are reached. Adding k targets to n costs 2k searches instead
+   * of n + k. The result is the same as with a full compute_cost_matrix call, up to the rounding
+   * of the path sums, and so are the waypoint sequences.
+   *
+   * If compute_cost_matrix was not called before, this is the same as compute_cost_matrix.
+   *
+   * @note Secondary matrices are not updated, use compute_shortest_path_costs for them.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   *
+   * @param[out] d_cost_matrix Device memory pointer of size T*T (T: n_target_locations)
+   * where the cost matrix will be written.
+   * @param[in] target_locations Host memory pointer of size T (T: n_target_locations)
+   * representing the new target locations indices with respect to the graph, in any order.
+   * Target locations indices must be in the range [0, V) (V: number of vertices).
+   * @param n_target_locations Number of target locations.
+   */
+  void update_cost_matrix(f_t* d_cost_matrix, i_t const* target_locations, i_t n_target_locations);
+
   /**
    * @brief Compute the waypoint sequence over the whole route.
    *
@@ -118,6 +226,31 @@ class waypoint_matrix_t {
                             i_t const* locations,
                             i_t n_locations);
 
+  /**
+   * @brief Stream the waypoint sequence over the whole route by chunks of legs.
+   *
+   * Same input and validity checks as compute_waypoint_sequence, see waypoint_sequence_stream_t.
+   *
+   * @note Calling this function before compute_cost_matrix is an error.
+   *
+   * @throws cuopt::logic_error when an error occurs.
+   *
+   * @param[in] target_locations Host memory pointer of size T (T: n_target_locations)
+   * representing the target locations indices with respect to the graph. It must stay valid
+   * while the stream is used.
+   * @param n_target_locations Number of target locations
+   * @param[in] locations Device memory pointer of size L (L: n_locations) containing the location
+   * of orders. It is copied to the host, the stream does not keep it.
+   * @param n_locations Number of locations
+   * @param legs_per_chunk Maximum number of legs returned by each waypoint_sequence_stream_t::next
+   * call.
+   */
+  waypoint_sequence_stream_t<i_t, f_t> stream_waypoint_sequence(i_t const* target_locations,
+                                                                i_t n_target_locations,
+                                                                i_t const* locations,
+                                                                i_t n_locations,
+                                                                i_t legs_per_chunk) const;
+
   /**
    * @brief Compute a custom matrix over the passed weights and target locations applied on shortest
    * paths found during previous compute_cost_matrix call.
@@ -150,33 +283,79 @@ class waypoint_matrix_t {
                                    f_t const* weights);
 
  private:
-  std::vector<f_t> mpsp(i_t const* target_locations, i_t n_target_locations);
+  friend class waypoint_sequence_stream_t<i_t, f_t>;
+
+  std::vector<i_t> get_host_locations(i_t const* target_locations,
+                                      i_t n_target_locations,
+                                      i_t const* locations,
+                                      i_t n_locations) const;
+  void reconstruct_legs(i_t const* target_locations,
+                        i_t const* locations,
+                        i_t first_leg,
+                        i_t n_legs,
+                        std::vector<i_t>& legs_offsets,
+                        std::vector<i_t>& waypoints) const;
+  template <typename pm_t>
+  void reconstruct_legs(pm_t const& predecessor_matrix,
+                        i_t const* target_locations,
+                        i_t const* locations,
+                        i_t first_leg,
+                        i_t n_legs,
+                        std::vector<i_t>& legs_offsets,
+                        std::vector<i_t>& waypoints) const;
+  std::vector<f_t> mpsp(i_t const* target_locations,
+                        i_t n_target_locations,
+                        std::vector<f_t const*> const& secondary_weights,
+                        std::vector<std::vector<f_t>>& secondary_matrices);
   template <typename pm_t>
   void dijkstra(pm_t& predecessor_matrix,
                 std::vector<f_t>& cost_matrix,
                 i_t src,
                 i_t const* target_locations,
                 i_t n_target_locations,
-                i_t id_src);
+                i_t id_src,
+                std::vector<f_t const*> const& secondary_weights,
+                std::vector<std::vector<f_t>>& secondary_matrices);
+  void build_reverse_graph();
+  void reverse_dijkstra(i_t dst, i_t const* sources, i_t n_sources, f_t* out_costs) const;
+  template <typename pm_t>
+  std::vector<f_t> update_mpsp(pm_t& predecessor_matrix,
+                               i_t const* target_locations,
+                               i_t n_target_locations,
+                               std::vector<i_t> const& previous_ids);
   std::vector<f_t> _compute_shortest_path_costs(i_t const* target_locations,
                                                 i_t n_target_locations,
                                                 f_t const* weights);
   template <typename pm_t>
-  void compute_secondary_cost(pm_t& predecessor_matrix,
-                              typename pm_t::value_type::value_type src_matrix_id,
-                              typename pm_t::value_type::value_type dst_graph_id,
-                              f_t const* weights,
-                              f_t& out_cost);
+  void compute_secondary_costs(pm_t& predecessor_matrix,
+                               i_t src_matrix_id,
+                               i_t src_graph_id,
+                               i_t const* target_locations,
+                               i_t n_target_locations,
+                               f_t const* weights,
+                               std::vector<f_t>& tree_costs,
+                               std::vector<i_t>& stack,
+                               f_t* out_costs);
   raft::handle_t const* handle_ptr_{nullptr};
   rmm::cuda_stream_view stream_view_{};
   i_t const* offsets_;
   i_t n_vertices_;
   i_t const* indices_;
   f_t const* weights_;
-  // Optimize allocation time based on number of vertices
+  // Source vertex of each edge, to climb shortest path trees stored as predecessor edges
+  std::vector<i_t> edge_sources_{};
+  // Ids of the edges entering each vertex, built by the first update_cost_matrix call
+  std::vector<i_t> reverse_offsets_{};
+  std::vector<i_t> reverse_edges_{};
+  // Predecessor edge of every vertex for each target location taken as source, -1 (or the
+  // uint16_t maximum) for the source itself and unreached vertices.
+  // Optimize allocation time based on number of edges
   bool is_int16_{false};
   std::vector<std::vector<int32_t>> predecessor_matrix32_{};
   std::vector<std::vector<uint16_t>> predecessor_matrix16_{};
+  // Target locations and host cost matrix of the last computation, kept for update_cost_matrix
+  std::vector<i_t> target_locations_{};
+  std::vector<f_t> cost_matrix_{};
 };
 }  // namespace distance_engine
 }  // namespace cuopt
@@ -6,6 +6,7 @@
 /* clang-format on */
 
 #include <barrier/barrier.hpp>
+#include <barrier/barrier_common.hpp>
 
 #include <barrier/conjugate_gradient.hpp>
 #include <barrier/cusparse_info.hpp>
@@ -1862,47 +1863,11 @@ int barrier_solver_t<i_t, f_t>::initial_point(iteration_data_t<i_t, f_t>& data)
   dense_vector_t<i_t, f_t> dual_res(lp.num_cols);
   float64_t epsilon_adjust = 10.0;
   if (settings.barrier_dual_initial_point == -1 || settings.barrier_dual_initial_point == 0) {
-    // Use the dual starting point suggested by the paper
-    // On Implementing Mehrotra’s Predictor–Corrector Interior-Point Method for Linear Programming
-    // Irvin J. Lustig, Roy E. Marsten, and David F. Shanno
-    // SIAM Journal on Optimization 1992 2:3, 435-449
-    // y = 0
-    data.y.set_scalar(0.0);
-
-    f_t epsilon = 1.0 + vector_norm1<i_t, f_t>(lp.objective);
-
     // A^T y + z - E^T v  - Q x = c
     // when y = 0, z - E^T v = c + Q x
     dense_vector_t<i_t, f_t> c = data.c;
     if (data.Q.n > 0) { matrix_vector_multiply(data.Q, 1.0, data.x, 1.0, c); }
-
-    // First handle the upper bounds case
-    for (i_t k = 0; k < data.n_upper_bounds; k++) {
-      i_t j = data.upper_bounds[k];
-      if (c[j] > epsilon) {
-        data.z[j] = c[j] + epsilon;
-        data.v[k] = epsilon;
-      } else if (c[j] < -epsilon) {
-        data.z[j] = -c[j];
-        data.v[k] = -2.0 * c[j];
-      } else if (0 <= c[j] && c[j] < epsilon) {
-        data.z[j] = c[j] + epsilon;
-        data.v[k] = epsilon;
-      } else if (-epsilon <= c[j] && c[j] <= 0) {
-        data.z[j] = epsilon;
-        data.v[k] = -c[j] + epsilon;
-      }
-    }
-    // Now hande the case with no upper bounds
-    for (i_t j = 0; j < lp.num_cols; j++) {
-      if (lp.upper[j] == inf) {
-        if (c[j] > epsilon_adjust) {
-          data.z[j] = c[j];
-        } else {
-          data.z[j] = epsilon_adjust;
-        }
-      }
-    }
+    barrier_dual_initial_point(lp, c, epsilon_adjust, data);
   } else if (use_augmented) {
     dense_vector_t<i_t, f_t> dual_rhs(lp.num_cols + lp.num_rows);
     dual_rhs.set_scalar(0.0);
@@ -2941,10 +2906,9 @@ void barrier_solver_t<i_t, f_t>::compute_target_mu(
 
   complementarity_aff_sum = complementarity_xz_aff_sum + complementarity_wv_aff_sum;
 
-  mu_aff = (complementarity_aff_sum) /
-           (static_cast<f_t>(data.x.size()) + static_cast<f_t>(data.n_upper_bounds));
-  sigma  = std::max(0.0, std::min(1.0, std::pow(mu_aff / mu, 3.0)));
-  new_mu = sigma * mu_aff;
+  mu_aff =
+    barrier_average_complementarity(complementarity_aff_sum, data.x.size(), data.n_upper_bounds);
+  barrier_centering(mu, mu_aff, sigma, new_mu);
 }
 
 template <typename i_t, typename f_t>
@@ -3144,13 +3108,14 @@ void barrier_solver_t<i_t, f_t>::compute_mu(iteration_data_t<i_t, f_t>& data, f_
 {
   raft::common::nvtx::range fun_scope("Barrier: compute_mu");
 
-  mu = (data.sum_reduce_helper_.sum(data.d_complementarity_xz_residual_.begin(),
-                                    data.d_complementarity_xz_residual_.size(),
-                                    stream_view_) +
-        data.sum_reduce_helper_.sum(data.d_complementarity_wv_residual_.begin(),
-                                    data.d_complementarity_wv_residual_.size(),
-                                    stream_view_)) /
-       (static_cast<f_t>(data.x.size()) + static_cast<f_t>(data.n_upper_bounds));
+  const f_t complementarity_sum =
+    data.sum_reduce_helper_.sum(data.d_complementarity_xz_residual_.begin(),
+                                data.d_complementarity_xz_residual_.size(),
+                                stream_view_) +
+    data.sum_reduce_helper_.sum(data.d_complementarity_wv_residual_.begin(),
+                                data.d_complementarity_wv_residual_.size(),
+                                stream_view_);
+  mu = barrier_average_complementarity(complementarity_sum, data.x.size(), data.n_upper_bounds);
 }
 
 template <typename i_t, typename f_t>
@@ -3317,35 +3282,6 @@ lp_status_t barrier_solver_t<i_t, f_t>::check_for_suboptimal_solution(
   f_t& relative_complementarity_residual,
   lp_solution_t<i_t, f_t>& solution)
 {
-  if (relative_primal_residual < settings.barrier_relaxed_feasibility_tol &&
-      relative_dual_residual < settings.barrier_relaxed_optimality_tol &&
-      relative_complementarity_residual < settings.barrier_relaxed_complementarity_tol &&
-      primal_objective == primal_objective) {
-    data.to_solution(lp,
-                     iter,
-                     primal_objective,
-                     compute_user_objective(lp, primal_objective),
-                     vector_norm2<i_t, f_t>(data.primal_residual),
-                     vector_norm2<i_t, f_t>(data.dual_residual),
-                     data.cusparse_view_,
-                     solution);
-    settings.log.printf("\n");
-    settings.log.printf(
-      "Suboptimal solution found in %d iterations and %.2f seconds\n", iter, toc(start_time));
-    settings.log.printf("Objective %+.8e\n", compute_user_objective(lp, primal_objective));
-    settings.log.printf("Primal infeasibility (abs/rel): %8.2e/%8.2e\n",
-                        primal_residual_norm,
-                        relative_primal_residual);
-    settings.log.printf(
-      "Dual infeasibility   (abs/rel): %8.2e/%8.2e\n", dual_residual_norm, relative_dual_residual);
-    settings.log.printf("Complementarity gap  (abs/rel): %8.2e/%8.2e\n",
-                        complementarity_residual_norm,
-                        relative_complementarity_residual);
-    settings.log.printf("\n");
-    return lp_status_t::OPTIMAL;  // TODO: Barrier should probably have a separate suboptimal
-                                  // status
-  }
-
   f_t primal_objective_save = data.c.inner_product(data.x_save);
   if (data.Q.n > 0) {
     dense_vector_t<i_t, f_t> Qx_save(data.Q.n);
@@ -3356,42 +3292,32 @@ lp_status_t barrier_solver_t<i_t, f_t>::check_for_suboptimal_solution(
     primal_objective_save += quad_objective;
   }
 
-  if (data.relative_primal_residual_save < settings.barrier_relaxed_feasibility_tol &&
-      data.relative_dual_residual_save < settings.barrier_relaxed_optimality_tol &&
-      data.relative_complementarity_residual_save < settings.barrier_relaxed_complementarity_tol) {
-    settings.log.printf("Restoring previous solution\n");
-    data.to_solution(lp,
-                     iter,
-                     primal_objective_save,
-                     compute_user_objective(lp, primal_objective_save),
-                     data.primal_residual_norm_save,
-                     data.dual_residual_norm_save,
-                     data.cusparse_view_,
-                     solution);
-    settings.log.printf("\n");
-    settings.log.printf(
-      "Suboptimal solution found in %d iterations and %.2f seconds\n", iter, toc(start_time));
-    settings.log.printf("Objective %+.8e\n", compute_user_objective(lp, primal_objective_save));
-    settings.log.printf("Primal infeasibility (abs/rel): %8.2e/%8.2e\n",
-                        data.primal_residual_norm_save,
-                        data.relative_primal_residual_save);
-    settings.log.printf("Dual infeasibility   (abs/rel): %8.2e/%8.2e\n",
-                        data.dual_residual_norm_save,
-                        data.relative_dual_residual_save);
-    settings.log.printf("Complementarity gap  (abs/rel): %8.2e/%8.2e\n",
-                        data.complementarity_residual_norm_save,
-                        data.relative_complementarity_residual_save);
-    settings.log.printf("\n");
-    return lp_status_t::OPTIMAL;  // TODO: Barrier should probably have a separate suboptimal
-                                  // status
-  } else {
-    settings.log.printf("Primal residual %.2e dual residual %.2e complementarity residual %.2e\n",
-                        relative_primal_residual,
-                        relative_dual_residual,
-                        relative_complementarity_residual);
-  }
-  settings.log.printf("Search direction computation failed\n");
-  return lp_status_t::NUMERICAL_ISSUES;
+  return barrier_suboptimal_solution(
+    settings,
+    lp,
+    data,
+    start_time,
+    iter,
+    primal_objective,
+    primal_objective_save,
+    primal_residual_norm,
+    dual_residual_norm,
+    complementarity_residual_norm,
+    relative_primal_residual,
+    relative_dual_residual,
+    relative_complementarity_residual,
+    [&](bool saved, f_t objective) {
+      data.to_solution(lp,
+                       iter,
+                       objective,
+                       compute_user_objective(lp, objective),
+                       saved ? data.primal_residual_norm_save
+                             : vector_norm2<i_t, f_t>(data.primal_residual),
+                       saved ? data.dual_residual_norm_save
+                             : vector_norm2<i_t, f_t>(data.dual_residual),
+                       data.cusparse_view_,
+                       solution);
+    });
 }
 
 template <typename i_t, typename f_t>
@@ -3489,10 +3415,18 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
     }
     f_t primal_objective = data.c.inner_product(data.x) + quad_objective;
 
-    f_t relative_primal_residual = primal_residual_norm / (1.0 + norm_b);
-    f_t relative_dual_residual   = dual_residual_norm / (1.0 + norm_c);
-    f_t relative_complementarity_residual =
-      complementarity_residual_norm / (1.0 + std::abs(primal_objective));
+    f_t relative_primal_residual;
+    f_t relative_dual_residual;
+    f_t relative_complementarity_residual;
+    barrier_relative_residuals(primal_residual_norm,
+                               dual_residual_norm,
+                               complementarity_residual_norm,
+                               norm_b,
+                               norm_c,
+                               primal_objective,
+                               relative_primal_residual,
+                               relative_dual_residual,
+                               relative_complementarity_residual);
 
     dense_vector_t<i_t, f_t> upper(lp.upper);
     data.gather_upper_bounds(upper, data.restrict_u_);
@@ -3651,40 +3585,25 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
 
       compute_primal_dual_objective(data, primal_objective, dual_objective);
 
-      relative_primal_residual = primal_residual_norm / (1.0 + norm_b);
-      relative_dual_residual   = dual_residual_norm / (1.0 + norm_c);
-      relative_complementarity_residual =
-        complementarity_residual_norm / (1.0 + std::abs(primal_objective));
-
-      if (relative_primal_residual < settings.barrier_relaxed_feasibility_tol &&
-          relative_dual_residual < settings.barrier_relaxed_optimality_tol &&
-          relative_complementarity_residual < settings.barrier_relaxed_complementarity_tol) {
-        if (relative_primal_residual < data.relative_primal_residual_save &&
-            relative_dual_residual < data.relative_dual_residual_save &&
-            relative_complementarity_residual < data.relative_complementarity_residual_save &&
-            primal_objective == primal_objective && dual_objective == dual_objective) {
-          settings.log.debug(
-            "Saving solution: feasibility %.2e (%.2e), optimality %.2e (%.2e), complementarity "
-            "%.2e (%.2e)\n",
-            relative_primal_residual,
-            primal_residual_norm,
-            relative_dual_residual,
-            dual_residual_norm,
-            relative_complementarity_residual,
-            complementarity_residual_norm);
-          data.w_save                                 = data.w;
-          data.x_save                                 = data.x;
-          data.y_save                                 = data.y;
-          data.v_save                                 = data.v;
-          data.z_save                                 = data.z;
-          data.relative_primal_residual_save          = relative_primal_residual;
-          data.relative_dual_residual_save            = relative_dual_residual;
-          data.relative_complementarity_residual_save = relative_complementarity_residual;
-          data.primal_residual_norm_save              = primal_residual_norm;
-          data.dual_residual_norm_save                = dual_residual_norm;
-          data.complementarity_residual_norm_save     = complementarity_residual_norm;
-        }
-      }
+      barrier_relative_residuals(primal_residual_norm,
+                                 dual_residual_norm,
+                                 complementarity_residual_norm,
+                                 norm_b,
+                                 norm_c,
+                                 primal_objective,
+                                 relative_primal_residual,
+                                 relative_dual_residual,
+                                 relative_complementarity_residual);
+      barrier_save_iterate(settings,
+                           primal_objective,
+                           dual_objective,
+                           primal_residual_norm,
+                           dual_residual_norm,
+                           complementarity_residual_norm,
+                           relative_primal_residual,
+                           relative_dual_residual,
+                           relative_complementarity_residual,
+                           data);
 
       iter++;
       elapsed_time = toc(start_time);
@@ -3705,14 +3624,15 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
                                              solution);
       }
 
-      settings.log.printf("%3d   %+.12e %+.12e %.2e %.2e %.2e %.1f\n",
-                          iter,
-                          compute_user_objective(lp, primal_objective),
-                          compute_user_objective(lp, dual_objective),
-                          relative_primal_residual,
-                          relative_dual_residual,
-                          relative_complementarity_residual,
-                          elapsed_time);
+      barrier_log_iteration(settings,
+                            lp,
+                            iter,
+                            primal_objective,
+                            dual_objective,
+                            relative_primal_residual,
+                            relative_dual_residual,
+                            relative_complementarity_residual,
+                            elapsed_time);
 
       bool primal_feasible = relative_primal_residual < settings.barrier_relative_feasibility_tol;
       bool dual_feasible   = relative_dual_residual < settings.barrier_relative_optimality_tol;
@@ -3725,16 +3645,15 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
         settings.log.printf("\n");
         settings.log.printf(
           "Optimal solution found in %d iterations and %.2fs\n", iter, toc(start_time));
-        settings.log.printf("Objective %+.8e\n", compute_user_objective(lp, primal_objective));
-        settings.log.printf("Primal infeasibility (abs/rel): %8.2e/%8.2e\n",
-                            primal_residual_norm,
-                            relative_primal_residual);
-        settings.log.printf("Dual infeasibility   (abs/rel): %8.2e/%8.2e\n",
-                            dual_residual_norm,
-                            relative_dual_residual);
-        settings.log.printf("Complementarity gap  (abs/rel): %8.2e/%8.2e\n",
-                            complementarity_residual_norm,
-                            relative_complementarity_residual);
+        barrier_log_solution(settings,
+                             lp,
+                             primal_objective,
+                             primal_residual_norm,
+                             dual_residual_norm,
+                             complementarity_residual_norm,
+                             relative_primal_residual,
+                             relative_dual_residual,
+                             relative_complementarity_residual);
         settings.log.printf("\n");
         data.to_solution(lp,
                          iter,
@@ -3754,10 +3673,10 @@ lp_status_t barrier_solver_t<i_t, f_t>::solve(f_t start_time,
            (!dual_feasible && relative_dual_residual > 100 * data.relative_dual_residual_save) ||
            (!small_gap && relative_complementarity_residual >
                             10000 * data.relative_complementarity_residual_save))) {
-        if (data.relative_primal_residual_save < settings.barrier_relaxed_feasibility_tol &&
-            data.relative_dual_residual_save < settings.barrier_relaxed_optimality_tol &&
-            data.relative_complementarity_residual_save <
-              settings.barrier_relaxed_complementarity_tol) {
+        if (barrier_within_relaxed_tolerances(settings,
+                                              data.relative_primal_residual_save,
+                                              data.relative_dual_residual_save,
+                                              data.relative_complementarity_residual_save)) {
           return check_for_suboptimal_solution(options,
                                                data,
                                                start_time,
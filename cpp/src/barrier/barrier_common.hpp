@@ -0,0 +1,262 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solution.hpp>
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/vector_math.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Steps of the Mehrotra predictor-corrector method shared by the GPU barrier (barrier_solver_t)
+// and the CPU barrier (cpu_barrier_solver_t). The vector kernels stay in each backend, these
+// helpers hold the scalar math, the iterate bookkeeping and the reporting. `data_t` is the
+// iteration data of a backend, which names its members the same way in both.
+
+// Dual starting point of Lustig, Marsten and Shanno with y = 0:
+// On Implementing Mehrotra's Predictor-Corrector Interior-Point Method for Linear Programming
+// SIAM Journal on Optimization 1992 2:3, 435-449
+// With y = 0 the dual constraints are z - E*v = c, where c includes Q*x for a QP
+template <typename i_t, typename f_t, typename data_t, typename vector_t>
+void barrier_dual_initial_point(const lp_problem_t<i_t, f_t>& lp,
+                                const vector_t& c,
+                                f_t epsilon_adjust,
+                                data_t& data)
+{
+  data.y.set_scalar(0.0);
+  const f_t epsilon = 1.0 + vector_norm1<i_t, f_t>(lp.objective);
+
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    const i_t j = data.upper_bounds[k];
+    if (c[j] > epsilon) {
+      data.z[j] = c[j] + epsilon;
+      data.v[k] = epsilon;
+    } else if (c[j] < -epsilon) {
+      data.z[j] = -c[j];
+      data.v[k] = -2.0 * c[j];
+    } else if (0 <= c[j] && c[j] < epsilon) {
+      data.z[j] = c[j] + epsilon;
+      data.v[k] = epsilon;
+    } else if (-epsilon <= c[j] && c[j] <= 0) {
+      data.z[j] = epsilon;
+      data.v[k] = -c[j] + epsilon;
+    }
+  }
+  for (i_t j = 0; j < lp.num_cols; j++) {
+    if (lp.upper[j] == inf) { data.z[j] = c[j] > epsilon_adjust ? c[j] : epsilon_adjust; }
+  }
+}
+
+// Average complementarity of the num_cols pairs x_j z_j and the n_upper_bounds pairs w_k v_k
+template <typename i_t, typename f_t>
+f_t barrier_average_complementarity(f_t complementarity_sum, size_t num_cols, i_t n_upper_bounds)
+{
+  return complementarity_sum / (static_cast<f_t>(num_cols) + static_cast<f_t>(n_upper_bounds));
+}
+
+// Mehrotra's heuristic: sigma = (mu_aff / mu)^3 and the corrector targets sigma * mu_aff
+template <typename f_t>
+void barrier_centering(f_t mu, f_t mu_aff, f_t& sigma, f_t& new_mu)
+{
+  sigma  = std::max(0.0, std::min(1.0, std::pow(mu_aff / mu, 3.0)));
+  new_mu = sigma * mu_aff;
+}
+
+template <typename f_t>
+void barrier_relative_residuals(f_t primal_residual_norm,
+                                f_t dual_residual_norm,
+                                f_t complementarity_residual_norm,
+                                f_t norm_b,
+                                f_t norm_c,
+                                f_t primal_objective,
+                                f_t& relative_primal_residual,
+                                f_t& relative_dual_residual,
+                                f_t& relative_complementarity_residual)
+{
+  relative_primal_residual = primal_residual_norm / (1.0 + norm_b);
+  relative_dual_residual   = dual_residual_norm / (1.0 + norm_c);
+  relative_complementarity_residual =
+    complementarity_residual_norm / (1.0 + std::abs(primal_objective));
+}
+
+template <typename i_t, typename f_t>
+bool barrier_within_relaxed_tolerances(const simplex_solver_settings_t<i_t, f_t>& settings,
+                                       f_t relative_primal_residual,
+                                       f_t relative_dual_residual,
+                                       f_t relative_complementarity_residual)
+{
+  return relative_primal_residual < settings.barrier_relaxed_feasibility_tol &&
+         relative_dual_residual < settings.barrier_relaxed_optimality_tol &&
+         relative_complementarity_residual < settings.barrier_relaxed_complementarity_tol;
+}
+
+// Keeps the iterate as the fallback solution if it is within the relaxed tolerances and better
+// than the one kept so far
+template <typename i_t, typename f_t, typename data_t>
+void barrier_save_iterate(const simplex_solver_settings_t<i_t, f_t>& settings,
+                          f_t primal_objective,
+                          f_t dual_objective,
+                          f_t primal_residual_norm,
+                          f_t dual_residual_norm,
+                          f_t complementarity_residual_norm,
+                          f_t relative_primal_residual,
+                          f_t relative_dual_residual,
+                          f_t relative_complementarity_residual,
+                          data_t& data)
+{
+  if (!barrier_within_relaxed_tolerances(
+        settings, relative_primal_residual, relative_dual_residual, relative_complementarity_residual)) {
+    return;
+  }
+  if (!(relative_primal_residual < data.relative_primal_residual_save &&
+        relative_dual_residual < data.relative_dual_residual_save &&
+        relative_complementarity_residual < data.relative_complementarity_residual_save &&
+        primal_objective == primal_objective && dual_objective == dual_objective)) {
+    return;
+  }
+  settings.log.debug(
+    "Saving solution: feasibility %.2e (%.2e), optimality %.2e (%.2e), complementarity "
+    "%.2e (%.2e)\n",
+    relative_primal_residual,
+    primal_residual_norm,
+    relative_dual_residual,
+    dual_residual_norm,
+    relative_complementarity_residual,
+    complementarity_residual_norm);
+  data.w_save                                 = data.w;
+  data.x_save                                 = data.x;
+  data.y_save                                 = data.y;
+  data.v_save                                 = data.v;
+  data.z_save                                 = data.z;
+  data.relative_primal_residual_save          = relative_primal_residual;
+  data.relative_dual_residual_save            = relative_dual_residual;
+  data.relative_complementarity_residual_save = relative_complementarity_residual;
+  data.primal_residual_norm_save              = primal_residual_norm;
+  data.dual_residual_norm_save                = dual_residual_norm;
+  data.complementarity_residual_norm_save     = complementarity_residual_norm;
+}
+
+template <typename i_t, typename f_t>
+void barrier_log_iteration(const simplex_solver_settings_t<i_t, f_t>& settings,
+                           const lp_problem_t<i_t, f_t>& lp,
+                           i_t iter,
+                           f_t primal_objective,
+                           f_t dual_objective,
+                           f_t relative_primal_residual,
+                           f_t relative_dual_residual,
+                           f_t relative_complementarity_residual,
+                           f_t elapsed_time)
+{
+  settings.log.printf("%3d   %+.12e %+.12e %.2e %.2e %.2e %.1f\n",
+                      iter,
+                      compute_user_objective(lp, primal_objective),
+                      compute_user_objective(lp, dual_objective),
+                      relative_primal_residual,
+                      relative_dual_residual,
+                      relative_complementarity_residual,
+                      elapsed_time);
+}
+
+// The objective and the residuals of a returned solution
+template <typename i_t, typename f_t>
+void barrier_log_solution(const simplex_solver_settings_t<i_t, f_t>& settings,
+                          const lp_problem_t<i_t, f_t>& lp,
+                          f_t primal_objective,
+                          f_t primal_residual_norm,
+                          f_t dual_residual_norm,
+                          f_t complementarity_residual_norm,
+                          f_t relative_primal_residual,
+                          f_t relative_dual_residual,
+                          f_t relative_complementarity_residual)
+{
+  settings.log.printf("Objective %+.8e\n", compute_user_objective(lp, primal_objective));
+  settings.log.printf(
+    "Primal infeasibility (abs/rel): %8.2e/%8.2e\n", primal_residual_norm, relative_primal_residual);
+  settings.log.printf(
+    "Dual infeasibility   (abs/rel): %8.2e/%8.2e\n", dual_residual_norm, relative_dual_residual);
+  settings.log.printf("Complementarity gap  (abs/rel): %8.2e/%8.2e\n",
+                      complementarity_residual_norm,
+                      relative_complementarity_residual);
+}
+
+// After a failed search direction, returns the current iterate if it is within the relaxed
+// tolerances, otherwise the saved one if there is one. `to_solution(saved, objective)` writes the
+// current or the saved iterate into the solution.
+template <typename i_t, typename f_t, typename data_t, typename to_solution_t>
+lp_status_t barrier_suboptimal_solution(const simplex_solver_settings_t<i_t, f_t>& settings,
+                                        const lp_problem_t<i_t, f_t>& lp,
+                                        const data_t& data,
+                                        f_t start_time,
+                                        i_t iter,
+                                        f_t primal_objective,
+                                        f_t primal_objective_save,
+                                        f_t primal_residual_norm,
+                                        f_t dual_residual_norm,
+                                        f_t complementarity_residual_norm,
+                                        f_t relative_primal_residual,
+                                        f_t relative_dual_residual,
+                                        f_t relative_complementarity_residual,
+                                        to_solution_t&& to_solution)
+{
+  if (barrier_within_relaxed_tolerances(
+        settings, relative_primal_residual, relative_dual_residual, relative_complementarity_residual) &&
+      primal_objective == primal_objective) {
+    to_solution(false, primal_objective);
+    settings.log.printf("\n");
+    settings.log.printf(
+      "Suboptimal solution found in %d iterations and %.2f seconds\n", iter, toc(start_time));
+    barrier_log_solution(settings,
+                         lp,
+                         primal_objective,
+                         primal_residual_norm,
+                         dual_residual_norm,
+                         complementarity_residual_norm,
+                         relative_primal_residual,
+                         relative_dual_residual,
+                         relative_complementarity_residual);
+    settings.log.printf("\n");
+    return lp_status_t::OPTIMAL;  // TODO: Barrier should probably have a separate suboptimal
+                                  // status
+  }
+
+  if (barrier_within_relaxed_tolerances(settings,
+                                        data.relative_primal_residual_save,
+                                        data.relative_dual_residual_save,
+                                        data.relative_complementarity_residual_save)) {
+    settings.log.printf("Restoring previous solution\n");
+    to_solution(true, primal_objective_save);
+    settings.log.printf("\n");
+    settings.log.printf(
+      "Suboptimal solution found in %d iterations and %.2f seconds\n", iter, toc(start_time));
+    barrier_log_solution(settings,
+                         lp,
+                         primal_objective_save,
+                         data.primal_residual_norm_save,
+                         data.dual_residual_norm_save,
+                         data.complementarity_residual_norm_save,
+                         data.relative_primal_residual_save,
+                         data.relative_dual_residual_save,
+                         data.relative_complementarity_residual_save);
+    settings.log.printf("\n");
+    return lp_status_t::OPTIMAL;
+  }
+  settings.log.printf("Primal residual %.2e dual residual %.2e complementarity residual %.2e\n",
+                      relative_primal_residual,
+                      relative_dual_residual,
+                      relative_complementarity_residual);
+  settings.log.printf("Search direction computation failed\n");
+  return lp_status_t::NUMERICAL_ISSUES;
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,937 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <barrier/cpu_barrier.hpp>
+
+#include <barrier/barrier_common.hpp>
+#include <barrier/dense_vector.hpp>
+#include <barrier/sparse_cholesky_cpu.hpp>
+
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/vector_math.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+class cpu_iteration_data_t {
+ public:
+  cpu_iteration_data_t(const lp_problem_t<i_t, f_t>& lp,
+                       const simplex_solver_settings_t<i_t, f_t>& settings)
+    : A(lp.A),
+      AT(lp.num_cols, lp.num_rows, 0),
+      ADAT(lp.num_rows, lp.num_rows, 0),
+      chol(settings, lp.num_rows),
+      num_threads(std::max(1, static_cast<int>(settings.num_threads))),
+      n_upper_bounds(0),
+      upper_bounds(),
+      c(lp.objective),
+      b(lp.rhs),
+      restrict_u(0),
+      diag(lp.num_cols),
+      inv_diag(lp.num_cols),
+      w(0),
+      x(lp.num_cols),
+      y(lp.num_rows),
+      v(0),
+      z(lp.num_cols),
+      w_save(0),
+      x_save(lp.num_cols),
+      y_save(lp.num_rows),
+      v_save(0),
+      z_save(lp.num_cols),
+      dw_aff(0),
+      dx_aff(lp.num_cols),
+      dy_aff(lp.num_rows),
+      dv_aff(0),
+      dz_aff(lp.num_cols),
+      dw(0),
+      dx(lp.num_cols),
+      dy(lp.num_rows),
+      dv(0),
+      dz(lp.num_cols),
+      primal_residual(lp.num_rows),
+      bound_residual(0),
+      dual_residual(lp.num_cols),
+      complementarity_xz_residual(lp.num_cols),
+      complementarity_wv_residual(0),
+      primal_rhs(lp.num_rows),
+      bound_rhs(0),
+      dual_rhs(lp.num_cols),
+      complementarity_xz_rhs(lp.num_cols),
+      complementarity_wv_rhs(0),
+      r1(lp.num_cols),
+      h(lp.num_rows),
+      has_factorization(false),
+      num_factorizations(0),
+      relative_primal_residual_save(inf),
+      relative_dual_residual_save(inf),
+      relative_complementarity_residual_save(inf),
+      primal_residual_norm_save(inf),
+      dual_residual_norm_save(inf),
+      complementarity_residual_norm_save(inf)
+  {
+    for (i_t j = 0; j < lp.num_cols; j++) {
+      if (lp.upper[j] < inf) { upper_bounds.push_back(j); }
+    }
+    n_upper_bounds = static_cast<i_t>(upper_bounds.size());
+    for (auto* vec : {&restrict_u,
+                      &w,
+                      &v,
+                      &w_save,
+                      &v_save,
+                      &dw_aff,
+                      &dv_aff,
+                      &dw,
+                      &dv,
+                      &bound_residual,
+                      &complementarity_wv_residual,
+                      &bound_rhs,
+                      &complementarity_wv_rhs}) {
+      vec->resize(n_upper_bounds, 0.0);
+    }
+    gather_upper_bounds(lp.upper, restrict_u);
+
+    A.transpose(AT);
+    adat_symbolic();
+    workspace.assign(num_threads, std::vector<f_t>(lp.num_rows, 0.0));
+  }
+
+  void gather_upper_bounds(const std::vector<f_t>& in, std::vector<f_t>& out) const
+  {
+    for (i_t k = 0; k < n_upper_bounds; k++) {
+      out[k] = in[upper_bounds[k]];
+    }
+  }
+
+  // Sparsity pattern of the lower triangle of A*A'. Column j holds the rows i >= j that share
+  // a column of A with row j
+  void adat_symbolic()
+  {
+    const i_t m = A.m;
+    std::vector<i_t> mark(m, -1);
+    std::vector<i_t> rows;
+    ADAT.col_start.assign(m + 1, 0);
+    ADAT.i.clear();
+    for (i_t j = 0; j < m; j++) {
+      rows.clear();
+      mark[j] = j;
+      rows.push_back(j);
+      for (i_t p = AT.col_start[j]; p < AT.col_start[j + 1]; p++) {
+        const i_t k = AT.i[p];
+        for (i_t q = A.col_start[k]; q < A.col_start[k + 1]; q++) {
+          const i_t i = A.i[q];
+          if (i > j && mark[i] != j) {
+            mark[i] = j;
+            rows.push_back(i);
+          }
+        }
+      }
+      std::sort(rows.begin(), rows.end());
+      ADAT.i.insert(ADAT.i.end(), rows.begin(), rows.end());
+      ADAT.col_start[j + 1] = static_cast<i_t>(ADAT.i.size());
+    }
+    ADAT.nz_max = ADAT.col_start[m];
+    ADAT.x.assign(ADAT.nz_max, 0.0);
+  }
+
+  // ADAT <- lower triangle of A * inv_diag * A'
+  void form_adat()
+  {
+    const i_t m = A.m;
+#pragma omp parallel num_threads(num_threads)
+    {
+      std::vector<f_t>& work = workspace[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+      for (i_t j = 0; j < m; j++) {
+        for (i_t p = AT.col_start[j]; p < AT.col_start[j + 1]; p++) {
+          const i_t k   = AT.i[p];
+          const f_t ajk = AT.x[p] * inv_diag[k];
+          for (i_t q = A.col_start[k]; q < A.col_start[k + 1]; q++) {
+            const i_t i = A.i[q];
+            if (i >= j) { work[i] += A.x[q] * ajk; }
+          }
+        }
+        for (i_t p = ADAT.col_start[j]; p < ADAT.col_start[j + 1]; p++) {
+          ADAT.x[p]       = work[ADAT.i[p]];
+          work[ADAT.i[p]] = 0.0;
+        }
+      }
+    }
+  }
+
+  // out <- alpha * A * inv_diag * A' * in + beta * out
+  void adat_multiply(f_t alpha,
+                     const dense_vector_t<i_t, f_t>& in,
+                     f_t beta,
+                     dense_vector_t<i_t, f_t>& out) const
+  {
+    dense_vector_t<i_t, f_t> u(A.n);
+    matrix_transpose_vector_multiply(A, 1.0, in, 0.0, u);
+    inv_diag.pairwise_product(u, u);
+    matrix_vector_multiply(A, alpha, u, beta, out);
+  }
+
+  // Solve A * inv_diag * A' * sol = rhs with a few steps of iterative refinement
+  i_t solve_adat(const dense_vector_t<i_t, f_t>& rhs, dense_vector_t<i_t, f_t>& sol) const
+  {
+    const i_t m = A.m;
+    chol.solve(rhs, sol);
+    const f_t tolerance = 1e-12 * (1.0 + vector_norm_inf<i_t, f_t>(rhs));
+    dense_vector_t<i_t, f_t> residual(rhs);
+    adat_multiply(-1.0, sol, 1.0, residual);
+    f_t residual_norm = vector_norm_inf<i_t, f_t>(residual);
+    dense_vector_t<i_t, f_t> correction(m);
+    dense_vector_t<i_t, f_t> candidate(m);
+    for (i_t iter = 0; iter < 3 && residual_norm > tolerance; iter++) {
+      chol.solve(residual, correction);
+      candidate = sol;
+      candidate.axpy(1.0, correction, 1.0);
+      dense_vector_t<i_t, f_t> candidate_residual(rhs);
+      adat_multiply(-1.0, candidate, 1.0, candidate_residual);
+      const f_t candidate_norm = vector_norm_inf<i_t, f_t>(candidate_residual);
+      if (!(candidate_norm < residual_norm)) { break; }
+      sol           = candidate;
+      residual      = candidate_residual;
+      residual_norm = candidate_norm;
+    }
+    if (residual_norm != residual_norm) { return -1; }
+    return 0;
+  }
+
+  void to_solution(const lp_problem_t<i_t, f_t>& lp,
+                   i_t iterations,
+                   f_t objective,
+                   f_t primal_residual_norm,
+                   const dense_vector_t<i_t, f_t>& x_out,
+                   const dense_vector_t<i_t, f_t>& y_out,
+                   const dense_vector_t<i_t, f_t>& v_out,
+                   const dense_vector_t<i_t, f_t>& z_out,
+                   lp_solution_t<i_t, f_t>& solution) const
+  {
+    solution.x = x_out;
+    solution.y = y_out;
+    // z_tilde = z - E * v
+    solution.z = z_out;
+    for (i_t k = 0; k < n_upper_bounds; k++) {
+      solution.z[upper_bounds[k]] -= v_out[k];
+    }
+    std::vector<f_t> dual_res = solution.z;
+    for (i_t j = 0; j < lp.num_cols; j++) {
+      dual_res[j] -= lp.objective[j];
+    }
+    matrix_transpose_vector_multiply(lp.A, 1.0, solution.y, 1.0, dual_res);
+
+    solution.iterations         = iterations;
+    solution.objective          = objective;
+    solution.user_objective     = compute_user_objective(lp, objective);
+    solution.l2_primal_residual = primal_residual_norm;
+    solution.l2_dual_residual   = vector_norm_inf<i_t, f_t>(dual_res);
+  }
+
+  const csc_matrix_t<i_t, f_t>& A;
+  csc_matrix_t<i_t, f_t> AT;
+  csc_matrix_t<i_t, f_t> ADAT;
+  sparse_cholesky_cpu_t<i_t, f_t> chol;
+  i_t num_threads;
+  std::vector<std::vector<f_t>> workspace;
+
+  i_t n_upper_bounds;
+  std::vector<i_t> upper_bounds;
+  dense_vector_t<i_t, f_t> c;
+  dense_vector_t<i_t, f_t> b;
+  dense_vector_t<i_t, f_t> restrict_u;
+
+  dense_vector_t<i_t, f_t> diag;
+  dense_vector_t<i_t, f_t> inv_diag;
+
+  dense_vector_t<i_t, f_t> w;
+  dense_vector_t<i_t, f_t> x;
+  dense_vector_t<i_t, f_t> y;
+  dense_vector_t<i_t, f_t> v;
+  dense_vector_t<i_t, f_t> z;
+
+  dense_vector_t<i_t, f_t> w_save;
+  dense_vector_t<i_t, f_t> x_save;
+  dense_vector_t<i_t, f_t> y_save;
+  dense_vector_t<i_t, f_t> v_save;
+  dense_vector_t<i_t, f_t> z_save;
+
+  dense_vector_t<i_t, f_t> dw_aff;
+  dense_vector_t<i_t, f_t> dx_aff;
+  dense_vector_t<i_t, f_t> dy_aff;
+  dense_vector_t<i_t, f_t> dv_aff;
+  dense_vector_t<i_t, f_t> dz_aff;
+
+  dense_vector_t<i_t, f_t> dw;
+  dense_vector_t<i_t, f_t> dx;
+  dense_vector_t<i_t, f_t> dy;
+  dense_vector_t<i_t, f_t> dv;
+  dense_vector_t<i_t, f_t> dz;
+
+  dense_vector_t<i_t, f_t> primal_residual;
+  dense_vector_t<i_t, f_t> bound_residual;
+  dense_vector_t<i_t, f_t> dual_residual;
+  dense_vector_t<i_t, f_t> complementarity_xz_residual;
+  dense_vector_t<i_t, f_t> complementarity_wv_residual;
+
+  dense_vector_t<i_t, f_t> primal_rhs;
+  dense_vector_t<i_t, f_t> bound_rhs;
+  dense_vector_t<i_t, f_t> dual_rhs;
+  dense_vector_t<i_t, f_t> complementarity_xz_rhs;
+  dense_vector_t<i_t, f_t> complementarity_wv_rhs;
+
+  dense_vector_t<i_t, f_t> r1;
+  dense_vector_t<i_t, f_t> h;
+
+  bool has_factorization;
+  i_t num_factorizations;
+
+  f_t relative_primal_residual_save;
+  f_t relative_dual_residual_save;
+  f_t relative_complementarity_residual_save;
+  f_t primal_residual_norm_save;
+  f_t dual_residual_norm_save;
+  f_t complementarity_residual_norm_save;
+};
+
+namespace {
+
+template <typename i_t, typename f_t>
+f_t max_step_to_boundary(const dense_vector_t<i_t, f_t>& x, const dense_vector_t<i_t, f_t>& dx)
+{
+  f_t step    = 1.0;
+  const i_t n = static_cast<i_t>(x.size());
+  for (i_t j = 0; j < n; j++) {
+    if (dx[j] < 0.0) { step = std::min(step, -x[j] / dx[j]); }
+  }
+  return step;
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+cpu_barrier_solver_t<i_t, f_t>::cpu_barrier_solver_t(
+  const lp_problem_t<i_t, f_t>& lp,
+  const presolve_info_t<i_t, f_t>& presolve,
+  const simplex_solver_settings_t<i_t, f_t>& settings)
+  : lp(lp), settings(settings), presolve_info(presolve)
+{
+}
+
+template <typename i_t, typename f_t>
+i_t cpu_barrier_solver_t<i_t, f_t>::initial_point(cpu_iteration_data_t<i_t, f_t>& data)
+{
+  const i_t m = lp.num_rows;
+  const i_t n = lp.num_cols;
+
+  // D = I + E*E'
+  data.diag.set_scalar(1.0);
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    data.diag[data.upper_bounds[k]] = 2.0;
+  }
+  data.diag.inverse(data.inv_diag);
+
+  data.form_adat();
+  i_t status = data.chol.factorize(data.ADAT);
+  if (status == CONCURRENT_HALT_RETURN) { return CONCURRENT_HALT_RETURN; }
+  if (status != 0) {
+    settings.log.printf("Initial factorization failed\n");
+    return -1;
+  }
+  data.num_factorizations++;
+
+  // x = Dinv * (F*u - A'*q), where A*Dinv*A'*q = A*Dinv*F*u - b
+  dense_vector_t<i_t, f_t> Fu(n);
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    const i_t j = data.upper_bounds[k];
+    Fu[j]       = lp.upper[j];
+  }
+  dense_vector_t<i_t, f_t> DinvFu(n);
+  data.inv_diag.pairwise_product(Fu, DinvFu);
+  dense_vector_t<i_t, f_t> rhs_x(lp.rhs);
+  matrix_vector_multiply(lp.A, 1.0, DinvFu, -1.0, rhs_x);
+  dense_vector_t<i_t, f_t> q(m);
+  status = data.solve_adat(rhs_x, q);
+  if (status != 0) { return status; }
+  matrix_transpose_vector_multiply(lp.A, -1.0, q, 1.0, Fu);
+  data.inv_diag.pairwise_product(Fu, data.x);
+
+  // w = E'*u - E'*x
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    const i_t j = data.upper_bounds[k];
+    data.w[k]   = lp.upper[j] - data.x[j];
+  }
+
+  const f_t epsilon_adjust = 10.0;
+  if (settings.barrier_dual_initial_point == -1 || settings.barrier_dual_initial_point == 0) {
+    barrier_dual_initial_point(lp, data.c, epsilon_adjust, data);
+  } else {
+    // Dual least squares: A*Dinv*A'*y = A*Dinv*c, z = Dinv*(c - A'*y), v = -E'*z
+    dense_vector_t<i_t, f_t> Dinvc(n);
+    data.inv_diag.pairwise_product(data.c, Dinvc);
+    dense_vector_t<i_t, f_t> rhs(m);
+    matrix_vector_multiply(lp.A, 1.0, Dinvc, 0.0, rhs);
+    status = data.solve_adat(rhs, data.y);
+    if (status != 0) { return status; }
+    dense_vector_t<i_t, f_t> cmATy = data.c;
+    matrix_transpose_vector_multiply(lp.A, -1.0, data.y, 1.0, cmATy);
+    data.inv_diag.pairwise_product(cmATy, data.z);
+    data.gather_upper_bounds(data.z, data.v);
+    data.v.multiply_scalar(-1.0);
+    data.v.ensure_positive(epsilon_adjust);
+    data.z.ensure_positive(epsilon_adjust);
+  }
+
+  // Make sure (w, x, v, z) > 0
+  data.w.ensure_positive(epsilon_adjust);
+  data.x.ensure_positive(epsilon_adjust);
+  return 0;
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_residuals(cpu_iteration_data_t<i_t, f_t>& data)
+{
+  // primal_residual = b - A*x
+  data.primal_residual = lp.rhs;
+  matrix_vector_multiply(lp.A, -1.0, data.x, 1.0, data.primal_residual);
+
+  // bound_residual = E'*u - w - E'*x
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    const i_t j            = data.upper_bounds[k];
+    data.bound_residual[k] = lp.upper[j] - data.w[k] - data.x[j];
+  }
+
+  // dual_residual = c - A'*y - z + E*v
+  data.c.pairwise_subtract(data.z, data.dual_residual);
+  matrix_transpose_vector_multiply(lp.A, -1.0, data.y, 1.0, data.dual_residual);
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    data.dual_residual[data.upper_bounds[k]] += data.v[k];
+  }
+
+  data.x.pairwise_product(data.z, data.complementarity_xz_residual);
+  data.w.pairwise_product(data.v, data.complementarity_wv_residual);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_residual_norms(cpu_iteration_data_t<i_t, f_t>& data,
+                                                            f_t& primal_residual_norm,
+                                                            f_t& dual_residual_norm,
+                                                            f_t& complementarity_residual_norm)
+{
+  compute_residuals(data);
+  primal_residual_norm = std::max(vector_norm_inf<i_t, f_t>(data.primal_residual),
+                                  vector_norm_inf<i_t, f_t>(data.bound_residual));
+  dual_residual_norm   = vector_norm_inf<i_t, f_t>(data.dual_residual);
+  complementarity_residual_norm =
+    std::max(vector_norm_inf<i_t, f_t>(data.complementarity_xz_residual),
+             vector_norm_inf<i_t, f_t>(data.complementarity_wv_residual));
+}
+
+template <typename i_t, typename f_t>
+i_t cpu_barrier_solver_t<i_t, f_t>::compute_search_direction(cpu_iteration_data_t<i_t, f_t>& data,
+                                                             dense_vector_t<i_t, f_t>& dw,
+                                                             dense_vector_t<i_t, f_t>& dx,
+                                                             dense_vector_t<i_t, f_t>& dy,
+                                                             dense_vector_t<i_t, f_t>& dv,
+                                                             dense_vector_t<i_t, f_t>& dz)
+{
+  // Solves the linear system
+  //
+  //  dw dx dy dv dz
+  // [ 0 A  0   0  0 ] [ dw ] = [ rp  ]
+  // [ I E' 0   0  0 ] [ dx ]   [ rw  ]
+  // [ 0 0  A' -E  I ] [ dy ]   [ rd  ]
+  // [ 0 Z  0   0  X ] [ dv ]   [ rxz ]
+  // [ V 0  0   W  0 ] [ dz ]   [ rwv ]
+  // by reducing it to the normal equations A*D^{-1}*A' dy = h
+
+  const i_t n = lp.num_cols;
+
+  // diag = z ./ x + E * (v ./ w) * E'
+  data.z.pairwise_divide(data.x, data.diag);
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    data.diag[data.upper_bounds[k]] += data.v[k] / data.w[k];
+  }
+  data.diag.inverse(data.inv_diag);
+
+  if (!data.has_factorization) {
+    data.form_adat();
+    const i_t status = data.chol.factorize(data.ADAT);
+    if (status == CONCURRENT_HALT_RETURN) { return CONCURRENT_HALT_RETURN; }
+    if (status < 0) {
+      settings.log.printf("Factorization failed.\n");
+      return -1;
+    }
+    data.has_factorization = true;
+    data.num_factorizations++;
+    if (data.chol.num_regularized_pivots() > 0) {
+      settings.log.debug("CPU Cholesky: %d small pivots regularized\n",
+                         data.chol.num_regularized_pivots());
+    }
+  }
+
+  // r1 = dual_rhs - complementarity_xz_rhs ./ x
+  //      + E * ((complementarity_wv_rhs - v .* bound_rhs) ./ w)
+  for (i_t j = 0; j < n; j++) {
+    data.r1[j] = data.dual_rhs[j] - data.complementarity_xz_rhs[j] / data.x[j];
+  }
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    data.r1[data.upper_bounds[k]] +=
+      (data.complementarity_wv_rhs[k] - data.v[k] * data.bound_rhs[k]) / data.w[k];
+  }
+
+  // h = primal_rhs + A * inv_diag * r1
+  dense_vector_t<i_t, f_t> tmp(n);
+  data.inv_diag.pairwise_product(data.r1, tmp);
+  data.h = data.primal_rhs;
+  matrix_vector_multiply(lp.A, 1.0, tmp, 1.0, data.h);
+
+  // Solve A D^{-1} A^T dy = h
+  i_t solve_status = data.solve_adat(data.h, dy);
+  if (solve_status < 0) {
+    settings.log.printf("Linear solve failed\n");
+    return -1;
+  }
+  dense_vector_t<i_t, f_t> y_residual(data.h);
+  data.adat_multiply(1.0, dy, -1.0, y_residual);
+  const f_t y_residual_norm = vector_norm_inf<i_t, f_t>(y_residual);
+  if (y_residual_norm > 1e-2) {
+    settings.log.printf("||ADAT*dy - h|| = %.2e || h || = %.2e\n",
+                        y_residual_norm,
+                        vector_norm_inf<i_t, f_t>(data.h));
+  }
+  if (y_residual_norm > 1e4) { return -1; }
+
+  // dx = inv_diag .* (A'*dy - r1)
+  matrix_transpose_vector_multiply(lp.A, 1.0, dy, -1.0, data.r1);
+  data.inv_diag.pairwise_product(data.r1, dx);
+
+  // dz = (complementarity_xz_rhs - z .* dx) ./ x
+  for (i_t j = 0; j < n; j++) {
+    dz[j] = (data.complementarity_xz_rhs[j] - data.z[j] * dx[j]) / data.x[j];
+  }
+
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    const i_t j = data.upper_bounds[k];
+    // dv = (v .* E'*dx + complementarity_wv_rhs - v .* bound_rhs) ./ w
+    dv[k] = (data.v[k] * dx[j] - data.bound_rhs[k] * data.v[k] + data.complementarity_wv_rhs[k]) /
+            data.w[k];
+    // dw = bound_rhs - E'*dx
+    dw[k] = data.bound_rhs[k] - dx[j];
+  }
+  return 0;
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_affine_rhs(cpu_iteration_data_t<i_t, f_t>& data)
+{
+  data.primal_rhs             = data.primal_residual;
+  data.bound_rhs              = data.bound_residual;
+  data.dual_rhs               = data.dual_residual;
+  data.complementarity_xz_rhs = data.complementarity_xz_residual;
+  data.complementarity_wv_rhs = data.complementarity_wv_residual;
+  data.complementarity_xz_rhs.multiply_scalar(-1.0);
+  data.complementarity_wv_rhs.multiply_scalar(-1.0);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_target_mu(
+  cpu_iteration_data_t<i_t, f_t>& data, f_t mu, f_t& mu_aff, f_t& sigma, f_t& new_mu)
+{
+  const f_t step_primal_aff = std::min(max_step_to_boundary(data.w, data.dw_aff),
+                                       max_step_to_boundary(data.x, data.dx_aff));
+  const f_t step_dual_aff   = std::min(max_step_to_boundary(data.v, data.dv_aff),
+                                     max_step_to_boundary(data.z, data.dz_aff));
+
+  f_t complementarity_aff_sum = 0.0;
+  for (size_t j = 0; j < data.x.size(); j++) {
+    complementarity_aff_sum += (data.x[j] + step_primal_aff * data.dx_aff[j]) *
+                               (data.z[j] + step_dual_aff * data.dz_aff[j]);
+  }
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    complementarity_aff_sum += (data.w[k] + step_primal_aff * data.dw_aff[k]) *
+                               (data.v[k] + step_dual_aff * data.dv_aff[k]);
+  }
+
+  mu_aff =
+    barrier_average_complementarity(complementarity_aff_sum, data.x.size(), data.n_upper_bounds);
+  barrier_centering(mu, mu_aff, sigma, new_mu);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_cc_rhs(cpu_iteration_data_t<i_t, f_t>& data,
+                                                    f_t new_mu)
+{
+  for (size_t j = 0; j < data.x.size(); j++) {
+    data.complementarity_xz_rhs[j] = -(data.dx_aff[j] * data.dz_aff[j]) + new_mu;
+  }
+  for (i_t k = 0; k < data.n_upper_bounds; k++) {
+    data.complementarity_wv_rhs[k] = -(data.dw_aff[k] * data.dv_aff[k]) + new_mu;
+  }
+  data.primal_rhs.set_scalar(0.0);
+  data.bound_rhs.set_scalar(0.0);
+  data.dual_rhs.set_scalar(0.0);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_final_direction(cpu_iteration_data_t<i_t, f_t>& data)
+{
+  data.dw.axpy(1.0, data.dw_aff, 1.0);
+  data.dx.axpy(1.0, data.dx_aff, 1.0);
+  data.dy.axpy(1.0, data.dy_aff, 1.0);
+  data.dv.axpy(1.0, data.dv_aff, 1.0);
+  data.dz.axpy(1.0, data.dz_aff, 1.0);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_primal_dual_step_length(
+  cpu_iteration_data_t<i_t, f_t>& data, f_t step_scale, f_t& step_primal, f_t& step_dual)
+{
+  const f_t max_step_primal =
+    std::min(max_step_to_boundary(data.w, data.dw), max_step_to_boundary(data.x, data.dx));
+  const f_t max_step_dual =
+    std::min(max_step_to_boundary(data.v, data.dv), max_step_to_boundary(data.z, data.dz));
+  step_primal = step_scale * max_step_primal;
+  step_dual   = step_scale * max_step_dual;
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_next_iterate(cpu_iteration_data_t<i_t, f_t>& data,
+                                                          f_t step_scale,
+                                                          f_t step_primal,
+                                                          f_t step_dual)
+{
+  data.w.axpy(step_primal, data.dw, 1.0);
+  data.x.axpy(step_primal, data.dx, 1.0);
+  data.y.axpy(step_dual, data.dy, 1.0);
+  data.v.axpy(step_dual, data.dv, 1.0);
+  data.z.axpy(step_dual, data.dz, 1.0);
+
+  // Shift free variable pairs x = u - v towards zero
+  const i_t num_free_variables = presolve_info.free_variable_pairs.size() / 2;
+  for (i_t k = 0; k < num_free_variables; k++) {
+    const i_t u   = presolve_info.free_variable_pairs[2 * k];
+    const i_t v   = presolve_info.free_variable_pairs[2 * k + 1];
+    const f_t eta = step_scale * std::min(data.x[u], data.x[v]);
+    data.x[u] -= eta;
+    data.x[v] -= eta;
+  }
+}
+
+template <typename i_t, typename f_t>
+f_t cpu_barrier_solver_t<i_t, f_t>::compute_mu(cpu_iteration_data_t<i_t, f_t>& data)
+{
+  return barrier_average_complementarity(
+    data.complementarity_xz_residual.sum() + data.complementarity_wv_residual.sum(),
+    data.x.size(),
+    data.n_upper_bounds);
+}
+
+template <typename i_t, typename f_t>
+void cpu_barrier_solver_t<i_t, f_t>::compute_primal_dual_objective(
+  cpu_iteration_data_t<i_t, f_t>& data, f_t& primal_objective, f_t& dual_objective)
+{
+  primal_objective = data.c.inner_product(data.x);
+  dual_objective   = data.b.inner_product(data.y) - data.restrict_u.inner_product(data.v);
+}
+
+template <typename i_t, typename f_t>
+lp_status_t cpu_barrier_solver_t<i_t, f_t>::check_for_suboptimal_solution(
+  cpu_iteration_data_t<i_t, f_t>& data,
+  f_t start_time,
+  i_t iter,
+  f_t primal_objective,
+  f_t primal_residual_norm,
+  f_t dual_residual_norm,
+  f_t complementarity_residual_norm,
+  f_t relative_primal_residual,
+  f_t relative_dual_residual,
+  f_t relative_complementarity_residual,
+  lp_solution_t<i_t, f_t>& solution)
+{
+  return barrier_suboptimal_solution(
+    settings,
+    lp,
+    data,
+    start_time,
+    iter,
+    primal_objective,
+    data.c.inner_product(data.x_save),
+    primal_residual_norm,
+    dual_residual_norm,
+    complementarity_residual_norm,
+    relative_primal_residual,
+    relative_dual_residual,
+    relative_complementarity_residual,
+    [&](bool saved, f_t objective) {
+      if (saved) {
+        data.to_solution(lp,
+                         iter,
+                         objective,
+                         data.primal_residual_norm_save,
+                         data.x_save,
+                         data.y_save,
+                         data.v_save,
+                         data.z_save,
+                         solution);
+      } else {
+        data.to_solution(
+          lp, iter, objective, primal_residual_norm, data.x, data.y, data.v, data.z, solution);
+      }
+    });
+}
+
+template <typename i_t, typename f_t>
+lp_status_t cpu_barrier_solver_t<i_t, f_t>::solve(
+  f_t start_time,
+  const barrier_solver_settings_t<i_t, f_t>& options,
+  lp_solution_t<i_t, f_t>& solution)
+{
+  const i_t n = lp.num_cols;
+  const i_t m = lp.num_rows;
+
+  solution.resize(m, n);
+  settings.log.printf("Barrier solver (CPU): %d constraints, %d variables, %ld nonzeros\n",
+                      m,
+                      n,
+                      static_cast<int64_t>(lp.A.col_start[n]));
+  settings.log.printf("\n");
+  if (lp.Q.n > 0) {
+    settings.log.printf("CPU barrier does not support quadratic objectives\n");
+    return lp_status_t::NUMERICAL_ISSUES;
+  }
+
+  const i_t num_free_variables = presolve_info.free_variable_pairs.size() / 2;
+  if (num_free_variables > 0) {
+    settings.log.printf("Free variables              : %d\n", num_free_variables);
+  }
+
+  cpu_iteration_data_t<i_t, f_t> data(lp, settings);
+  if (data.n_upper_bounds > 0) {
+    settings.log.printf("Upper bounds                : %d\n", data.n_upper_bounds);
+  }
+  settings.log.printf("Linear system               : ADAT\n");
+
+  auto halted = [&]() {
+    return settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1;
+  };
+
+  // The symbolic analysis is performed once and reused by every factorization
+  const i_t symbolic_status = data.chol.analyze(data.ADAT);
+  if (symbolic_status == CONCURRENT_HALT_RETURN || halted()) {
+    settings.log.printf("Barrier solver halted\n");
+    return lp_status_t::CONCURRENT_LIMIT;
+  }
+  if (symbolic_status != 0) {
+    settings.log.printf("Error in symbolic analysis\n");
+    return lp_status_t::NUMERICAL_ISSUES;
+  }
+  if (toc(start_time) > settings.time_limit) {
+    settings.log.printf("Barrier time limit exceeded\n");
+    return lp_status_t::TIME_LIMIT;
+  }
+
+  const i_t initial_status = initial_point(data);
+  if (toc(start_time) > settings.time_limit) {
+    settings.log.printf("Barrier time limit exceeded\n");
+    return lp_status_t::TIME_LIMIT;
+  }
+  if (initial_status == CONCURRENT_HALT_RETURN || halted()) {
+    settings.log.printf("Barrier solver halted\n");
+    return lp_status_t::CONCURRENT_LIMIT;
+  }
+  if (initial_status != 0) {
+    settings.log.printf("Unable to compute initial point\n");
+    return lp_status_t::NUMERICAL_ISSUES;
+  }
+
+  f_t primal_residual_norm;
+  f_t dual_residual_norm;
+  f_t complementarity_residual_norm;
+  compute_residual_norms(
+    data, primal_residual_norm, dual_residual_norm, complementarity_residual_norm);
+  f_t mu = compute_mu(data);
+
+  const f_t norm_b = vector_norm_inf<i_t, f_t>(data.b);
+  const f_t norm_c = vector_norm_inf<i_t, f_t>(data.c);
+
+  f_t primal_objective;
+  f_t dual_objective;
+  compute_primal_dual_objective(data, primal_objective, dual_objective);
+
+  f_t relative_primal_residual;
+  f_t relative_dual_residual;
+  f_t relative_complementarity_residual;
+  barrier_relative_residuals(primal_residual_norm,
+                             dual_residual_norm,
+                             complementarity_residual_norm,
+                             norm_b,
+                             norm_c,
+                             primal_objective,
+                             relative_primal_residual,
+                             relative_dual_residual,
+                             relative_complementarity_residual);
+
+  i_t iter = 0;
+  settings.log.printf("\n");
+  settings.log.printf(
+    "                  Objective                         Infeasibility        Time\n");
+  settings.log.printf(
+    "Iter   Primal              Dual                Primal   Dual    Compl.   Elapsed\n");
+  barrier_log_iteration(settings,
+                        lp,
+                        iter,
+                        primal_objective,
+                        dual_objective,
+                        relative_primal_residual,
+                        relative_dual_residual,
+                        relative_complementarity_residual,
+                        toc(start_time));
+
+  data.w_save = data.w;
+  data.x_save = data.x;
+  data.y_save = data.y;
+  data.v_save = data.v;
+  data.z_save = data.z;
+
+  auto suboptimal = [&]() {
+    return check_for_suboptimal_solution(data,
+                                         start_time,
+                                         iter,
+                                         primal_objective,
+                                         primal_residual_norm,
+                                         dual_residual_norm,
+                                         complementarity_residual_norm,
+                                         relative_primal_residual,
+                                         relative_dual_residual,
+                                         relative_complementarity_residual,
+                                         solution);
+  };
+
+  const i_t iteration_limit = std::min(settings.iteration_limit, options.iteration_limit);
+  while (iter < iteration_limit) {
+    if (toc(start_time) > settings.time_limit) {
+      settings.log.printf("Barrier time limit exceeded\n");
+      return lp_status_t::TIME_LIMIT;
+    }
+    if (halted()) {
+      settings.log.printf("Barrier solver halted\n");
+      return lp_status_t::CONCURRENT_LIMIT;
+    }
+
+    // Compute the affine step
+    compute_affine_rhs(data);
+    i_t status = compute_search_direction(
+      data, data.dw_aff, data.dx_aff, data.dy_aff, data.dv_aff, data.dz_aff);
+    if (status == CONCURRENT_HALT_RETURN || halted()) {
+      settings.log.printf("Barrier solver halted\n");
+      return lp_status_t::CONCURRENT_LIMIT;
+    }
+    if (status < 0) { return suboptimal(); }
+
+    f_t mu_aff, sigma, new_mu;
+    compute_target_mu(data, mu, mu_aff, sigma, new_mu);
+    compute_cc_rhs(data, new_mu);
+
+    // Compute the centering-corrector step reusing the factorization
+    status = compute_search_direction(data, data.dw, data.dx, data.dy, data.dv, data.dz);
+    if (status == CONCURRENT_HALT_RETURN || halted()) {
+      settings.log.printf("Barrier solver halted\n");
+      return lp_status_t::CONCURRENT_LIMIT;
+    }
+    if (status < 0) { return suboptimal(); }
+    data.has_factorization = false;
+
+    compute_final_direction(data);
+    f_t step_primal, step_dual;
+    compute_primal_dual_step_length(data, options.step_scale, step_primal, step_dual);
+    compute_next_iterate(data, options.step_scale, step_primal, step_dual);
+
+    compute_residual_norms(
+      data, primal_residual_norm, dual_residual_norm, complementarity_residual_norm);
+    mu = compute_mu(data);
+    compute_primal_dual_objective(data, primal_objective, dual_objective);
+
+    barrier_relative_residuals(primal_residual_norm,
+                               dual_residual_norm,
+                               complementarity_residual_norm,
+                               norm_b,
+                               norm_c,
+                               primal_objective,
+                               relative_primal_residual,
+                               relative_dual_residual,
+                               relative_complementarity_residual);
+    barrier_save_iterate(settings,
+                         primal_objective,
+                         dual_objective,
+                         primal_residual_norm,
+                         dual_residual_norm,
+                         complementarity_residual_norm,
+                         relative_primal_residual,
+                         relative_dual_residual,
+                         relative_complementarity_residual,
+                         data);
+
+    iter++;
+
+    if (primal_objective != primal_objective || dual_objective != dual_objective) {
+      settings.log.printf("Numerical error in objective\n");
+      return suboptimal();
+    }
+
+    barrier_log_iteration(settings,
+                          lp,
+                          iter,
+                          primal_objective,
+                          dual_objective,
+                          relative_primal_residual,
+                          relative_dual_residual,
+                          relative_complementarity_residual,
+                          toc(start_time));
+
+    const bool converged =
+      relative_primal_residual < settings.barrier_relative_feasibility_tol &&
+      relative_dual_residual < settings.barrier_relative_optimality_tol &&
+      relative_complementarity_residual < settings.barrier_relative_complementarity_tol;
+    if (converged) {
+      settings.log.printf("\n");
+      settings.log.printf(
+        "Optimal solution found in %d iterations and %.2fs\n", iter, toc(start_time));
+      barrier_log_solution(settings,
+                           lp,
+                           primal_objective,
+                           primal_residual_norm,
+                           dual_residual_norm,
+                           complementarity_residual_norm,
+                           relative_primal_residual,
+                           relative_dual_residual,
+                           relative_complementarity_residual);
+      settings.log.printf("Factorizations              : %d\n", data.num_factorizations);
+      settings.log.printf("\n");
+      data.to_solution(
+        lp, iter, primal_objective, primal_residual_norm, data.x, data.y, data.v, data.z, solution);
+      return lp_status_t::OPTIMAL;
+    }
+  }
+  data.to_solution(
+    lp, iter, primal_objective, primal_residual_norm, data.x, data.y, data.v, data.z, solution);
+  return lp_status_t::ITERATION_LIMIT;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class cpu_iteration_data_t<int, double>;
+template class cpu_barrier_solver_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
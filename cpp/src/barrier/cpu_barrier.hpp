@@ -0,0 +1,86 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <barrier/barrier.hpp>
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solution.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+class cpu_iteration_data_t;  // Forward declare
+
+// CPU backend of the barrier solver.
+//
+// Runs the same Mehrotra predictor-corrector method as barrier_solver_t (initial point,
+// affine and centering-corrector directions, step lengths, termination and suboptimal
+// solution handling) on the normal equations A*D^{-1}*A' entirely on the host. The steps that do
+// not depend on the backend live in barrier_common.hpp and are shared with barrier_solver_t. The
+// normal equations are factored with sparse_cholesky_cpu_t, whose symbolic analysis is performed
+// once and reused in every iteration. Only linear programs are supported.
+template <typename i_t, typename f_t>
+class cpu_barrier_solver_t {
+ public:
+  cpu_barrier_solver_t(const lp_problem_t<i_t, f_t>& lp,
+                       const presolve_info_t<i_t, f_t>& presolve,
+                       const simplex_solver_settings_t<i_t, f_t>& settings);
+  lp_status_t solve(f_t start_time,
+                    const barrier_solver_settings_t<i_t, f_t>& options,
+                    lp_solution_t<i_t, f_t>& solution);
+
+ private:
+  i_t initial_point(cpu_iteration_data_t<i_t, f_t>& data);
+  void compute_residuals(cpu_iteration_data_t<i_t, f_t>& data);
+  void compute_residual_norms(cpu_iteration_data_t<i_t, f_t>& data,
+                              f_t& primal_residual_norm,
+                              f_t& dual_residual_norm,
+                              f_t& complementarity_residual_norm);
+  i_t compute_search_direction(cpu_iteration_data_t<i_t, f_t>& data,
+                               dense_vector_t<i_t, f_t>& dw,
+                               dense_vector_t<i_t, f_t>& dx,
+                               dense_vector_t<i_t, f_t>& dy,
+                               dense_vector_t<i_t, f_t>& dv,
+                               dense_vector_t<i_t, f_t>& dz);
+  void compute_affine_rhs(cpu_iteration_data_t<i_t, f_t>& data);
+  void compute_target_mu(
+    cpu_iteration_data_t<i_t, f_t>& data, f_t mu, f_t& mu_aff, f_t& sigma, f_t& new_mu);
+  void compute_cc_rhs(cpu_iteration_data_t<i_t, f_t>& data, f_t new_mu);
+  void compute_final_direction(cpu_iteration_data_t<i_t, f_t>& data);
+  void compute_primal_dual_step_length(cpu_iteration_data_t<i_t, f_t>& data,
+                                       f_t step_scale,
+                                       f_t& step_primal,
+                                       f_t& step_dual);
+  void compute_next_iterate(cpu_iteration_data_t<i_t, f_t>& data,
+                            f_t step_scale,
+                            f_t step_primal,
+                            f_t step_dual);
+  f_t compute_mu(cpu_iteration_data_t<i_t, f_t>& data);
+  void compute_primal_dual_objective(cpu_iteration_data_t<i_t, f_t>& data,
+                                     f_t& primal_objective,
+                                     f_t& dual_objective);
+  lp_status_t check_for_suboptimal_solution(cpu_iteration_data_t<i_t, f_t>& data,
+                                            f_t start_time,
+                                            i_t iter,
+                                            f_t primal_objective,
+                                            f_t primal_residual_norm,
+                                            f_t dual_residual_norm,
+                                            f_t complementarity_residual_norm,
+                                            f_t relative_primal_residual,
+                                            f_t relative_dual_residual,
+                                            f_t relative_complementarity_residual,
+                                            lp_solution_t<i_t, f_t>& solution);
+
+  const lp_problem_t<i_t, f_t>& lp;
+  const simplex_solver_settings_t<i_t, f_t>& settings;
+  const presolve_info_t<i_t, f_t>& presolve_info;
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,393 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <barrier/ordering.hpp>
+
+#include <dual_simplex/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t>
+void approximate_minimum_degree(i_t n,
+                                const std::vector<i_t>& adj_start,
+                                const std::vector<i_t>& adj_index,
+                                std::vector<i_t>& perm)
+{
+  perm.resize(n);
+  if (n == 0) { return; }
+
+  // The quotient graph. Every vertex is either an uneliminated variable, an element (a
+  // variable that has been eliminated and whose clique is still needed), or dead (an absorbed
+  // element or a dense variable that is ordered last).
+  constexpr i_t VARIABLE = 0;
+  constexpr i_t ELEMENT  = 1;
+  constexpr i_t DEAD     = 2;
+  std::vector<i_t> status(n, VARIABLE);
+  std::vector<std::vector<i_t>> variables(n);          // variables adjacent to variable i
+  std::vector<std::vector<i_t>> elements(n);           // elements adjacent to variable i
+  std::vector<std::vector<i_t>> element_variables(n);  // variables in element e
+
+  const i_t dense_threshold =
+    std::max(static_cast<i_t>(16), static_cast<i_t>(10.0 * std::sqrt(static_cast<double>(n))));
+  std::vector<i_t> dense_vertices;
+  for (i_t i = 0; i < n; i++) {
+    if (adj_start[i + 1] - adj_start[i] > dense_threshold) {
+      status[i] = DEAD;
+      dense_vertices.push_back(i);
+    }
+  }
+  for (i_t i = 0; i < n; i++) {
+    if (status[i] != VARIABLE) { continue; }
+    for (i_t p = adj_start[i]; p < adj_start[i + 1]; p++) {
+      const i_t j = adj_index[p];
+      if (j != i && status[j] == VARIABLE) { variables[i].push_back(j); }
+    }
+  }
+
+  // Degree lists
+  std::vector<i_t> degree(n, 0);
+  std::vector<i_t> head(n, -1);
+  std::vector<i_t> next(n, -1);
+  std::vector<i_t> prev(n, -1);
+  i_t min_degree = 0;
+  auto insert    = [&](i_t i) {
+    const i_t d = degree[i];
+    next[i]     = head[d];
+    prev[i]     = -1;
+    if (head[d] != -1) { prev[head[d]] = i; }
+    head[d]    = i;
+    min_degree = std::min(min_degree, d);
+  };
+  auto remove = [&](i_t i) {
+    const i_t d = degree[i];
+    if (prev[i] != -1) {
+      next[prev[i]] = next[i];
+    } else {
+      head[d] = next[i];
+    }
+    if (next[i] != -1) { prev[next[i]] = prev[i]; }
+  };
+
+  for (i_t i = n - 1; i >= 0; i--) {
+    if (status[i] != VARIABLE) { continue; }
+    degree[i] = static_cast<i_t>(variables[i].size());
+    insert(i);
+  }
+
+  const i_t num_variables = n - static_cast<i_t>(dense_vertices.size());
+  std::vector<i_t> mark(n, -1);     // mark[i] == p if i is in the new element p
+  std::vector<i_t> w(n, 0);         // w[e] = | L_e \ L_p | for elements adjacent to L_p
+  std::vector<i_t> w_stamp(n, -1);  // w_stamp[e] == p if w[e] is valid for pivot p
+  std::vector<i_t> Lp;
+  i_t k = 0;
+  while (k < num_variables) {
+    while (head[min_degree] == -1) {
+      min_degree++;
+    }
+    const i_t p = head[min_degree];
+    remove(p);
+    perm[k++] = p;
+    status[p] = ELEMENT;
+
+    // Form the new element L_p from the variables adjacent to p and the elements it absorbs
+    Lp.clear();
+    mark[p] = p;
+    for (i_t j : variables[p]) {
+      if (status[j] == VARIABLE && mark[j] != p) {
+        mark[j] = p;
+        Lp.push_back(j);
+      }
+    }
+    for (i_t e : elements[p]) {
+      if (status[e] != ELEMENT) { continue; }
+      for (i_t j : element_variables[e]) {
+        if (status[j] == VARIABLE && mark[j] != p) {
+          mark[j] = p;
+          Lp.push_back(j);
+        }
+      }
+      status[e] = DEAD;
+      std::vector<i_t>().swap(element_variables[e]);
+    }
+    std::vector<i_t>().swap(variables[p]);
+    std::vector<i_t>().swap(elements[p]);
+
+    // Compute the external degree | L_e \ L_p | of every element adjacent to L_p
+    for (i_t i : Lp) {
+      for (i_t e : elements[i]) {
+        if (status[e] != ELEMENT) { continue; }
+        if (w_stamp[e] != p) {
+          w_stamp[e] = p;
+          w[e]       = static_cast<i_t>(element_variables[e].size());
+        }
+        w[e]--;
+      }
+    }
+
+    // Update the variables in L_p and their approximate degrees
+    const i_t remaining = num_variables - k;
+    const i_t Lp_size   = static_cast<i_t>(Lp.size());
+    for (i_t i : Lp) {
+      remove(i);
+      i_t external_degree = 0;
+      std::vector<i_t>& Ei = elements[i];
+      i_t q                = 0;
+      for (i_t e : Ei) {
+        if (status[e] != ELEMENT) { continue; }
+        if (w[e] == 0) {
+          // L_e is a subset of L_p. Absorb e into p
+          status[e] = DEAD;
+          std::vector<i_t>().swap(element_variables[e]);
+          continue;
+        }
+        Ei[q++] = e;
+        external_degree += w[e];
+      }
+      Ei.resize(q);
+      Ei.push_back(p);
+
+      // Variables in L_p are now reached through p
+      std::vector<i_t>& Ai = variables[i];
+      q                    = 0;
+      for (i_t j : Ai) {
+        if (status[j] == VARIABLE && mark[j] != p && j != i) { Ai[q++] = j; }
+      }
+      Ai.resize(q);
+
+      i_t d = static_cast<i_t>(Ai.size()) + (Lp_size - 1) + external_degree;
+      d     = std::min(d, degree[i] + Lp_size);
+      d     = std::max(static_cast<i_t>(0), std::min(d, remaining - 1));
+      degree[i] = d;
+      insert(i);
+    }
+    element_variables[p] = Lp;
+  }
+
+  for (i_t i : dense_vertices) {
+    perm[k++] = i;
+  }
+}
+
+template <typename i_t>
+void nested_dissection(i_t n,
+                       const std::vector<i_t>& adj_start,
+                       const std::vector<i_t>& adj_index,
+                       i_t leaf_size,
+                       std::vector<i_t>& perm)
+{
+  perm.resize(n);
+  if (n == 0) { return; }
+
+  // A part is a set of vertices that will occupy perm[position, position + size)
+  struct part_t {
+    std::vector<i_t> vertices;
+    i_t position;
+  };
+  std::vector<part_t> stack;
+  {
+    part_t all;
+    all.vertices.resize(n);
+    std::iota(all.vertices.begin(), all.vertices.end(), 0);
+    all.position = 0;
+    stack.push_back(std::move(all));
+  }
+
+  std::vector<i_t> local(n, -1);  // local[v] = index of v in the current part, -1 otherwise
+  std::vector<i_t> level(n, -1);
+  std::vector<i_t> queue;
+  queue.reserve(n);
+
+  // Breadth first search from root restricted to the current part. On return queue holds the
+  // reached vertices in order, level[] their distance from root, and the number of levels is
+  // returned
+  auto bfs = [&](i_t root) -> i_t {
+    queue.clear();
+    queue.push_back(root);
+    level[root]    = 0;
+    i_t num_levels = 1;
+    for (size_t head = 0; head < queue.size(); head++) {
+      const i_t v = queue[head];
+      for (i_t p = adj_start[v]; p < adj_start[v + 1]; p++) {
+        const i_t u = adj_index[p];
+        if (local[u] == -1 || level[u] != -1) { continue; }
+        level[u]   = level[v] + 1;
+        num_levels = std::max(num_levels, level[u] + 1);
+        queue.push_back(u);
+      }
+    }
+    return num_levels;
+  };
+  auto clear_levels = [&]() {
+    for (i_t v : queue) {
+      level[v] = -1;
+    }
+  };
+  auto part_degree = [&](i_t v) {
+    i_t d = 0;
+    for (i_t p = adj_start[v]; p < adj_start[v + 1]; p++) {
+      if (local[adj_index[p]] != -1) { d++; }
+    }
+    return d;
+  };
+
+  std::vector<i_t> leaf_start;
+  std::vector<i_t> leaf_index;
+  std::vector<i_t> leaf_perm;
+  auto order_leaf = [&](const part_t& part) {
+    const i_t size = static_cast<i_t>(part.vertices.size());
+    leaf_start.assign(size + 1, 0);
+    leaf_index.clear();
+    for (i_t k = 0; k < size; k++) {
+      const i_t v = part.vertices[k];
+      for (i_t p = adj_start[v]; p < adj_start[v + 1]; p++) {
+        const i_t u = adj_index[p];
+        if (local[u] != -1 && u != v) { leaf_index.push_back(local[u]); }
+      }
+      leaf_start[k + 1] = static_cast<i_t>(leaf_index.size());
+    }
+    approximate_minimum_degree(size, leaf_start, leaf_index, leaf_perm);
+    for (i_t k = 0; k < size; k++) {
+      perm[part.position + k] = part.vertices[leaf_perm[k]];
+    }
+  };
+
+  while (!stack.empty()) {
+    part_t part = std::move(stack.back());
+    stack.pop_back();
+    const i_t size = static_cast<i_t>(part.vertices.size());
+    for (i_t k = 0; k < size; k++) {
+      local[part.vertices[k]] = k;
+    }
+    auto release = [&]() {
+      for (i_t v : part.vertices) {
+        local[v] = -1;
+      }
+    };
+
+    if (size <= leaf_size) {
+      order_leaf(part);
+      release();
+      continue;
+    }
+
+    // Split off the connected component containing the first vertex
+    i_t num_levels = bfs(part.vertices[0]);
+    if (static_cast<i_t>(queue.size()) < size) {
+      part_t reached;
+      part_t rest;
+      reached.position = part.position;
+      reached.vertices = queue;
+      for (i_t v : part.vertices) {
+        if (level[v] == -1) { rest.vertices.push_back(v); }
+      }
+      rest.position = part.position + static_cast<i_t>(reached.vertices.size());
+      clear_levels();
+      release();
+      stack.push_back(std::move(reached));
+      stack.push_back(std::move(rest));
+      continue;
+    }
+
+    // Find a pseudo-peripheral vertex: restart the search from a vertex of minimum degree in
+    // the last level while the number of levels increases
+    for (i_t restart = 0; restart < 4; restart++) {
+      i_t root       = queue.back();
+      i_t min_degree = part_degree(root);
+      for (auto it = queue.rbegin(); it != queue.rend() && level[*it] == num_levels - 1; ++it) {
+        const i_t d = part_degree(*it);
+        if (d < min_degree) {
+          min_degree = d;
+          root       = *it;
+        }
+      }
+      clear_levels();
+      const i_t new_num_levels = bfs(root);
+      if (new_num_levels <= num_levels) {
+        num_levels = new_num_levels;
+        break;
+      }
+      num_levels = new_num_levels;
+    }
+
+    if (num_levels < 3) {
+      // The part is too tightly connected for a level structure separator
+      clear_levels();
+      order_leaf(part);
+      release();
+      continue;
+    }
+
+    // Choose the middle level as the separator
+    std::vector<i_t> level_count(num_levels, 0);
+    for (i_t v : queue) {
+      level_count[level[v]]++;
+    }
+    i_t separator_level = 1;
+    i_t count           = level_count[0];
+    while (separator_level < num_levels - 2 && count + level_count[separator_level] < size / 2) {
+      count += level_count[separator_level];
+      separator_level++;
+    }
+
+    part_t first;
+    part_t second;
+    std::vector<i_t> separator;
+    for (i_t v : queue) {
+      if (level[v] < separator_level) {
+        first.vertices.push_back(v);
+      } else if (level[v] > separator_level) {
+        second.vertices.push_back(v);
+      } else {
+        // Separator vertices that are not adjacent to the second part can move to the first
+        bool adjacent_to_second = false;
+        for (i_t p = adj_start[v]; p < adj_start[v + 1]; p++) {
+          const i_t u = adj_index[p];
+          if (local[u] != -1 && level[u] > separator_level) {
+            adjacent_to_second = true;
+            break;
+          }
+        }
+        if (adjacent_to_second) {
+          separator.push_back(v);
+        } else {
+          first.vertices.push_back(v);
+        }
+      }
+    }
+    clear_levels();
+    release();
+
+    first.position  = part.position;
+    second.position = part.position + static_cast<i_t>(first.vertices.size());
+    const i_t separator_position =
+      second.position + static_cast<i_t>(second.vertices.size());
+    for (size_t k = 0; k < separator.size(); k++) {
+      perm[separator_position + k] = separator[k];
+    }
+    stack.push_back(std::move(first));
+    stack.push_back(std::move(second));
+  }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template void approximate_minimum_degree<int>(int n,
+                                              const std::vector<int>& adj_start,
+                                              const std::vector<int>& adj_index,
+                                              std::vector<int>& perm);
+
+template void nested_dissection<int>(int n,
+                                     const std::vector<int>& adj_start,
+                                     const std::vector<int>& adj_index,
+                                     int leaf_size,
+                                     std::vector<int>& perm);
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
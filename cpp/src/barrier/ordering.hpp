@@ -0,0 +1,36 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Fill-reducing orderings for the CPU sparse Cholesky factorization.
+//
+// The graph is given by the symmetric adjacency structure (adj_start, adj_index) of an
+// n x n matrix, without the diagonal. On output perm[k] is the vertex eliminated k-th.
+
+// Approximate minimum degree ordering on a quotient graph with element absorption.
+// Dense vertices (degree > max(16, 10 * sqrt(n))) are ordered last.
+template <typename i_t>
+void approximate_minimum_degree(i_t n,
+                                const std::vector<i_t>& adj_start,
+                                const std::vector<i_t>& adj_index,
+                                std::vector<i_t>& perm);
+
+// Nested dissection ordering. The graph is recursively bisected with level structure
+// separators rooted at a pseudo-peripheral vertex. Subgraphs with at most leaf_size
+// vertices are ordered with approximate minimum degree.
+template <typename i_t>
+void nested_dissection(i_t n,
+                       const std::vector<i_t>& adj_start,
+                       const std::vector<i_t>& adj_index,
+                       i_t leaf_size,
+                       std::vector<i_t>& perm);
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,631 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <barrier/ordering.hpp>
+#include <barrier/sparse_cholesky_cpu.hpp>
+
+#include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/vector_math.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+// Pivots smaller than this, relative to the largest diagonal entry, are replaced by a huge
+// value. This effectively removes the corresponding row and column from the system, which is
+// the standard treatment of (near) dependent rows in interior point normal equations.
+constexpr double cholesky_pivot_tolerance   = 1e-30;
+constexpr double cholesky_regularized_pivot = 1e128;
+
+// Below this number of rows the ordering is always AMD when settings.ordering is automatic
+constexpr int nested_dissection_min_size = 100000;
+constexpr int nested_dissection_leaf_size = 256;
+
+// Compute the elimination tree of the matrix whose lower triangle has row structure
+// (row_start, row_cols), where row_cols holds the columns c < r of row r
+template <typename i_t>
+void elimination_tree(i_t n,
+                      const std::vector<i_t>& row_start,
+                      const std::vector<i_t>& row_cols,
+                      std::vector<i_t>& parent)
+{
+  parent.assign(n, -1);
+  std::vector<i_t> ancestor(n, -1);
+  for (i_t k = 0; k < n; k++) {
+    for (i_t p = row_start[k]; p < row_start[k + 1]; p++) {
+      i_t i = row_cols[p];
+      while (i != -1 && i < k) {
+        const i_t next = ancestor[i];
+        ancestor[i]    = k;
+        if (next == -1) { parent[i] = k; }
+        i = next;
+      }
+    }
+  }
+}
+
+// Row structure of the lower triangle of P*A*P' (entries strictly below the diagonal)
+template <typename i_t, typename f_t>
+void permuted_lower_rows(const csc_matrix_t<i_t, f_t>& A_lower,
+                         const std::vector<i_t>& pinv,
+                         std::vector<i_t>& row_start,
+                         std::vector<i_t>& row_cols)
+{
+  const i_t n = A_lower.n;
+  row_start.assign(n + 1, 0);
+  for (i_t j = 0; j < n; j++) {
+    for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      const i_t i = A_lower.i[p];
+      if (i == j) { continue; }
+      row_start[std::max(pinv[i], pinv[j]) + 1]++;
+    }
+  }
+  for (i_t k = 0; k < n; k++) {
+    row_start[k + 1] += row_start[k];
+  }
+  row_cols.resize(row_start[n]);
+  std::vector<i_t> next(row_start.begin(), row_start.end() - 1);
+  for (i_t j = 0; j < n; j++) {
+    for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      const i_t i = A_lower.i[p];
+      if (i == j) { continue; }
+      const i_t r         = std::max(pinv[i], pinv[j]);
+      row_cols[next[r]++] = std::min(pinv[i], pinv[j]);
+    }
+  }
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+sparse_cholesky_cpu_t<i_t, f_t>::sparse_cholesky_cpu_t(
+  const simplex_solver_settings_t<i_t, f_t>& settings, i_t size)
+  : settings_(settings),
+    n_(size),
+    num_threads_(std::max(1, static_cast<int>(settings.num_threads))),
+    num_supernodes_(0),
+    num_regularized_pivots_(0),
+    nnz_L_(0),
+    input_nnz_(0),
+    max_diagonal_(0.0)
+{
+}
+
+template <typename i_t, typename f_t>
+i_t sparse_cholesky_cpu_t<i_t, f_t>::analyze(const csc_matrix_t<i_t, f_t>& A_lower)
+{
+  const f_t start_time = tic();
+  const i_t n          = n_;
+  input_nnz_           = A_lower.col_start[n];
+
+  // Symmetric adjacency structure without the diagonal
+  std::vector<i_t> adj_start(n + 1, 0);
+  for (i_t j = 0; j < n; j++) {
+    for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      const i_t i = A_lower.i[p];
+      if (i == j) { continue; }
+      adj_start[i + 1]++;
+      adj_start[j + 1]++;
+    }
+  }
+  for (i_t k = 0; k < n; k++) {
+    adj_start[k + 1] += adj_start[k];
+  }
+  std::vector<i_t> adj_index(adj_start[n]);
+  {
+    std::vector<i_t> next(adj_start.begin(), adj_start.end() - 1);
+    for (i_t j = 0; j < n; j++) {
+      for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+        const i_t i = A_lower.i[p];
+        if (i == j) { continue; }
+        adj_index[next[i]++] = j;
+        adj_index[next[j]++] = i;
+      }
+    }
+  }
+
+  // Fill-reducing ordering
+  const bool use_nested_dissection =
+    settings_.ordering == 0 ||
+    (settings_.ordering == -1 && n >= nested_dissection_min_size && num_threads_ > 1);
+  std::vector<i_t> perm;
+  if (use_nested_dissection) {
+    nested_dissection(n, adj_start, adj_index, static_cast<i_t>(nested_dissection_leaf_size), perm);
+  } else {
+    approximate_minimum_degree(n, adj_start, adj_index, perm);
+  }
+  std::vector<i_t>().swap(adj_index);
+  if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+    return CONCURRENT_HALT_RETURN;
+  }
+
+  // Postorder the elimination tree so that supernodes are contiguous and children precede
+  // their parents
+  std::vector<i_t> pinv(n);
+  std::vector<i_t> row_start;
+  std::vector<i_t> row_cols;
+  std::vector<i_t> parent;
+  inverse_permutation(perm, pinv);
+  permuted_lower_rows(A_lower, pinv, row_start, row_cols);
+  elimination_tree(n, row_start, row_cols, parent);
+  {
+    std::vector<i_t> child_head(n, -1);
+    std::vector<i_t> child_next(n, -1);
+    for (i_t j = n - 1; j >= 0; j--) {
+      if (parent[j] == -1) { continue; }
+      child_next[j]         = child_head[parent[j]];
+      child_head[parent[j]] = j;
+    }
+    std::vector<i_t> post;
+    post.reserve(n);
+    std::vector<i_t> stack;
+    for (i_t root = 0; root < n; root++) {
+      if (parent[root] != -1) { continue; }
+      stack.push_back(root);
+      while (!stack.empty()) {
+        const i_t j = stack.back();
+        if (child_head[j] != -1) {
+          const i_t child = child_head[j];
+          child_head[j]   = child_next[child];
+          stack.push_back(child);
+        } else {
+          post.push_back(j);
+          stack.pop_back();
+        }
+      }
+    }
+    perm_.resize(n);
+    for (i_t k = 0; k < n; k++) {
+      perm_[k] = perm[post[k]];
+    }
+  }
+  inverse_permutation(perm_, pinv);
+  permuted_lower_rows(A_lower, pinv, row_start, row_cols);
+  elimination_tree(n, row_start, row_cols, parent);
+
+  // Column counts of L from the row subtrees of the elimination tree
+  std::vector<i_t> col_count(n, 1);
+  {
+    std::vector<i_t> mark(n, -1);
+    for (i_t k = 0; k < n; k++) {
+      mark[k] = k;
+      for (i_t p = row_start[k]; p < row_start[k + 1]; p++) {
+        i_t i = row_cols[p];
+        while (i != -1 && mark[i] != k) {
+          col_count[i]++;
+          mark[i] = k;
+          i       = parent[i];
+        }
+      }
+    }
+  }
+
+  // Fundamental supernodes
+  std::vector<i_t> num_children(n, 0);
+  for (i_t j = 0; j < n; j++) {
+    if (parent[j] != -1) { num_children[parent[j]]++; }
+  }
+  super_start_.clear();
+  std::vector<i_t> col_to_super(n);
+  for (i_t j = 0; j < n; j++) {
+    const bool merge = j > 0 && parent[j - 1] == j && col_count[j - 1] == col_count[j] + 1 &&
+                       num_children[j] == 1;
+    if (!merge) { super_start_.push_back(j); }
+    col_to_super[j] = static_cast<i_t>(super_start_.size()) - 1;
+  }
+  num_supernodes_ = static_cast<i_t>(super_start_.size());
+  super_start_.push_back(n);
+
+  std::vector<i_t> super_parent(num_supernodes_, -1);
+  std::vector<i_t> super_child_head(num_supernodes_, -1);
+  std::vector<i_t> super_child_next(num_supernodes_, -1);
+  for (i_t s = num_supernodes_ - 1; s >= 0; s--) {
+    const i_t last = super_start_[s + 1] - 1;
+    if (parent[last] == -1) { continue; }
+    super_parent[s]                   = col_to_super[parent[last]];
+    super_child_next[s]               = super_child_head[super_parent[s]];
+    super_child_head[super_parent[s]] = s;
+  }
+
+  // Column structure of the strictly lower part of P*A*P'
+  std::vector<i_t> col_start(n + 1, 0);
+  for (i_t p = 0; p < row_start[n]; p++) {
+    col_start[row_cols[p] + 1]++;
+  }
+  for (i_t k = 0; k < n; k++) {
+    col_start[k + 1] += col_start[k];
+  }
+  std::vector<i_t> col_rows(row_start[n]);
+  {
+    std::vector<i_t> next(col_start.begin(), col_start.end() - 1);
+    for (i_t r = 0; r < n; r++) {
+      for (i_t p = row_start[r]; p < row_start[r + 1]; p++) {
+        col_rows[next[row_cols[p]]++] = r;
+      }
+    }
+  }
+
+  // Row structure of each supernode: its own columns, the entries of A below them, and the
+  // rows of its children below its last column
+  super_row_start_.assign(num_supernodes_ + 1, 0);
+  super_rows_.clear();
+  {
+    std::vector<i_t> mark(n, -1);
+    for (i_t s = 0; s < num_supernodes_; s++) {
+      const i_t first = super_start_[s];
+      const i_t last  = super_start_[s + 1];
+      for (i_t c = first; c < last; c++) {
+        super_rows_.push_back(c);
+        mark[c] = s;
+      }
+      const size_t extra_start = super_rows_.size();
+      for (i_t c = first; c < last; c++) {
+        for (i_t p = col_start[c]; p < col_start[c + 1]; p++) {
+          const i_t r = col_rows[p];
+          if (mark[r] != s) {
+            mark[r] = s;
+            super_rows_.push_back(r);
+          }
+        }
+      }
+      for (i_t t = super_child_head[s]; t != -1; t = super_child_next[t]) {
+        const i_t t_cols = super_start_[t + 1] - super_start_[t];
+        for (i_t p = super_row_start_[t] + t_cols; p < super_row_start_[t + 1]; p++) {
+          const i_t r = super_rows_[p];
+          if (mark[r] != s) {
+            mark[r] = s;
+            super_rows_.push_back(r);
+          }
+        }
+      }
+      std::sort(super_rows_.begin() + extra_start, super_rows_.end());
+      super_row_start_[s + 1] = static_cast<i_t>(super_rows_.size());
+    }
+  }
+
+  super_value_start_.assign(num_supernodes_ + 1, 0);
+  nnz_L_ = 0;
+  for (i_t s = 0; s < num_supernodes_; s++) {
+    const int64_t nr = super_row_start_[s + 1] - super_row_start_[s];
+    const int64_t ns = super_start_[s + 1] - super_start_[s];
+    super_value_start_[s + 1] = super_value_start_[s] + nr * ns;
+    nnz_L_ += nr * ns - ns * (ns - 1) / 2;
+  }
+  values_.assign(super_value_start_[num_supernodes_], 0.0);
+
+  // Map the entries of A to their position in the supernodal storage
+  value_map_.resize(input_nnz_);
+  {
+    std::vector<i_t> entry_start(num_supernodes_ + 1, 0);
+    for (i_t j = 0; j < n; j++) {
+      for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+        const i_t c = std::min(pinv[A_lower.i[p]], pinv[j]);
+        entry_start[col_to_super[c] + 1]++;
+      }
+    }
+    for (i_t s = 0; s < num_supernodes_; s++) {
+      entry_start[s + 1] += entry_start[s];
+    }
+    std::vector<i_t> entries(input_nnz_);
+    std::vector<i_t> next(entry_start.begin(), entry_start.end() - 1);
+    for (i_t j = 0; j < n; j++) {
+      for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+        const i_t c                         = std::min(pinv[A_lower.i[p]], pinv[j]);
+        entries[next[col_to_super[c]]++] = p;
+      }
+    }
+    std::vector<i_t> column_of(input_nnz_);
+    for (i_t j = 0; j < n; j++) {
+      for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+        column_of[p] = j;
+      }
+    }
+    std::vector<i_t> relative_row(n, -1);
+    for (i_t s = 0; s < num_supernodes_; s++) {
+      const i_t nr = super_row_start_[s + 1] - super_row_start_[s];
+      for (i_t k = 0; k < nr; k++) {
+        relative_row[super_rows_[super_row_start_[s] + k]] = k;
+      }
+      for (i_t q = entry_start[s]; q < entry_start[s + 1]; q++) {
+        const i_t p  = entries[q];
+        const i_t pi = pinv[A_lower.i[p]];
+        const i_t pj = pinv[column_of[p]];
+        const i_t r  = std::max(pi, pj);
+        const i_t c  = std::min(pi, pj);
+        value_map_[p] = super_value_start_[s] + static_cast<int64_t>(c - super_start_[s]) * nr +
+                        relative_row[r];
+      }
+    }
+  }
+
+  // Supernode d updates every supernode that owns one of its off-diagonal rows
+  update_start_.assign(num_supernodes_ + 1, 0);
+  for (i_t pass = 0; pass < 2; pass++) {
+    std::vector<i_t> next;
+    if (pass == 1) {
+      for (i_t s = 0; s < num_supernodes_; s++) {
+        update_start_[s + 1] += update_start_[s];
+      }
+      update_supernode_.resize(update_start_[num_supernodes_]);
+      update_row_.resize(update_start_[num_supernodes_]);
+      next.assign(update_start_.begin(), update_start_.end() - 1);
+    }
+    for (i_t d = 0; d < num_supernodes_; d++) {
+      const i_t ns = super_start_[d + 1] - super_start_[d];
+      const i_t nr = super_row_start_[d + 1] - super_row_start_[d];
+      const i_t* rows = super_rows_.data() + super_row_start_[d];
+      i_t k           = ns;
+      while (k < nr) {
+        const i_t t = col_to_super[rows[k]];
+        if (pass == 0) {
+          update_start_[t + 1]++;
+        } else {
+          update_supernode_[next[t]] = d;
+          update_row_[next[t]++]     = k;
+        }
+        while (k < nr && col_to_super[rows[k]] == t) {
+          k++;
+        }
+      }
+    }
+  }
+
+  // Level of each supernode in the supernodal elimination tree. A supernode only depends on
+  // its descendants, which all have a smaller level
+  std::vector<i_t> level(num_supernodes_, 0);
+  i_t num_levels = num_supernodes_ > 0 ? 1 : 0;
+  for (i_t s = 0; s < num_supernodes_; s++) {
+    if (super_parent[s] != -1) {
+      level[super_parent[s]] = std::max(level[super_parent[s]], level[s] + 1);
+      num_levels             = std::max(num_levels, level[super_parent[s]] + 1);
+    }
+  }
+  level_start_.assign(num_levels + 1, 0);
+  for (i_t s = 0; s < num_supernodes_; s++) {
+    level_start_[level[s] + 1]++;
+  }
+  for (i_t l = 0; l < num_levels; l++) {
+    level_start_[l + 1] += level_start_[l];
+  }
+  level_supernodes_.resize(num_supernodes_);
+  {
+    std::vector<i_t> next(level_start_.begin(), level_start_.end() - 1);
+    for (i_t s = 0; s < num_supernodes_; s++) {
+      level_supernodes_[next[level[s]]++] = s;
+    }
+  }
+
+  relative_row_.assign(num_threads_, std::vector<i_t>());
+  for (auto& relative_row : relative_row_) {
+    relative_row.assign(n, -1);
+  }
+
+  settings_.log.printf("CPU Cholesky ordering       : %s\n",
+                       use_nested_dissection ? "nested dissection" : "AMD");
+  settings_.log.printf("CPU Cholesky nonzeros in L  : %ld (%d supernodes, %d levels)\n",
+                       nnz_L_,
+                       num_supernodes_,
+                       num_levels);
+  settings_.log.printf("CPU Cholesky analysis time  : %.2fs\n", toc(start_time));
+  return 0;
+}
+
+template <typename i_t, typename f_t>
+void sparse_cholesky_cpu_t<i_t, f_t>::factor_supernode(i_t s,
+                                                       i_t num_threads,
+                                                       std::vector<i_t>& relative_row,
+                                                       i_t& regularized)
+{
+  const i_t first = super_start_[s];
+  const i_t ns    = super_start_[s + 1] - first;
+  const i_t nr    = super_row_start_[s + 1] - super_row_start_[s];
+  const i_t* rows = super_rows_.data() + super_row_start_[s];
+  f_t* Ls         = values_.data() + super_value_start_[s];
+  for (i_t k = 0; k < nr; k++) {
+    relative_row[rows[k]] = k;
+  }
+
+  // Apply the updates from descendant supernodes. Column jj of the update
+  //   L_d(p:end, :) * L_d(p + jj, :)'
+  // only touches column rows_d[p + jj] of this supernode, so columns are independent
+  auto apply_update_column = [&](i_t d, i_t p, i_t jj, std::vector<f_t>& work) {
+    const i_t nrd     = super_row_start_[d + 1] - super_row_start_[d];
+    const i_t ncd     = super_start_[d + 1] - super_start_[d];
+    const i_t* rows_d = super_rows_.data() + super_row_start_[d];
+    const f_t* Ld     = values_.data() + super_value_start_[d];
+    const i_t m2      = nrd - p;
+    work.assign(m2, 0.0);
+    for (i_t k = 0; k < ncd; k++) {
+      const f_t* col_k = Ld + static_cast<int64_t>(k) * nrd + p;
+      const f_t ljk    = col_k[jj];
+      if (ljk == 0.0) { continue; }
+      for (i_t ii = jj; ii < m2; ii++) {
+        work[ii] += col_k[ii] * ljk;
+      }
+    }
+    f_t* dest = Ls + static_cast<int64_t>(rows_d[p + jj] - first) * nr;
+    for (i_t ii = jj; ii < m2; ii++) {
+      dest[relative_row[rows_d[p + ii]]] -= work[ii];
+    }
+  };
+  auto update_width = [&](i_t d, i_t p) {
+    const i_t nrd     = super_row_start_[d + 1] - super_row_start_[d];
+    const i_t* rows_d = super_rows_.data() + super_row_start_[d];
+    i_t q             = 0;
+    while (p + q < nrd && rows_d[p + q] < first + ns) {
+      q++;
+    }
+    return q;
+  };
+
+  if (num_threads > 1) {
+#pragma omp parallel num_threads(num_threads)
+    {
+      std::vector<f_t> work;
+      for (i_t u = update_start_[s]; u < update_start_[s + 1]; u++) {
+        const i_t d = update_supernode_[u];
+        const i_t p = update_row_[u];
+        const i_t q = update_width(d, p);
+#pragma omp for schedule(dynamic, 4)
+        for (i_t jj = 0; jj < q; jj++) {
+          apply_update_column(d, p, jj, work);
+        }
+      }
+    }
+  } else {
+    std::vector<f_t> work;
+    for (i_t u = update_start_[s]; u < update_start_[s + 1]; u++) {
+      const i_t d = update_supernode_[u];
+      const i_t p = update_row_[u];
+      const i_t q = update_width(d, p);
+      for (i_t jj = 0; jj < q; jj++) {
+        apply_update_column(d, p, jj, work);
+      }
+    }
+  }
+
+  // Dense left-looking Cholesky of the diagonal block and solve for the rows below it
+  const f_t pivot_tolerance = cholesky_pivot_tolerance * max_diagonal_;
+  constexpr i_t row_block   = 256;
+  for (i_t j = 0; j < ns; j++) {
+    f_t* col_j           = Ls + static_cast<int64_t>(j) * nr;
+    const i_t num_blocks = (nr - j + row_block - 1) / row_block;
+    const bool parallel  = num_threads > 1 && num_blocks > 1 && j > 0;
+#pragma omp parallel for num_threads(num_threads) schedule(static) if (parallel)
+    for (i_t b = 0; b < num_blocks; b++) {
+      const i_t row_begin = j + b * row_block;
+      const i_t row_end   = std::min(nr, row_begin + row_block);
+      for (i_t k = 0; k < j; k++) {
+        const f_t* col_k = Ls + static_cast<int64_t>(k) * nr;
+        const f_t ljk    = col_k[j];
+        if (ljk == 0.0) { continue; }
+        for (i_t i = row_begin; i < row_end; i++) {
+          col_j[i] -= col_k[i] * ljk;
+        }
+      }
+    }
+    f_t pivot = col_j[j];
+    if (!(pivot > pivot_tolerance)) {
+      pivot = cholesky_regularized_pivot;
+      regularized++;
+    }
+    const f_t ljj = std::sqrt(pivot);
+    col_j[j]      = ljj;
+    for (i_t i = j + 1; i < nr; i++) {
+      col_j[i] /= ljj;
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+i_t sparse_cholesky_cpu_t<i_t, f_t>::factorize(const csc_matrix_t<i_t, f_t>& A_lower)
+{
+  const i_t n = n_;
+  if (A_lower.n != n || A_lower.col_start[n] != input_nnz_) {
+    settings_.log.printf("CPU Cholesky: matrix pattern does not match the symbolic analysis\n");
+    return -1;
+  }
+
+  std::fill(values_.begin(), values_.end(), 0.0);
+  max_diagonal_ = 0.0;
+  for (i_t j = 0; j < n; j++) {
+    for (i_t p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      values_[value_map_[p]] += A_lower.x[p];
+      if (A_lower.i[p] == j) { max_diagonal_ = std::max(max_diagonal_, std::abs(A_lower.x[p])); }
+    }
+  }
+
+  i_t regularized       = 0;
+  const i_t num_levels  = static_cast<i_t>(level_start_.size()) - 1;
+  for (i_t l = 0; l < num_levels; l++) {
+    const i_t level_begin = level_start_[l];
+    const i_t level_size  = level_start_[l + 1] - level_begin;
+    if (level_size >= num_threads_ || num_threads_ == 1) {
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 1) reduction(+ : regularized)
+      for (i_t k = 0; k < level_size; k++) {
+        factor_supernode(level_supernodes_[level_begin + k],
+                         1,
+                         relative_row_[omp_get_thread_num()],
+                         regularized);
+      }
+    } else {
+      // Few but large supernodes near the root: parallelize inside each supernode instead
+      for (i_t k = 0; k < level_size; k++) {
+        factor_supernode(
+          level_supernodes_[level_begin + k], num_threads_, relative_row_[0], regularized);
+      }
+    }
+    if (settings_.concurrent_halt != nullptr && *settings_.concurrent_halt == 1) {
+      return CONCURRENT_HALT_RETURN;
+    }
+  }
+  num_regularized_pivots_ = regularized;
+  return 0;
+}
+
+template <typename i_t, typename f_t>
+i_t sparse_cholesky_cpu_t<i_t, f_t>::solve(const dense_vector_t<i_t, f_t>& b,
+                                           dense_vector_t<i_t, f_t>& x) const
+{
+  const i_t n = n_;
+  std::vector<f_t> y(n);
+  for (i_t k = 0; k < n; k++) {
+    y[k] = b[perm_[k]];
+  }
+
+  // Solve L * y = P * b
+  for (i_t s = 0; s < num_supernodes_; s++) {
+    const i_t first = super_start_[s];
+    const i_t ns    = super_start_[s + 1] - first;
+    const i_t nr    = super_row_start_[s + 1] - super_row_start_[s];
+    const i_t* rows = super_rows_.data() + super_row_start_[s];
+    const f_t* Ls   = values_.data() + super_value_start_[s];
+    for (i_t j = 0; j < ns; j++) {
+      const f_t* col_j = Ls + static_cast<int64_t>(j) * nr;
+      const f_t yj     = y[first + j] / col_j[j];
+      y[first + j]     = yj;
+      if (yj == 0.0) { continue; }
+      for (i_t i = j + 1; i < nr; i++) {
+        y[rows[i]] -= col_j[i] * yj;
+      }
+    }
+  }
+
+  // Solve L' * y = y
+  for (i_t s = num_supernodes_ - 1; s >= 0; s--) {
+    const i_t first = super_start_[s];
+    const i_t ns    = super_start_[s + 1] - first;
+    const i_t nr    = super_row_start_[s + 1] - super_row_start_[s];
+    const i_t* rows = super_rows_.data() + super_row_start_[s];
+    const f_t* Ls   = values_.data() + super_value_start_[s];
+    for (i_t j = ns - 1; j >= 0; j--) {
+      const f_t* col_j = Ls + static_cast<int64_t>(j) * nr;
+      f_t sum          = y[first + j];
+      for (i_t i = j + 1; i < nr; i++) {
+        sum -= col_j[i] * y[rows[i]];
+      }
+      y[first + j] = sum / col_j[j];
+    }
+  }
+
+  for (i_t k = 0; k < n; k++) {
+    x[perm_[k]] = y[k];
+  }
+  return 0;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class sparse_cholesky_cpu_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
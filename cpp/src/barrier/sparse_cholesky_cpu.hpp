@@ -0,0 +1,83 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+#pragma once
+
+#include <barrier/dense_vector.hpp>
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Multithreaded supernodal Cholesky factorization P*A*P' = L*L' of a symmetric positive
+// (semi)definite matrix on the CPU.
+//
+// analyze() computes the fill-reducing ordering (AMD or nested dissection, selected by
+// settings.ordering), the postordered elimination tree, the fundamental supernodes and the
+// structure of L once. Every subsequent call to factorize() must pass a matrix with exactly the
+// same sparsity pattern and only performs the numerical factorization. Supernodes are factored
+// left-looking, level by level in the supernodal elimination tree, with independent subtrees
+// processed in parallel.
+//
+// Matrices are passed as the lower triangle (row >= col, including the diagonal) in CSC format.
+template <typename i_t, typename f_t>
+class sparse_cholesky_cpu_t {
+ public:
+  sparse_cholesky_cpu_t(const simplex_solver_settings_t<i_t, f_t>& settings, i_t size);
+
+  i_t analyze(const csc_matrix_t<i_t, f_t>& A_lower);
+  i_t factorize(const csc_matrix_t<i_t, f_t>& A_lower);
+  i_t solve(const dense_vector_t<i_t, f_t>& b, dense_vector_t<i_t, f_t>& x) const;
+
+  int64_t nnz_L() const { return nnz_L_; }
+  i_t num_supernodes() const { return num_supernodes_; }
+  // Number of pivots that were too small and were replaced during the last factorization
+  i_t num_regularized_pivots() const { return num_regularized_pivots_; }
+
+ private:
+  void factor_supernode(i_t s, i_t num_threads, std::vector<i_t>& relative_row, i_t& regularized);
+
+  const simplex_solver_settings_t<i_t, f_t>& settings_;
+  i_t n_;
+  i_t num_threads_;
+  i_t num_supernodes_;
+  i_t num_regularized_pivots_;
+  int64_t nnz_L_;
+
+  std::vector<i_t> perm_;  // perm_[k] = original index of the k-th pivot
+
+  // Supernode s holds columns [super_start_[s], super_start_[s + 1]) of L. Its row structure
+  // is super_rows_[super_row_start_[s], super_row_start_[s + 1]) in increasing order, starting
+  // with its own columns. Its values are a dense column-major block at super_value_start_[s].
+  std::vector<i_t> super_start_;
+  std::vector<i_t> super_row_start_;
+  std::vector<i_t> super_rows_;
+  std::vector<int64_t> super_value_start_;
+  std::vector<f_t> values_;
+
+  // Supernode d updates supernode s starting at local row update_row_[k], for k in
+  // [update_start_[s], update_start_[s + 1]) and d = update_supernode_[k]
+  std::vector<i_t> update_start_;
+  std::vector<i_t> update_supernode_;
+  std::vector<i_t> update_row_;
+
+  // Supernodes grouped by their level in the supernodal elimination tree
+  std::vector<i_t> level_start_;
+  std::vector<i_t> level_supernodes_;
+
+  // value_map_[p] is the position in values_ of the p-th entry of A_lower
+  std::vector<int64_t> value_map_;
+  i_t input_nnz_;
+  f_t max_diagonal_;
+
+  std::vector<std::vector<i_t>> relative_row_;  // Per thread workspace of size n
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
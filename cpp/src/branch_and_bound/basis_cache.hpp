@@ -0,0 +1,147 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/basis_updates.hpp>
+#include <dual_simplex/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Least recently used bases of the node LPs of a B&B worker.
+//
+// A node starts from the optimal basis of its parent. When the worker moves on to a node whose
+// parent is not the last node it solved, e.g. the sibling of a pruned node or a node above in a
+// dive, its factorization belongs to another basis and would be recomputed from scratch. The
+// cache remembers the bases of the last nodes that branched, so the worker can resume from them
+// instead.
+//
+// The factorization of the worker is not copied. An entry only records the position of its basis
+// in the update history of the factorization (see `basis_update_mpf_t::history_id`), and a hit
+// rolls the factorization back to it. The entries are invalidated when the worker refactorizes.
+//
+// The entries are keyed by a fingerprint of the set of basic columns, which does not depend on
+// the order of the basic list. A hit is checked against the basic list of the entry.
+template <typename i_t, typename f_t>
+class basis_cache_t {
+ public:
+  explicit basis_cache_t(i_t capacity) : capacity_(capacity) {}
+
+  // Rolls `factors` back to the basis given by `vstatus` and restores its `basic_list` and
+  // `nonbasic_list`. Returns false if it is not in the cache.
+  bool find(const std::vector<variable_status_t>& vstatus,
+            basis_update_mpf_t<i_t, f_t>& factors,
+            std::vector<i_t>& basic_list,
+            std::vector<i_t>& nonbasic_list)
+  {
+    remove_stale(factors);
+    if (entries_.empty()) { return false; }
+    uint64_t fingerprint = 0;
+    i_t num_basic        = 0;
+    for (size_t j = 0; j < vstatus.size(); ++j) {
+      if (vstatus[j] == variable_status_t::BASIC) {
+        fingerprint += mix(j);
+        ++num_basic;
+      }
+    }
+    for (size_t k = 0; k < entries_.size(); ++k) {
+      const entry_t& entry = entries_[k];
+      if (entry.fingerprint != fingerprint ||
+          static_cast<i_t>(entry.basic_list.size()) != num_basic ||
+          !std::all_of(entry.basic_list.begin(), entry.basic_list.end(), [&](i_t j) {
+            return vstatus[j] == variable_status_t::BASIC;
+          })) {
+        continue;
+      }
+      factors.rollback(entry.num_updates);
+      basic_list    = entry.basic_list;
+      nonbasic_list = entry.nonbasic_list;
+      std::rotate(entries_.begin(), entries_.begin() + k, entries_.begin() + k + 1);
+      // The updates after this basis are gone, and so are the bases that needed them
+      remove_stale(factors);
+      return true;
+    }
+    return false;
+  }
+
+  // Records the current basis of `factors`, evicting the least recently used one if the cache is
+  // full
+  void insert(const basis_update_mpf_t<i_t, f_t>& factors,
+              const std::vector<i_t>& basic_list,
+              const std::vector<i_t>& nonbasic_list)
+  {
+    if (capacity_ <= 0) { return; }
+    remove_stale(factors);
+    uint64_t fingerprint = 0;
+    for (i_t j : basic_list) {
+      fingerprint += mix(j);
+    }
+    // Replace the entry of the same basis if there is one, otherwise the oldest one. The storage
+    // of the entries is reused.
+    size_t k = 0;
+    while (k < entries_.size() && entries_[k].fingerprint != fingerprint) {
+      ++k;
+    }
+    if (k == entries_.size() && entries_.size() < static_cast<size_t>(capacity_)) {
+      entries_.push_back({fingerprint, factors.num_updates(), basic_list, nonbasic_list});
+    } else {
+      k                         = std::min(k, entries_.size() - 1);
+      entries_[k].fingerprint   = fingerprint;
+      entries_[k].num_updates   = factors.num_updates();
+      entries_[k].basic_list    = basic_list;
+      entries_[k].nonbasic_list = nonbasic_list;
+    }
+    std::rotate(entries_.begin(), entries_.begin() + k, entries_.begin() + k + 1);
+  }
+
+  void clear() { entries_.clear(); }
+  i_t size() const { return entries_.size(); }
+
+ private:
+  struct entry_t {
+    uint64_t fingerprint;
+    i_t num_updates;
+    std::vector<i_t> basic_list;
+    std::vector<i_t> nonbasic_list;
+  };
+
+  // Drops the entries that `factors` can no longer roll back to: all of them if it was
+  // refactorized, and those past its last update otherwise
+  void remove_stale(const basis_update_mpf_t<i_t, f_t>& factors)
+  {
+    if (factors.history_id() != history_id_) {
+      entries_.clear();
+      history_id_ = factors.history_id();
+      return;
+    }
+    entries_.erase(std::remove_if(entries_.begin(),
+                                  entries_.end(),
+                                  [&](const entry_t& entry) {
+                                    return entry.num_updates > factors.num_updates();
+                                  }),
+                   entries_.end());
+  }
+
+  // SplitMix64 finalizer, so that the sum over the basic columns identifies the set
+  static uint64_t mix(uint64_t j)
+  {
+    j += 0x9e3779b97f4a7c15ull;
+    j = (j ^ (j >> 30)) * 0xbf58476d1ce4e5b9ull;
+    j = (j ^ (j >> 27)) * 0x94d049bb133111ebull;
+    return j ^ (j >> 31);
+  }
+
+  const i_t capacity_;
+  uint64_t history_id_{0};        // history of the factorization the entries belong to
+  std::vector<entry_t> entries_;  // most recently used first
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,607 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_checkpoint.hpp>
+
+#include <branch_and_bound/node_spill.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+#include <unistd.h>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+constexpr char bb_checkpoint_magic[8] = {'C', 'U', 'O', 'P', 'T', 'B', 'B', 'C'};
+constexpr uint32_t bb_checkpoint_version = 2;
+
+// FNV-1a, 64 bits
+class fnv_hash_t {
+ public:
+  void add(const void* data, size_t size)
+  {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t k = 0; k < size; ++k) {
+      hash_ ^= bytes[k];
+      hash_ *= 1099511628211ull;
+    }
+  }
+
+  template <typename T>
+  void add(const std::vector<T>& values)
+  {
+    add(values.data(), values.size() * sizeof(T));
+  }
+
+  uint64_t value() const { return hash_; }
+
+ private:
+  uint64_t hash_{14695981039346656037ull};
+};
+
+// Values are written in the native byte order, vectors are preceded by their size
+class byte_writer_t {
+ public:
+  explicit byte_writer_t(std::vector<uint8_t>& bytes) : bytes_(bytes) {}
+
+  template <typename T>
+  void put(const T& value)
+  {
+    append(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void put(const std::vector<T>& values)
+  {
+    put<uint64_t>(values.size());
+    append(values.data(), values.size() * sizeof(T));
+  }
+
+ private:
+  void append(const void* data, size_t size)
+  {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    bytes_.insert(bytes_.end(), bytes, bytes + size);
+  }
+
+  std::vector<uint8_t>& bytes_;
+};
+
+// Stops at the first value that runs past the end of the data, see ok()
+class byte_reader_t {
+ public:
+  byte_reader_t(const uint8_t* data, size_t size) : data_(data), end_(data + size) {}
+
+  template <typename T>
+  void get(T& value)
+  {
+    if (!ok_ || static_cast<size_t>(end_ - data_) < sizeof(T)) {
+      ok_ = false;
+      return;
+    }
+    std::memcpy(&value, data_, sizeof(T));
+    data_ += sizeof(T);
+  }
+
+  template <typename T>
+  void get(std::vector<T>& values)
+  {
+    uint64_t size = 0;
+    get(size);
+    if (!ok_ || size > static_cast<size_t>(end_ - data_) / sizeof(T)) {
+      ok_ = false;
+      return;
+    }
+    values.resize(size);
+    std::memcpy(values.data(), data_, size * sizeof(T));
+    data_ += size * sizeof(T);
+  }
+
+  bool ok() const { return ok_; }
+  bool at_end() const { return data_ == end_; }
+
+ private:
+  const uint8_t* data_;
+  const uint8_t* end_;
+  bool ok_{true};
+};
+
+template <typename i_t, typename f_t>
+void put_workers(byte_writer_t& out, const std::vector<bb_checkpoint_worker_t<i_t, f_t>>& workers)
+{
+  out.put<uint64_t>(workers.size());
+  for (const auto& worker : workers) {
+    out.put(worker.plunge_stack);
+    out.put(worker.backlog);
+    out.put(worker.clock);
+    out.put(worker.work_units);
+    out.put(worker.next_creation_seq);
+    out.put(worker.event_sequence);
+    out.put(worker.next_solution_seq);
+    out.put(worker.local_lower_bound_ceiling);
+  }
+}
+
+template <typename i_t, typename f_t>
+void get_workers(byte_reader_t& in, std::vector<bb_checkpoint_worker_t<i_t, f_t>>& workers)
+{
+  uint64_t num_workers = 0;
+  in.get(num_workers);
+  workers.clear();
+  for (uint64_t k = 0; k < num_workers && in.ok(); ++k) {
+    bb_checkpoint_worker_t<i_t, f_t> worker{};
+    in.get(worker.plunge_stack);
+    in.get(worker.backlog);
+    in.get(worker.clock);
+    in.get(worker.work_units);
+    in.get(worker.next_creation_seq);
+    in.get(worker.event_sequence);
+    in.get(worker.next_solution_seq);
+    in.get(worker.local_lower_bound_ceiling);
+    workers.push_back(std::move(worker));
+  }
+}
+
+template <typename i_t, typename f_t>
+void serialize(const bb_checkpoint_t<i_t, f_t>& checkpoint, std::vector<uint8_t>& bytes)
+{
+  byte_writer_t out(bytes);
+  for (char c : bb_checkpoint_magic) {
+    out.put(c);
+  }
+  out.put(bb_checkpoint_version);
+  out.put(static_cast<uint8_t>(sizeof(i_t)));
+  out.put(static_cast<uint8_t>(sizeof(f_t)));
+
+  out.put(checkpoint.problem_hash);
+  out.put(checkpoint.num_original_cols);
+  out.put(checkpoint.lp_hash);
+  out.put(checkpoint.root_vstatus);
+  out.put(checkpoint.incumbent);
+  out.put(checkpoint.pseudo_cost_sum_down);
+  out.put(checkpoint.pseudo_cost_sum_up);
+  out.put(checkpoint.pseudo_cost_num_down);
+  out.put(checkpoint.pseudo_cost_num_up);
+  out.put(checkpoint.cuts.m);
+  out.put(checkpoint.cuts.n);
+  out.put(checkpoint.cuts.row_start);
+  out.put(checkpoint.cuts.j);
+  out.put(checkpoint.cuts.x);
+  out.put(checkpoint.cut_rhs);
+  out.put(checkpoint.cut_types);
+
+  out.put<uint64_t>(checkpoint.nodes.size());
+  for (const auto& node : checkpoint.nodes) {
+    out.put(node.parent);
+    out.put(node.branch_var);
+    out.put(node.branch_dir);
+    out.put(node.branch_var_lower);
+    out.put(node.branch_var_upper);
+    out.put(node.fractional_val);
+    out.put(node.lower_bound);
+    out.put(node.objective_estimate);
+    out.put(node.integer_infeasible);
+    out.put(static_cast<uint8_t>(node.is_open));
+    out.put(static_cast<uint8_t>(node.has_basis));
+    out.put(node.basis);
+    out.put(node.origin_worker_id);
+    out.put(node.creation_seq);
+  }
+  out.put(checkpoint.nodes_explored);
+
+  put_workers(out, checkpoint.bfs_workers);
+  put_workers(out, checkpoint.diving_workers);
+  out.put(checkpoint.num_syncs);
+  out.put(checkpoint.horizon);
+  out.put(checkpoint.next_horizon);
+  out.put(checkpoint.upper_bound);
+  out.put(checkpoint.crushed_incumbent);
+  out.put(checkpoint.lower_bound_ceiling);
+  out.put(checkpoint.total_lp_iters);
+
+  fnv_hash_t checksum;
+  checksum.add(bytes);
+  out.put(checksum.value());
+}
+
+template <typename i_t, typename f_t>
+bool deserialize(const std::vector<uint8_t>& bytes, bb_checkpoint_t<i_t, f_t>& checkpoint)
+{
+  if (bytes.size() < sizeof(uint64_t)) { return false; }
+  const size_t size = bytes.size() - sizeof(uint64_t);
+  fnv_hash_t checksum;
+  checksum.add(bytes.data(), size);
+  uint64_t saved_checksum;
+  std::memcpy(&saved_checksum, bytes.data() + size, sizeof(uint64_t));
+  if (checksum.value() != saved_checksum) { return false; }
+
+  byte_reader_t in(bytes.data(), size);
+  char magic[8]{};
+  for (char& c : magic) {
+    in.get(c);
+  }
+  uint32_t version     = 0;
+  uint8_t index_size   = 0;
+  uint8_t element_size = 0;
+  in.get(version);
+  in.get(index_size);
+  in.get(element_size);
+  if (!in.ok() || std::memcmp(magic, bb_checkpoint_magic, sizeof(magic)) != 0 ||
+      version != bb_checkpoint_version || index_size != sizeof(i_t) ||
+      element_size != sizeof(f_t)) {
+    return false;
+  }
+
+  in.get(checkpoint.problem_hash);
+  in.get(checkpoint.num_original_cols);
+  in.get(checkpoint.lp_hash);
+  in.get(checkpoint.root_vstatus);
+  in.get(checkpoint.incumbent);
+  in.get(checkpoint.pseudo_cost_sum_down);
+  in.get(checkpoint.pseudo_cost_sum_up);
+  in.get(checkpoint.pseudo_cost_num_down);
+  in.get(checkpoint.pseudo_cost_num_up);
+  in.get(checkpoint.cuts.m);
+  in.get(checkpoint.cuts.n);
+  in.get(checkpoint.cuts.row_start);
+  in.get(checkpoint.cuts.j);
+  in.get(checkpoint.cuts.x);
+  in.get(checkpoint.cut_rhs);
+  in.get(checkpoint.cut_types);
+  checkpoint.cuts.nz_max = checkpoint.cuts.j.size();
+
+  uint64_t num_nodes = 0;
+  in.get(num_nodes);
+  checkpoint.nodes.clear();
+  for (uint64_t k = 0; k < num_nodes && in.ok(); ++k) {
+    bb_checkpoint_node_t<i_t, f_t> node{};
+    uint8_t is_open   = 0;
+    uint8_t has_basis = 0;
+    in.get(node.parent);
+    in.get(node.branch_var);
+    in.get(node.branch_dir);
+    in.get(node.branch_var_lower);
+    in.get(node.branch_var_upper);
+    in.get(node.fractional_val);
+    in.get(node.lower_bound);
+    in.get(node.objective_estimate);
+    in.get(node.integer_infeasible);
+    in.get(is_open);
+    in.get(has_basis);
+    in.get(node.basis);
+    in.get(node.origin_worker_id);
+    in.get(node.creation_seq);
+    node.is_open   = is_open != 0;
+    node.has_basis = has_basis != 0;
+    checkpoint.nodes.push_back(std::move(node));
+  }
+  in.get(checkpoint.nodes_explored);
+
+  get_workers(in, checkpoint.bfs_workers);
+  get_workers(in, checkpoint.diving_workers);
+  in.get(checkpoint.num_syncs);
+  in.get(checkpoint.horizon);
+  in.get(checkpoint.next_horizon);
+  in.get(checkpoint.upper_bound);
+  in.get(checkpoint.crushed_incumbent);
+  in.get(checkpoint.lower_bound_ceiling);
+  in.get(checkpoint.total_lp_iters);
+  if (!in.ok() || !in.at_end()) { return false; }
+
+  // The checksum catches the truncated and damaged files, these checks the files written by a
+  // different version of the solver
+  const i_t n = checkpoint.num_original_cols;
+  if (checkpoint.pseudo_cost_sum_down.size() != static_cast<size_t>(n) ||
+      checkpoint.pseudo_cost_sum_up.size() != static_cast<size_t>(n) ||
+      checkpoint.pseudo_cost_num_down.size() != static_cast<size_t>(n) ||
+      checkpoint.pseudo_cost_num_up.size() != static_cast<size_t>(n)) {
+    return false;
+  }
+  const auto& cuts = checkpoint.cuts;
+  if (cuts.n != n || cuts.row_start.size() != static_cast<size_t>(cuts.m) + 1 ||
+      cuts.x.size() != cuts.j.size() || checkpoint.cut_rhs.size() != static_cast<size_t>(cuts.m) ||
+      checkpoint.cut_types.size() != static_cast<size_t>(cuts.m) || cuts.row_start[0] != 0 ||
+      cuts.row_start[cuts.m] != static_cast<i_t>(cuts.j.size())) {
+    return false;
+  }
+  for (i_t i = 0; i < cuts.m; ++i) {
+    if (cuts.row_start[i] > cuts.row_start[i + 1]) { return false; }
+  }
+  for (i_t j : cuts.j) {
+    if (j < 0 || j >= n) { return false; }
+  }
+  for (size_t k = 0; k < checkpoint.nodes.size(); ++k) {
+    const auto& node = checkpoint.nodes[k];
+    if (node.parent < -1 || node.parent >= static_cast<i_t>(k) || node.branch_var < 0 ||
+        node.branch_var >= n ||
+        (node.branch_dir != rounding_direction_t::DOWN &&
+         node.branch_dir != rounding_direction_t::UP)) {
+      return false;
+    }
+  }
+  for (const auto& worker : checkpoint.bfs_workers) {
+    for (const auto* queue : {&worker.plunge_stack, &worker.backlog}) {
+      for (i_t k : *queue) {
+        if (k < 0 || k >= static_cast<i_t>(checkpoint.nodes.size()) ||
+            !checkpoint.nodes[k].is_open) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+std::vector<const mip_node_t<i_t, f_t>*> bb_checkpoint_t<i_t, f_t>::save_tree(
+  const search_tree_t<i_t, f_t>& tree)
+{
+  nodes.clear();
+  std::vector<const mip_node_t<i_t, f_t>*> saved_nodes;
+
+  // Preorder of the pending nodes and of the nodes with children, the down child first
+  std::vector<std::pair<const mip_node_t<i_t, f_t>*, i_t>> stack;
+  for (int child = 1; child >= 0; --child) {
+    if (tree.root.children[child] != nullptr) {
+      stack.push_back({tree.root.children[child].get(), -1});
+    }
+  }
+  while (!stack.empty()) {
+    const auto [node, parent] = stack.back();
+    stack.pop_back();
+    const bool has_children = node->children[0] != nullptr || node->children[1] != nullptr;
+    if (inactive_status(node->status) ||
+        (!has_children && node->status != node_status_t::PENDING)) {
+      continue;
+    }
+
+    bb_checkpoint_node_t<i_t, f_t> saved{};
+    saved.parent             = parent;
+    saved.branch_var         = node->branch_var;
+    saved.branch_dir         = node->branch_dir;
+    saved.branch_var_lower   = node->branch_var_lower;
+    saved.branch_var_upper   = node->branch_var_upper;
+    saved.fractional_val     = node->fractional_val;
+    saved.lower_bound        = node->lower_bound;
+    saved.objective_estimate = node->objective_estimate;
+    saved.integer_infeasible = node->integer_infeasible;
+    saved.origin_worker_id   = node->origin_worker_id;
+    saved.creation_seq       = node->creation_seq;
+    saved.is_open            = !has_children;
+    saved.has_basis          = false;
+    if (saved.is_open) {
+      // The basis of a spilled node is on disk, it starts from the root basis after a resume
+      if (node->vstatus.size() == root_vstatus.size()) {
+        encode_basis(root_vstatus, node->vstatus, saved.basis);
+        saved.has_basis = true;
+      }
+    }
+    const i_t index = nodes.size();
+    nodes.push_back(std::move(saved));
+    saved_nodes.push_back(node);
+    for (int child = 1; child >= 0; --child) {
+      if (node->children[child] != nullptr) {
+        stack.push_back({node->children[child].get(), index});
+      }
+    }
+  }
+
+  // Drop the nodes whose subtree has no pending node left. The children come after their parent.
+  std::vector<bool> keep(nodes.size(), false);
+  for (i_t k = static_cast<i_t>(nodes.size()) - 1; k >= 0; --k) {
+    keep[k] = keep[k] || nodes[k].is_open;
+    if (keep[k] && nodes[k].parent >= 0) { keep[nodes[k].parent] = true; }
+  }
+  std::vector<i_t> new_index(nodes.size(), -1);
+  i_t num_kept = 0;
+  for (size_t k = 0; k < nodes.size(); ++k) {
+    if (!keep[k]) { continue; }
+    new_index[k] = num_kept;
+    if (nodes[k].parent >= 0) { nodes[k].parent = new_index[nodes[k].parent]; }
+    if (static_cast<size_t>(num_kept) != k) {
+      nodes[num_kept]       = std::move(nodes[k]);
+      saved_nodes[num_kept] = saved_nodes[k];
+    }
+    ++num_kept;
+  }
+  nodes.resize(num_kept);
+  saved_nodes.resize(num_kept);
+  return saved_nodes;
+}
+
+template <typename i_t, typename f_t>
+std::vector<mip_node_t<i_t, f_t>*> bb_checkpoint_t<i_t, f_t>::restore_tree(
+  search_tree_t<i_t, f_t>& tree, bool keep_bases) const
+{
+  const std::vector<variable_status_t> root_basis = std::move(tree.root.vstatus);
+  tree.root.vstatus.clear();
+
+  std::vector<mip_node_t<i_t, f_t>*> built(nodes.size(), nullptr);
+  for (size_t k = 0; k < nodes.size(); ++k) {
+    const auto& saved            = nodes[k];
+    mip_node_t<i_t, f_t>* parent = saved.parent >= 0 ? built[saved.parent] : &tree.root;
+    const int child              = saved.branch_dir == rounding_direction_t::UP ? 1 : 0;
+    if (parent == nullptr || parent->children[child] != nullptr) { continue; }
+
+    auto node                = std::make_unique<mip_node_t<i_t, f_t>>();
+    node->status             = saved.is_open ? node_status_t::PENDING : node_status_t::HAS_CHILDREN;
+    node->lower_bound        = saved.lower_bound;
+    node->objective_estimate = saved.objective_estimate;
+    node->depth              = parent->depth + 1;
+    node->node_id            = tree.num_nodes.fetch_add(1) + 1;
+    node->branch_var         = saved.branch_var;
+    node->branch_dir         = saved.branch_dir;
+    node->branch_var_lower   = saved.branch_var_lower;
+    node->branch_var_upper   = saved.branch_var_upper;
+    node->fractional_val     = saved.fractional_val;
+    node->integer_infeasible = saved.integer_infeasible;
+    node->origin_worker_id   = saved.origin_worker_id;
+    node->creation_seq       = saved.creation_seq;
+    node->parent             = parent;
+    if (saved.is_open) {
+      bool restored = false;
+      if (keep_bases && saved.has_basis) {
+        node->vstatus = root_vstatus;
+        restored      = decode_basis(saved.basis.data(), saved.basis.size(), node->vstatus);
+      }
+      if (!restored) { node->vstatus = root_basis; }
+    }
+    built[k]                = node.get();
+    parent->children[child] = std::move(node);
+  }
+  return built;
+}
+
+template <typename i_t, typename f_t>
+i_t bb_checkpoint_t<i_t, f_t>::num_open_nodes() const
+{
+  i_t num_open = 0;
+  for (const auto& node : nodes) {
+    num_open += node.is_open;
+  }
+  return num_open;
+}
+
+template <typename i_t, typename f_t>
+uint64_t hash_lp(const lp_problem_t<i_t, f_t>& lp,
+                 const std::vector<variable_type_t>& var_types,
+                 bool with_bounds)
+{
+  fnv_hash_t hash;
+  hash.add(&lp.num_rows, sizeof(i_t));
+  hash.add(&lp.num_cols, sizeof(i_t));
+  hash.add(lp.A.col_start);
+  hash.add(lp.A.i);
+  hash.add(lp.A.x);
+  hash.add(lp.objective);
+  hash.add(lp.rhs);
+  hash.add(var_types);
+  if (with_bounds) {
+    hash.add(lp.lower);
+    hash.add(lp.upper);
+  }
+  return hash.value();
+}
+
+template <typename i_t, typename f_t>
+int64_t write_bb_checkpoint(const std::string& path, const bb_checkpoint_t<i_t, f_t>& checkpoint)
+{
+  std::vector<uint8_t> bytes;
+  serialize(checkpoint, bytes);
+
+  const std::string temporary_path = path + ".tmp";
+  std::FILE* file                  = std::fopen(temporary_path.c_str(), "wb");
+  if (file == nullptr) { return -1; }
+  bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() &&
+            std::fflush(file) == 0 && fsync(fileno(file)) == 0;
+  ok      = std::fclose(file) == 0 && ok;
+  if (!ok || std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+    std::remove(temporary_path.c_str());
+    return -1;
+  }
+  return bytes.size();
+}
+
+template <typename i_t, typename f_t>
+bool read_bb_checkpoint(const std::string& path, bb_checkpoint_t<i_t, f_t>& checkpoint)
+{
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) { return false; }
+  std::vector<uint8_t> bytes;
+  uint8_t buffer[1 << 16];
+  size_t num_read;
+  while ((num_read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    bytes.insert(bytes.end(), buffer, buffer + num_read);
+  }
+  const bool read_error = std::ferror(file) != 0;
+  std::fclose(file);
+  return !read_error && deserialize(bytes, checkpoint);
+}
+
+template <typename i_t, typename f_t>
+bb_checkpoint_writer_t<i_t, f_t>::bb_checkpoint_writer_t(const std::string& path) : path_(path)
+{
+  thread_ = std::thread([this]() { run(); });
+}
+
+template <typename i_t, typename f_t>
+bb_checkpoint_writer_t<i_t, f_t>::~bb_checkpoint_writer_t()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+template <typename i_t, typename f_t>
+void bb_checkpoint_writer_t<i_t, f_t>::write(std::unique_ptr<bb_checkpoint_t<i_t, f_t>> checkpoint)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_ = std::move(checkpoint);
+  }
+  condition_.notify_all();
+}
+
+template <typename i_t, typename f_t>
+void bb_checkpoint_writer_t<i_t, f_t>::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this]() { return queued_ == nullptr && !writing_; });
+}
+
+template <typename i_t, typename f_t>
+bool bb_checkpoint_writer_t<i_t, f_t>::busy()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queued_ != nullptr || writing_;
+}
+
+template <typename i_t, typename f_t>
+void bb_checkpoint_writer_t<i_t, f_t>::run()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this]() { return stop_ || queued_ != nullptr; });
+    // The queued checkpoint is still written when stopping
+    if (queued_ == nullptr) { break; }
+    std::unique_ptr<bb_checkpoint_t<i_t, f_t>> checkpoint = std::move(queued_);
+    writing_                                               = true;
+    lock.unlock();
+    const int64_t size = write_bb_checkpoint(path_, *checkpoint);
+    checkpoint.reset();
+    lock.lock();
+    writing_ = false;
+    if (size < 0) {
+      ++num_failed_;
+    } else {
+      ++num_written_;
+      last_size_ = size;
+    }
+    condition_.notify_all();
+  }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template struct bb_checkpoint_t<int, double>;
+template class bb_checkpoint_writer_t<int, double>;
+template uint64_t hash_lp<int, double>(const lp_problem_t<int, double>& lp,
+                                       const std::vector<variable_type_t>& var_types,
+                                       bool with_bounds);
+template int64_t write_bb_checkpoint<int, double>(const std::string& path,
+                                                  const bb_checkpoint_t<int, double>& checkpoint);
+template bool read_bb_checkpoint<int, double>(const std::string& path,
+                                              bb_checkpoint_t<int, double>& checkpoint);
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,191 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <branch_and_bound/mip_node.hpp>
+
+#include <cuts/cuts.hpp>
+
+#include <dual_simplex/initial_basis.hpp>
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+#include <dual_simplex/types.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Node of the search tree saved in a checkpoint: an open node, or an ancestor of one
+template <typename i_t, typename f_t>
+struct bb_checkpoint_node_t {
+  i_t parent;  // Index of the parent in the checkpoint, -1 for the children of the root
+  i_t branch_var;
+  rounding_direction_t branch_dir;
+  f_t branch_var_lower;
+  f_t branch_var_upper;
+  f_t fractional_val;
+  f_t lower_bound;
+  f_t objective_estimate;
+  i_t integer_infeasible;
+  bool is_open;  // Waiting to be solved, otherwise the node has children
+  // Basis of an open node, encoded against the root basis of the checkpoint (see
+  // `encode_basis`). Without a basis, the node starts from the basis of the root.
+  bool has_basis;
+  std::vector<uint8_t> basis;
+  // Identity of the node in the deterministic mode, see `mip_node_t::creation_seq`
+  int32_t origin_worker_id;
+  int32_t creation_seq;
+};
+
+// Worker of the deterministic mode in a checkpoint. The nodes are indices into
+// `bb_checkpoint_t::nodes`.
+template <typename i_t, typename f_t>
+struct bb_checkpoint_worker_t {
+  std::vector<i_t> plunge_stack;  // From the front of the plunge stack
+  std::vector<i_t> backlog;       // In the order of the heap, which a push in order rebuilds
+  double clock;                   // Work units spent on nodes
+  double work_units;              // Work units of the work context
+  int32_t next_creation_seq;
+  int event_sequence;
+  int next_solution_seq;
+  f_t local_lower_bound_ceiling;
+};
+
+// State of the B&B search saved in a checkpoint: the open part of the search tree, the incumbent,
+// the pseudo-costs and the cut pool of the root.
+//
+// The search resumes on the same problem, after the root LP and its cut passes are solved again.
+// The bounds of the nodes are given by the branching decisions along their path, which only
+// involve the original variables of the LP, so the tree is valid whatever cuts the root ends up
+// with. The bases of the nodes are only kept if the root LP has the same cuts as when the
+// checkpoint was taken, the nodes start from the root basis otherwise.
+//
+// In the deterministic mode, the checkpoint is taken at a sync point where no worker is in the
+// middle of a node or a dive, see `branch_and_bound_t::deterministic_sync_callback`. It also holds
+// the queues of the workers, their clocks and the horizon, so that a resume with the same settings
+// continues the trajectory of the run that wrote it.
+template <typename i_t, typename f_t>
+struct bb_checkpoint_t {
+  // Identifies the problem given to B&B, before the cuts
+  uint64_t problem_hash{0};
+  i_t num_original_cols{0};
+  // Identifies the root LP with its cuts, see `hash_lp`
+  uint64_t lp_hash{0};
+  std::vector<variable_status_t> root_vstatus;
+
+  // Incumbent in the space of the user problem, empty if there is none
+  std::vector<f_t> incumbent;
+
+  // Pseudo-costs of the original variables
+  std::vector<f_t> pseudo_cost_sum_down;
+  std::vector<f_t> pseudo_cost_sum_up;
+  std::vector<i_t> pseudo_cost_num_down;
+  std::vector<i_t> pseudo_cost_num_up;
+
+  // Cut pool of the root, in the form cut'*x >= rhs over the original variables
+  csr_matrix_t<i_t, f_t> cuts{0, 0, 0};
+  std::vector<f_t> cut_rhs;
+  std::vector<cut_type_t> cut_types;
+
+  // Open nodes and their ancestors, each one after its parent
+  std::vector<bb_checkpoint_node_t<i_t, f_t>> nodes;
+  int64_t nodes_explored{0};
+
+  // State of the deterministic mode, the workers are empty in the other modes
+  std::vector<bb_checkpoint_worker_t<i_t, f_t>> bfs_workers;
+  std::vector<bb_checkpoint_worker_t<i_t, f_t>> diving_workers;
+  int64_t num_syncs{0};
+  double horizon{0.0};       // Work units of the sync point where the checkpoint was taken
+  double next_horizon{0.0};  // Work units of the next sync point
+  f_t upper_bound{0.0};
+  std::vector<f_t> crushed_incumbent;  // Incumbent in the space of the LP of B&B, with its cuts
+  f_t lower_bound_ceiling{0.0};
+  int64_t total_lp_iters{0};
+
+  bool is_deterministic() const { return !bfs_workers.empty(); }
+
+  // Saves the pending nodes of `tree` and their ancestors, with the bases of the pending nodes
+  // encoded against `root_vstatus`. The tree must not change meanwhile. Returns the node of the
+  // tree saved in each entry of `nodes`.
+  std::vector<const mip_node_t<i_t, f_t>*> save_tree(const search_tree_t<i_t, f_t>& tree);
+
+  // Rebuilds the saved nodes below the root of `tree`. The open nodes get their saved basis if
+  // `keep_bases` is true, and the basis of the root otherwise. Returns the node built for each
+  // entry of `nodes`.
+  std::vector<mip_node_t<i_t, f_t>*> restore_tree(search_tree_t<i_t, f_t>& tree,
+                                                  bool keep_bases) const;
+
+  i_t num_open_nodes() const;
+};
+
+// Hash of the rows, columns and objective of an LP. The bounds are left out with `with_bounds`
+// false, since the root changes them without changing the bases that are dual feasible.
+template <typename i_t, typename f_t>
+uint64_t hash_lp(const lp_problem_t<i_t, f_t>& lp,
+                 const std::vector<variable_type_t>& var_types,
+                 bool with_bounds);
+
+// A checkpoint is written to a temporary file next to `path`, which replaces `path` once it is
+// complete, so a crash while writing leaves the previous checkpoint intact. Returns the size of
+// the file, or -1 if it could not be written.
+template <typename i_t, typename f_t>
+int64_t write_bb_checkpoint(const std::string& path, const bb_checkpoint_t<i_t, f_t>& checkpoint);
+
+// Returns false if the file does not exist, or is not a complete checkpoint written with the same
+// index and floating point types
+template <typename i_t, typename f_t>
+bool read_bb_checkpoint(const std::string& path, bb_checkpoint_t<i_t, f_t>& checkpoint);
+
+// Writes the checkpoints on a background thread, so the search only stops for the time it takes to
+// copy its state
+template <typename i_t, typename f_t>
+class bb_checkpoint_writer_t {
+ public:
+  explicit bb_checkpoint_writer_t(const std::string& path);
+  // Writes the queued checkpoint and stops the background thread
+  ~bb_checkpoint_writer_t();
+
+  bb_checkpoint_writer_t(const bb_checkpoint_writer_t&)            = delete;
+  bb_checkpoint_writer_t& operator=(const bb_checkpoint_writer_t&) = delete;
+
+  // Queues a checkpoint, replacing the queued one if it was not started yet
+  void write(std::unique_ptr<bb_checkpoint_t<i_t, f_t>> checkpoint);
+  // Returns once the queued checkpoint has been written
+  void wait();
+  // True while a checkpoint is queued or being written
+  bool busy();
+
+  const std::string& path() const { return path_; }
+  int64_t num_written() const { return num_written_; }
+  int64_t num_failed() const { return num_failed_; }
+  int64_t last_size() const { return last_size_; }
+
+ private:
+  void run();
+
+  std::string path_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::unique_ptr<bb_checkpoint_t<i_t, f_t>> queued_;
+  bool writing_{false};
+  bool stop_{false};
+  std::thread thread_;
+
+  std::atomic<int64_t> num_written_{0};
+  std::atomic<int64_t> num_failed_{0};
+  std::atomic<int64_t> last_size_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,197 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_trace.hpp>
+
+#include <branch_and_bound/branch_and_bound_worker.hpp>
+
+#include <cuopt/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+constexpr char bb_trace_magic[8] = {'C', 'U', 'O', 'P', 'T', 'B', 'B', 'T'};
+
+constexpr int num_node_record_types = 5;
+
+}  // namespace
+
+bb_trace_writer_t::bb_trace_writer_t(const std::string& path,
+                                     int num_workers,
+                                     bool deterministic,
+                                     double search_start_time)
+{
+  file_ = std::fopen(path.c_str(), "wb");
+  if (file_ == nullptr) { return; }
+
+  bb_trace_header_t header;
+  std::memcpy(header.magic, bb_trace_magic, sizeof(header.magic));
+  header.version           = bb_trace_version;
+  header.record_size       = sizeof(bb_trace_record_t);
+  header.num_workers       = num_workers;
+  header.deterministic     = deterministic ? 1 : 0;
+  header.search_start_time = search_start_time;
+  if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+    std::fclose(file_);
+    file_ = nullptr;
+    return;
+  }
+  buffer_.reserve(buffer_records);
+}
+
+bb_trace_writer_t::~bb_trace_writer_t()
+{
+  if (file_ == nullptr) { return; }
+  flush_locked();
+  std::fclose(file_);
+}
+
+void bb_trace_writer_t::write(const bb_trace_record_t& record)
+{
+  if (file_ == nullptr) { return; }
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffer_.push_back(record);
+  if (buffer_.size() == buffer_records) { flush_locked(); }
+}
+
+void bb_trace_writer_t::flush()
+{
+  if (file_ == nullptr) { return; }
+  std::lock_guard<std::mutex> lock(mutex_);
+  flush_locked();
+  std::fflush(file_);
+}
+
+void bb_trace_writer_t::flush_locked()
+{
+  if (!buffer_.empty()) {
+    std::fwrite(buffer_.data(), sizeof(bb_trace_record_t), buffer_.size(), file_);
+  }
+  buffer_.clear();
+}
+
+void read_bb_trace(const std::string& path,
+                   bb_trace_header_t& header,
+                   std::vector<bb_trace_record_t>& records)
+{
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  cuopt_expects(
+    file != nullptr, error_type_t::ValidationError, "Could not open B&B trace %s", path.c_str());
+
+  const bool valid_header = std::fread(&header, sizeof(header), 1, file) == 1 &&
+                            std::memcmp(header.magic, bb_trace_magic, sizeof(header.magic)) == 0;
+  const bool supported =
+    valid_header && header.version == bb_trace_version &&
+    header.record_size == sizeof(bb_trace_record_t);
+  if (!supported) { std::fclose(file); }
+  cuopt_expects(valid_header, error_type_t::ValidationError, "%s is not a B&B trace", path.c_str());
+  cuopt_expects(supported,
+                error_type_t::ValidationError,
+                "Unsupported version %u of B&B trace %s",
+                header.version,
+                path.c_str());
+
+  records.clear();
+  bb_trace_record_t chunk[1024];
+  size_t count;
+  while ((count = std::fread(chunk, sizeof(bb_trace_record_t), 1024, file)) > 0) {
+    records.insert(records.end(), chunk, chunk + count);
+  }
+  std::fclose(file);
+}
+
+bb_trace_profile_t profile_bb_trace(const bb_trace_header_t& header,
+                                    const std::vector<bb_trace_record_t>& records)
+{
+  bb_trace_profile_t profile;
+  profile.workers.resize(std::max(header.num_workers, 0));
+  profile.dives_per_strategy.resize(num_search_strategies);
+
+  double end_time = header.search_start_time;
+  for (const auto& record : records) {
+    end_time = std::max(end_time, record.wall_time);
+  }
+  profile.search_time = end_time - header.search_start_time;
+
+  // A dive is successful if its worker found an integer solution since its previous task
+  std::vector<bool> found_integer(profile.workers.size(), false);
+  double bound = -std::numeric_limits<double>::infinity();
+
+  for (const auto& record : records) {
+    const auto type = static_cast<bb_trace_record_type_t>(record.type);
+    if (record.type < num_node_record_types || type == bb_trace_record_type_t::TASK) {
+      if (record.worker_id < 0 || record.worker_id >= static_cast<int>(profile.workers.size())) {
+        ++profile.skipped_records;
+        continue;
+      }
+    }
+    if (record.type < num_node_record_types) {
+      auto& worker = profile.workers[record.worker_id];
+      ++profile.nodes_by_type[record.type];
+      ++worker.nodes;
+      worker.lp_iterations += record.lp_iterations;
+      worker.lp_time += record.duration;
+      if (type == bb_trace_record_type_t::NODE_INTEGER) { found_integer[record.worker_id] = true; }
+      if (record.search_strategy == BEST_FIRST) {
+        ++profile.tree_nodes;
+        const size_t depth = std::max(record.depth, 0);
+        if (depth >= profile.tree_nodes_per_depth.size()) {
+          profile.tree_nodes_per_depth.resize(depth + 1, 0);
+        }
+        ++profile.tree_nodes_per_depth[depth];
+      } else {
+        ++profile.dive_nodes;
+      }
+    } else if (type == bb_trace_record_type_t::TASK) {
+      auto& worker = profile.workers[record.worker_id];
+      ++worker.tasks;
+      worker.busy_time += record.duration;
+      if (record.search_strategy != BEST_FIRST &&
+          record.search_strategy < profile.dives_per_strategy.size()) {
+        auto& dives = profile.dives_per_strategy[record.search_strategy];
+        ++dives.dives;
+        dives.nodes += record.node_id;
+        if (found_integer[record.worker_id]) { ++dives.successful; }
+      }
+      found_integer[record.worker_id] = false;
+      continue;
+    } else if (type != bb_trace_record_type_t::BOUNDS) {
+      continue;
+    }
+
+    if (type == bb_trace_record_type_t::BOUNDS) { bound = record.objective; }
+    if (profile.bound_curve.empty() || bound != profile.bound_curve.back().bound ||
+        record.incumbent != profile.bound_curve.back().incumbent) {
+      profile.bound_curve.push_back(
+        {record.wall_time, record.work_timestamp, bound, record.incumbent});
+    }
+  }
+
+  for (auto& worker : profile.workers) {
+    worker.idle_time = std::max(profile.search_time - worker.busy_time, 0.0);
+  }
+  return profile;
+}
+
+const char* bb_trace_strategy_name(int search_strategy)
+{
+  switch (search_strategy) {
+    case BEST_FIRST: return "best first";
+    case PSEUDOCOST_DIVING: return "pseudocost diving";
+    case LINE_SEARCH_DIVING: return "line search diving";
+    case GUIDED_DIVING: return "guided diving";
+    case COEFFICIENT_DIVING: return "coefficient diving";
+    default: return "unknown";
+  }
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex
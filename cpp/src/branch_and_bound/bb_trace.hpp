@@ -0,0 +1,138 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// A B&B trace is a binary file made of a bb_trace_header_t followed by bb_trace_record_t records,
+// both written in the native byte order. The records of the workers are interleaved in the order
+// they were written. Objective values are in the user space (unscaled, with the original sense)
+enum class bb_trace_record_type_t : uint8_t {
+  // A node LP was solved (or the node was found infeasible by bound strengthening). Same values as
+  // bb_event_type_t
+  NODE_BRANCHED   = 0,
+  NODE_FATHOMED   = 1,
+  NODE_INTEGER    = 2,
+  NODE_INFEASIBLE = 3,
+  NODE_NUMERICAL  = 4,
+  // A worker finished a task: a plunge, a dive or, in deterministic mode, the nodes processed
+  // between two waits at a sync point
+  TASK = 16,
+  // Global bound and incumbent, written when the solver reports progress
+  BOUNDS = 17,
+};
+
+struct bb_trace_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  int32_t num_workers;
+  int32_t deterministic;
+  double search_start_time;  // Seconds since the start of the solve
+};
+
+struct bb_trace_record_t {
+  double wall_time;       // Seconds since the start of the solve, at the end of the event
+  double work_timestamp;  // Clock of the worker in work units in deterministic mode, 0 otherwise
+  double duration;        // LP solve time of the node, or length of the task
+  double objective;       // Node lower bound, objective of the integer solution or global bound
+  double incumbent;       // Incumbent objective when the record was written
+  int64_t node_id;        // Node id, or number of nodes processed by the task
+  int32_t lp_iterations;  // Simplex iterations of the node LP or of the task
+  int32_t depth;          // Depth of the node
+  int32_t branch_var;     // Branching variable of a branched node, -1 otherwise
+  int16_t worker_id;      // -1 for BOUNDS records
+  uint8_t type;           // bb_trace_record_type_t
+  uint8_t search_strategy;
+};
+
+static_assert(sizeof(bb_trace_header_t) == 32);
+static_assert(sizeof(bb_trace_record_t) == 64);
+
+constexpr uint32_t bb_trace_version = 1;
+
+// Buffered, thread-safe writer of a B&B trace. A trace that cannot be opened is reported on
+// is_open() and the records are dropped, so tracing never stops a solve
+class bb_trace_writer_t {
+ public:
+  bb_trace_writer_t(const std::string& path,
+                    int num_workers,
+                    bool deterministic,
+                    double search_start_time);
+  ~bb_trace_writer_t();
+
+  bb_trace_writer_t(const bb_trace_writer_t&)            = delete;
+  bb_trace_writer_t& operator=(const bb_trace_writer_t&) = delete;
+
+  bool is_open() const { return file_ != nullptr; }
+
+  void write(const bb_trace_record_t& record);
+  void flush();
+
+ private:
+  void flush_locked();
+
+  static constexpr size_t buffer_records = 4096;
+
+  std::FILE* file_{nullptr};
+  std::mutex mutex_;
+  std::vector<bb_trace_record_t> buffer_;
+};
+
+// Reads a whole trace. Throws a ValidationError if the file is not a B&B trace
+void read_bb_trace(const std::string& path,
+                   bb_trace_header_t& header,
+                   std::vector<bb_trace_record_t>& records);
+
+// Summary of a trace computed by the profiler
+struct bb_trace_profile_t {
+  struct worker_t {
+    int64_t tasks{0};
+    int64_t nodes{0};
+    int64_t lp_iterations{0};
+    double lp_time{0.0};
+    double busy_time{0.0};  // Total length of the tasks
+    double idle_time{0.0};  // Search time not spent in a task
+  };
+
+  struct dives_t {
+    int64_t dives{0};
+    int64_t successful{0};  // Dives that found an integer feasible solution
+    int64_t nodes{0};
+  };
+
+  struct bound_sample_t {
+    double wall_time;
+    double work_timestamp;
+    double bound;
+    double incumbent;
+  };
+
+  double search_time{0.0};
+  int64_t nodes_by_type[5]{};  // Indexed by the node record types
+  int64_t tree_nodes{0};       // Nodes of the best-first search tree
+  int64_t dive_nodes{0};       // Nodes solved while diving
+  std::vector<int64_t> tree_nodes_per_depth;
+  std::vector<worker_t> workers;
+  std::vector<dives_t> dives_per_strategy;  // Indexed by search_strategy_t
+  std::vector<bound_sample_t> bound_curve;  // Changes of the bound or the incumbent
+  int64_t skipped_records{0};  // Node and task records whose worker is not in the header
+};
+
+bb_trace_profile_t profile_bb_trace(const bb_trace_header_t& header,
+                                    const std::vector<bb_trace_record_t>& records);
+
+const char* bb_trace_strategy_name(int search_strategy);
+
+}  // namespace cuopt::linear_programming::dual_simplex
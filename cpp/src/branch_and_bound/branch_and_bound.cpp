@@ -28,6 +28,7 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -62,8 +63,9 @@ i_t fractional_variables(const simplex_solver_settings_t<i_t, f_t>& settings,
                          const std::vector<variable_type_t>& var_types,
                          std::vector<i_t>& fractional)
 {
-  const i_t n = x.size();
-  assert(x.size() == var_types.size());
+  // The slacks of the local cuts of a node come after the variables of the LP
+  const i_t n = var_types.size();
+  assert(x.size() >= var_types.size());
   for (i_t j = 0; j < n; ++j) {
     if (is_fractional(x[j], var_types[j], settings.integer_tol)) { fractional.push_back(j); }
   }
@@ -317,6 +319,7 @@ void branch_and_bound_t<i_t, f_t>::report_heuristic(f_t obj)
       user_lower,
       user_gap.c_str(),
       toc(exploration_stats_.start_time));
+    trace_bounds(get_lower_bound());
   } else {
     settings_.log.printf("New solution from primal heuristics. Objective %+.6e. Time %.2f\n",
                          compute_user_objective(original_lp_, obj),
@@ -363,6 +366,308 @@ void branch_and_bound_t<i_t, f_t>::report(
                          user_gap.c_str(),
                          toc(exploration_stats_.start_time));
   }
+  trace_bounds(lower_bound);
+}
+
+template <typename i_t, typename f_t>
+template <typename WorkerT>
+void branch_and_bound_t<i_t, f_t>::trace_node(WorkerT* worker,
+                                              mip_node_t<i_t, f_t>* node_ptr,
+                                              node_status_t status)
+{
+  if (!trace_) { return; }
+
+  bb_trace_record_type_t type;
+  switch (status) {
+    case node_status_t::HAS_CHILDREN: type = bb_trace_record_type_t::NODE_BRANCHED; break;
+    case node_status_t::FATHOMED: type = bb_trace_record_type_t::NODE_FATHOMED; break;
+    case node_status_t::INTEGER_FEASIBLE: type = bb_trace_record_type_t::NODE_INTEGER; break;
+    case node_status_t::INFEASIBLE: type = bb_trace_record_type_t::NODE_INFEASIBLE; break;
+    case node_status_t::NUMERICAL: type = bb_trace_record_type_t::NODE_NUMERICAL; break;
+    default: return;
+  }
+
+  bb_trace_record_t record;
+  record.wall_time      = toc(exploration_stats_.start_time);
+  record.work_timestamp = 0.0;
+  if constexpr (requires { worker->clock; }) { record.work_timestamp = worker->clock; }
+  record.duration        = worker->node_lp_time;
+  record.objective       = compute_user_objective(original_lp_, node_ptr->lower_bound);
+  record.incumbent       = compute_user_objective(original_lp_, upper_bound_.load());
+  record.node_id         = node_ptr->node_id;
+  record.lp_iterations   = worker->node_lp_iters;
+  record.depth           = node_ptr->depth;
+  record.branch_var      = status == node_status_t::HAS_CHILDREN
+                             ? node_ptr->get_down_child()->branch_var
+                             : -1;
+  record.worker_id       = worker->trace_id;
+  record.type            = static_cast<uint8_t>(type);
+  record.search_strategy = worker->search_strategy;
+  trace_->write(record);
+
+  ++worker->task_nodes;
+  worker->task_lp_iters += worker->node_lp_iters;
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::trace_task_begin(branch_and_bound_worker_t<i_t, f_t>* worker)
+{
+  if (!trace_) { return; }
+  worker->task_start_time = toc(exploration_stats_.start_time);
+  worker->task_nodes      = 0;
+  worker->task_lp_iters   = 0;
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::trace_task_end(branch_and_bound_worker_t<i_t, f_t>* worker,
+                                                  double work_timestamp)
+{
+  if (!trace_) { return; }
+  bb_trace_record_t record;
+  record.wall_time       = toc(exploration_stats_.start_time);
+  record.work_timestamp  = work_timestamp;
+  record.duration        = record.wall_time - worker->task_start_time;
+  record.objective       = compute_user_objective(original_lp_, worker->lower_bound.load());
+  record.incumbent       = compute_user_objective(original_lp_, upper_bound_.load());
+  record.node_id         = worker->task_nodes;
+  record.lp_iterations   = worker->task_lp_iters;
+  record.depth           = 0;
+  record.branch_var      = -1;
+  record.worker_id       = worker->trace_id;
+  record.type            = static_cast<uint8_t>(bb_trace_record_type_t::TASK);
+  record.search_strategy = worker->search_strategy;
+  trace_->write(record);
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::trace_bounds(f_t lower_bound)
+{
+  if (!trace_) { return; }
+  bb_trace_record_t record;
+  record.wall_time       = toc(exploration_stats_.start_time);
+  record.work_timestamp  = deterministic_mode_enabled_ ? deterministic_current_horizon_ : 0.0;
+  record.duration        = 0.0;
+  record.objective       = compute_user_objective(original_lp_, lower_bound);
+  record.incumbent       = compute_user_objective(original_lp_, upper_bound_.load());
+  record.node_id         = exploration_stats_.nodes_explored;
+  record.lp_iterations   = 0;
+  record.depth           = 0;
+  record.branch_var      = -1;
+  record.worker_id       = -1;
+  record.type            = static_cast<uint8_t>(bb_trace_record_type_t::BOUNDS);
+  record.search_strategy = 0;
+  trace_->write(record);
+}
+
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::apply_conflicts(branch_and_bound_worker_t<i_t, f_t>* worker)
+{
+  auto& lower = worker->leaf_problem.lower;
+  auto& upper = worker->leaf_problem.upper;
+  std::vector<conflict_literal_t<i_t, f_t>> implied;
+  if (!conflict_pool_.propagate(lower, upper, implied)) { return false; }
+  if (implied.empty()) { return true; }
+
+  constexpr f_t inf = std::numeric_limits<f_t>::infinity();
+  for (const auto& literal : implied) {
+    if (literal.is_upper) {
+      worker->node_propagator.tighten_bounds(literal.j, -inf, literal.bound, lower, upper);
+    } else {
+      worker->node_propagator.tighten_bounds(literal.j, literal.bound, inf, lower, upper);
+    }
+  }
+  return worker->node_propagator.propagate(settings_, lower, upper);
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::learn_conflict(branch_and_bound_worker_t<i_t, f_t>* worker,
+                                                  bool lp_infeasible)
+{
+  const auto& leaf_problem = worker->leaf_problem;
+  const i_t n              = leaf_problem.num_cols;
+  std::vector<i_t> proof_index;
+  std::vector<f_t> proof_coeff;
+  f_t proof_rhs;
+
+  if (lp_infeasible) {
+    // Aggregate the rows with the dual ray: y'*A*x = y'*b
+    const auto& y = worker->leaf_solution.y;
+    std::vector<f_t> alpha(n);
+    matrix_transpose_vector_multiply(leaf_problem.A, 1.0, y, 0.0, alpha);
+    proof_rhs = dot<i_t, f_t>(leaf_problem.rhs, y);
+    for (i_t j = 0; j < n; ++j) {
+      if (alpha[j] != 0.0) {
+        proof_index.push_back(j);
+        proof_coeff.push_back(alpha[j]);
+      }
+    }
+  } else {
+    const i_t i = worker->node_propagator.last_infeasible_row;
+    if (i < 0) { return; }
+    const i_t row_start = Arow_.row_start[i];
+    const i_t row_end   = Arow_.row_start[i + 1];
+    proof_index.assign(Arow_.j.begin() + row_start, Arow_.j.begin() + row_end);
+    proof_coeff.assign(Arow_.x.begin() + row_start, Arow_.x.begin() + row_end);
+    proof_rhs = leaf_problem.rhs[i];
+  }
+
+  std::vector<conflict_literal_t<i_t, f_t>> conflict;
+  const i_t max_literals = std::max<i_t>(10, n / 10);
+  if (conflict_from_proof(proof_index,
+                          proof_coeff,
+                          proof_rhs,
+                          leaf_problem.lower,
+                          leaf_problem.upper,
+                          original_lp_.lower,
+                          original_lp_.upper,
+                          var_types_,
+                          settings_,
+                          max_literals,
+                          conflict)) {
+    conflict_pool_.add_conflict(conflict);
+  }
+}
+
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::should_restart()
+{
+  const i_t max_restarts = settings_.max_restarts < 0 ? 1 : settings_.max_restarts;
+  if (num_restarts_ >= max_restarts || settings_.deterministic) { return false; }
+  if (exploration_stats_.nodes_explored > settings_.restart_node_limit) { return false; }
+
+  // The fixings only change with the incumbent
+  const f_t upper_bound = upper_bound_.load();
+  if (!(upper_bound < restart_upper_bound_)) { return false; }
+  restart_upper_bound_ = upper_bound;
+
+  std::vector<f_t> lower_bounds;
+  std::vector<f_t> upper_bounds;
+  find_reduced_cost_fixings(upper_bound, lower_bounds, upper_bounds);
+  i_t num_unfixed = 0;
+  i_t num_fixed   = 0;
+  for (i_t j = 0; j < original_lp_.num_cols; ++j) {
+    if (var_types_[j] == variable_type_t::CONTINUOUS ||
+        original_lp_.upper[j] - original_lp_.lower[j] < settings_.fixed_tol) {
+      continue;
+    }
+    ++num_unfixed;
+    if (upper_bounds[j] - lower_bounds[j] < settings_.fixed_tol) { ++num_fixed; }
+  }
+  return num_fixed > 0 && num_fixed >= settings_.restart_fixing_fraction * num_unfixed;
+}
+
+template <typename i_t, typename f_t>
+mip_status_t branch_and_bound_t<i_t, f_t>::restart_root(
+  mip_solution_t<i_t, f_t>& solution,
+  simplex_solver_settings_t<i_t, f_t>& lp_settings,
+  basis_update_mpf_t<i_t, f_t>& basis_update,
+  std::vector<i_t>& basic_list,
+  std::vector<i_t>& nonbasic_list,
+  std::vector<i_t>& fractional)
+{
+  raft::common::nvtx::range scope("BB::restart");
+  ++num_restarts_;
+  restart_requested_   = false;
+  lower_bound_ceiling_ = inf;
+  node_queue_.clear();
+
+  // The fixings exclude every solution that is not better than the incumbent. So, if they make
+  // the problem infeasible, the incumbent is optimal.
+  std::vector<f_t> lower_bounds;
+  std::vector<f_t> upper_bounds;
+  const f_t upper_bound = upper_bound_.load();
+  find_reduced_cost_fixings(upper_bound, lower_bounds, upper_bounds);
+  std::vector<bool> bounds_changed(original_lp_.num_cols, true);
+  std::vector<char> row_sense;
+  bounds_strengthening_t<i_t, f_t> presolve(original_lp_, Arow_, row_sense, var_types_);
+  bool feasible =
+    presolve.bounds_strengthening(settings_, bounds_changed, lower_bounds, upper_bounds);
+
+  i_t num_fixed = 0;
+  for (i_t j = 0; j < original_lp_.num_cols; ++j) {
+    if (var_types_[j] != variable_type_t::CONTINUOUS &&
+        upper_bounds[j] - lower_bounds[j] < settings_.fixed_tol) {
+      ++num_fixed;
+    }
+  }
+  settings_.log.printf("\nRestart %d after %ld nodes. %d integer variables are fixed\n",
+                       num_restarts_,
+                       exploration_stats_.nodes_explored.load(),
+                       num_fixed);
+  if (!feasible) {
+    set_final_solution(solution, upper_bound);
+    return solver_status_;
+  }
+
+  mutex_original_lp_.lock();
+  original_lp_.lower = lower_bounds;
+  original_lp_.upper = upper_bounds;
+  mutex_original_lp_.unlock();
+
+  i_t iter                    = 0;
+  bool initialize_basis       = false;
+  lp_settings.concurrent_halt = NULL;
+  dual::status_t root_status  = dual_phase2_with_advanced_basis(2,
+                                                                0,
+                                                                initialize_basis,
+                                                                exploration_stats_.start_time,
+                                                                original_lp_,
+                                                                lp_settings,
+                                                                root_vstatus_,
+                                                                basis_update,
+                                                                basic_list,
+                                                                nonbasic_list,
+                                                                root_relax_soln_,
+                                                                iter,
+                                                                edge_norms_);
+  exploration_stats_.total_lp_iters += iter;
+
+  if (root_status == dual::status_t::DUAL_UNBOUNDED) {
+    set_final_solution(solution, upper_bound);
+    return solver_status_;
+  }
+  if (root_status == dual::status_t::TIME_LIMIT) {
+    solver_status_ = mip_status_t::TIME_LIMIT;
+    set_final_solution(solution, root_objective_);
+    return solver_status_;
+  }
+  if (root_status != dual::status_t::OPTIMAL) {
+    settings_.log.printf("Numerical issue at root node. Resolving from scratch\n");
+    lp_status_t scratch_status =
+      solve_linear_program_with_advanced_basis(original_lp_,
+                                               exploration_stats_.start_time,
+                                               lp_settings,
+                                               root_relax_soln_,
+                                               basis_update,
+                                               basic_list,
+                                               nonbasic_list,
+                                               root_vstatus_,
+                                               edge_norms_);
+    if (scratch_status != lp_status_t::OPTIMAL) {
+      solver_status_ = mip_status_t::NUMERICAL;
+      set_final_solution(solution, root_objective_);
+      return solver_status_;
+    }
+    exploration_stats_.total_lp_iters += root_relax_soln_.iterations;
+  }
+  root_objective_ = compute_objective(original_lp_, root_relax_soln_.x);
+  set_uninitialized_steepest_edge_norms(original_lp_, basic_list, edge_norms_);
+
+  fractional.clear();
+  const i_t num_fractional =
+    fractional_variables(settings_, root_relax_soln_.x, var_types_, fractional);
+  report(' ', upper_bound_.load(), root_objective_, 0, num_fractional);
+  if (num_fractional == 0) {
+    if (root_objective_ < upper_bound_) {
+      mutex_upper_.lock();
+      incumbent_.set_incumbent_solution(root_objective_, root_relax_soln_.x);
+      upper_bound_ = root_objective_;
+      mutex_upper_.unlock();
+    }
+    set_final_solution(solution, root_objective_);
+    return solver_status_;
+  }
+  return mip_status_t::UNSET;
 }
 
 template <typename i_t, typename f_t>
@@ -600,6 +905,18 @@ bool branch_and_bound_t<i_t, f_t>::repair_solution(const std::vector<f_t>& edge_
   return feasible;
 }
 
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::prune_spilled_nodes()
+{
+  std::vector<mip_node_t<i_t, f_t>*> pruned;
+  node_queue_.prune_spilled(upper_bound_, pruned);
+  for (mip_node_t<i_t, f_t>* node : pruned) {
+    search_tree_.graphviz_node(settings_.log, node, "cutoff", node->lower_bound);
+    search_tree_.update(node, node_status_t::FATHOMED);
+    --exploration_stats_.nodes_unexplored;
+  }
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::repair_heuristic_solutions()
 {
@@ -661,6 +978,7 @@ void branch_and_bound_t<i_t, f_t>::set_solution_at_root(mip_solution_t<i_t, f_t>
   solution.lower_bound        = root_objective_;
   solution.nodes_explored     = 0;
   solution.simplex_iterations = root_relax_soln_.iterations;
+  solution.num_restarts       = num_restarts_;
   settings_.log.printf("Optimal solution found at root node. Objective %.16e. Time %.2f.\n",
                        compute_user_objective(original_lp_, root_objective_),
                        toc(exploration_stats_.start_time));
@@ -673,6 +991,118 @@ void branch_and_bound_t<i_t, f_t>::set_solution_at_root(mip_solution_t<i_t, f_t>
   }
 }
 
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::checkpoint_due()
+{
+  return checkpoint_writer_ != nullptr && !checkpoint_writer_->busy() &&
+         toc(last_checkpoint_time_) >= settings_.checkpoint_interval;
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::save_checkpoint()
+{
+  raft::common::nvtx::range scope("BB::save_checkpoint");
+
+  auto checkpoint               = std::make_unique<bb_checkpoint_t<i_t, f_t>>();
+  checkpoint->problem_hash      = problem_hash_;
+  checkpoint->num_original_cols = num_original_cols_;
+  checkpoint->lp_hash           = hash_lp(original_lp_, var_types_, false);
+  checkpoint->root_vstatus      = root_vstatus_;
+  checkpoint->nodes_explored    = exploration_stats_.nodes_explored;
+
+  std::vector<f_t> incumbent;
+  mutex_upper_.lock();
+  if (incumbent_.has_incumbent) { incumbent = incumbent_.x; }
+  mutex_upper_.unlock();
+  if (!incumbent.empty()) {
+    uncrush_primal_solution(original_problem_, original_lp_, incumbent, checkpoint->incumbent);
+  }
+
+  const i_t n = num_original_cols_;
+  checkpoint->pseudo_cost_sum_down.resize(n);
+  checkpoint->pseudo_cost_sum_up.resize(n);
+  checkpoint->pseudo_cost_num_down.resize(n);
+  checkpoint->pseudo_cost_num_up.resize(n);
+  // The diving workers keep updating the pseudo-costs, so the sum and the count of each variable
+  // are read together under its lock
+  for (i_t j = 0; j < n; ++j) {
+    pc_.pseudo_cost_mutex_down[j].lock();
+    checkpoint->pseudo_cost_sum_down[j] = pc_.pseudo_cost_sum_down[j];
+    checkpoint->pseudo_cost_num_down[j] = pc_.pseudo_cost_num_down[j];
+    pc_.pseudo_cost_mutex_down[j].unlock();
+    pc_.pseudo_cost_mutex_up[j].lock();
+    checkpoint->pseudo_cost_sum_up[j] = pc_.pseudo_cost_sum_up[j];
+    checkpoint->pseudo_cost_num_up[j] = pc_.pseudo_cost_num_up[j];
+    pc_.pseudo_cost_mutex_up[j].unlock();
+  }
+
+  cut_pool_->get_cuts(checkpoint->cuts, checkpoint->cut_rhs, checkpoint->cut_types);
+  const auto saved_nodes = checkpoint->save_tree(search_tree_);
+  if (deterministic_mode_enabled_) { deterministic_save_workers(*checkpoint, saved_nodes); }
+
+  checkpoint_writer_->write(std::move(checkpoint));
+  last_checkpoint_time_ = tic();
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::read_resume_checkpoint()
+{
+  auto checkpoint = std::make_unique<bb_checkpoint_t<i_t, f_t>>();
+  if (!read_bb_checkpoint(settings_.resume_file, *checkpoint)) {
+    settings_.log.printf("Warning: could not read the B&B checkpoint %s\n",
+                         settings_.resume_file.c_str());
+    return;
+  }
+  if (checkpoint->problem_hash != problem_hash_ ||
+      checkpoint->num_original_cols != num_original_cols_) {
+    settings_.log.printf("Warning: the B&B checkpoint %s was written for a different problem\n",
+                         settings_.resume_file.c_str());
+    return;
+  }
+  settings_.log.printf("Resuming B&B from %s: %d open nodes, %ld nodes explored\n",
+                       settings_.resume_file.c_str(),
+                       checkpoint->num_open_nodes(),
+                       checkpoint->nodes_explored);
+  resume_checkpoint_ = std::move(checkpoint);
+}
+
+template <typename i_t, typename f_t>
+i_t branch_and_bound_t<i_t, f_t>::restore_checkpoint_tree()
+{
+  // The bases of the nodes are only valid for the root LP they were computed with
+  const bool keep_bases = resume_checkpoint_->lp_hash == hash_lp(original_lp_, var_types_, false) &&
+                          resume_checkpoint_->root_vstatus.size() == root_vstatus_.size();
+  if (!keep_bases) {
+    settings_.log.printf(
+      "The root LP differs from the checkpoint. The open nodes start from the root basis.\n");
+  }
+  const auto nodes                  = resume_checkpoint_->restore_tree(search_tree_, keep_bases);
+  exploration_stats_.nodes_explored = resume_checkpoint_->nodes_explored;
+  // The search already decided not to restart with the incumbent of the checkpoint
+  restart_upper_bound_ = upper_bound_.load();
+
+  i_t num_open_nodes = 0;
+  for (size_t k = 0; k < nodes.size(); ++k) {
+    if (nodes[k] == nullptr || !resume_checkpoint_->nodes[k].is_open) { continue; }
+    ++num_open_nodes;
+    if (!settings_.deterministic) { node_queue_.push(nodes[k]); }
+  }
+  // The coordinator gives the nodes to the workers in the deterministic mode
+  if (settings_.deterministic) {
+    resume_nodes_ = nodes;
+  } else {
+    resume_checkpoint_.reset();
+  }
+  return num_open_nodes;
+}
+
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::deterministic_resume() const
+{
+  return settings_.deterministic && resume_checkpoint_ != nullptr &&
+         resume_checkpoint_->is_deterministic();
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>& solution,
                                                       f_t lower_bound)
@@ -704,6 +1134,50 @@ void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>&
   settings_.log.printf("Explored %d nodes in %.2fs.\n",
                        exploration_stats_.nodes_explored,
                        toc(exploration_stats_.start_time));
+  if (node_cut_nodes_ > 0) {
+    settings_.log.printf("Node cuts: %ld nodes improved, %ld cuts, %ld LP iterations\n",
+                         node_cut_nodes_.load(),
+                         node_cut_count_.load(),
+                         node_cut_lp_iters_.load());
+  }
+  if (basis_cache_hits_ > 0) {
+    const int64_t hits   = basis_cache_hits_;
+    const int64_t misses = basis_cache_misses_;
+    settings_.log.printf(
+      "Basis cache: %ld refactorizations avoided, %.1f%% hit rate, %.3fs recording and restoring\n",
+      hits,
+      100.0 * hits / (hits + misses),
+      basis_cache_time_.load());
+  }
+  if (node_selector_.num_estimate_picks() > 0 || node_selector_.num_plunges_stopped() > 0) {
+    settings_.log.printf("Node selection: %ld best-estimate picks, %ld plunges stopped\n",
+                         node_selector_.num_estimate_picks(),
+                         node_selector_.num_plunges_stopped());
+  }
+  if (node_queue_.spilled_nodes().num_spilled() > 0) {
+    const auto& spilled = node_queue_.spilled_nodes();
+    settings_.log.printf(
+      "Node spill: %ld nodes spilled, %ld reloaded, %ld pruned, %.1f MB written, %ld compactions\n",
+      spilled.num_spilled(),
+      spilled.num_reloaded(),
+      spilled.num_pruned(),
+      spilled.bytes_written() / (1024.0 * 1024.0),
+      spilled.num_compactions());
+  }
+  if (checkpoint_writer_ != nullptr) {
+    checkpoint_writer_->wait();
+    settings_.log.printf("Checkpoints: %ld written, %.1f MB last, %ld failed\n",
+                         checkpoint_writer_->num_written(),
+                         checkpoint_writer_->last_size() / (1024.0 * 1024.0),
+                         checkpoint_writer_->num_failed());
+  }
+  if (conflict_pool_.num_added() > 0) {
+    settings_.log.printf("Conflicts: %ld learned, %d pooled, %ld nodes pruned, %ld bounds\n",
+                         conflict_pool_.num_added(),
+                         conflict_pool_.size(),
+                         conflict_pool_.num_pruned(),
+                         conflict_pool_.num_implied());
+  }
   settings_.log.printf("Absolute Gap %e Objective %.16e %s Bound %.16e\n",
                        gap,
                        obj,
@@ -748,6 +1222,7 @@ void branch_and_bound_t<i_t, f_t>::set_final_solution(mip_solution_t<i_t, f_t>&
   solution.lower_bound        = lower_bound;
   solution.nodes_explored     = exploration_stats_.nodes_explored;
   solution.simplex_iterations = exploration_stats_.total_lp_iters;
+  solution.num_restarts       = num_restarts_;
 }
 
 template <typename i_t, typename f_t>
@@ -768,6 +1243,7 @@ void branch_and_bound_t<i_t, f_t>::add_feasible_solution(f_t leaf_objective,
     upper_bound_ = leaf_objective;
     report(feasible_solution_symbol(thread_type), leaf_objective, get_lower_bound(), leaf_depth, 0);
     send_solution = true;
+    if (thread_type != BEST_FIRST) { node_selector_.record_dive_incumbent(); }
   }
 
   if (send_solution && settings_.solution_callback != nullptr) {
@@ -825,6 +1301,7 @@ branch_variable_t<i_t> branch_and_bound_t<i_t, f_t>::variable_selection(
                                                      exploration_stats_,
                                                      upper_bound_,
                                                      worker_pool_.num_idle_workers(),
+                                                     trial_pool_,
                                                      log);
       } else {
         branch_var = pc_.variable_selection(fractional, solution, log);
@@ -1165,6 +1642,7 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
   if (lp_status == dual::status_t::DUAL_UNBOUNDED) {
     node_ptr->lower_bound = inf;
     policy.graphviz(search_tree, node_ptr, "infeasible", 0.0);
+    trace_node(worker, node_ptr, node_status_t::INFEASIBLE);
     search_tree.update(node_ptr, node_status_t::INFEASIBLE);
     status = node_status_t::INFEASIBLE;
 
@@ -1172,12 +1650,21 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
     f_t leaf_obj          = compute_objective(leaf_problem, leaf_solution.x);
     node_ptr->lower_bound = upper_bound;
     policy.graphviz(search_tree, node_ptr, "cut off", leaf_obj);
+    trace_node(worker, node_ptr, node_status_t::FATHOMED);
     search_tree.update(node_ptr, node_status_t::FATHOMED);
     status = node_status_t::FATHOMED;
 
   } else if (lp_status == dual::status_t::OPTIMAL) {
+    // The solution without the slacks of the local cuts
+    std::vector<f_t> local_x;
+    if (leaf_problem.num_cols > original_lp_.num_cols) {
+      local_x.assign(leaf_solution.x.begin(), leaf_solution.x.begin() + original_lp_.num_cols);
+    }
+    const std::vector<f_t>& x = leaf_problem.num_cols > original_lp_.num_cols ? local_x
+                                                                                : leaf_solution.x;
+
     std::vector<i_t> leaf_fractional;
-    i_t num_frac = fractional_variables(settings_, leaf_solution.x, var_types_, leaf_fractional);
+    i_t num_frac = fractional_variables(settings_, x, var_types_, leaf_fractional);
 
 #ifdef DEBUG_FRACTIONAL_FIXED
     for (i_t j : leaf_fractional) {
@@ -1203,24 +1690,24 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
     if (original_lp_.objective_is_integral) {
       node_ptr->lower_bound = std::ceil(leaf_obj - settings_.integer_tol);
     }
-    policy.on_optimal_callback(leaf_solution.x, leaf_obj);
+    policy.on_optimal_callback(x, leaf_obj);
 
     if (num_frac == 0) {
-      policy.handle_integer_solution(node_ptr, leaf_obj, leaf_solution.x);
+      policy.handle_integer_solution(node_ptr, leaf_obj, x);
       policy.graphviz(search_tree, node_ptr, "integer feasible", leaf_obj);
+      trace_node(worker, node_ptr, node_status_t::INTEGER_FEASIBLE);
       search_tree.update(node_ptr, node_status_t::INTEGER_FEASIBLE);
       status = node_status_t::INTEGER_FEASIBLE;
 
     } else if (leaf_obj <= upper_bound + abs_fathom_tol) {
-      auto [branch_var, dir] =
-        policy.select_branch_variable(node_ptr, leaf_fractional, leaf_solution.x);
+      auto [branch_var, dir] = policy.select_branch_variable(node_ptr, leaf_fractional, x);
       round_dir = dir;
 
       assert(node_ptr->vstatus.size() == leaf_problem.num_cols);
       assert(branch_var >= 0);
       assert(dir != rounding_direction_t::NONE);
 
-      policy.update_objective_estimate(node_ptr, leaf_fractional, leaf_solution.x);
+      policy.update_objective_estimate(node_ptr, leaf_fractional, x);
 
       logger_t log;
       log.log = false;
@@ -1231,11 +1718,13 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
                          node_ptr->vstatus,
                          leaf_problem,
                          log);
+      trace_node(worker, node_ptr, node_status_t::HAS_CHILDREN);
       search_tree.update(node_ptr, node_status_t::HAS_CHILDREN);
       status = node_status_t::HAS_CHILDREN;
 
     } else {
       policy.graphviz(search_tree, node_ptr, "fathomed", leaf_obj);
+      trace_node(worker, node_ptr, node_status_t::FATHOMED);
       search_tree.update(node_ptr, node_status_t::FATHOMED);
       status = node_status_t::FATHOMED;
     }
@@ -1248,6 +1737,7 @@ std::pair<node_status_t, rounding_direction_t> branch_and_bound_t<i_t, f_t>::upd
   } else {
     policy.on_numerical_issue(node_ptr);
     policy.graphviz(search_tree, node_ptr, "numerical", 0.0);
+    trace_node(worker, node_ptr, node_status_t::NUMERICAL);
     search_tree.update(node_ptr, node_status_t::NUMERICAL);
     status = node_status_t::NUMERICAL;
   }
@@ -1312,7 +1802,6 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
 #endif
 
   std::vector<variable_status_t>& leaf_vstatus = node_ptr->vstatus;
-  assert(leaf_vstatus.size() == worker->leaf_problem.num_cols);
 
   simplex_solver_settings_t lp_settings = settings_;
   lp_settings.set_log(false);
@@ -1355,14 +1844,39 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
     node_ptr->vstatus[node_ptr->branch_var]);
 #endif
 
-  bool feasible            = worker->set_lp_variable_bounds(node_ptr, settings_);
+  bool feasible = worker->set_lp_variable_bounds(node_ptr, settings_);
+  assert(leaf_vstatus.size() == worker->leaf_problem.num_cols);
+  if (conflict_analysis_) {
+    if (feasible) {
+      feasible = apply_conflicts(worker);
+    } else {
+      learn_conflict(worker, false);
+    }
+  }
   dual::status_t lp_status = dual::status_t::DUAL_UNBOUNDED;
   worker->leaf_edge_norms  = edge_norms_;
+  worker->node_lp_iters    = 0;
+  worker->node_lp_time     = 0.0;
+  worker->leaf_edge_norms.resize(worker->leaf_problem.num_cols, 1.0);
 
   if (feasible) {
     i_t node_iter     = 0;
     f_t lp_start_time = tic();
 
+    // The factorization of the starting basis may still be cached, e.g. when the node is the
+    // sibling of a pruned node
+    if (worker->recompute_basis && settings_.basis_cache_size > 0) {
+      const f_t cache_start = tic();
+      if (worker->basis_cache.find(
+            leaf_vstatus, worker->basis_factors, worker->basic_list, worker->nonbasic_list)) {
+        worker->recompute_basis = false;
+        ++basis_cache_hits_;
+      } else {
+        ++basis_cache_misses_;
+      }
+      basis_cache_time_ += toc(cache_start);
+    }
+
     lp_status = dual_phase2_with_advanced_basis(2,
                                                 0,
                                                 worker->recompute_basis,
@@ -1391,9 +1905,21 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
 
       lp_status = convert_lp_status_to_dual_status(second_status);
     }
+    // The local cuts are only valid in the subtree, so they cannot be part of a global conflict
+    if (conflict_analysis_ && lp_status == dual::status_t::DUAL_UNBOUNDED &&
+        worker->leaf_cuts == nullptr) {
+      learn_conflict(worker, true);
+    }
 
-    stats.total_lp_solve_time += toc(lp_start_time);
+    worker->node_lp_iters = node_iter;
+    worker->node_lp_time  = toc(lp_start_time);
+    stats.total_lp_solve_time += worker->node_lp_time;
     stats.total_lp_iters += node_iter;
+
+    if (lp_status == dual::status_t::OPTIMAL && node_cut_passes_ > 0 &&
+        worker->search_strategy == search_strategy_t::BEST_FIRST) {
+      lp_status = separate_node_cuts(node_ptr, worker, lp_settings);
+    }
   }
 
 #ifdef LOG_NODE_SIMPLEX
@@ -1402,15 +1928,192 @@ dual::status_t branch_and_bound_t<i_t, f_t>::solve_node_lp(
 
   return lp_status;
 }
+template <typename i_t, typename f_t>
+dual::status_t branch_and_bound_t<i_t, f_t>::separate_node_cuts(
+  mip_node_t<i_t, f_t>* node_ptr,
+  branch_and_bound_worker_t<i_t, f_t>* worker,
+  const simplex_solver_settings_t<i_t, f_t>& lp_settings)
+{
+  raft::common::nvtx::range scope("BB::separate_node_cuts");
+  const lp_problem_t<i_t, f_t>& leaf_problem = worker->leaf_problem;
+  lp_solution_t<i_t, f_t>& leaf_solution     = worker->leaf_solution;
+  const bool generate_cuts                   = settings_.node_cut_generation != 0;
+
+  if (cut_pool_ == nullptr || (cut_pool_->pool_size() == 0 && !generate_cuts)) {
+    return dual::status_t::OPTIMAL;
+  }
+  if (node_ptr->depth > settings_.node_cut_max_depth) { return dual::status_t::OPTIMAL; }
+
+  // Only the nodes in the lower half of the gap are worth the effort, since the other ones do not
+  // hold back the lower bound
+  const f_t leaf_obj    = compute_objective(leaf_problem, leaf_solution.x);
+  const f_t upper_bound = upper_bound_;
+  if (std::isfinite(upper_bound) &&
+      leaf_obj > root_objective_ + 0.5 * (upper_bound - root_objective_)) {
+    return dual::status_t::OPTIMAL;
+  }
+
+  // Keep the throughput of the tree: the cut passes may only use a fraction of the LP iterations
+  if (node_cut_lp_iters_ > settings_.node_cut_effort * exploration_stats_.total_lp_iters) {
+    return dual::status_t::OPTIMAL;
+  }
+
+  std::vector<i_t> fractional;
+  if (fractional_variables(settings_, leaf_solution.x, var_types_, fractional) == 0) {
+    return dual::status_t::OPTIMAL;
+  }
+
+  // The cuts are added to a copy of the leaf problem. When they improve the bound, the node keeps
+  // them for its subtree, and the worker continues with the leaf problem and the basis with the
+  // cuts (see `node_cuts_t`).
+  lp_problem_t<i_t, f_t> cut_problem        = leaf_problem;
+  lp_solution_t<i_t, f_t> cut_solution      = leaf_solution;
+  basis_update_mpf_t<i_t, f_t> basis_update = worker->basis_factors;
+  std::vector<i_t> basic_list               = worker->basic_list;
+  std::vector<i_t> nonbasic_list            = worker->nonbasic_list;
+  std::vector<variable_status_t> vstatus    = node_ptr->vstatus;
+  std::vector<f_t> edge_norms               = worker->leaf_edge_norms;
+  std::vector<i_t> new_slacks               = new_slacks_;
+  const auto parent_cuts                    = node_ptr->cuts;
+  csr_matrix_t<i_t, f_t> added_cuts(0, cut_problem.num_cols, 0);
+  std::vector<f_t> added_rhs;
+
+  // Each node may spend at most twice the iterations of its LP on the cut passes
+  i_t iteration_budget = std::max<i_t>(100, 2 * worker->node_lp_iters);
+  const f_t min_change = settings_.cut_change_threshold * std::max<f_t>(1e-3, std::abs(leaf_obj));
+  const i_t max_cuts_per_pass = 100;
+
+  // Knapsack and strong CG cuts are too expensive to generate at every node
+  simplex_solver_settings_t<i_t, f_t> cut_settings = lp_settings;
+  cut_settings.knapsack_cuts                       = 0;
+  cut_settings.strong_chvatal_gomory_cuts          = 0;
+
+  dual::status_t status = dual::status_t::OPTIMAL;
+  f_t cut_obj           = leaf_obj;
+  bool improved         = false;
+  i_t num_cuts          = 0;
+
+  for (i_t pass = 0; pass < node_cut_passes_ && iteration_budget > 0; ++pass) {
+    csr_matrix_t<i_t, f_t> cuts(0, cut_problem.num_cols, 0);
+    std::vector<f_t> cut_rhs;
+    std::vector<cut_type_t> cut_types;
+
+    // The cuts generated from the node LP are only valid in the subtree, so they are kept out of
+    // the root pool. They are only generated when the leaf problem matches the rows of Arow_, i.e.,
+    // on the first pass and without the cuts of the ancestors.
+    if (generate_cuts && pass == 0 && parent_cuts == nullptr) {
+      cut_pool_t<i_t, f_t> local_pool(cut_problem.num_cols, cut_settings);
+      cut_generation_t<i_t, f_t> cut_generation(
+        local_pool, cut_problem, cut_settings, Arow_, new_slacks, var_types_);
+      cut_generation.generate_cuts(cut_problem,
+                                   cut_settings,
+                                   Arow_,
+                                   new_slacks,
+                                   var_types_,
+                                   basis_update,
+                                   cut_solution.x,
+                                   basic_list,
+                                   nonbasic_list);
+      local_pool.get_violated_cuts(cut_solution.x, max_cuts_per_pass, cuts, cut_rhs, cut_types);
+    }
+
+    csr_matrix_t<i_t, f_t> pool_cuts(0, cut_problem.num_cols, 0);
+    std::vector<f_t> pool_rhs;
+    std::vector<cut_type_t> pool_types;
+    cut_pool_->get_violated_cuts(
+      cut_solution.x, max_cuts_per_pass - cuts.m, pool_cuts, pool_rhs, pool_types);
+    if (pool_cuts.m > 0) {
+      cuts.append_rows(pool_cuts);
+      cut_rhs.insert(cut_rhs.end(), pool_rhs.begin(), pool_rhs.end());
+    }
+    if (cuts.m == 0) { break; }
+
+    if (add_cuts(settings_,
+                 cuts,
+                 cut_rhs,
+                 cut_problem,
+                 new_slacks,
+                 cut_solution,
+                 basis_update,
+                 basic_list,
+                 nonbasic_list,
+                 vstatus,
+                 edge_norms) != 0) {
+      break;
+    }
+    num_cuts += cuts.m;
+    added_cuts.n = std::max(added_cuts.n, cuts.n);
+    added_cuts.append_rows(cuts);
+    added_rhs.insert(added_rhs.end(), cut_rhs.begin(), cut_rhs.end());
+
+    i_t iter                     = 0;
+    cut_settings.iteration_limit = iteration_budget;
+    cut_settings.time_limit      = settings_.time_limit - toc(exploration_stats_.start_time);
+
+    status = dual_phase2_with_advanced_basis(2,
+                                             0,
+                                             false,
+                                             tic(),
+                                             cut_problem,
+                                             cut_settings,
+                                             vstatus,
+                                             basis_update,
+                                             basic_list,
+                                             nonbasic_list,
+                                             cut_solution,
+                                             iter,
+                                             edge_norms);
+    iteration_budget -= iter;
+    node_cut_lp_iters_ += iter;
+
+    if (status == dual::status_t::DUAL_UNBOUNDED || status == dual::status_t::CUTOFF) {
+      // The local cuts prove that the node can be pruned
+      ++node_cut_nodes_;
+      node_cut_count_ += num_cuts;
+      return status;
+    }
+    if (status != dual::status_t::OPTIMAL) { break; }
+
+    const f_t obj = compute_objective(cut_problem, cut_solution.x);
+    if (obj > leaf_obj) {
+      const i_t num_parent_cuts = parent_cuts != nullptr ? parent_cuts->num_cuts : 0;
+      node_cuts_t<i_t, f_t> node_cuts{
+        parent_cuts, added_cuts, added_rhs, num_parent_cuts + added_cuts.m};
+      node_ptr->cuts          = std::make_shared<const node_cuts_t<i_t, f_t>>(std::move(node_cuts));
+      node_ptr->vstatus       = vstatus;
+      worker->leaf_cuts       = node_ptr->cuts;
+      worker->leaf_problem    = cut_problem;
+      worker->leaf_solution   = cut_solution;
+      worker->leaf_edge_norms = edge_norms;
+      worker->basis_factors   = basis_update;
+      worker->basic_list      = basic_list;
+      worker->nonbasic_list   = nonbasic_list;
+      worker->basis_cache.clear();
+      improved = true;
+    }
+    if (obj - cut_obj <= min_change) { break; }
+    cut_obj = obj;
+  }
+
+  if (improved) {
+    ++node_cut_nodes_;
+    node_cut_count_ += num_cuts;
+  }
+  return dual::status_t::OPTIMAL;
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::plunge_with(branch_and_bound_worker_t<i_t, f_t>* worker)
 {
   std::deque<mip_node_t<i_t, f_t>*> stack;
   stack.push_front(worker->start_node);
+  const i_t start_depth    = worker->start_node->depth;
   worker->recompute_basis  = true;
   worker->recompute_bounds = true;
+  trace_task_begin(worker);
 
-  while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET) {
+  while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET && !restart_requested_ &&
+         !checkpoint_requested_) {
     mip_node_t<i_t, f_t>* node_ptr = stack.front();
     stack.pop_front();
 
@@ -1445,7 +2148,21 @@ void branch_and_bound_t<i_t, f_t>::plunge_with(branch_and_bound_worker_t<i_t, f_
       break;
     }
 
+    // Leave the rest of the plunge to the other workers when it strays too far from the best bound
+    if (!node_selector_.continue_plunge(
+          node_ptr->depth - start_depth, lower_bound, get_lower_bound(), upper_bound)) {
+      node_queue_.push(node_ptr);
+      for (mip_node_t<i_t, f_t>* node : stack) {
+        node_queue_.push(node);
+      }
+      stack.clear();
+      break;
+    }
+
+    const bool first_node    = node_ptr == worker->start_node;
+    f_t node_start_time      = tic();
     dual::status_t lp_status = solve_node_lp(node_ptr, worker, exploration_stats_, settings_.log);
+    node_selector_.record_node_lp(first_node, toc(node_start_time));
 
     if (lp_status == dual::status_t::TIME_LIMIT) {
       solver_status_ = mip_status_t::TIME_LIMIT;
@@ -1494,9 +2211,25 @@ void branch_and_bound_t<i_t, f_t>::plunge_with(branch_and_bound_worker_t<i_t, f_
 
         stack.push_front(node_ptr->get_down_child());
       }
+
+      // The sibling is solved by this worker if the first child is pruned
+      if (stack.size() > 1) {
+        const f_t cache_start = tic();
+        worker->basis_cache.insert(
+          worker->basis_factors, worker->basic_list, worker->nonbasic_list);
+        basis_cache_time_ += toc(cache_start);
+      }
+    }
+  }
+
+  // Hand the rest of the plunge back to the queue while a checkpoint is taken
+  if (checkpoint_requested_ && solver_status_ == mip_status_t::UNSET && !restart_requested_) {
+    for (mip_node_t<i_t, f_t>* node : stack) {
+      node_queue_.push(node);
     }
   }
 
+  trace_task_end(worker, 0.0);
   if (settings_.num_threads > 1) {
     worker_pool_.return_worker_to_pool(worker);
     active_workers_per_strategy_[BEST_FIRST]--;
@@ -1511,11 +2244,12 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
   log.log = false;
 
   search_strategy_t search_strategy = worker->search_strategy;
-  const i_t diving_node_limit       = settings_.diving_settings.node_limit;
-  const i_t diving_backtrack_limit  = settings_.diving_settings.backtrack_limit;
+  const i_t diving_node_limit       = node_selector_.dive_node_limit();
+  const i_t diving_backtrack_limit  = node_selector_.dive_backtrack_limit();
 
   worker->recompute_basis  = true;
   worker->recompute_bounds = true;
+  trace_task_begin(worker);
 
   search_tree_t<i_t, f_t> dive_tree(std::move(*worker->start_node));
   std::deque<mip_node_t<i_t, f_t>*> stack;
@@ -1527,7 +2261,8 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
   dive_stats.nodes_explored      = 0;
   dive_stats.nodes_unexplored    = 1;
 
-  while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET && is_running_) {
+  while (stack.size() > 0 && solver_status_ == mip_status_t::UNSET && is_running_ &&
+         !restart_requested_) {
     mip_node_t<i_t, f_t>* node_ptr = stack.front();
     stack.pop_front();
 
@@ -1569,6 +2304,10 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
         stack.push_front(node_ptr->get_up_child());
         stack.push_front(node_ptr->get_down_child());
       }
+      // For the backtracking
+      const f_t cache_start = tic();
+      worker->basis_cache.insert(worker->basis_factors, worker->basic_list, worker->nonbasic_list);
+      basis_cache_time_ += toc(cache_start);
     }
 
     // Remove nodes that we no longer can backtrack to (i.e., from the current node, we can only
@@ -1578,10 +2317,23 @@ void branch_and_bound_t<i_t, f_t>::dive_with(branch_and_bound_worker_t<i_t, f_t>
     }
   }
 
+  node_selector_.record_dive();
+  trace_task_end(worker, 0.0);
   worker_pool_.return_worker_to_pool(worker);
   active_workers_per_strategy_[search_strategy]--;
 }
 
+template <typename i_t, typename f_t>
+std::optional<mip_node_t<i_t, f_t>*> branch_and_bound_t<i_t, f_t>::pop_next_node(f_t rel_gap)
+{
+  const bool has_incumbent = std::isfinite(upper_bound_.load());
+  if (node_selector_.next_rule(rel_gap, has_incumbent) == node_rule_t::BEST_ESTIMATE) {
+    std::optional<mip_node_t<i_t, f_t>*> node = node_queue_.pop_best_estimate();
+    if (node.has_value()) { return node; }
+  }
+  return node_queue_.pop_best_first();
+}
+
 template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::run_scheduler()
 {
@@ -1594,6 +2346,7 @@ void branch_and_bound_t<i_t, f_t>::run_scheduler()
     get_max_workers(num_workers, strategies);
 
   worker_pool_.init(num_workers, original_lp_, Arow_, var_types_, settings_);
+  trial_pool_.init(settings_.num_threads);
   active_workers_per_strategy_.fill(0);
 
 #ifdef CUOPT_LOG_DEBUG
@@ -1620,6 +2373,21 @@ void branch_and_bound_t<i_t, f_t>::run_scheduler()
     rel_gap                = user_relative_gap(original_lp_, upper_bound_.load(), lower_bound);
 
     repair_heuristic_solutions();
+    node_queue_.spill_nodes();
+    prune_spilled_nodes();
+
+    if (checkpoint_requested_ && active_workers_per_strategy_[BEST_FIRST] == 0) {
+      save_checkpoint();
+      checkpoint_requested_ = false;
+    } else if (!checkpoint_requested_ && checkpoint_due()) {
+      // Stops the best-first workers at their next node, the dives keep running
+      checkpoint_requested_ = true;
+    }
+
+    if (should_restart()) {
+      restart_requested_ = true;
+      break;
+    }
 
     // If the guided diving was disabled previously due to the lack of an incumbent solution,
     // re-enable as soon as a new incumbent is found.
@@ -1671,8 +2439,10 @@ void branch_and_bound_t<i_t, f_t>::run_scheduler()
       if (worker == nullptr) { break; }
 
       if (strategy == BEST_FIRST) {
+        if (checkpoint_requested_) { continue; }
+
         // If there any node left in the heap, we pop the top node and explore it.
-        std::optional<mip_node_t<i_t, f_t>*> start_node = node_queue_.pop_best_first();
+        std::optional<mip_node_t<i_t, f_t>*> start_node = pop_next_node(rel_gap);
 
         if (!start_node.has_value()) { continue; }
         if (upper_bound_ < start_node.value()->lower_bound) {
@@ -1729,6 +2499,7 @@ template <typename i_t, typename f_t>
 void branch_and_bound_t<i_t, f_t>::single_threaded_solve()
 {
   branch_and_bound_worker_t<i_t, f_t> worker(0, original_lp_, Arow_, var_types_, settings_);
+  trial_pool_.init(1);
 
   f_t lower_bound = get_lower_bound();
   f_t abs_gap     = upper_bound_ - lower_bound;
@@ -1742,6 +2513,14 @@ void branch_and_bound_t<i_t, f_t>::single_threaded_solve()
     rel_gap                = user_relative_gap(original_lp_, upper_bound_.load(), lower_bound);
 
     repair_heuristic_solutions();
+    node_queue_.spill_nodes();
+    prune_spilled_nodes();
+    if (checkpoint_due()) { save_checkpoint(); }
+
+    if (should_restart()) {
+      restart_requested_ = true;
+      break;
+    }
 
     f_t now = toc(exploration_stats_.start_time);
     f_t time_since_last_log =
@@ -1764,7 +2543,7 @@ void branch_and_bound_t<i_t, f_t>::single_threaded_solve()
     }
 
     // If there any node left in the heap, we pop the top node and explore it.
-    std::optional<mip_node_t<i_t, f_t>*> start_node = node_queue_.pop_best_first();
+    std::optional<mip_node_t<i_t, f_t>*> start_node = pop_next_node(rel_gap);
 
     if (!start_node.has_value()) { continue; }
     if (upper_bound_ < start_node.value()->lower_bound) {
@@ -1819,95 +2598,23 @@ lp_status_t branch_and_bound_t<i_t, f_t>::solve_root_relaxation(
     continue;
   }
 
-  if (root_crossover_solution_set_.load(std::memory_order_acquire)) {
-    // Crush the root relaxation solution on converted user problem
-    std::vector<f_t> crushed_root_x;
-    crush_primal_solution(
-      original_problem_, original_lp_, root_crossover_soln_.x, new_slacks_, crushed_root_x);
-    std::vector<f_t> crushed_root_y;
-    std::vector<f_t> crushed_root_z;
-
-    f_t dual_res_inf = crush_dual_solution(original_problem_,
-                                           original_lp_,
-                                           new_slacks_,
-                                           root_crossover_soln_.y,
-                                           root_crossover_soln_.z,
-                                           crushed_root_y,
-                                           crushed_root_z);
-
-    root_crossover_soln_.x = crushed_root_x;
-    root_crossover_soln_.y = crushed_root_y;
-    root_crossover_soln_.z = crushed_root_z;
-
-    // Call crossover on the crushed solution
-    auto root_crossover_settings            = settings_;
-    root_crossover_settings.log.log         = false;
-    root_crossover_settings.concurrent_halt = get_root_concurrent_halt();
-    crossover_status_t crossover_status     = crossover(original_lp_,
-                                                    root_crossover_settings,
-                                                    root_crossover_soln_,
-                                                    exploration_stats_.start_time,
-                                                    root_crossover_soln_,
-                                                    crossover_vstatus_);
-
-    // Check if crossover was stopped by dual simplex
-    if (crossover_status == crossover_status_t::OPTIMAL) {
-      set_root_concurrent_halt(1);             // Stop dual simplex
-      root_status = root_status_future.get();  // Wait for dual simplex to finish
-      set_root_concurrent_halt(0);             // Clear the concurrent halt flag
-      // Override the root relaxation solution with the crossover solution
-      root_relax_soln = root_crossover_soln_;
-      root_vstatus    = crossover_vstatus_;
-      root_status     = lp_status_t::OPTIMAL;
-      basic_list.clear();
-      nonbasic_list.reserve(original_lp_.num_cols - original_lp_.num_rows);
-      nonbasic_list.clear();
-      // Get the basic list and nonbasic list from the vstatus
-      for (i_t j = 0; j < original_lp_.num_cols; j++) {
-        if (crossover_vstatus_[j] == variable_status_t::BASIC) {
-          basic_list.push_back(j);
-        } else {
-          nonbasic_list.push_back(j);
-        }
-      }
-      if (basic_list.size() != original_lp_.num_rows) {
-        settings_.log.printf(
-          "basic_list size %d != m %d\n", basic_list.size(), original_lp_.num_rows);
-        assert(basic_list.size() == original_lp_.num_rows);
-      }
-      if (nonbasic_list.size() != original_lp_.num_cols - original_lp_.num_rows) {
-        settings_.log.printf("nonbasic_list size %d != n - m %d\n",
-                             nonbasic_list.size(),
-                             original_lp_.num_cols - original_lp_.num_rows);
-        assert(nonbasic_list.size() == original_lp_.num_cols - original_lp_.num_rows);
-      }
-      // Populate the basis_update from the crossover vstatus
-      i_t refactor_status = basis_update.refactor_basis(original_lp_.A,
-                                                        root_crossover_settings,
-                                                        original_lp_.lower,
-                                                        original_lp_.upper,
-                                                        exploration_stats_.start_time,
-                                                        basic_list,
-                                                        nonbasic_list,
-                                                        crossover_vstatus_);
-      if (refactor_status != 0) {
-        settings_.log.printf("Failed to refactor basis. %d deficient columns.\n", refactor_status);
-        assert(refactor_status == 0);
-        root_status = lp_status_t::NUMERICAL_ISSUES;
-      }
-
-      // Set the edge norms to a default value
-      edge_norms.resize(original_lp_.num_cols, -1.0);
-      set_uninitialized_steepest_edge_norms<i_t, f_t>(original_lp_, basic_list, edge_norms);
-      user_objective = root_crossover_soln_.user_objective;
-      iter           = root_crossover_soln_.iterations;
-      solver_name    = "Barrier/PDLP and Crossover";
-    } else {
-      root_status    = root_status_future.get();
-      user_objective = root_relax_soln_.user_objective;
-      iter           = root_relax_soln_.iterations;
-      solver_name    = "Dual Simplex";
-    }
+  if (root_crossover_solution_set_.load(std::memory_order_acquire) &&
+      crossover_root_solution(
+        root_crossover_soln_, crossover_vstatus_, get_root_concurrent_halt())) {
+    // Crossover was not stopped by dual simplex
+    set_root_concurrent_halt(1);             // Stop dual simplex
+    root_status = root_status_future.get();  // Wait for dual simplex to finish
+    set_root_concurrent_halt(0);             // Clear the concurrent halt flag
+    // Override the root relaxation solution with the crossover solution
+    root_relax_soln = root_crossover_soln_;
+    root_vstatus    = crossover_vstatus_;
+    root_status     = set_root_basis(root_vstatus, basis_update, basic_list, nonbasic_list);
+    // Set the edge norms to a default value
+    edge_norms.resize(original_lp_.num_cols, -1.0);
+    set_uninitialized_steepest_edge_norms<i_t, f_t>(original_lp_, basic_list, edge_norms);
+    user_objective = root_crossover_soln_.user_objective;
+    iter           = root_crossover_soln_.iterations;
+    solver_name    = "Barrier/PDLP and Crossover";
   } else {
     root_status    = root_status_future.get();
     user_objective = root_relax_soln_.user_objective;
@@ -1915,11 +2622,233 @@ lp_status_t branch_and_bound_t<i_t, f_t>::solve_root_relaxation(
     solver_name    = "Dual Simplex";
   }
 
+  report_root_relaxation(root_status, iter, toc(start_time), solver_name, user_objective);
+  is_root_solution_set = true;
+
+  return root_status;
+}
+
+template <typename i_t, typename f_t>
+lp_status_t branch_and_bound_t<i_t, f_t>::solve_root_relaxation_cpu_concurrent(
+  simplex_solver_settings_t<i_t, f_t> const& lp_settings,
+  lp_solution_t<i_t, f_t>& root_relax_soln,
+  std::vector<variable_status_t>& root_vstatus,
+  basis_update_mpf_t<i_t, f_t>& basis_update,
+  std::vector<i_t>& basic_list,
+  std::vector<i_t>& nonbasic_list,
+  std::vector<f_t>& edge_norms)
+{
+  enum solver_id_t { DUAL_SIMPLEX = 0, SCALED_DUAL_SIMPLEX = 1, BARRIER = 2, NUM_SOLVERS = 3 };
+  const char* solver_names[NUM_SOLVERS] = {
+    "Dual Simplex", "Dual Simplex with column scaling", "Barrier and Crossover"};
+  f_t start_time = tic();
+
+  // Each solver has its own halt flag, since dual simplex and crossover raise theirs when they
+  // finish. The first solver to return a final status raises all of them.
+  std::array<std::atomic<int>, NUM_SOLVERS> halt{};
+  std::atomic<int> winner{-1};
+  auto finish = [&](solver_id_t id, bool final_status) {
+    int expected = -1;
+    if (final_status && winner.compare_exchange_strong(expected, id)) {
+      for (auto& flag : halt) {
+        flag = 1;
+      }
+    }
+  };
+  auto is_final = [](lp_status_t status) {
+    return status != lp_status_t::CONCURRENT_LIMIT && status != lp_status_t::NUMERICAL_ISSUES;
+  };
+
+  // Dual simplex on the scaled LP, with a different pivoting sequence
+  simplex_solver_settings_t<i_t, f_t> scaled_settings = lp_settings;
+  scaled_settings.scale_columns                       = true;
+  scaled_settings.log.log                             = false;
+  scaled_settings.concurrent_halt                     = &halt[SCALED_DUAL_SIMPLEX];
+  lp_solution_t<i_t, f_t> scaled_soln(original_lp_.num_rows, original_lp_.num_cols);
+  std::vector<variable_status_t> scaled_vstatus;
+  std::vector<f_t> scaled_edge_norms;
+  lp_status_t scaled_status = lp_status_t::UNSET;
+  auto scaled_future        = std::async(std::launch::async, [&]() {
+    basis_update_mpf_t<i_t, f_t> scaled_basis_update(original_lp_.num_rows,
+                                                     settings_.refactor_frequency);
+    std::vector<i_t> scaled_basic_list(original_lp_.num_rows);
+    std::vector<i_t> scaled_nonbasic_list;
+    scaled_status = solve_linear_program_with_advanced_basis(original_lp_,
+                                                             exploration_stats_.start_time,
+                                                             scaled_settings,
+                                                             scaled_soln,
+                                                             scaled_basis_update,
+                                                             scaled_basic_list,
+                                                             scaled_nonbasic_list,
+                                                             scaled_vstatus,
+                                                             scaled_edge_norms,
+                                                             nullptr);
+    finish(SCALED_DUAL_SIMPLEX, is_final(scaled_status));
+  });
+
+  // Barrier on the user problem, followed by crossover on the root LP. Only linear objectives
+  // are supported by the CPU barrier.
+  const bool run_barrier = original_problem_.Q_values.empty();
+  lp_solution_t<i_t, f_t> barrier_soln(original_problem_.num_rows, original_problem_.num_cols);
+  std::vector<variable_status_t> barrier_vstatus;
+  std::future<void> barrier_future;
+  if (run_barrier) {
+    barrier_future = std::async(std::launch::async, [&]() {
+      simplex_solver_settings_t<i_t, f_t> barrier_settings = settings_;
+      barrier_settings.log.log                             = false;
+      barrier_settings.crossover                           = false;
+      barrier_settings.cpu_barrier                         = 1;
+      barrier_settings.concurrent_halt                     = &halt[BARRIER];
+      // The two dual simplex solvers hold a thread each
+      barrier_settings.num_threads = std::max(1, static_cast<int>(settings_.num_threads) - 2);
+      const lp_status_t barrier_status = solve_linear_program_with_barrier(
+        original_problem_, barrier_settings, exploration_stats_.start_time, barrier_soln);
+      finish(BARRIER,
+             barrier_status == lp_status_t::OPTIMAL &&
+               crossover_root_solution(barrier_soln, barrier_vstatus, &halt[BARRIER]));
+    });
+  }
+
+  // Dual simplex with the settings of the root, on this thread
+  simplex_solver_settings_t<i_t, f_t> dual_settings = lp_settings;
+  dual_settings.concurrent_halt                     = &halt[DUAL_SIMPLEX];
+  lp_status_t root_status = solve_linear_program_with_advanced_basis(original_lp_,
+                                                                     exploration_stats_.start_time,
+                                                                     dual_settings,
+                                                                     root_relax_soln,
+                                                                     basis_update,
+                                                                     basic_list,
+                                                                     nonbasic_list,
+                                                                     root_vstatus,
+                                                                     edge_norms);
+  finish(DUAL_SIMPLEX, is_final(root_status));
+  // When dual simplex failed, the other solvers run until they finish or reach the limits
+  scaled_future.get();
+  if (run_barrier) { barrier_future.get(); }
+
+  const int id = std::max(winner.load(), static_cast<int>(DUAL_SIMPLEX));
+  if (id == SCALED_DUAL_SIMPLEX) {
+    root_relax_soln = scaled_soln;
+    root_vstatus    = scaled_vstatus;
+    root_status     = scaled_status;
+  } else if (id == BARRIER) {
+    root_relax_soln = barrier_soln;
+    root_vstatus    = barrier_vstatus;
+    root_status     = lp_status_t::OPTIMAL;
+  }
+  if (id != DUAL_SIMPLEX && root_status == lp_status_t::OPTIMAL) {
+    // The basis factorization and the edge norms of dual simplex belong to another basis
+    root_status = set_root_basis(root_vstatus, basis_update, basic_list, nonbasic_list);
+    edge_norms.assign(original_lp_.num_cols, -1.0);
+    set_uninitialized_steepest_edge_norms<i_t, f_t>(original_lp_, basic_list, edge_norms);
+  }
+
+  report_root_relaxation(root_status,
+                         root_relax_soln.iterations,
+                         toc(start_time),
+                         solver_names[id],
+                         root_relax_soln.user_objective);
+  is_root_solution_set = true;
+
+  return root_status;
+}
+
+template <typename i_t, typename f_t>
+bool branch_and_bound_t<i_t, f_t>::crossover_root_solution(lp_solution_t<i_t, f_t>& solution,
+                                                           std::vector<variable_status_t>& vstatus,
+                                                           std::atomic<int>* concurrent_halt)
+{
+  // Crush the root relaxation solution on converted user problem
+  std::vector<f_t> crushed_root_x;
+  crush_primal_solution(original_problem_, original_lp_, solution.x, new_slacks_, crushed_root_x);
+  std::vector<f_t> crushed_root_y;
+  std::vector<f_t> crushed_root_z;
+
+  crush_dual_solution(original_problem_,
+                      original_lp_,
+                      new_slacks_,
+                      solution.y,
+                      solution.z,
+                      crushed_root_y,
+                      crushed_root_z);
+
+  solution.x = crushed_root_x;
+  solution.y = crushed_root_y;
+  solution.z = crushed_root_z;
+
+  // Call crossover on the crushed solution
+  auto root_crossover_settings            = settings_;
+  root_crossover_settings.log.log         = false;
+  root_crossover_settings.concurrent_halt = concurrent_halt;
+  crossover_status_t crossover_status     = crossover(original_lp_,
+                                                  root_crossover_settings,
+                                                  solution,
+                                                  exploration_stats_.start_time,
+                                                  solution,
+                                                  vstatus);
+  return crossover_status == crossover_status_t::OPTIMAL;
+}
+
+template <typename i_t, typename f_t>
+lp_status_t branch_and_bound_t<i_t, f_t>::set_root_basis(
+  std::vector<variable_status_t>& vstatus,
+  basis_update_mpf_t<i_t, f_t>& basis_update,
+  std::vector<i_t>& basic_list,
+  std::vector<i_t>& nonbasic_list)
+{
+  basic_list.clear();
+  nonbasic_list.reserve(original_lp_.num_cols - original_lp_.num_rows);
+  nonbasic_list.clear();
+  // Get the basic list and nonbasic list from the vstatus
+  for (i_t j = 0; j < original_lp_.num_cols; j++) {
+    if (vstatus[j] == variable_status_t::BASIC) {
+      basic_list.push_back(j);
+    } else {
+      nonbasic_list.push_back(j);
+    }
+  }
+  if (basic_list.size() != original_lp_.num_rows) {
+    settings_.log.printf(
+      "basic_list size %d != m %d\n", basic_list.size(), original_lp_.num_rows);
+    assert(basic_list.size() == original_lp_.num_rows);
+  }
+  if (nonbasic_list.size() != original_lp_.num_cols - original_lp_.num_rows) {
+    settings_.log.printf("nonbasic_list size %d != n - m %d\n",
+                         nonbasic_list.size(),
+                         original_lp_.num_cols - original_lp_.num_rows);
+    assert(nonbasic_list.size() == original_lp_.num_cols - original_lp_.num_rows);
+  }
+  // Populate the basis_update from the vstatus
+  auto refactor_settings    = settings_;
+  refactor_settings.log.log = false;
+  i_t refactor_status       = basis_update.refactor_basis(original_lp_.A,
+                                                    refactor_settings,
+                                                    original_lp_.lower,
+                                                    original_lp_.upper,
+                                                    exploration_stats_.start_time,
+                                                    basic_list,
+                                                    nonbasic_list,
+                                                    vstatus);
+  if (refactor_status != 0) {
+    settings_.log.printf("Failed to refactor basis. %d deficient columns.\n", refactor_status);
+    assert(refactor_status == 0);
+    return lp_status_t::NUMERICAL_ISSUES;
+  }
+  return lp_status_t::OPTIMAL;
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::report_root_relaxation(lp_status_t root_status,
+                                                          i_t iter,
+                                                          f_t solve_time,
+                                                          const std::string& solver_name,
+                                                          f_t user_objective)
+{
   settings_.log.printf("\n");
   if (root_status == lp_status_t::OPTIMAL) {
     settings_.log.printf("Root relaxation solution found in %d iterations and %.2fs by %s\n",
                          iter,
-                         toc(start_time),
+                         solve_time,
                          solver_name.c_str());
     settings_.log.printf("Root relaxation objective %+.8e\n", user_objective);
   } else {
@@ -1928,9 +2857,6 @@ lp_status_t branch_and_bound_t<i_t, f_t>::solve_root_relaxation(
   }
 
   settings_.log.printf("\n");
-  is_root_solution_set = true;
-
-  return root_status;
 }
 
 template <typename i_t, typename f_t>
@@ -1947,6 +2873,14 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   exploration_stats_.nodes_explored   = 0;
   original_lp_.A.to_compressed_row(Arow_);
 
+  if (settings_.sub_mip == 0 &&
+      (!settings_.checkpoint_file.empty() || !settings_.resume_file.empty())) {
+    num_original_cols_         = original_lp_.num_cols;
+    problem_hash_              = hash_lp(original_lp_, var_types_, true);
+    deterministic_checkpoints_ = settings_.deterministic;
+    if (!settings_.resume_file.empty()) { read_resume_checkpoint(); }
+  }
+
   if (guess_.size() != 0) {
     raft::common::nvtx::range scope_guess("BB::check_initial_guess");
     std::vector<f_t> crushed_guess;
@@ -1965,6 +2899,10 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
     }
   }
 
+  if (resume_checkpoint_ && !resume_checkpoint_->incumbent.empty() && !deterministic_resume()) {
+    set_new_solution(resume_checkpoint_->incumbent);
+  }
+
   root_relax_soln_.resize(original_lp_.num_rows, original_lp_.num_cols);
 
   i_t original_rows                     = original_lp_.num_rows;
@@ -1977,7 +2915,30 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   basis_update_mpf_t<i_t, f_t> basis_update(original_lp_.num_rows, settings_.refactor_frequency);
   lp_status_t root_status;
 
-  if (!enable_concurrent_lp_root_solve()) {
+  // The race takes a thread for each dual simplex, the barrier gets the rest of the threads
+  const bool cpu_concurrent_root =
+    settings_.concurrent_root_lp == 1 ||
+    (settings_.concurrent_root_lp == -1 && !settings_.deterministic && settings_.sub_mip == 0 &&
+     settings_.num_threads >= 3);
+  if (enable_concurrent_lp_root_solve()) {
+    settings_.log.printf("\nSolving LP root relaxation in concurrent mode\n");
+    root_status = solve_root_relaxation(lp_settings,
+                                        root_relax_soln_,
+                                        root_vstatus_,
+                                        basis_update,
+                                        basic_list,
+                                        nonbasic_list,
+                                        edge_norms_);
+  } else if (cpu_concurrent_root) {
+    settings_.log.printf("\nSolving LP root relaxation in concurrent mode on the CPU\n");
+    root_status = solve_root_relaxation_cpu_concurrent(lp_settings,
+                                                       root_relax_soln_,
+                                                       root_vstatus_,
+                                                       basis_update,
+                                                       basic_list,
+                                                       nonbasic_list,
+                                                       edge_norms_);
+  } else {
     // RINS/SUBMIP path
     settings_.log.printf("\nSolving LP root relaxation with dual simplex\n");
     root_status = solve_linear_program_with_advanced_basis(original_lp_,
@@ -1989,15 +2950,6 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
                                                            nonbasic_list,
                                                            root_vstatus_,
                                                            edge_norms_);
-  } else {
-    settings_.log.printf("\nSolving LP root relaxation in concurrent mode\n");
-    root_status = solve_root_relaxation(lp_settings,
-                                        root_relax_soln_,
-                                        root_vstatus_,
-                                        basis_update,
-                                        basic_list,
-                                        nonbasic_list,
-                                        edge_norms_);
   }
   exploration_stats_.total_lp_iters      = root_relax_soln_.iterations;
   exploration_stats_.total_lp_solve_time = toc(exploration_stats_.start_time);
@@ -2077,9 +3029,18 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
       "|  Time  |\n");
   }
 
-  cut_pool_t<i_t, f_t> cut_pool(original_lp_.num_cols, settings_);
+  cut_pool_ = std::make_unique<cut_pool_t<i_t, f_t>>(original_lp_.num_cols, settings_);
+  if (resume_checkpoint_ && !deterministic_resume()) {
+    // The cuts of the checkpoint compete with the new ones in the cut passes of the root
+    const auto& cuts = resume_checkpoint_->cuts;
+    for (i_t i = 0; i < cuts.m; ++i) {
+      cut_pool_->add_cut(resume_checkpoint_->cut_types[i],
+                         sparse_vector_t<i_t, f_t>(cuts, i),
+                         resume_checkpoint_->cut_rhs[i]);
+    }
+  }
   cut_generation_t<i_t, f_t> cut_generation(
-    cut_pool, original_lp_, settings_, Arow_, new_slacks_, var_types_);
+    *cut_pool_, original_lp_, settings_, Arow_, new_slacks_, var_types_);
 
   std::vector<f_t> saved_solution;
 #ifdef CHECK_CUTS_AGAINST_SAVED_SOLUTION
@@ -2091,378 +3052,431 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
   f_t root_relax_objective = root_objective_;
 
   i_t cut_pool_size = 0;
-  for (i_t cut_pass = 0; cut_pass < settings_.max_cut_passes; cut_pass++) {
-    if (num_fractional == 0) {
-      set_solution_at_root(solution, cut_info);
-      return mip_status_t::OPTIMAL;
-    } else {
+  // The root is solved again on each restart of B&B, keeping the cut pool and the pseudo-costs
+  while (true) {
+    for (i_t cut_pass = 0; cut_pass < settings_.max_cut_passes; cut_pass++) {
+      if (num_fractional == 0) {
+        set_solution_at_root(solution, cut_info);
+        return mip_status_t::OPTIMAL;
+      } else {
 #ifdef PRINT_FRACTIONAL_INFO
-      settings_.log.printf(
-        "Found %d fractional variables on cut pass %d\n", num_fractional, cut_pass);
-      for (i_t j : fractional) {
-        settings_.log.printf("Fractional variable %d lower %e value %e upper %e\n",
-                             j,
-                             original_lp_.lower[j],
-                             root_relax_soln_.x[j],
-                             original_lp_.upper[j]);
-      }
+        settings_.log.printf(
+          "Found %d fractional variables on cut pass %d\n", num_fractional, cut_pass);
+        for (i_t j : fractional) {
+          settings_.log.printf("Fractional variable %d lower %e value %e upper %e\n",
+                               j,
+                               original_lp_.lower[j],
+                               root_relax_soln_.x[j],
+                               original_lp_.upper[j]);
+        }
 #endif
 
-      // Generate cuts and add them to the cut pool
-      f_t cut_start_time = tic();
-      cut_generation.generate_cuts(original_lp_,
-                                   settings_,
-                                   Arow_,
-                                   new_slacks_,
-                                   var_types_,
-                                   basis_update,
-                                   root_relax_soln_.x,
-                                   basic_list,
-                                   nonbasic_list);
-      f_t cut_generation_time = toc(cut_start_time);
-      if (cut_generation_time > 1.0) {
-        settings_.log.debug("Cut generation time %.2f seconds\n", cut_generation_time);
-      }
-      // Score the cuts
-      f_t score_start_time = tic();
-      cut_pool.score_cuts(root_relax_soln_.x);
-      f_t score_time = toc(score_start_time);
-      if (score_time > 1.0) { settings_.log.debug("Cut scoring time %.2f seconds\n", score_time); }
-      // Get the best cuts from the cut pool
-      csr_matrix_t<i_t, f_t> cuts_to_add(0, original_lp_.num_cols, 0);
-      std::vector<f_t> cut_rhs;
-      std::vector<cut_type_t> cut_types;
-      i_t num_cuts = cut_pool.get_best_cuts(cuts_to_add, cut_rhs, cut_types);
-      if (num_cuts == 0) { break; }
-      cut_info.record_cut_types(cut_types);
+        // Generate cuts and add them to the cut pool
+        f_t cut_start_time = tic();
+        cut_generation.generate_cuts(original_lp_,
+                                     settings_,
+                                     Arow_,
+                                     new_slacks_,
+                                     var_types_,
+                                     basis_update,
+                                     root_relax_soln_.x,
+                                     basic_list,
+                                     nonbasic_list);
+        f_t cut_generation_time = toc(cut_start_time);
+        if (cut_generation_time > 1.0) {
+          settings_.log.debug("Cut generation time %.2f seconds\n", cut_generation_time);
+        }
+        // Score the cuts
+        f_t score_start_time = tic();
+        cut_pool_->score_cuts(root_relax_soln_.x);
+        f_t score_time = toc(score_start_time);
+        if (score_time > 1.0) {
+          settings_.log.debug("Cut scoring time %.2f seconds\n", score_time);
+        }
+        // Get the best cuts from the cut pool
+        csr_matrix_t<i_t, f_t> cuts_to_add(0, original_lp_.num_cols, 0);
+        std::vector<f_t> cut_rhs;
+        std::vector<cut_type_t> cut_types;
+        i_t num_cuts = cut_pool_->get_best_cuts(cuts_to_add, cut_rhs, cut_types);
+        if (num_cuts == 0) { break; }
+        cut_info.record_cut_types(cut_types);
 #ifdef PRINT_CUT_POOL_TYPES
-      cut_pool.print_cutpool_types();
-      print_cut_types("In LP      ", cut_types, settings_);
-      printf("Cut pool size: %d\n", cut_pool.pool_size());
+        cut_pool_->print_cutpool_types();
+        print_cut_types("In LP      ", cut_types, settings_);
+        printf("Cut pool size: %d\n", cut_pool_->pool_size());
 #endif
 
 #ifdef CHECK_CUT_MATRIX
-      if (cuts_to_add.check_matrix() != 0) {
-        settings_.log.printf("Bad cuts matrix\n");
-        for (i_t i = 0; i < static_cast<i_t>(cut_types.size()); ++i) {
-          settings_.log.printf("row %d cut type %d\n", i, cut_types[i]);
+        if (cuts_to_add.check_matrix() != 0) {
+          settings_.log.printf("Bad cuts matrix\n");
+          for (i_t i = 0; i < static_cast<i_t>(cut_types.size()); ++i) {
+            settings_.log.printf("row %d cut type %d\n", i, cut_types[i]);
+          }
+          return mip_status_t::NUMERICAL;
         }
-        return mip_status_t::NUMERICAL;
-      }
 #endif
-      // Check against saved solution
+        // Check against saved solution
 #ifdef CHECK_CUTS_AGAINST_SAVED_SOLUTION
-      verify_cuts_against_saved_solution(cuts_to_add, cut_rhs, saved_solution);
+        verify_cuts_against_saved_solution(cuts_to_add, cut_rhs, saved_solution);
 #endif
-      cut_pool_size = cut_pool.pool_size();
-
-      // Resolve the LP with the new cuts
-      settings_.log.debug(
-        "Solving LP with %d cuts (%d cut nonzeros). Cuts in pool %d. Total constraints %d\n",
-        num_cuts,
-        cuts_to_add.row_start[cuts_to_add.m],
-        cut_pool.pool_size(),
-        cuts_to_add.m + original_lp_.num_rows);
-      lp_settings.log.log = false;
-
-      f_t add_cuts_start_time = tic();
-      mutex_original_lp_.lock();
-      i_t add_cuts_status = add_cuts(settings_,
-                                     cuts_to_add,
-                                     cut_rhs,
-                                     original_lp_,
-                                     new_slacks_,
-                                     root_relax_soln_,
-                                     basis_update,
-                                     basic_list,
-                                     nonbasic_list,
-                                     root_vstatus_,
-                                     edge_norms_);
-      var_types_.resize(original_lp_.num_cols, variable_type_t::CONTINUOUS);
-      mutex_original_lp_.unlock();
-      f_t add_cuts_time = toc(add_cuts_start_time);
-      if (add_cuts_time > 1.0) {
-        settings_.log.debug("Add cuts time %.2f seconds\n", add_cuts_time);
-      }
-      if (add_cuts_status != 0) {
-        settings_.log.printf("Failed to add cuts\n");
-        return mip_status_t::NUMERICAL;
-      }
+        cut_pool_size = cut_pool_->pool_size();
 
-      if (settings_.reduced_cost_strengthening >= 1 && upper_bound_.load() < last_upper_bound) {
-        mutex_upper_.lock();
-        last_upper_bound = upper_bound_.load();
-        std::vector<f_t> lower_bounds;
-        std::vector<f_t> upper_bounds;
-        find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
-        mutex_upper_.unlock();
+        // Resolve the LP with the new cuts
+        settings_.log.debug(
+          "Solving LP with %d cuts (%d cut nonzeros). Cuts in pool %d. Total constraints %d\n",
+          num_cuts,
+          cuts_to_add.row_start[cuts_to_add.m],
+          cut_pool_->pool_size(),
+          cuts_to_add.m + original_lp_.num_rows);
+        lp_settings.log.log = false;
+
+        f_t add_cuts_start_time = tic();
         mutex_original_lp_.lock();
-        original_lp_.lower = lower_bounds;
-        original_lp_.upper = upper_bounds;
+        i_t add_cuts_status = add_cuts(settings_,
+                                       cuts_to_add,
+                                       cut_rhs,
+                                       original_lp_,
+                                       new_slacks_,
+                                       root_relax_soln_,
+                                       basis_update,
+                                       basic_list,
+                                       nonbasic_list,
+                                       root_vstatus_,
+                                       edge_norms_);
+        var_types_.resize(original_lp_.num_cols, variable_type_t::CONTINUOUS);
         mutex_original_lp_.unlock();
-      }
+        f_t add_cuts_time = toc(add_cuts_start_time);
+        if (add_cuts_time > 1.0) {
+          settings_.log.debug("Add cuts time %.2f seconds\n", add_cuts_time);
+        }
+        if (add_cuts_status != 0) {
+          settings_.log.printf("Failed to add cuts\n");
+          return mip_status_t::NUMERICAL;
+        }
 
-      // Try to do bound strengthening
-      std::vector<bool> bounds_changed(original_lp_.num_cols, true);
-      std::vector<char> row_sense;
+        if (settings_.reduced_cost_strengthening >= 1 && upper_bound_.load() < last_upper_bound) {
+          mutex_upper_.lock();
+          last_upper_bound = upper_bound_.load();
+          std::vector<f_t> lower_bounds;
+          std::vector<f_t> upper_bounds;
+          find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
+          mutex_upper_.unlock();
+          mutex_original_lp_.lock();
+          original_lp_.lower = lower_bounds;
+          original_lp_.upper = upper_bounds;
+          mutex_original_lp_.unlock();
+        }
+
+        // Try to do bound strengthening
+        std::vector<bool> bounds_changed(original_lp_.num_cols, true);
+        std::vector<char> row_sense;
 #ifdef CHECK_MATRICES
-      settings_.log.printf("Before A check\n");
-      original_lp_.A.check_matrix();
+        settings_.log.printf("Before A check\n");
+        original_lp_.A.check_matrix();
 #endif
-      original_lp_.A.to_compressed_row(Arow_);
-
-      f_t node_presolve_start_time = tic();
-      bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
-      std::vector<f_t> new_lower = original_lp_.lower;
-      std::vector<f_t> new_upper = original_lp_.upper;
-      bool feasible =
-        node_presolve.bounds_strengthening(settings_, bounds_changed, new_lower, new_upper);
-      mutex_original_lp_.lock();
-      original_lp_.lower = new_lower;
-      original_lp_.upper = new_upper;
-      mutex_original_lp_.unlock();
-      f_t node_presolve_time = toc(node_presolve_start_time);
-      if (node_presolve_time > 1.0) {
-        settings_.log.debug("Node presolve time %.2f seconds\n", node_presolve_time);
-      }
-      if (!feasible) {
-        settings_.log.printf("Bound strengthening detected infeasibility\n");
-        return mip_status_t::INFEASIBLE;
-      }
+        original_lp_.A.to_compressed_row(Arow_);
+
+        f_t node_presolve_start_time = tic();
+        bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
+        std::vector<f_t> new_lower = original_lp_.lower;
+        std::vector<f_t> new_upper = original_lp_.upper;
+        bool feasible =
+          node_presolve.bounds_strengthening(settings_, bounds_changed, new_lower, new_upper);
+        mutex_original_lp_.lock();
+        original_lp_.lower = new_lower;
+        original_lp_.upper = new_upper;
+        mutex_original_lp_.unlock();
+        f_t node_presolve_time = toc(node_presolve_start_time);
+        if (node_presolve_time > 1.0) {
+          settings_.log.debug("Node presolve time %.2f seconds\n", node_presolve_time);
+        }
+        if (!feasible) {
+          settings_.log.printf("Bound strengthening detected infeasibility\n");
+          return mip_status_t::INFEASIBLE;
+        }
 
-      i_t iter                    = 0;
-      bool initialize_basis       = false;
-      lp_settings.concurrent_halt = NULL;
-      f_t dual_phase2_start_time  = tic();
-      dual::status_t cut_status   = dual_phase2_with_advanced_basis(2,
-                                                                  0,
-                                                                  initialize_basis,
-                                                                  exploration_stats_.start_time,
-                                                                  original_lp_,
-                                                                  lp_settings,
-                                                                  root_vstatus_,
-                                                                  basis_update,
-                                                                  basic_list,
-                                                                  nonbasic_list,
-                                                                  root_relax_soln_,
-                                                                  iter,
-                                                                  edge_norms_);
-      exploration_stats_.total_lp_iters += iter;
-      root_objective_      = compute_objective(original_lp_, root_relax_soln_.x);
-      f_t dual_phase2_time = toc(dual_phase2_start_time);
-      if (dual_phase2_time > 1.0) {
-        settings_.log.debug("Dual phase2 time %.2f seconds\n", dual_phase2_time);
-      }
-      if (cut_status == dual::status_t::TIME_LIMIT) {
-        solver_status_ = mip_status_t::TIME_LIMIT;
-        set_final_solution(solution, root_objective_);
-        return solver_status_;
-      }
+        i_t iter                    = 0;
+        bool initialize_basis       = false;
+        lp_settings.concurrent_halt = NULL;
+        f_t dual_phase2_start_time  = tic();
+        dual::status_t cut_status   = dual_phase2_with_advanced_basis(2,
+                                                                    0,
+                                                                    initialize_basis,
+                                                                    exploration_stats_.start_time,
+                                                                    original_lp_,
+                                                                    lp_settings,
+                                                                    root_vstatus_,
+                                                                    basis_update,
+                                                                    basic_list,
+                                                                    nonbasic_list,
+                                                                    root_relax_soln_,
+                                                                    iter,
+                                                                    edge_norms_);
+        exploration_stats_.total_lp_iters += iter;
+        root_objective_      = compute_objective(original_lp_, root_relax_soln_.x);
+        f_t dual_phase2_time = toc(dual_phase2_start_time);
+        if (dual_phase2_time > 1.0) {
+          settings_.log.debug("Dual phase2 time %.2f seconds\n", dual_phase2_time);
+        }
+        if (cut_status == dual::status_t::TIME_LIMIT) {
+          solver_status_ = mip_status_t::TIME_LIMIT;
+          set_final_solution(solution, root_objective_);
+          return solver_status_;
+        }
 
-      if (cut_status != dual::status_t::OPTIMAL) {
-        settings_.log.printf("Numerical issue at root node. Resolving from scratch\n");
-        lp_status_t scratch_status =
-          solve_linear_program_with_advanced_basis(original_lp_,
-                                                   exploration_stats_.start_time,
-                                                   lp_settings,
-                                                   root_relax_soln_,
-                                                   basis_update,
-                                                   basic_list,
-                                                   nonbasic_list,
-                                                   root_vstatus_,
-                                                   edge_norms_);
-        if (scratch_status == lp_status_t::OPTIMAL) {
-          // We recovered
-          cut_status = convert_lp_status_to_dual_status(scratch_status);
-          exploration_stats_.total_lp_iters += root_relax_soln_.iterations;
-          root_objective_ = compute_objective(original_lp_, root_relax_soln_.x);
-        } else {
-          settings_.log.printf("Cut status %s\n", dual::status_to_string(cut_status).c_str());
-          return mip_status_t::NUMERICAL;
+        if (cut_status != dual::status_t::OPTIMAL) {
+          settings_.log.printf("Numerical issue at root node. Resolving from scratch\n");
+          lp_status_t scratch_status =
+            solve_linear_program_with_advanced_basis(original_lp_,
+                                                     exploration_stats_.start_time,
+                                                     lp_settings,
+                                                     root_relax_soln_,
+                                                     basis_update,
+                                                     basic_list,
+                                                     nonbasic_list,
+                                                     root_vstatus_,
+                                                     edge_norms_);
+          if (scratch_status == lp_status_t::OPTIMAL) {
+            // We recovered
+            cut_status = convert_lp_status_to_dual_status(scratch_status);
+            exploration_stats_.total_lp_iters += root_relax_soln_.iterations;
+            root_objective_ = compute_objective(original_lp_, root_relax_soln_.x);
+          } else {
+            settings_.log.printf("Cut status %s\n", dual::status_to_string(cut_status).c_str());
+            return mip_status_t::NUMERICAL;
+          }
         }
-      }
 
-      f_t remove_cuts_start_time = tic();
-      mutex_original_lp_.lock();
-      remove_cuts(original_lp_,
-                  settings_,
-                  exploration_stats_.start_time,
-                  Arow_,
-                  new_slacks_,
-                  original_rows,
-                  var_types_,
-                  root_vstatus_,
-                  edge_norms_,
-                  root_relax_soln_.x,
-                  root_relax_soln_.y,
-                  root_relax_soln_.z,
-                  basic_list,
-                  nonbasic_list,
-                  basis_update);
-      mutex_original_lp_.unlock();
-      f_t remove_cuts_time = toc(remove_cuts_start_time);
-      if (remove_cuts_time > 1.0) {
-        settings_.log.debug("Remove cuts time %.2f seconds\n", remove_cuts_time);
-      }
-      fractional.clear();
-      num_fractional = fractional_variables(settings_, root_relax_soln_.x, var_types_, fractional);
+        f_t remove_cuts_start_time = tic();
+        mutex_original_lp_.lock();
+        remove_cuts(original_lp_,
+                    settings_,
+                    exploration_stats_.start_time,
+                    Arow_,
+                    new_slacks_,
+                    original_rows,
+                    var_types_,
+                    root_vstatus_,
+                    edge_norms_,
+                    root_relax_soln_.x,
+                    root_relax_soln_.y,
+                    root_relax_soln_.z,
+                    basic_list,
+                    nonbasic_list,
+                    basis_update);
+        mutex_original_lp_.unlock();
+        f_t remove_cuts_time = toc(remove_cuts_start_time);
+        if (remove_cuts_time > 1.0) {
+          settings_.log.debug("Remove cuts time %.2f seconds\n", remove_cuts_time);
+        }
+        fractional.clear();
+        num_fractional =
+          fractional_variables(settings_, root_relax_soln_.x, var_types_, fractional);
+
+        if (num_fractional == 0) {
+          upper_bound_ = root_objective_;
+          mutex_upper_.lock();
+          incumbent_.set_incumbent_solution(root_objective_, root_relax_soln_.x);
+          mutex_upper_.unlock();
+        }
+        f_t obj = upper_bound_.load();
+        report(' ', obj, root_objective_, 0, num_fractional);
+
+        f_t rel_gap = user_relative_gap(original_lp_, upper_bound_.load(), root_objective_);
+        f_t abs_gap = upper_bound_.load() - root_objective_;
+        if (rel_gap < settings_.relative_mip_gap_tol || abs_gap < settings_.absolute_mip_gap_tol) {
+          set_solution_at_root(solution, cut_info);
+          set_final_solution(solution, root_objective_);
+          return mip_status_t::OPTIMAL;
+        }
 
-      if (num_fractional == 0) {
-        upper_bound_ = root_objective_;
-        mutex_upper_.lock();
-        incumbent_.set_incumbent_solution(root_objective_, root_relax_soln_.x);
-        mutex_upper_.unlock();
+        f_t change_in_objective = root_objective_ - last_objective;
+        const f_t factor        = settings_.cut_change_threshold;
+        const f_t min_objective = 1e-3;
+        if (change_in_objective <=
+            factor * std::max(min_objective, std::abs(root_relax_objective))) {
+          settings_.log.debug(
+            "Change in objective %.16e is less than 1e-3 of root relax objective %.16e\n",
+            change_in_objective,
+            root_relax_objective);
+          break;
+        }
+        last_objective = root_objective_;
       }
-      f_t obj = upper_bound_.load();
-      report(' ', obj, root_objective_, 0, num_fractional);
+    }
 
-      f_t rel_gap = user_relative_gap(original_lp_, upper_bound_.load(), root_objective_);
-      f_t abs_gap = upper_bound_.load() - root_objective_;
-      if (rel_gap < settings_.relative_mip_gap_tol || abs_gap < settings_.absolute_mip_gap_tol) {
-        set_solution_at_root(solution, cut_info);
-        set_final_solution(solution, root_objective_);
-        return mip_status_t::OPTIMAL;
-      }
+    print_cut_info(settings_, cut_info);
 
-      f_t change_in_objective = root_objective_ - last_objective;
-      const f_t factor        = settings_.cut_change_threshold;
-      const f_t min_objective = 1e-3;
-      if (change_in_objective <= factor * std::max(min_objective, std::abs(root_relax_objective))) {
-        settings_.log.debug(
-          "Change in objective %.16e is less than 1e-3 of root relax objective %.16e\n",
-          change_in_objective,
-          root_relax_objective);
-        break;
-      }
-      last_objective = root_objective_;
+    if (cut_info.has_cuts()) {
+      settings_.log.printf("Cut pool size  : %d\n", cut_pool_size);
+      settings_.log.printf("Size with cuts : %d constraints, %d variables, %d nonzeros\n",
+                           original_lp_.num_rows,
+                           original_lp_.num_cols,
+                           original_lp_.A.col_start[original_lp_.A.n]);
     }
-  }
 
-  print_cut_info(settings_, cut_info);
+    set_uninitialized_steepest_edge_norms(original_lp_, basic_list, edge_norms_);
 
-  if (cut_info.has_cuts()) {
-    settings_.log.printf("Cut pool size  : %d\n", cut_pool_size);
-    settings_.log.printf("Size with cuts : %d constraints, %d variables, %d nonzeros\n",
-                         original_lp_.num_rows,
-                         original_lp_.num_cols,
-                         original_lp_.A.col_start[original_lp_.A.n]);
-  }
+    pc_.resize(original_lp_.num_cols);
+    if (resume_checkpoint_) {
+      // The pseudo-costs of the checkpoint replace strong branching
+      for (i_t j = 0; j < num_original_cols_; ++j) {
+        pc_.pseudo_cost_sum_down[j] = resume_checkpoint_->pseudo_cost_sum_down[j];
+        pc_.pseudo_cost_sum_up[j]   = resume_checkpoint_->pseudo_cost_sum_up[j];
+        pc_.pseudo_cost_num_down[j] = resume_checkpoint_->pseudo_cost_num_down[j];
+        pc_.pseudo_cost_num_up[j]   = resume_checkpoint_->pseudo_cost_num_up[j];
+      }
+    } else {
+      raft::common::nvtx::range scope_sb("BB::strong_branching");
+      strong_branching<i_t, f_t>(original_problem_,
+                                 original_lp_,
+                                 settings_,
+                                 exploration_stats_.start_time,
+                                 var_types_,
+                                 root_relax_soln_.x,
+                                 fractional,
+                                 root_objective_,
+                                 root_vstatus_,
+                                 edge_norms_,
+                                 pc_);
+    }
 
-  set_uninitialized_steepest_edge_norms(original_lp_, basic_list, edge_norms_);
+    if (toc(exploration_stats_.start_time) > settings_.time_limit) {
+      solver_status_ = mip_status_t::TIME_LIMIT;
+      set_final_solution(solution, root_objective_);
+      return solver_status_;
+    }
 
-  pc_.resize(original_lp_.num_cols);
-  {
-    raft::common::nvtx::range scope_sb("BB::strong_branching");
-    strong_branching<i_t, f_t>(original_problem_,
-                               original_lp_,
-                               settings_,
-                               exploration_stats_.start_time,
-                               var_types_,
-                               root_relax_soln_.x,
-                               fractional,
-                               root_objective_,
-                               root_vstatus_,
-                               edge_norms_,
-                               pc_);
-  }
+    if (settings_.reduced_cost_strengthening >= 2 && upper_bound_.load() < last_upper_bound) {
+      std::vector<f_t> lower_bounds;
+      std::vector<f_t> upper_bounds;
+      i_t num_fixed = find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
+      if (num_fixed > 0) {
+        std::vector<bool> bounds_changed(original_lp_.num_cols, true);
+        std::vector<char> row_sense;
 
-  if (toc(exploration_stats_.start_time) > settings_.time_limit) {
-    solver_status_ = mip_status_t::TIME_LIMIT;
-    set_final_solution(solution, root_objective_);
-    return solver_status_;
-  }
+        bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
 
-  if (settings_.reduced_cost_strengthening >= 2 && upper_bound_.load() < last_upper_bound) {
-    std::vector<f_t> lower_bounds;
-    std::vector<f_t> upper_bounds;
-    i_t num_fixed = find_reduced_cost_fixings(upper_bound_.load(), lower_bounds, upper_bounds);
-    if (num_fixed > 0) {
-      std::vector<bool> bounds_changed(original_lp_.num_cols, true);
-      std::vector<char> row_sense;
-
-      bounds_strengthening_t<i_t, f_t> node_presolve(original_lp_, Arow_, row_sense, var_types_);
-
-      mutex_original_lp_.lock();
-      original_lp_.lower = lower_bounds;
-      original_lp_.upper = upper_bounds;
-      bool feasible      = node_presolve.bounds_strengthening(
-        settings_, bounds_changed, original_lp_.lower, original_lp_.upper);
-      mutex_original_lp_.unlock();
-      if (!feasible) {
-        settings_.log.printf("Bound strengthening failed\n");
-        return mip_status_t::NUMERICAL;  // We had a feasible integer solution, but bound
-                                         // strengthening thinks we are infeasible.
-      }
-      // Go through and check the fractional variables and remove any that are now fixed to their
-      // bounds
-      std::vector<i_t> to_remove(fractional.size(), 0);
-      i_t num_to_remove = 0;
-      for (i_t k = 0; k < fractional.size(); k++) {
-        const i_t j = fractional[k];
-        if (std::abs(original_lp_.upper[j] - original_lp_.lower[j]) < settings_.fixed_tol) {
-          to_remove[k] = 1;
-          num_to_remove++;
+        mutex_original_lp_.lock();
+        original_lp_.lower = lower_bounds;
+        original_lp_.upper = upper_bounds;
+        bool feasible      = node_presolve.bounds_strengthening(
+          settings_, bounds_changed, original_lp_.lower, original_lp_.upper);
+        mutex_original_lp_.unlock();
+        if (!feasible) {
+          settings_.log.printf("Bound strengthening failed\n");
+          return mip_status_t::NUMERICAL;  // We had a feasible integer solution, but bound
+                                           // strengthening thinks we are infeasible.
         }
-      }
-      if (num_to_remove > 0) {
-        std::vector<i_t> new_fractional;
-        new_fractional.reserve(fractional.size() - num_to_remove);
+        // Go through and check the fractional variables and remove any that are now fixed to their
+        // bounds
+        std::vector<i_t> to_remove(fractional.size(), 0);
+        i_t num_to_remove = 0;
         for (i_t k = 0; k < fractional.size(); k++) {
-          if (!to_remove[k]) { new_fractional.push_back(fractional[k]); }
+          const i_t j = fractional[k];
+          if (std::abs(original_lp_.upper[j] - original_lp_.lower[j]) < settings_.fixed_tol) {
+            to_remove[k] = 1;
+            num_to_remove++;
+          }
+        }
+        if (num_to_remove > 0) {
+          std::vector<i_t> new_fractional;
+          new_fractional.reserve(fractional.size() - num_to_remove);
+          for (i_t k = 0; k < fractional.size(); k++) {
+            if (!to_remove[k]) { new_fractional.push_back(fractional[k]); }
+          }
+          fractional     = new_fractional;
+          num_fractional = fractional.size();
         }
-        fractional     = new_fractional;
-        num_fractional = fractional.size();
       }
     }
-  }
 
-  // Choose variable to branch on
-  i_t branch_var = pc_.variable_selection(fractional, root_relax_soln_.x, log);
+    search_tree_.root      = std::move(mip_node_t<i_t, f_t>(root_objective_, root_vstatus_));
+    search_tree_.num_nodes = 0;
+    search_tree_.graphviz_node(settings_.log, &search_tree_.root, "lower bound", root_objective_);
+    i_t num_open_nodes = 2;
+    if (resume_checkpoint_) {
+      num_open_nodes = restore_checkpoint_tree();
+    } else {
+      // Choose variable to branch on
+      i_t branch_var = pc_.variable_selection(fractional, root_relax_soln_.x, log);
+      search_tree_.branch(&search_tree_.root,
+                          branch_var,
+                          root_relax_soln_.x[branch_var],
+                          num_fractional,
+                          root_vstatus_,
+                          original_lp_,
+                          log);
+      node_queue_.push(search_tree_.root.get_down_child());
+      node_queue_.push(search_tree_.root.get_up_child());
+    }
+    if (std::isfinite(settings_.node_memory_limit) && !settings_.deterministic &&
+        !node_queue_.set_memory_limit(settings_.node_memory_limit, root_vstatus_)) {
+      settings_.log.printf("Warning: could not create the node spill file\n");
+    }
 
-  search_tree_.root      = std::move(mip_node_t<i_t, f_t>(root_objective_, root_vstatus_));
-  search_tree_.num_nodes = 0;
-  search_tree_.graphviz_node(settings_.log, &search_tree_.root, "lower bound", root_objective_);
-  search_tree_.branch(&search_tree_.root,
-                      branch_var,
-                      root_relax_soln_.x[branch_var],
-                      num_fractional,
-                      root_vstatus_,
-                      original_lp_,
-                      log);
-  node_queue_.push(search_tree_.root.get_down_child());
-  node_queue_.push(search_tree_.root.get_up_child());
+    settings_.log.printf("Exploring the B&B tree using %d threads\n\n", settings_.num_threads);
 
-  settings_.log.printf("Exploring the B&B tree using %d threads\n\n", settings_.num_threads);
+    exploration_stats_.nodes_unexplored     = num_open_nodes;
+    exploration_stats_.nodes_since_last_log = 0;
+    exploration_stats_.last_log             = tic();
+    min_node_queue_size_                    = 2 * settings_.num_threads;
+
+    if (settings_.diving_settings.coefficient_diving != 0) {
+      calculate_variable_locks(original_lp_, var_up_locks_, var_down_locks_);
+    }
+    if (settings_.deterministic) {
+      settings_.log.printf(
+        " | Explored | Unexplored |    Objective    |     Bound     | IntInf | Depth | Iter/Node "
+        "|   Gap    |  Work |  Time  |\n");
+    } else {
+      settings_.log.printf(
+        " | Explored | Unexplored |    Objective    |     Bound     | IntInf | Depth | Iter/Node "
+        "|   Gap    |  Time  |\n");
+    }
 
-  exploration_stats_.nodes_explored       = 0;
-  exploration_stats_.nodes_unexplored     = 2;
-  exploration_stats_.nodes_since_last_log = 0;
-  exploration_stats_.last_log             = tic();
-  min_node_queue_size_                    = 2 * settings_.num_threads;
+    node_selector_.init(settings_);
+    conflict_analysis_ = settings_.conflict_analysis != 0 && !settings_.deterministic;
+    node_cut_passes_   = settings_.node_cut_passes < 0 ? 2 : settings_.node_cut_passes;
+    if (settings_.deterministic) { node_cut_passes_ = 0; }
+
+    if (!settings_.tree_trace_file.empty() && num_restarts_ == 0) {
+      trace_ = std::make_unique<bb_trace_writer_t>(settings_.tree_trace_file,
+                                                   2 * settings_.num_threads,
+                                                   settings_.deterministic,
+                                                   toc(exploration_stats_.start_time));
+      if (!trace_->is_open()) {
+        settings_.log.printf("Warning: could not open B&B trace file %s\n",
+                             settings_.tree_trace_file.c_str());
+        trace_.reset();
+      }
+    }
 
-  if (settings_.diving_settings.coefficient_diving != 0) {
-    calculate_variable_locks(original_lp_, var_up_locks_, var_down_locks_);
-  }
-  if (settings_.deterministic) {
-    settings_.log.printf(
-      " | Explored | Unexplored |    Objective    |     Bound     | IntInf | Depth | Iter/Node "
-      "|   Gap    |  Work |  Time  |\n");
-  } else {
-    settings_.log.printf(
-      " | Explored | Unexplored |    Objective    |     Bound     | IntInf | Depth | Iter/Node "
-      "|   Gap    |  Time  |\n");
-  }
+    if (!settings_.checkpoint_file.empty() && settings_.sub_mip == 0 && num_restarts_ == 0) {
+      checkpoint_writer_ =
+        std::make_unique<bb_checkpoint_writer_t<i_t, f_t>>(settings_.checkpoint_file);
+      last_checkpoint_time_ = tic();
+    }
 
-  if (settings_.deterministic) {
-    run_deterministic_coordinator(Arow_);
-  } else if (settings_.num_threads > 1) {
+    if (settings_.deterministic) {
+      run_deterministic_coordinator(Arow_);
+    } else if (settings_.num_threads > 1) {
 #pragma omp parallel num_threads(settings_.num_threads)
-    {
+      {
 #pragma omp master
-      run_scheduler();
+        run_scheduler();
+      }
+    } else {
+      single_threaded_solve();
     }
-  } else {
-    single_threaded_solve();
+
+    if (!restart_requested_) { break; }
+    mip_status_t restart_status =
+      restart_root(solution, lp_settings, basis_update, basic_list, nonbasic_list, fractional);
+    if (restart_status != mip_status_t::UNSET) { return restart_status; }
+    num_fractional       = fractional.size();
+    last_objective       = root_objective_;
+    root_relax_objective = root_objective_;
   }
 
   is_running_ = false;
@@ -2498,6 +3512,8 @@ mip_status_t branch_and_bound_t<i_t, f_t>::solve(mip_solution_t<i_t, f_t>& solut
       lower_bound = search_tree_.root.lower_bound;
     }
   }
+  trace_bounds(lower_bound);
+  trace_.reset();
   set_final_solution(solution, lower_bound);
   return solver_status_;
 }
@@ -2623,7 +3639,7 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_coordinator(const csr_matri
 {
   raft::common::nvtx::range scope("BB::deterministic_coordinator");
 
-  deterministic_horizon_step_ = 0.50;
+  deterministic_horizon_step_ = settings_.deterministic_horizon_step;
 
   // Compute worker counts using the same formula as reliability-branching scheduler
   const i_t num_workers = 2 * settings_.num_threads;
@@ -2642,6 +3658,8 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_coordinator(const csr_matri
   deterministic_current_horizon_           = deterministic_horizon_step_;
   deterministic_horizon_number_            = 0;
   deterministic_global_termination_status_ = mip_status_t::UNSET;
+  deterministic_checkpoint_pending_        = false;
+  deterministic_last_checkpoint_           = 0.0;
 
   deterministic_workers_ = std::make_unique<deterministic_bfs_worker_pool_t<i_t, f_t>>(
     num_bfs_workers, original_lp_, Arow, var_types_, settings_);
@@ -2667,7 +3685,15 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_coordinator(const csr_matri
     }
   }
 
+  if (deterministic_diving_workers_) {
+    // Diving workers follow the BFS workers in the B&B trace
+    for (auto& worker : *deterministic_diving_workers_) {
+      worker.trace_id = num_bfs_workers + worker.worker_id;
+    }
+  }
+
   deterministic_scheduler_ = std::make_unique<work_unit_scheduler_t>(deterministic_horizon_step_);
+  deterministic_scheduler_->set_run_ahead(true);
 
   scoped_context_registrations_t context_registrations(*deterministic_scheduler_);
   for (auto& worker : *deterministic_workers_) {
@@ -2688,22 +3714,36 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_coordinator(const csr_matri
     actual_diving_workers,
     deterministic_horizon_step_);
 
-  search_tree_.root.get_down_child()->origin_worker_id = -1;
-  search_tree_.root.get_down_child()->creation_seq     = 0;
-  search_tree_.root.get_up_child()->origin_worker_id   = -1;
-  search_tree_.root.get_up_child()->creation_seq       = 1;
+  if (resume_checkpoint_) {
+    deterministic_resume_workers();
+  } else {
+    search_tree_.root.get_down_child()->origin_worker_id = -1;
+    search_tree_.root.get_down_child()->creation_seq     = 0;
+    search_tree_.root.get_up_child()->origin_worker_id   = -1;
+    search_tree_.root.get_up_child()->creation_seq       = 1;
 
-  (*deterministic_workers_)[0].enqueue_node(search_tree_.root.get_down_child());
-  (*deterministic_workers_)[1 % num_bfs_workers].enqueue_node(search_tree_.root.get_up_child());
+    (*deterministic_workers_)[0].enqueue_node(search_tree_.root.get_down_child());
+    (*deterministic_workers_)[1 % num_bfs_workers].enqueue_node(search_tree_.root.get_up_child());
+  }
 
   deterministic_scheduler_->set_sync_callback([this](double) { deterministic_sync_callback(); });
+  // Only the merge runs serially: workers sort their own outputs as soon as they reach the sync
+  // point, while the slower ones are still working, and copy the merged state back in parallel
+  deterministic_scheduler_->set_arrival_callback([this](work_limit_context_t& ctx, double) {
+    deterministic_with_worker(ctx, [](auto& worker) { worker.prepare_for_sync(); });
+  });
+  deterministic_scheduler_->set_release_callback([this](work_limit_context_t& ctx, double) {
+    deterministic_with_worker(
+      ctx, [this](auto& worker) { worker.set_snapshots(deterministic_snapshot_); });
+  });
 
   std::vector<f_t> incumbent_snapshot;
   if (incumbent_.has_incumbent) { incumbent_snapshot = incumbent_.x; }
 
-  deterministic_broadcast_snapshots(*deterministic_workers_, incumbent_snapshot);
+  deterministic_publish_snapshot(incumbent_snapshot);
+  deterministic_broadcast_snapshots(*deterministic_workers_);
   if (deterministic_diving_workers_) {
-    deterministic_broadcast_snapshots(*deterministic_diving_workers_, incumbent_snapshot);
+    deterministic_broadcast_snapshots(*deterministic_diving_workers_);
   }
 
   const int total_thread_count = num_bfs_workers + num_diving_workers;
@@ -2796,8 +3836,10 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_bfs_loop(
 {
   raft::common::nvtx::range scope("BB::worker_loop");
 
+  trace_task_begin(&worker);
   while (deterministic_global_termination_status_ == mip_status_t::UNSET) {
-    if (worker.has_work()) {
+    // No new node while a checkpoint is pending, see deterministic_checkpoint_boundary
+    if (worker.has_work() && !deterministic_checkpoint_pending_) {
       mip_node_t<i_t, f_t>* node = worker.dequeue_node();
       if (node == nullptr) { continue; }
 
@@ -2824,10 +3866,13 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_bfs_loop(
     }
 
     // No work - advance to sync point to participate in barrier
+    if (worker.task_nodes > 0) { trace_task_end(&worker, worker.clock); }
     f_t nowork_start = tic();
     deterministic_scheduler_->wait_for_next_sync(worker.work_context);
     worker.total_nowork_time += toc(nowork_start);
+    trace_task_begin(&worker);
   }
+  if (worker.task_nodes > 0) { trace_task_end(&worker, worker.clock); }
 }
 
 template <typename i_t, typename f_t>
@@ -2839,7 +3884,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
   double horizon_end = deterministic_current_horizon_;
 
   double wait_start = tic();
-  producer_sync_.wait_for_producers(horizon_end);
+  producer_sync_.wait_for_producers(horizon_end - deterministic_resume_work_);
   double wait_time = toc(wait_start);
   total_producer_wait_time_ += wait_time;
   max_producer_wait_time_ = std::max(max_producer_wait_time_, wait_time);
@@ -2864,9 +3909,16 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
     }
   }
 
-  deterministic_populate_diving_heap();
+  if (deterministic_checkpoints_ && !deterministic_checkpoint_pending_ &&
+      horizon_end >= deterministic_last_checkpoint_ + settings_.checkpoint_interval) {
+    deterministic_checkpoint_pending_ = true;
+  }
 
-  deterministic_assign_diving_nodes();
+  // The dives do not start while a checkpoint is pending
+  if (!deterministic_checkpoint_pending_) {
+    deterministic_populate_diving_heap();
+    deterministic_assign_diving_nodes();
+  }
 
   deterministic_balance_worker_loads();
 
@@ -2909,10 +3961,8 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
   std::vector<f_t> incumbent_snapshot;
   if (incumbent_.has_incumbent) { incumbent_snapshot = incumbent_.x; }
 
-  deterministic_broadcast_snapshots(*deterministic_workers_, incumbent_snapshot);
-  if (deterministic_diving_workers_) {
-    deterministic_broadcast_snapshots(*deterministic_diving_workers_, incumbent_snapshot);
-  }
+  // Each worker copies it in the scheduler's release callback
+  deterministic_publish_snapshot(incumbent_snapshot);
 
   f_t lower_bound = deterministic_compute_lower_bound();
   f_t upper_bound = upper_bound_.load();
@@ -2944,6 +3994,8 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
   // Signal shutdown to prevent threads from entering barriers after termination
   if (deterministic_global_termination_status_ != mip_status_t::UNSET) {
     deterministic_scheduler_->signal_shutdown();
+  } else if (deterministic_checkpoint_pending_) {
+    deterministic_checkpoint_boundary(horizon_end);
   }
 
   f_t time_since_last_log =
@@ -2979,6 +4031,168 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sync_callback()
 #endif
 }
 
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::deterministic_checkpoint_boundary(double horizon_end)
+{
+  // Every worker waits at the sync point or runs ahead in a node LP, which only touches its own
+  // state, so the nodes and the dives in progress are read without a race
+  for (const auto& worker : *deterministic_workers_) {
+    if (worker.current_node != nullptr) { return; }
+  }
+  if (deterministic_diving_workers_) {
+    for (const auto& worker : *deterministic_diving_workers_) {
+      if (worker.in_dive) { return; }
+    }
+  }
+
+  // The workers restart from the bases of their next nodes and the dive queues are refilled at the
+  // next sync point, as after a resume from this checkpoint
+  for (auto& worker : *deterministic_workers_) {
+    worker.last_solved_node = nullptr;
+  }
+  if (deterministic_diving_workers_) {
+    for (auto& worker : *deterministic_diving_workers_) {
+      worker.dive_queue.clear();
+    }
+  }
+  deterministic_checkpoint_pending_ = false;
+  deterministic_last_checkpoint_    = horizon_end;
+
+  if (checkpoint_writer_ != nullptr) { save_checkpoint(); }
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::deterministic_save_workers(
+  bb_checkpoint_t<i_t, f_t>& checkpoint,
+  const std::vector<const mip_node_t<i_t, f_t>*>& saved_nodes)
+{
+  std::unordered_map<const mip_node_t<i_t, f_t>*, i_t> index;
+  for (size_t k = 0; k < saved_nodes.size(); ++k) {
+    index[saved_nodes[k]] = k;
+  }
+  auto save_queue = [&index](const auto& nodes, std::vector<i_t>& saved) {
+    for (const mip_node_t<i_t, f_t>* node : nodes) {
+      auto it = index.find(node);
+      assert(it != index.end());
+      if (it != index.end()) { saved.push_back(it->second); }
+    }
+  };
+
+  for (const auto& worker : *deterministic_workers_) {
+    bb_checkpoint_worker_t<i_t, f_t> saved{};
+    save_queue(worker.plunge_stack, saved.plunge_stack);
+    save_queue(worker.backlog.data(), saved.backlog);
+    saved.clock                     = worker.clock;
+    saved.work_units                = worker.work_context.global_work_units_elapsed;
+    saved.next_creation_seq         = worker.next_creation_seq;
+    saved.event_sequence            = worker.event_sequence;
+    saved.next_solution_seq         = worker.next_solution_seq;
+    saved.local_lower_bound_ceiling = worker.local_lower_bound_ceiling;
+    checkpoint.bfs_workers.push_back(std::move(saved));
+  }
+  if (deterministic_diving_workers_) {
+    for (const auto& worker : *deterministic_diving_workers_) {
+      bb_checkpoint_worker_t<i_t, f_t> saved{};
+      saved.clock             = worker.clock;
+      saved.work_units        = worker.work_context.global_work_units_elapsed;
+      saved.next_solution_seq = worker.next_solution_seq;
+      checkpoint.diving_workers.push_back(std::move(saved));
+    }
+  }
+
+  checkpoint.num_syncs           = deterministic_horizon_number_;
+  checkpoint.horizon             = deterministic_last_checkpoint_;
+  checkpoint.next_horizon        = deterministic_current_horizon_;
+  checkpoint.upper_bound         = upper_bound_.load();
+  checkpoint.lower_bound_ceiling = lower_bound_ceiling_.load();
+  checkpoint.total_lp_iters      = exploration_stats_.total_lp_iters;
+  if (incumbent_.has_incumbent) { checkpoint.crushed_incumbent = incumbent_.x; }
+}
+
+template <typename i_t, typename f_t>
+void branch_and_bound_t<i_t, f_t>::deterministic_resume_workers()
+{
+  const auto& checkpoint = *resume_checkpoint_;
+  const size_t num_bfs_workers = deterministic_workers_->size();
+  const size_t num_diving_workers =
+    deterministic_diving_workers_ ? deterministic_diving_workers_->size() : 0;
+  const bool same_search = checkpoint.is_deterministic() &&
+                           checkpoint.bfs_workers.size() == num_bfs_workers &&
+                           checkpoint.diving_workers.size() == num_diving_workers &&
+                           checkpoint.lp_hash == hash_lp(original_lp_, var_types_, false);
+
+  if (!same_search) {
+    // The open nodes are spread over the backlogs. The search is deterministic from there, but
+    // does not follow the run that wrote the checkpoint.
+    if (checkpoint.is_deterministic()) {
+      settings_.log.printf(
+        "The checkpoint was taken with other workers or another root LP. The search does not "
+        "continue its trajectory.\n");
+      if (!checkpoint.incumbent.empty()) { set_new_solution(checkpoint.incumbent); }
+    }
+    for (size_t k = 0; k < resume_nodes_.size(); ++k) {
+      mip_node_t<i_t, f_t>* node = resume_nodes_[k];
+      if (node == nullptr || !checkpoint.nodes[k].is_open) { continue; }
+      node->origin_worker_id = -1;
+      node->creation_seq     = k;
+      auto& worker           = (*deterministic_workers_)[k % num_bfs_workers];
+      worker.backlog.push(node);
+      ++worker.total_nodes_assigned;
+    }
+    resume_checkpoint_.reset();
+    resume_nodes_.clear();
+    return;
+  }
+
+  // The backlogs are pushed in the order of their heaps, which rebuilds the same heaps
+  for (size_t w = 0; w < num_bfs_workers; ++w) {
+    auto& worker      = (*deterministic_workers_)[w];
+    const auto& saved = checkpoint.bfs_workers[w];
+    for (i_t k : saved.plunge_stack) {
+      if (resume_nodes_[k] != nullptr) { worker.plunge_stack.push_back(resume_nodes_[k]); }
+    }
+    for (i_t k : saved.backlog) {
+      if (resume_nodes_[k] != nullptr) { worker.backlog.push(resume_nodes_[k]); }
+    }
+    worker.total_nodes_assigned += worker.queue_size();
+    worker.clock                                  = saved.clock;
+    worker.work_context.global_work_units_elapsed = saved.work_units;
+    worker.next_creation_seq                      = saved.next_creation_seq;
+    worker.event_sequence                         = saved.event_sequence;
+    worker.next_solution_seq                      = saved.next_solution_seq;
+    worker.local_lower_bound_ceiling              = saved.local_lower_bound_ceiling;
+  }
+  for (size_t w = 0; w < num_diving_workers; ++w) {
+    auto& worker      = (*deterministic_diving_workers_)[w];
+    const auto& saved = checkpoint.diving_workers[w];
+    worker.clock                                  = saved.clock;
+    worker.work_context.global_work_units_elapsed = saved.work_units;
+    worker.next_solution_seq                      = saved.next_solution_seq;
+  }
+
+  deterministic_scheduler_->resume_at_sync(checkpoint.num_syncs);
+  deterministic_horizon_number_                = checkpoint.num_syncs;
+  deterministic_current_horizon_               = checkpoint.next_horizon;
+  deterministic_last_checkpoint_               = checkpoint.horizon;
+  deterministic_resume_work_                   = checkpoint.horizon;
+  work_unit_context_.global_work_units_elapsed = checkpoint.horizon;
+
+  // The incumbent is restored as the search had it, without the repair of set_new_solution
+  if (!checkpoint.crushed_incumbent.empty()) {
+    mutex_upper_.lock();
+    incumbent_.set_incumbent_solution(checkpoint.upper_bound, checkpoint.crushed_incumbent);
+    upper_bound_ = checkpoint.upper_bound;
+    mutex_upper_.unlock();
+  }
+  lower_bound_ceiling_              = checkpoint.lower_bound_ceiling;
+  exploration_stats_.total_lp_iters = checkpoint.total_lp_iters;
+
+  settings_.log.printf("Resuming the deterministic search at %.2f work units\n",
+                       checkpoint.horizon);
+  resume_checkpoint_.reset();
+  resume_nodes_.clear();
+}
+
 template <typename i_t, typename f_t>
 node_status_t branch_and_bound_t<i_t, f_t>::solve_node_deterministic(
   deterministic_bfs_worker_t<i_t, f_t>& worker,
@@ -3020,12 +4234,16 @@ node_status_t branch_and_bound_t<i_t, f_t>::solve_node_deterministic(
 
   if (settings_.deterministic) {
     // TEMP APPROXIMATION;
-    worker.work_context.record_work_sync_on_horizon(worker.node_presolver.last_nnz_processed / 1e8);
+    worker.work_context.record_work_counts(single_kernel_work(
+      work_kernel_t::BOUND_STRENGTHENING, worker.node_presolver.last_nnz_processed));
   }
 #endif
 
   if (!feasible) {
     node_ptr->lower_bound = std::numeric_limits<f_t>::infinity();
+    worker.node_lp_iters  = 0;
+    worker.node_lp_time   = 0.0;
+    trace_node(&worker, node_ptr, node_status_t::INFEASIBLE);
     search_tree.update(node_ptr, node_status_t::INFEASIBLE);
     worker.record_infeasible(node_ptr);
     --exploration_stats_.nodes_unexplored;
@@ -3041,40 +4259,47 @@ node_status_t branch_and_bound_t<i_t, f_t>::solve_node_deterministic(
   f_t lp_start_time                            = tic();
   std::vector<f_t> leaf_edge_norms             = edge_norms_;
 
-  dual::status_t lp_status = dual_phase2_with_advanced_basis(2,
-                                                             0,
-                                                             worker.recompute_bounds_and_basis,
-                                                             lp_start_time,
-                                                             worker.leaf_problem,
-                                                             lp_settings,
-                                                             leaf_vstatus,
-                                                             worker.basis_factors,
-                                                             worker.basic_list,
-                                                             worker.nonbasic_list,
-                                                             worker.leaf_solution,
-                                                             node_iter,
-                                                             leaf_edge_norms,
-                                                             &worker.work_context);
-
-  if (lp_status == dual::status_t::NUMERICAL) {
-    settings_.log.printf("Numerical issue node %d. Resolving from scratch.\n", node_ptr->node_id);
-    lp_status_t second_status = solve_linear_program_with_advanced_basis(worker.leaf_problem,
-                                                                         lp_start_time,
-                                                                         lp_settings,
-                                                                         worker.leaf_solution,
-                                                                         worker.basis_factors,
-                                                                         worker.basic_list,
-                                                                         worker.nonbasic_list,
-                                                                         leaf_vstatus,
-                                                                         leaf_edge_norms,
-                                                                         &worker.work_context);
-    lp_status                 = convert_lp_status_to_dual_status(second_status);
+  dual::status_t lp_status;
+  {
+    // The LP only touches the state of the worker, so it can run past the sync point
+    scoped_run_ahead_t run_ahead(*deterministic_scheduler_, worker.work_context);
+    lp_status = dual_phase2_with_advanced_basis(2,
+                                                0,
+                                                worker.recompute_bounds_and_basis,
+                                                lp_start_time,
+                                                worker.leaf_problem,
+                                                lp_settings,
+                                                leaf_vstatus,
+                                                worker.basis_factors,
+                                                worker.basic_list,
+                                                worker.nonbasic_list,
+                                                worker.leaf_solution,
+                                                node_iter,
+                                                leaf_edge_norms,
+                                                &worker.work_context);
+
+    if (lp_status == dual::status_t::NUMERICAL) {
+      settings_.log.printf("Numerical issue node %d. Resolving from scratch.\n", node_ptr->node_id);
+      lp_status_t second_status = solve_linear_program_with_advanced_basis(worker.leaf_problem,
+                                                                           lp_start_time,
+                                                                           lp_settings,
+                                                                           worker.leaf_solution,
+                                                                           worker.basis_factors,
+                                                                           worker.basic_list,
+                                                                           worker.nonbasic_list,
+                                                                           leaf_vstatus,
+                                                                           leaf_edge_norms,
+                                                                           &worker.work_context);
+      lp_status                 = convert_lp_status_to_dual_status(second_status);
+    }
   }
 
   double work_performed = worker.work_context.global_work_units_elapsed - work_units_at_start;
   worker.clock += work_performed;
 
-  exploration_stats_.total_lp_solve_time += toc(lp_start_time);
+  worker.node_lp_iters = node_iter;
+  worker.node_lp_time  = toc(lp_start_time);
+  exploration_stats_.total_lp_solve_time += worker.node_lp_time;
   exploration_stats_.total_lp_iters += node_iter;
   ++exploration_stats_.nodes_explored;
   --exploration_stats_.nodes_unexplored;
@@ -3148,27 +4373,56 @@ template <typename PoolT>
 void branch_and_bound_t<i_t, f_t>::deterministic_merge_pseudo_cost_updates(PoolT& pool)
 {
   std::vector<pseudo_cost_update_t<i_t, f_t>> all_pc_updates;
+  std::vector<size_t> run_ends;
   for (auto& worker : pool) {
+    // Normally already taken and sorted by the worker when it reached the sync point
     auto updates = worker.pc_snapshot.take_updates();
+    all_pc_updates.insert(
+      all_pc_updates.end(), worker.pending_pc_updates.begin(), worker.pending_pc_updates.end());
     all_pc_updates.insert(all_pc_updates.end(), updates.begin(), updates.end());
+    worker.pending_pc_updates.clear();
+    run_ends.push_back(all_pc_updates.size());
   }
-  std::sort(all_pc_updates.begin(), all_pc_updates.end());
+  merge_sorted_runs(all_pc_updates, run_ends);
   pc_.merge_updates(all_pc_updates);
 }
 
 template <typename i_t, typename f_t>
-template <typename PoolT>
-void branch_and_bound_t<i_t, f_t>::deterministic_broadcast_snapshots(
-  PoolT& pool, const std::vector<f_t>& incumbent_snapshot)
+void branch_and_bound_t<i_t, f_t>::deterministic_publish_snapshot(
+  const std::vector<f_t>& incumbent_snapshot)
 {
-  deterministic_snapshot_t<i_t, f_t> snap;
-  snap.upper_bound    = upper_bound_.load();
-  snap.total_lp_iters = exploration_stats_.total_lp_iters.load();
-  snap.incumbent      = incumbent_snapshot;
-  snap.pc_snapshot    = pc_.create_snapshot();
+  deterministic_snapshot_.upper_bound    = upper_bound_.load();
+  deterministic_snapshot_.total_lp_iters = exploration_stats_.total_lp_iters.load();
+  deterministic_snapshot_.incumbent      = incumbent_snapshot;
+  deterministic_snapshot_.pc_snapshot    = pc_.create_snapshot();
+}
 
+template <typename i_t, typename f_t>
+template <typename PoolT>
+void branch_and_bound_t<i_t, f_t>::deterministic_broadcast_snapshots(PoolT& pool)
+{
   for (auto& worker : pool) {
-    worker.set_snapshots(snap);
+    worker.set_snapshots(deterministic_snapshot_);
+  }
+}
+
+template <typename i_t, typename f_t>
+template <typename Func>
+void branch_and_bound_t<i_t, f_t>::deterministic_with_worker(work_limit_context_t& ctx, Func&& fn)
+{
+  for (auto& worker : *deterministic_workers_) {
+    if (&worker.work_context == &ctx) {
+      fn(worker);
+      return;
+    }
+  }
+  if (deterministic_diving_workers_) {
+    for (auto& worker : *deterministic_diving_workers_) {
+      if (&worker.work_context == &ctx) {
+        fn(worker);
+        return;
+      }
+    }
   }
 }
 
@@ -3205,8 +4459,13 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sort_replay_events(
         if (success) {
           // Queue repaired solution with work unit timestamp (...workstamp?)
           mutex_heuristic_queue_.lock();
-          heuristic_solution_queue_.push_back(
-            {repaired_obj, std::move(repaired_solution), 0, -1, 0, deterministic_current_horizon_});
+          heuristic_solution_queue_.push_back({repaired_obj,
+                                               std::move(repaired_solution),
+                                               0,
+                                               -1,
+                                               0,
+                                               deterministic_current_horizon_ -
+                                                 deterministic_resume_work_});
           mutex_heuristic_queue_.unlock();
         }
       }
@@ -3220,7 +4479,7 @@ void branch_and_bound_t<i_t, f_t>::deterministic_sort_replay_events(
   {
     std::vector<queued_integer_solution_t<i_t, f_t>> future_solutions;
     for (auto& sol : heuristic_solution_queue_) {
-      if (sol.work_timestamp < deterministic_current_horizon_) {
+      if (sol.work_timestamp + deterministic_resume_work_ < deterministic_current_horizon_) {
         heuristic_solutions.push_back(std::move(sol));
       } else {
         future_solutions.push_back(std::move(sol));
@@ -3552,11 +4811,14 @@ void branch_and_bound_t<i_t, f_t>::run_deterministic_diving_loop(
   raft::common::nvtx::range scope("BB::diving_worker_loop");
 
   while (deterministic_global_termination_status_ == mip_status_t::UNSET) {
-    // Process dives from queue until empty or horizon exhausted
-    auto entry_opt = worker.dequeue_dive_node();
-    if (entry_opt.has_value()) {
-      deterministic_dive(worker, std::move(entry_opt.value()));
-      continue;
+    // Process dives from queue until empty or horizon exhausted. No new dive while a checkpoint is
+    // pending, see deterministic_checkpoint_boundary.
+    if (!deterministic_checkpoint_pending_) {
+      auto entry_opt = worker.dequeue_dive_node();
+      if (entry_opt.has_value()) {
+        deterministic_dive(worker, std::move(entry_opt.value()));
+        continue;
+      }
     }
 
     // Queue empty - wait for next sync point where we'll be assigned new nodes
@@ -3586,9 +4848,12 @@ void branch_and_bound_t<i_t, f_t>::deterministic_dive(
   i_t nodes_this_dive               = 0;
   worker.lp_iters_this_dive         = 0;
   worker.recompute_bounds_and_basis = true;
+  worker.in_dive                    = true;
+  trace_task_begin(&worker);
 
+  // A pending checkpoint ends the dive
   while (!stack.empty() && deterministic_global_termination_status_ == mip_status_t::UNSET &&
-         nodes_this_dive < max_nodes_per_dive) {
+         nodes_this_dive < max_nodes_per_dive && !deterministic_checkpoint_pending_) {
     mip_node_t<i_t, f_t>* node_ptr = stack.front();
     stack.pop_front();
 
@@ -3629,8 +4894,8 @@ void branch_and_bound_t<i_t, f_t>::deterministic_dive(
 
     if (settings_.deterministic) {
       // TEMP APPROXIMATION;
-      worker.work_context.record_work_sync_on_horizon(worker.node_presolver.last_nnz_processed /
-                                                      1e8);
+      worker.work_context.record_work_counts(single_kernel_work(
+        work_kernel_t::BOUND_STRENGTHENING, worker.node_presolver.last_nnz_processed));
     }
 
     if (!feasible) {
@@ -3653,38 +4918,45 @@ void branch_and_bound_t<i_t, f_t>::deterministic_dive(
     f_t lp_start_time                            = tic();
     std::vector<f_t> leaf_edge_norms             = edge_norms_;
 
-    dual::status_t lp_status = dual_phase2_with_advanced_basis(2,
-                                                               0,
-                                                               worker.recompute_bounds_and_basis,
-                                                               lp_start_time,
-                                                               worker.leaf_problem,
-                                                               lp_settings,
-                                                               leaf_vstatus,
-                                                               worker.basis_factors,
-                                                               worker.basic_list,
-                                                               worker.nonbasic_list,
-                                                               worker.leaf_solution,
-                                                               node_iter,
-                                                               leaf_edge_norms,
-                                                               &worker.work_context);
-
-    if (lp_status == dual::status_t::NUMERICAL) {
-      lp_status_t second_status = solve_linear_program_with_advanced_basis(worker.leaf_problem,
-                                                                           lp_start_time,
-                                                                           lp_settings,
-                                                                           worker.leaf_solution,
-                                                                           worker.basis_factors,
-                                                                           worker.basic_list,
-                                                                           worker.nonbasic_list,
-                                                                           leaf_vstatus,
-                                                                           leaf_edge_norms,
-                                                                           &worker.work_context);
-      lp_status                 = convert_lp_status_to_dual_status(second_status);
+    dual::status_t lp_status;
+    {
+      // The LP only touches the state of the worker, so it can run past the sync point
+      scoped_run_ahead_t run_ahead(*deterministic_scheduler_, worker.work_context);
+      lp_status = dual_phase2_with_advanced_basis(2,
+                                                  0,
+                                                  worker.recompute_bounds_and_basis,
+                                                  lp_start_time,
+                                                  worker.leaf_problem,
+                                                  lp_settings,
+                                                  leaf_vstatus,
+                                                  worker.basis_factors,
+                                                  worker.basic_list,
+                                                  worker.nonbasic_list,
+                                                  worker.leaf_solution,
+                                                  node_iter,
+                                                  leaf_edge_norms,
+                                                  &worker.work_context);
+
+      if (lp_status == dual::status_t::NUMERICAL) {
+        lp_status_t second_status = solve_linear_program_with_advanced_basis(worker.leaf_problem,
+                                                                             lp_start_time,
+                                                                             lp_settings,
+                                                                             worker.leaf_solution,
+                                                                             worker.basis_factors,
+                                                                             worker.basic_list,
+                                                                             worker.nonbasic_list,
+                                                                             leaf_vstatus,
+                                                                             leaf_edge_norms,
+                                                                             &worker.work_context);
+        lp_status                 = convert_lp_status_to_dual_status(second_status);
+      }
     }
 
     ++nodes_this_dive;
     ++worker.total_nodes_explored;
     worker.lp_iters_this_dive += node_iter;
+    worker.node_lp_iters = node_iter;
+    worker.node_lp_time  = toc(lp_start_time);
 
     worker.clock = worker.work_context.global_work_units_elapsed;
 
@@ -3696,6 +4968,8 @@ void branch_and_bound_t<i_t, f_t>::deterministic_dive(
     deterministic_diving_policy_t<i_t, f_t> policy{*this, worker, stack, max_backtrack_depth};
     update_tree_impl(node_ptr, dive_tree, &worker, lp_status, policy);
   }
+  worker.in_dive = false;
+  trace_task_end(&worker, worker.clock);
 }
 
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
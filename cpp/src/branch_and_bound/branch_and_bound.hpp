@@ -7,13 +7,18 @@
 
 #pragma once
 
+#include <branch_and_bound/bb_checkpoint.hpp>
 #include <branch_and_bound/bb_event.hpp>
+#include <branch_and_bound/bb_trace.hpp>
 #include <branch_and_bound/branch_and_bound_worker.hpp>
+#include <branch_and_bound/conflict_pool.hpp>
 #include <branch_and_bound/deterministic_workers.hpp>
 #include <branch_and_bound/diving_heuristics.hpp>
 #include <branch_and_bound/mip_node.hpp>
 #include <branch_and_bound/node_queue.hpp>
+#include <branch_and_bound/node_selector.hpp>
 #include <branch_and_bound/pseudo_costs.hpp>
+#include <branch_and_bound/trial_branching.hpp>
 
 #include <cuts/cuts.hpp>
 
@@ -125,6 +130,17 @@ class branch_and_bound_t {
                                     std::vector<i_t>& basic_list,
                                     std::vector<i_t>& nonbasic_list,
                                     std::vector<f_t>& edge_norms);
+  // Races dual simplex, dual simplex on the column scaled LP and the CPU barrier followed by
+  // crossover on the root LP, each on its own thread. The first one to finish stops the others and
+  // its basis is used by the cuts and B&B.
+  lp_status_t solve_root_relaxation_cpu_concurrent(
+    simplex_solver_settings_t<i_t, f_t> const& lp_settings,
+    lp_solution_t<i_t, f_t>& root_relax_soln,
+    std::vector<variable_status_t>& root_vstatus,
+    basis_update_mpf_t<i_t, f_t>& basis_update,
+    std::vector<i_t>& basic_list,
+    std::vector<i_t>& nonbasic_list,
+    std::vector<f_t>& edge_norms);
 
   i_t find_reduced_cost_fixings(f_t upper_bound,
                                 std::vector<f_t>& lower_bounds,
@@ -200,6 +216,9 @@ class branch_and_bound_t {
   // Heap storing the nodes waiting to be explored.
   node_queue_t<i_t, f_t> node_queue_;
 
+  // Rule used to pick the nodes from the queue, and limits of the plunges and dives
+  node_selector_t<i_t, f_t> node_selector_;
+
   // Search tree
   search_tree_t<i_t, f_t> search_tree_;
 
@@ -210,6 +229,9 @@ class branch_and_bound_t {
   // Worker pool
   branch_and_bound_worker_pool_t<i_t, f_t> worker_pool_;
 
+  // Workspaces of the trial branching LPs in reliability branching, one per thread
+  trial_branching_pool_t<i_t, f_t> trial_pool_;
+
   // Global status of the solver.
   omp_atomic_t<mip_status_t> solver_status_;
   omp_atomic_t<bool> is_running_{false};
@@ -224,6 +246,49 @@ class branch_and_bound_t {
   omp_atomic_t<f_t> lower_bound_ceiling_;
   std::function<void(f_t)> user_bound_callback_;
 
+  // Trace of the search, see bb_trace.hpp
+  std::unique_ptr<bb_trace_writer_t> trace_;
+
+  // Conflicts learned from the infeasible nodes. Only used in the opportunistic mode, since the
+  // conflicts found by a worker depend on the timing of the other workers.
+  conflict_pool_t<i_t, f_t> conflict_pool_{2000, 10000};
+  bool conflict_analysis_{false};
+
+  // Restarts of B&B. The tree is discarded when the incumbent lets the reduced costs of the root
+  // fix enough variables early in the search (see `should_restart`).
+  i_t num_restarts_{0};
+  f_t restart_upper_bound_{std::numeric_limits<f_t>::infinity()};
+  omp_atomic_t<bool> restart_requested_{false};
+
+  // Cuts found at the root. The pool is only read by the workers, which separate its cuts at the
+  // nodes of the tree (see `separate_node_cuts`).
+  std::unique_ptr<cut_pool_t<i_t, f_t>> cut_pool_;
+  i_t node_cut_passes_{0};
+  omp_atomic_t<int64_t> node_cut_nodes_{0};
+  omp_atomic_t<int64_t> node_cut_count_{0};
+  omp_atomic_t<int64_t> node_cut_lp_iters_{0};
+
+  // Node LPs whose starting factorization was found in the basis cache of the worker, and the
+  // ones refactorized from scratch (see `basis_cache_t`)
+  omp_atomic_t<int64_t> basis_cache_hits_{0};
+  omp_atomic_t<int64_t> basis_cache_misses_{0};
+  omp_atomic_t<f_t> basis_cache_time_{0.0};  // time spent recording and restoring the bases
+
+  // Checkpoints of the search, see bb_checkpoint.hpp. A checkpoint is requested once the interval
+  // has elapsed and saved when the best-first workers have handed their plunges back to the queue,
+  // so the tree does not change while it is copied. The deterministic mode takes them at the sync
+  // points instead, see deterministic_sync_callback.
+  std::unique_ptr<bb_checkpoint_writer_t<i_t, f_t>> checkpoint_writer_;
+  f_t last_checkpoint_time_{0.0};
+  omp_atomic_t<bool> checkpoint_requested_{false};
+  uint64_t problem_hash_{0};
+  i_t num_original_cols_{0};
+
+  // Checkpoint the search resumes from, kept until its tree is restored. In the deterministic mode,
+  // it is kept with the restored nodes until the coordinator gives them to the workers.
+  std::unique_ptr<bb_checkpoint_t<i_t, f_t>> resume_checkpoint_;
+  std::vector<mip_node_t<i_t, f_t>*> resume_nodes_;
+
   void report_heuristic(f_t obj);
   void report(char symbol,
               f_t obj,
@@ -237,6 +302,83 @@ class branch_and_bound_t {
                             const cut_info_t<i_t, f_t>& cut_info);
   void update_user_bound(f_t lower_bound);
 
+  // Crushes a solution of the root relaxation of the user problem and runs crossover on the root
+  // LP. Returns true if crossover found an optimal basis, given by `vstatus`.
+  bool crossover_root_solution(lp_solution_t<i_t, f_t>& solution,
+                               std::vector<variable_status_t>& vstatus,
+                               std::atomic<int>* concurrent_halt);
+  // Factorizes the basis of the root LP given by `vstatus`. Returns NUMERICAL_ISSUES if the basis
+  // is singular and OPTIMAL otherwise.
+  lp_status_t set_root_basis(std::vector<variable_status_t>& vstatus,
+                             basis_update_mpf_t<i_t, f_t>& basis_update,
+                             std::vector<i_t>& basic_list,
+                             std::vector<i_t>& nonbasic_list);
+  void report_root_relaxation(lp_status_t root_status,
+                              i_t iter,
+                              f_t solve_time,
+                              const std::string& solver_name,
+                              f_t user_objective);
+
+  // Records of the B&B trace, written only when settings_.tree_trace_file is set. Nodes are traced
+  // before search_tree_t::update, which may free them
+  template <typename WorkerT>
+  void trace_node(WorkerT* worker, mip_node_t<i_t, f_t>* node_ptr, node_status_t status);
+  void trace_task_begin(branch_and_bound_worker_t<i_t, f_t>* worker);
+  void trace_task_end(branch_and_bound_worker_t<i_t, f_t>* worker, double work_timestamp);
+  void trace_bounds(f_t lower_bound);
+
+  // Applies the conflict pool to the bounds of the leaf problem of the worker and propagates the
+  // implied bounds. Returns false if the node is infeasible.
+  bool apply_conflicts(branch_and_bound_worker_t<i_t, f_t>* worker);
+
+  // Adds the conflict explaining why the leaf problem of the worker is infeasible, either from
+  // the dual ray of the node LP or from the row where bound propagation failed.
+  void learn_conflict(branch_and_bound_worker_t<i_t, f_t>* worker, bool lp_infeasible);
+
+  // Checks whether the reduced costs of the root fix a fraction of at least
+  // `settings_.restart_fixing_fraction` of the unfixed integer variables with the current
+  // incumbent. Only called by the thread scheduling the tasks.
+  bool should_restart();
+
+  // Fixes the variables with the reduced costs globally, propagates the bounds and solves the root
+  // LP again for the next tree. Returns UNSET if the search should continue, or the final status
+  // otherwise.
+  mip_status_t restart_root(mip_solution_t<i_t, f_t>& solution,
+                            simplex_solver_settings_t<i_t, f_t>& lp_settings,
+                            basis_update_mpf_t<i_t, f_t>& basis_update,
+                            std::vector<i_t>& basic_list,
+                            std::vector<i_t>& nonbasic_list,
+                            std::vector<i_t>& fractional);
+
+  // Adds the violated cuts of the root pool, and optionally the Gomory and MIR cuts of the node LP,
+  // to a local copy of the leaf problem and solves it again. The local cuts are dropped before
+  // branching, so the children are solved without them. Their effect is kept through the lower
+  // bound of the node and the solution used to select the branching variable, which replace the
+  // ones in the worker when the cuts improve the bound. Returns the status of the node LP.
+  dual::status_t separate_node_cuts(mip_node_t<i_t, f_t>* node_ptr,
+                                    branch_and_bound_worker_t<i_t, f_t>* worker,
+                                    const simplex_solver_settings_t<i_t, f_t>& lp_settings);
+
+  // True when the checkpoint interval has elapsed and the previous checkpoint was written
+  bool checkpoint_due();
+
+  // Copies the state of the search into a checkpoint, written on a background thread. The tree must
+  // not change meanwhile.
+  void save_checkpoint();
+
+  // Reads the checkpoint given by the resume file of the settings. It is ignored with a warning if
+  // it cannot be read or was written for a different problem.
+  void read_resume_checkpoint();
+
+  // Rebuilds the tree of the checkpoint below the root, pushes its open nodes to the queue and
+  // returns their number. The deterministic mode keeps them in `resume_nodes_`.
+  i_t restore_checkpoint_tree();
+
+  // True if the search resumes the trajectory of a deterministic checkpoint, which the root
+  // reproduces. The incumbent and the cuts of the checkpoint are then restored with the workers
+  // rather than before the root.
+  bool deterministic_resume() const;
+
   // Set the final solution.
   void set_final_solution(mip_solution_t<i_t, f_t>& solution, f_t lower_bound);
 
@@ -250,6 +392,10 @@ class branch_and_bound_t {
   // Repairs low-quality solutions from the heuristics, if it is applicable.
   void repair_heuristic_solutions();
 
+  // Fathoms the spilled nodes cut off by the incumbent, so they are not kept on disk until they
+  // are reloaded.
+  void prune_spilled_nodes();
+
   // We use best-first to pick the `start_node` and then perform a depth-first search
   // from this node (i.e., a plunge). It can only backtrack to a sibling node.
   // Unexplored nodes in the subtree are inserted back into the global heap.
@@ -259,6 +405,10 @@ class branch_and_bound_t {
   // to find integer feasible solutions.
   void dive_with(branch_and_bound_worker_t<i_t, f_t>* worker);
 
+  // Pops the node that starts the next plunge, by its lower bound or by its estimate
+  // (see `node_selector_t`)
+  std::optional<mip_node_t<i_t, f_t>*> pop_next_node(f_t rel_gap);
+
   // Run the scheduler whose will schedule and manage
   // all the other workers.
   void run_scheduler();
@@ -344,8 +494,29 @@ class branch_and_bound_t {
   template <typename PoolT>
   void deterministic_merge_pseudo_cost_updates(PoolT& pool);
 
+  // Build the state given to the workers for the next horizon
+  void deterministic_publish_snapshot(const std::vector<f_t>& incumbent_snapshot);
+
+  // Copy the published state to every worker of the pool
   template <typename PoolT>
-  void deterministic_broadcast_snapshots(PoolT& pool, const std::vector<f_t>& incumbent_snapshot);
+  void deterministic_broadcast_snapshots(PoolT& pool);
+
+  // Run fn on the BFS or diving worker owning the work context
+  template <typename Func>
+  void deterministic_with_worker(work_limit_context_t& ctx, Func&& fn);
+
+  // Ends the pending checkpoint interval at the sync point `horizon_end` and writes the checkpoint
+  // if there is a checkpoint file. Does nothing while a worker is in the middle of a node or a dive.
+  void deterministic_checkpoint_boundary(double horizon_end);
+
+  // Adds the queues, the clocks and the horizon to a checkpoint, `saved_nodes` being the tree node
+  // of each of its entries
+  void deterministic_save_workers(bb_checkpoint_t<i_t, f_t>& checkpoint,
+                                  const std::vector<const mip_node_t<i_t, f_t>*>& saved_nodes);
+
+  // Gives the nodes of the resumed checkpoint to the workers, where they were when it was taken if
+  // it is a deterministic checkpoint of the same workers and root LP
+  void deterministic_resume_workers();
 
   friend struct nondeterministic_policy_t<i_t, f_t>;
   friend struct deterministic_bfs_policy_t<i_t, f_t>;
@@ -355,12 +526,25 @@ class branch_and_bound_t {
   // unique_ptr as we only want to initialize these if we're in the deterministic codepath
   std::unique_ptr<deterministic_bfs_worker_pool_t<i_t, f_t>> deterministic_workers_;
   std::unique_ptr<cuopt::work_unit_scheduler_t> deterministic_scheduler_;
+  deterministic_snapshot_t<i_t, f_t> deterministic_snapshot_;
   mip_status_t deterministic_global_termination_status_{mip_status_t::UNSET};
   double deterministic_horizon_step_{5.0};     // Work unit step per horizon (tunable)
   double deterministic_current_horizon_{0.0};  // Current horizon target
   bool deterministic_mode_enabled_{false};
   int deterministic_horizon_number_{0};  // Current horizon number (for debugging)
 
+  // Checkpoint boundaries of the deterministic mode, every checkpoint interval counted in work
+  // units. Once the interval has elapsed, the workers finish their nodes and dives without
+  // starting new ones until the checkpoint is taken. A checkpoint file or a resume file enables
+  // them, so the run that writes the checkpoints and the one that resumes from them take the same
+  // boundaries and follow the same search.
+  bool deterministic_checkpoints_{false};
+  bool deterministic_checkpoint_pending_{false};
+  double deterministic_last_checkpoint_{0.0};
+  // Horizon of the resumed checkpoint. The heuristic producers start over after a resume, so their
+  // work units and the timestamps of their solutions count from there.
+  double deterministic_resume_work_{0.0};
+
   // Producer synchronization for external heuristics (CPUFJ)
   // B&B waits for registered producers at each horizon sync
   producer_sync_t producer_sync_;
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <branch_and_bound/basis_cache.hpp>
 #include <branch_and_bound/mip_node.hpp>
 
 #include <dual_simplex/basis_updates.hpp>
@@ -17,6 +18,7 @@
 
 #include <array>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -56,15 +58,26 @@ class branch_and_bound_worker_t {
   omp_atomic_t<bool> is_active;
   omp_atomic_t<f_t> lower_bound;
 
+  // Owns a copy of the column-wise A, since the simplex kernels take an `lp_problem_t` and the
+  // local cuts add rows to it. Only the row-wise `Arow` is shared between the workers.
   lp_problem_t<i_t, f_t> leaf_problem;
   lp_solution_t<i_t, f_t> leaf_solution;
   std::vector<f_t> leaf_edge_norms;
 
+  // Local cuts in the rows of `leaf_problem` (see `node_cuts_t`)
+  std::shared_ptr<const node_cuts_t<i_t, f_t>> leaf_cuts;
+
   basis_update_mpf_t<i_t, f_t> basis_factors;
   std::vector<i_t> basic_list;
   std::vector<i_t> nonbasic_list;
 
+  // Factorizations of the last nodes that branched, used when the worker does not continue from
+  // the basis of the last node
+  basis_cache_t<i_t, f_t> basis_cache;
+
+  // Both only see the rows of the global LP, since the local cuts only contain continuous slacks
   bounds_strengthening_t<i_t, f_t> node_presolver;
+  incremental_bounds_strengthening_t<i_t, f_t> node_propagator;
   std::vector<bool> bounds_changed;
 
   std::vector<f_t> start_lower;
@@ -76,6 +89,14 @@ class branch_and_bound_worker_t {
   bool recompute_basis  = true;
   bool recompute_bounds = true;
 
+  // Statistics of the last node LP and of the current task, written to the B&B trace
+  i_t trace_id;
+  i_t node_lp_iters{0};
+  f_t node_lp_time{0.0};
+  f_t task_start_time{0.0};
+  i_t task_nodes{0};
+  i_t task_lp_iters{0};
+
   branch_and_bound_worker_t(i_t worker_id,
                             const lp_problem_t<i_t, f_t>& original_lp,
                             const csr_matrix_t<i_t, f_t>& Arow,
@@ -90,10 +111,15 @@ class branch_and_bound_worker_t {
       basis_factors(original_lp.num_rows, settings.refactor_frequency),
       basic_list(original_lp.num_rows),
       nonbasic_list(),
-      node_presolver(leaf_problem, Arow, {}, var_type),
+      basis_cache(settings.basis_cache_size),
+      node_presolver(original_lp, Arow, {}, var_type),
+      node_propagator(original_lp, Arow, {}, var_type),
       bounds_changed(original_lp.num_cols, false),
       rng(settings.random_seed + pcgenerator_t::default_seed + worker_id,
-          pcgenerator_t::default_stream ^ worker_id)
+          pcgenerator_t::default_stream ^ worker_id),
+      trace_id(worker_id),
+      num_global_rows(original_lp.num_rows),
+      num_global_cols(original_lp.num_cols)
   {
   }
 
@@ -106,6 +132,7 @@ class branch_and_bound_worker_t {
     search_strategy = BEST_FIRST;
     lower_bound     = node->lower_bound;
     is_active       = true;
+    propagated_path.clear();
   }
 
   // Initialize the worker for diving, setting the `start_node`, `start_lower` and
@@ -124,35 +151,179 @@ class branch_and_bound_worker_t {
     search_strategy = type;
     lower_bound     = node->lower_bound;
     is_active       = true;
+    propagated_path.clear();
 
     std::fill(bounds_changed.begin(), bounds_changed.end(), false);
     node->get_variable_bounds(start_lower, start_upper, bounds_changed);
     return node_presolver.bounds_strengthening(settings, bounds_changed, start_lower, start_upper);
   }
 
-  // Set the variables bounds for the LP relaxation of the current node.
+  // Set the variables bounds and the local cuts for the LP relaxation of the current node.
+  //
+  // The bounds of the nodes solved in the current plunge or dive are propagated incrementally:
+  // if the parent of the node was solved before, its bounds are restored from the trail of the
+  // propagator, the branching bound is applied and only the rows touched by the changes are
+  // propagated. Otherwise, the bounds are recomputed from `start_lower` and `start_upper`.
   bool set_lp_variable_bounds(mip_node_t<i_t, f_t>* node_ptr,
                               const simplex_solver_settings_t<i_t, f_t>& settings)
   {
+    set_leaf_cuts(node_ptr->cuts);
+
+    // When the previous node branched, the node is one of its children. Otherwise, look for
+    // its parent on the path.
+    size_t k = propagated_path.size();
+    if (recompute_bounds) {
+      while (k > 0 && !propagated_path[k - 1].is_parent_of(node_ptr)) {
+        --k;
+      }
+    }
+    assert(k == 0 || propagated_path[k - 1].is_parent_of(node_ptr));
+
+    if (k > 0) {
+      const size_t mark =
+        k < propagated_path.size() ? propagated_path[k].mark : node_propagator.mark();
+      node_propagator.backtrack(mark, leaf_problem.lower, leaf_problem.upper);
+      propagated_path.resize(k);
+      propagated_path.push_back({node_ptr->node_id, node_ptr->depth, mark});
+      node_propagator.tighten_bounds(node_ptr->branch_var,
+                                     node_ptr->branch_var_lower,
+                                     node_ptr->branch_var_upper,
+                                     leaf_problem.lower,
+                                     leaf_problem.upper);
+      return node_propagator.propagate(settings, leaf_problem.lower, leaf_problem.upper);
+    }
+
     // Reset the bound_changed markers
     std::fill(bounds_changed.begin(), bounds_changed.end(), false);
 
     // Set the correct bounds for the leaf problem
-    if (recompute_bounds) {
-      leaf_problem.lower = start_lower;
-      leaf_problem.upper = start_upper;
-      node_ptr->get_variable_bounds(leaf_problem.lower, leaf_problem.upper, bounds_changed);
+    leaf_problem.lower = start_lower;
+    leaf_problem.upper = start_upper;
+    leaf_problem.lower.resize(leaf_problem.num_cols, 0.0);
+    leaf_problem.upper.resize(leaf_problem.num_cols, std::numeric_limits<f_t>::infinity());
+    node_ptr->get_variable_bounds(leaf_problem.lower, leaf_problem.upper, bounds_changed);
+
+    node_propagator.reset(bounds_changed, leaf_problem.lower, leaf_problem.upper);
+    propagated_path.clear();
+    propagated_path.push_back({node_ptr->node_id, node_ptr->depth, node_propagator.mark()});
+    return node_propagator.propagate(settings, leaf_problem.lower, leaf_problem.upper);
+  }
 
-    } else {
-      node_ptr->update_branched_variable_bounds(
-        leaf_problem.lower, leaf_problem.upper, bounds_changed);
+ private:
+  // Changes the rows of `leaf_problem` to the local cuts of a node. The cuts form a trail along
+  // the path of the tree, like the bounds of `node_propagator`: the ones shared with the last node
+  // are kept, the ones past the closest common ancestor are popped and the ones of the node are
+  // pushed. The basis must be recomputed if the rows changed.
+  void set_leaf_cuts(const std::shared_ptr<const node_cuts_t<i_t, f_t>>& cuts)
+  {
+    if (cuts == leaf_cuts) { return; }
+
+    // The number of cuts strictly decreases towards the root of a chain
+    std::vector<const node_cuts_t<i_t, f_t>*> missing;
+    const node_cuts_t<i_t, f_t>* target  = cuts.get();
+    const node_cuts_t<i_t, f_t>* current = leaf_cuts.get();
+    while (target != current) {
+      if (target != nullptr && (current == nullptr || target->num_cuts >= current->num_cuts)) {
+        missing.push_back(target);
+        target = target->parent.get();
+      } else {
+        current = current->parent.get();
+      }
     }
 
-    return node_presolver.bounds_strengthening(
-      settings, bounds_changed, leaf_problem.lower, leaf_problem.upper);
+    pop_leaf_cuts(current != nullptr ? current->num_cuts : 0);
+    push_leaf_cuts(missing);
+    basic_list.resize(leaf_problem.num_rows);
+    leaf_cuts       = cuts;
+    recompute_basis = true;
+    basis_cache.clear();
+  }
+
+  // Removes the cuts after the first `num_cuts` and their slacks from the leaf problem
+  void pop_leaf_cuts(i_t num_cuts)
+  {
+    const i_t m = num_global_rows + num_cuts;
+    const i_t n = num_global_cols + num_cuts;
+    if (leaf_problem.num_rows == m) { return; }
+
+    csc_matrix_t<i_t, f_t>& A = leaf_problem.A;
+    i_t nz                    = 0;
+    for (i_t j = 0; j < n; ++j) {
+      const i_t col_start = A.col_start[j];
+      const i_t col_end   = A.col_start[j + 1];
+      A.col_start[j]      = nz;
+      for (i_t p = col_start; p < col_end; ++p) {
+        if (A.i[p] < m) {
+          A.i[nz] = A.i[p];
+          A.x[nz] = A.x[p];
+          ++nz;
+        }
+      }
+    }
+    A.col_start[n] = nz;
+    A.resize(m, n, nz);
+
+    leaf_problem.num_rows = m;
+    leaf_problem.num_cols = n;
+    leaf_problem.rhs.resize(m);
+    leaf_problem.objective.resize(n);
+    leaf_problem.lower.resize(n);
+    leaf_problem.upper.resize(n);
+    leaf_solution.resize(m, n);
+  }
+
+  // Appends the cuts of `chain`, from the last to the first one, and their slacks to the leaf
+  // problem
+  void push_leaf_cuts(const std::vector<const node_cuts_t<i_t, f_t>*>& chain)
+  {
+    i_t num_cuts = 0;
+    i_t cuts_nz  = 0;
+    for (const node_cuts_t<i_t, f_t>* cuts : chain) {
+      num_cuts += cuts->rows.m;
+      cuts_nz += cuts->rows.row_start[cuts->rows.m];
+    }
+    if (num_cuts == 0) { return; }
+
+    const i_t old_rows = leaf_problem.num_rows;
+    const i_t old_cols = leaf_problem.num_cols;
+    const i_t m        = old_rows + num_cuts;
+    const i_t n        = old_cols + num_cuts;
+
+    // The cuts with the coefficient of their slack
+    csr_matrix_t<i_t, f_t> C(num_cuts, n, cuts_nz + num_cuts);
+    i_t k  = 0;
+    i_t nz = 0;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      const csr_matrix_t<i_t, f_t>& rows = (*it)->rows;
+      for (i_t i = 0; i < rows.m; ++i, ++k) {
+        C.row_start[k] = nz;
+        for (i_t p = rows.row_start[i]; p < rows.row_start[i + 1]; ++p) {
+          C.j[nz] = rows.j[p];
+          C.x[nz] = rows.x[p];
+          ++nz;
+        }
+        C.j[nz] = old_cols + k;
+        C.x[nz] = 1.0;
+        ++nz;
+        leaf_problem.rhs.push_back((*it)->rhs[i]);
+      }
+    }
+    C.row_start[num_cuts] = nz;
+
+    csr_matrix_t<i_t, f_t> Arow(old_rows, old_cols, 0);
+    leaf_problem.A.to_compressed_row(Arow);
+    Arow.n = n;
+    Arow.append_rows(C);
+    Arow.to_compressed_col(leaf_problem.A);
+
+    leaf_problem.num_rows = m;
+    leaf_problem.num_cols = n;
+    leaf_problem.objective.resize(n, 0.0);
+    leaf_problem.lower.resize(n, 0.0);
+    leaf_problem.upper.resize(n, std::numeric_limits<f_t>::infinity());
+    leaf_solution.resize(m, n);
   }
 
- private:
   // For diving, we need to store the full node instead of
   // of just a pointer, since it is not stored in the tree anymore.
   // To keep the same interface across all worker types,
@@ -160,6 +331,30 @@ class branch_and_bound_worker_t {
   // will be pointed by `start_node`.
   // For exploration, this will not be used.
   mip_node_t<i_t, f_t> internal_node;
+
+  // Nodes whose bounds are on the trail of `node_propagator`, from the first node of the plunge
+  // or dive to the last node solved. `mark` is the position of the trail before the branching
+  // bound of the node was applied, i.e., where the bounds of its parent end.
+  //
+  // The nodes are identified by their id and depth rather than their address: a node on the path
+  // may be fathomed and freed, and another node allocated at the same address. The ids are unique
+  // in the search tree and in a dive tree, whose root is the only node at its depth.
+  struct propagated_node_t {
+    i_t node_id;
+    i_t depth;
+    size_t mark;
+
+    bool is_parent_of(const mip_node_t<i_t, f_t>* node) const
+    {
+      return node->parent != nullptr && node->parent->node_id == node_id &&
+             node->parent->depth == depth;
+    }
+  };
+  std::vector<propagated_node_t> propagated_path;
+
+  // Dimensions of the global LP, i.e., of `leaf_problem` without local cuts
+  i_t num_global_rows;
+  i_t num_global_cols;
 };
 
 template <typename i_t, typename f_t>
@@ -172,6 +367,7 @@ class branch_and_bound_worker_pool_t {
             const simplex_solver_settings_t<i_t, f_t>& settings)
   {
     workers_.resize(num_workers);
+    idle_workers_.clear();
     num_idle_workers_ = num_workers;
     for (i_t i = 0; i < num_workers; ++i) {
       workers_[i] = std::make_unique<branch_and_bound_worker_t<i_t, f_t>>(
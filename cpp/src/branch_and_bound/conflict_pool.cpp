@@ -0,0 +1,272 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/conflict_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+bool conflict_from_proof(const std::vector<i_t>& proof_index,
+                         const std::vector<f_t>& proof_coeff,
+                         f_t proof_rhs,
+                         const std::vector<f_t>& local_lower,
+                         const std::vector<f_t>& local_upper,
+                         const std::vector<f_t>& global_lower,
+                         const std::vector<f_t>& global_upper,
+                         const std::vector<variable_type_t>& var_types,
+                         const simplex_solver_settings_t<i_t, f_t>& settings,
+                         i_t max_literals,
+                         std::vector<conflict_literal_t<i_t, f_t>>& conflict)
+{
+  conflict.clear();
+  const i_t nz = proof_index.size();
+
+  f_t min_activity = 0.0;
+  f_t max_activity = 0.0;
+  for (i_t k = 0; k < nz; ++k) {
+    const i_t j = proof_index[k];
+    const f_t a = proof_coeff[k];
+    if (a > 0) {
+      min_activity += a * local_lower[j];
+      max_activity += a * local_upper[j];
+    } else if (a < 0) {
+      min_activity += a * local_upper[j];
+      max_activity += a * local_lower[j];
+    }
+  }
+
+  // Flip the proof so its minimum activity is above the right-hand side by `slack`
+  const f_t tol = 1e3 * settings.primal_tol * std::max<f_t>(1.0, std::abs(proof_rhs));
+  f_t sign;
+  f_t slack;
+  if (min_activity > proof_rhs + tol) {
+    sign  = 1.0;
+    slack = min_activity - proof_rhs - tol;
+  } else if (max_activity < proof_rhs - tol) {
+    sign  = -1.0;
+    slack = proof_rhs - tol - max_activity;
+  } else {
+    return false;
+  }
+
+  struct candidate_t {
+    i_t k;
+    f_t cost;  // Decrease of the minimum activity when the bound is relaxed to the global bound
+    bool is_integer;
+  };
+  std::vector<candidate_t> candidates;
+  for (i_t k = 0; k < nz; ++k) {
+    const i_t j = proof_index[k];
+    const f_t a = sign * proof_coeff[k];
+    if (a == 0) { continue; }
+    const f_t local  = a > 0 ? local_lower[j] : local_upper[j];
+    const f_t global = a > 0 ? global_lower[j] : global_upper[j];
+    if (local == global) { continue; }
+    const bool is_integer =
+      var_types[j] == variable_type_t::INTEGER || var_types[j] == variable_type_t::BINARY;
+    candidates.push_back({k, a * (local - global), is_integer});
+  }
+
+  // Relax the bounds of the continuous variables first, as they cannot be part of a conflict
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+    if (a.is_integer != b.is_integer) { return b.is_integer; }
+    return a.cost < b.cost;
+  });
+  for (const auto& candidate : candidates) {
+    if (candidate.cost <= slack) {
+      slack -= candidate.cost;
+      continue;
+    }
+    if (!candidate.is_integer) { return false; }
+    const i_t j = proof_index[candidate.k];
+    if (sign * proof_coeff[candidate.k] > 0) {
+      conflict.push_back({j, local_lower[j], false});
+    } else {
+      conflict.push_back({j, local_upper[j], true});
+    }
+  }
+
+  // An empty conflict would mean that the proof holds with the global bounds. This is left to the
+  // node LPs, rather than concluding that the problem is infeasible from a single ray.
+  if (conflict.empty() || static_cast<i_t>(conflict.size()) > max_literals) {
+    conflict.clear();
+    return false;
+  }
+  return true;
+}
+
+namespace {
+
+template <typename i_t, typename f_t>
+bool is_implied(const conflict_literal_t<i_t, f_t>& literal,
+                const std::vector<f_t>& lower,
+                const std::vector<f_t>& upper)
+{
+  return literal.is_upper ? upper[literal.j] <= literal.bound : lower[literal.j] >= literal.bound;
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::add_conflict(
+  const std::vector<conflict_literal_t<i_t, f_t>>& literals)
+{
+  if (literals.empty()) { return; }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  const int64_t now = ++clock_;
+  if (static_cast<i_t>(conflicts_.size()) >= max_conflicts_) {
+    drop_conflicts();
+    rebuild_watches();
+  }
+  conflicts_.push_back({literals, now});
+  watch_conflict(conflicts_.size() - 1);
+  num_conflicts_ = conflicts_.size();
+}
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::drop_conflicts()
+{
+  const int64_t now = clock_;
+  auto is_old       = [&](const conflict_t& c) { return now - c.last_used > max_age_; };
+  conflicts_.erase(std::remove_if(conflicts_.begin(), conflicts_.end(), is_old), conflicts_.end());
+
+  // Keep the half of the pool used most recently
+  const i_t keep = max_conflicts_ / 2;
+  if (static_cast<i_t>(conflicts_.size()) > keep) {
+    std::nth_element(conflicts_.begin(),
+                     conflicts_.begin() + keep,
+                     conflicts_.end(),
+                     [](const conflict_t& a, const conflict_t& b) {
+                       return a.last_used > b.last_used;
+                     });
+    conflicts_.resize(keep);
+  }
+}
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::watch_conflict(i_t c)
+{
+  constexpr f_t inf    = std::numeric_limits<f_t>::infinity();
+  const auto& literals = conflicts_[c].literals;
+  if (literals.size() == 1) {
+    unit_conflicts_.push_back(c);
+    return;
+  }
+  for (i_t k = 0; k < 2; ++k) {
+    const auto& literal = literals[k];
+    const i_t j         = literal.j;
+    if (j >= static_cast<i_t>(watches_.size())) {
+      watches_.resize(j + 1);
+      max_upper_watch_.resize(j + 1, -inf);
+      min_lower_watch_.resize(j + 1, inf);
+    }
+    if (watches_[j].empty()) { watched_vars_.push_back(j); }
+    watches_[j].push_back({c, k});
+    if (literal.is_upper) {
+      max_upper_watch_[j] = std::max(max_upper_watch_[j], literal.bound);
+    } else {
+      min_lower_watch_[j] = std::min(min_lower_watch_[j], literal.bound);
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+void conflict_pool_t<i_t, f_t>::rebuild_watches()
+{
+  constexpr f_t inf = std::numeric_limits<f_t>::infinity();
+  for (i_t j : watched_vars_) {
+    watches_[j].clear();
+    max_upper_watch_[j] = -inf;
+    min_lower_watch_[j] = inf;
+  }
+  watched_vars_.clear();
+  unit_conflicts_.clear();
+  for (i_t c = 0; c < static_cast<i_t>(conflicts_.size()); ++c) {
+    watch_conflict(c);
+  }
+}
+
+template <typename i_t, typename f_t>
+bool conflict_pool_t<i_t, f_t>::check_conflict(i_t c,
+                                               const std::vector<f_t>& lower,
+                                               const std::vector<f_t>& upper,
+                                               int64_t now,
+                                               std::vector<conflict_literal_t<i_t, f_t>>& implied)
+{
+  auto& conflict                           = conflicts_[c];
+  const conflict_literal_t<i_t, f_t>* open = nullptr;
+  for (const auto& literal : conflict.literals) {
+    if (is_implied(literal, lower, upper)) { continue; }
+    // A literal that cannot hold, or two literals that may not hold
+    const i_t j = literal.j;
+    if ((literal.is_upper ? lower[j] > literal.bound : upper[j] < literal.bound) ||
+        open != nullptr) {
+      return true;
+    }
+    open = &literal;
+  }
+
+  conflict.last_used = now;
+  if (open == nullptr) {
+    ++num_pruned_;
+    return false;
+  }
+  // The literals are on integer variables, so the negation of x_j >= b is x_j <= b - 1
+  implied.push_back({open->j, open->is_upper ? open->bound + 1 : open->bound - 1, !open->is_upper});
+  ++num_implied_;
+  return true;
+}
+
+template <typename i_t, typename f_t>
+bool conflict_pool_t<i_t, f_t>::propagate(const std::vector<f_t>& lower,
+                                          const std::vector<f_t>& upper,
+                                          std::vector<conflict_literal_t<i_t, f_t>>& implied)
+{
+  if (num_conflicts_ == 0) { return true; }
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  const int64_t now = clock_;
+  for (i_t j : watched_vars_) {
+    if (upper[j] > max_upper_watch_[j] && lower[j] < min_lower_watch_[j]) { continue; }
+    for (const auto& watch : watches_[j]) {
+      const auto& literals = conflicts_[watch.conflict].literals;
+      if (!is_implied(literals[watch.literal], lower, upper)) { continue; }
+      // A conflict with both watches implied is checked from the first one
+      if (watch.literal == 1 && is_implied(literals[0], lower, upper)) { continue; }
+      if (!check_conflict(watch.conflict, lower, upper, now, implied)) { return false; }
+    }
+  }
+  for (i_t c : unit_conflicts_) {
+    if (!check_conflict(c, lower, upper, now, implied)) { return false; }
+  }
+  return true;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template bool conflict_from_proof<int, double>(
+  const std::vector<int>& proof_index,
+  const std::vector<double>& proof_coeff,
+  double proof_rhs,
+  const std::vector<double>& local_lower,
+  const std::vector<double>& local_upper,
+  const std::vector<double>& global_lower,
+  const std::vector<double>& global_upper,
+  const std::vector<variable_type_t>& var_types,
+  const simplex_solver_settings_t<int, double>& settings,
+  int max_literals,
+  std::vector<conflict_literal_t<int, double>>& conflict);
+
+template class conflict_pool_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
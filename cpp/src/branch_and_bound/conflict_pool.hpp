@@ -0,0 +1,135 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <utilities/omp_helpers.hpp>
+
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// The bound x_j <= bound if is_upper, x_j >= bound otherwise
+template <typename i_t, typename f_t>
+struct conflict_literal_t {
+  i_t j;
+  f_t bound;
+  bool is_upper;
+};
+
+// A conflict is a set of bounds on integer variables that cannot hold at the same time, i.e., a
+// node whose bounds imply all of them is infeasible (see Chapter 11 of [1]).
+//
+// The conflict is derived from a proof of infeasibility of a node: a row a'*x = rhs, aggregated
+// from the rows of Ax = b (the Farkas certificate of an infeasible LP, or the row found infeasible
+// by bound propagation), whose activity cannot reach rhs within the local bounds. The literals are
+// the local bounds tighter than the global bounds that the proof needs: the other local bounds
+// are relaxed to the global bounds, starting from those that weaken the proof the least.
+//
+// Returns false if the proof does not hold with a safety margin, or if it needs a bound on a
+// continuous variable or more than `max_literals` bounds.
+//
+// [1] T. Achterberg, “Constraint Integer Programming,” PhD, Technischen Universität Berlin,
+// Berlin, 2007. doi: 10.14279/depositonce-1634.
+template <typename i_t, typename f_t>
+bool conflict_from_proof(const std::vector<i_t>& proof_index,
+                         const std::vector<f_t>& proof_coeff,
+                         f_t proof_rhs,
+                         const std::vector<f_t>& local_lower,
+                         const std::vector<f_t>& local_upper,
+                         const std::vector<f_t>& global_lower,
+                         const std::vector<f_t>& global_upper,
+                         const std::vector<variable_type_t>& var_types,
+                         const simplex_solver_settings_t<i_t, f_t>& settings,
+                         i_t max_literals,
+                         std::vector<conflict_literal_t<i_t, f_t>>& conflict);
+
+// Conflicts shared by all the B&B workers.
+//
+// A conflict can only prune a node or tighten a bound if at most one of its literals is not
+// implied by the bounds of the node, so at least one of its first two literals is implied. These
+// two literals are watched: `propagate` only visits the variables with a watched literal and the
+// conflicts whose watched literals are implied. The workers propagate under a shared lock, and
+// adding a conflict takes the lock exclusively.
+//
+// The age of a conflict is the number of conflicts added to the pool since it last pruned a node
+// or tightened a bound. When the pool is full, the conflicts older than `max_age` are dropped,
+// and then the oldest ones.
+template <typename i_t, typename f_t>
+class conflict_pool_t {
+ public:
+  conflict_pool_t(i_t max_conflicts, int64_t max_age)
+    : max_conflicts_(max_conflicts), max_age_(max_age)
+  {
+  }
+
+  void add_conflict(const std::vector<conflict_literal_t<i_t, f_t>>& literals);
+
+  // Checks the conflicts against the bounds of a node. Returns false if the bounds imply all the
+  // literals of a conflict. Otherwise, `implied` receives the negation of the last literal of the
+  // conflicts whose other literals are all implied.
+  bool propagate(const std::vector<f_t>& lower,
+                 const std::vector<f_t>& upper,
+                 std::vector<conflict_literal_t<i_t, f_t>>& implied);
+
+  i_t size() const { return num_conflicts_; }
+
+  int64_t num_added() const { return clock_; }
+  int64_t num_pruned() const { return num_pruned_; }
+  int64_t num_implied() const { return num_implied_; }
+
+ private:
+  struct conflict_t {
+    std::vector<conflict_literal_t<i_t, f_t>> literals;
+    omp_atomic_t<int64_t> last_used;
+  };
+
+  // Literal `literal` (0 or 1) of conflict `conflict`
+  struct watch_t {
+    i_t conflict;
+    i_t literal;
+  };
+
+  void drop_conflicts();
+  void watch_conflict(i_t c);
+  void rebuild_watches();
+
+  // Returns false if the bounds imply all the literals of conflict `c`
+  bool check_conflict(i_t c,
+                      const std::vector<f_t>& lower,
+                      const std::vector<f_t>& upper,
+                      int64_t now,
+                      std::vector<conflict_literal_t<i_t, f_t>>& implied);
+
+  const i_t max_conflicts_;
+  const int64_t max_age_;
+
+  std::shared_mutex mutex_;
+  std::vector<conflict_t> conflicts_;
+
+  // Watches by variable. A literal x_j <= b is implied by upper[j] <= b, so no watch on x_j is
+  // implied while upper[j] > max_upper_watch_[j] and lower[j] < min_lower_watch_[j].
+  std::vector<std::vector<watch_t>> watches_;
+  std::vector<f_t> max_upper_watch_;
+  std::vector<f_t> min_lower_watch_;
+  std::vector<i_t> watched_vars_;
+  // Conflicts with a single literal, which are checked at every node
+  std::vector<i_t> unit_conflicts_;
+  omp_atomic_t<i_t> num_conflicts_{0};
+
+  omp_atomic_t<int64_t> clock_{0};
+  omp_atomic_t<int64_t> num_pruned_{0};
+  omp_atomic_t<int64_t> num_implied_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -14,6 +14,7 @@
 
 #include <utilities/work_limit_context.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <deque>
 #include <limits>
@@ -24,6 +25,32 @@
 
 namespace cuopt::linear_programming::dual_simplex {
 
+// Sort data given as consecutive runs, run_ends[k] being the end of run k. Runs are expected to be
+// already sorted by their producer, in which case this is a log(#runs) deep merge tree instead of a
+// full sort
+template <typename T>
+void merge_sorted_runs(std::vector<T>& data, const std::vector<size_t>& run_ends)
+{
+  std::vector<size_t> bounds{0};
+  for (size_t end : run_ends) {
+    if (!std::is_sorted(data.begin() + bounds.back(), data.begin() + end)) {
+      std::sort(data.begin() + bounds.back(), data.begin() + end);
+    }
+    bounds.push_back(end);
+  }
+
+  while (bounds.size() > 2) {
+    std::vector<size_t> merged_bounds{0};
+    for (size_t k = 0; k + 2 < bounds.size(); k += 2) {
+      std::inplace_merge(
+        data.begin() + bounds[k], data.begin() + bounds[k + 1], data.begin() + bounds[k + 2]);
+      merged_bounds.push_back(bounds[k + 2]);
+    }
+    if (bounds.size() % 2 == 0) { merged_bounds.push_back(bounds.back()); }
+    bounds = std::move(merged_bounds);
+  }
+}
+
 template <typename i_t, typename f_t>
 struct backlog_node_compare_t {
   bool operator()(const mip_node_t<i_t, f_t>* a, const mip_node_t<i_t, f_t>* b) const
@@ -79,6 +106,9 @@ class deterministic_worker_base_t : public branch_and_bound_worker_t<i_t, f_t> {
   std::vector<queued_integer_solution_t<i_t, f_t>> integer_solutions;
   int next_solution_seq{0};
 
+  // Pseudo-cost updates taken from pc_snapshot and sorted when reaching a sync point
+  std::vector<pseudo_cost_update_t<i_t, f_t>> pending_pc_updates;
+
   i_t total_nodes_processed{0};
   i_t total_integer_solutions{0};
   double total_runtime{0.0};
@@ -104,6 +134,17 @@ class deterministic_worker_base_t : public branch_and_bound_worker_t<i_t, f_t> {
   }
 
   bool has_work() const { return static_cast<const Derived*>(this)->has_work_impl(); }
+
+  // Called by the worker's own thread when it reaches a sync point, while other workers may still
+  // be running. Sorts the worker's outputs so the sync callback only has to merge them
+  void prepare_for_sync()
+  {
+    std::sort(integer_solutions.begin(), integer_solutions.end());
+    auto updates = pc_snapshot.take_updates();
+    pending_pc_updates.insert(pending_pc_updates.end(), updates.begin(), updates.end());
+    std::sort(pending_pc_updates.begin(), pending_pc_updates.end());
+    static_cast<Derived*>(this)->prepare_for_sync_impl();
+  }
 };
 
 template <typename i_t, typename f_t>
@@ -148,6 +189,8 @@ class deterministic_bfs_worker_t
     return current_node != nullptr || !plunge_stack.empty() || !backlog.empty();
   }
 
+  void prepare_for_sync_impl() { events.sort_for_replay(); }
+
   void enqueue_node(mip_node_t<i_t, f_t>* node)
   {
     plunge_stack.push_front(node);
@@ -285,6 +328,7 @@ class deterministic_diving_worker_t
 
   // Diving state
   bool recompute_bounds_and_basis{true};
+  bool in_dive{false};  // A checkpoint waits for the dive to end, see deterministic_sync_callback
 
   // Diving statistics
   i_t total_nodes_explored{0};
@@ -302,8 +346,9 @@ class deterministic_diving_worker_t
       diving_type(type),
       root_solution(root_sol)
   {
-    dive_lower = original_lp.lower;
-    dive_upper = original_lp.upper;
+    this->search_strategy = type;
+    dive_lower            = original_lp.lower;
+    dive_upper            = original_lp.upper;
   }
 
   deterministic_diving_worker_t(const deterministic_diving_worker_t&)            = delete;
@@ -313,6 +358,8 @@ class deterministic_diving_worker_t
 
   bool has_work_impl() const { return !dive_queue.empty(); }
 
+  void prepare_for_sync_impl() {}
+
   void enqueue_dive_node(mip_node_t<i_t, f_t>* node, const lp_problem_t<i_t, f_t>& original_lp)
   {
     dive_queue_entry_t<i_t, f_t> entry;
@@ -390,10 +437,13 @@ class deterministic_worker_pool_base_t {
   bb_event_batch_t<i_t, f_t> collect_and_sort_events()
   {
     bb_event_batch_t<i_t, f_t> all_events;
+    std::vector<size_t> run_ends;
+    run_ends.reserve(workers_.size());
     for (auto& worker : workers_) {
       static_cast<Derived*>(this)->collect_worker_events(worker, all_events);
+      run_ends.push_back(all_events.size());
     }
-    all_events.sort_for_replay();
+    merge_sorted_runs(all_events.events, run_ends);
     return all_events;
   }
 
@@ -0,0 +1,234 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/feasibility_jump.hpp>
+
+#include <dual_simplex/tic_toc.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+feasibility_jump_t<i_t, f_t>::feasibility_jump_t(
+  const user_problem_t<i_t, f_t>& problem,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  f_t start_time)
+  : settings_(settings),
+    start_time_(start_time),
+    num_integers_(0),
+    objective_is_zero_(true),
+    best_objective_(inf),
+    num_solutions_(0),
+    num_moves_(0)
+{
+  const i_t m = problem.num_rows;
+  const i_t n = problem.num_cols;
+  auto& pb    = problem_;
+
+  pb.n_variables              = n;
+  pb.n_constraints            = m;
+  pb.objective_offset         = problem.obj_constant;
+  pb.objective_scaling_factor = problem.obj_scale;
+  pb.absolute_tolerance       = 0.5 * settings.primal_tol;
+  pb.integrality_tolerance    = settings.integer_tol;
+
+  pb.constraint_lower_bounds.resize(m);
+  pb.constraint_upper_bounds.resize(m);
+  for (i_t i = 0; i < m; ++i) {
+    const f_t b                   = problem.rhs[i];
+    pb.constraint_lower_bounds[i] = problem.row_sense[i] == 'L' ? -inf : b;
+    pb.constraint_upper_bounds[i] = problem.row_sense[i] == 'G' ? inf : b;
+  }
+  // Same convention as convert_range_rows
+  for (i_t k = 0; k < problem.num_range_rows; ++k) {
+    const i_t i = problem.range_rows[k];
+    const f_t r = problem.range_value[k];
+    const f_t b = problem.rhs[i];
+    if (problem.row_sense[i] == 'L' || (problem.row_sense[i] == 'E' && r <= 0)) {
+      pb.constraint_lower_bounds[i] = b - std::abs(r);
+      pb.constraint_upper_bounds[i] = b;
+    } else {
+      pb.constraint_lower_bounds[i] = b;
+      pb.constraint_upper_bounds[i] = b + std::abs(r);
+    }
+  }
+
+  pb.variable_lower_bounds  = problem.lower;
+  pb.variable_upper_bounds  = problem.upper;
+  pb.objective_coefficients = problem.objective;
+  pb.is_integer.assign(n, false);
+  for (i_t j = 0; j < n; ++j) {
+    if (j < static_cast<i_t>(problem.var_types.size()) &&
+        problem.var_types[j] != variable_type_t::CONTINUOUS) {
+      pb.is_integer[j]            = true;
+      pb.variable_lower_bounds[j] = std::ceil(pb.variable_lower_bounds[j] - settings.integer_tol);
+      pb.variable_upper_bounds[j] = std::floor(pb.variable_upper_bounds[j] + settings.integer_tol);
+      ++num_integers_;
+    }
+    if (problem.objective[j] != 0.0) { objective_is_zero_ = false; }
+  }
+  for (i_t j = 0; j < n; ++j) {
+    // No assignment within the bounds, so there is nothing to look for
+    if (pb.variable_lower_bounds[j] > pb.variable_upper_bounds[j]) {
+      num_integers_ = 0;
+      break;
+    }
+  }
+
+  // Columns of A, without the explicit zeros
+  const auto& A = problem.A;
+  pb.reverse_offsets.resize(n + 1);
+  pb.reverse_constraints.reserve(A.col_start[n]);
+  pb.reverse_coefficients.reserve(A.col_start[n]);
+  for (i_t j = 0; j < n; ++j) {
+    pb.reverse_offsets[j] = pb.reverse_constraints.size();
+    for (i_t p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+      if (A.x[p] == 0.0) { continue; }
+      pb.reverse_constraints.push_back(A.i[p]);
+      pb.reverse_coefficients.push_back(A.x[p]);
+    }
+  }
+  pb.reverse_offsets[n] = pb.reverse_constraints.size();
+
+  // Rows of A
+  const i_t nnz = pb.reverse_constraints.size();
+  pb.offsets.assign(m + 1, 0);
+  for (i_t p = 0; p < nnz; ++p) {
+    ++pb.offsets[pb.reverse_constraints[p] + 1];
+  }
+  for (i_t i = 0; i < m; ++i) {
+    pb.offsets[i + 1] += pb.offsets[i];
+  }
+  pb.variables.resize(nnz);
+  pb.coefficients.resize(nnz);
+  std::vector<i_t> next(pb.offsets.begin(), pb.offsets.end() - 1);
+  for (i_t j = 0; j < n; ++j) {
+    for (i_t p = pb.reverse_offsets[j]; p < pb.reverse_offsets[j + 1]; ++p) {
+      const i_t q        = next[pb.reverse_constraints[p]]++;
+      pb.variables[q]    = j;
+      pb.coefficients[q] = pb.reverse_coefficients[p];
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+feasibility_jump_t<i_t, f_t>::~feasibility_jump_t()
+{
+  stop();
+}
+
+template <typename i_t, typename f_t>
+i_t feasibility_jump_t<i_t, f_t>::num_climbers() const
+{
+  // The climbers do not run in a deterministic order
+  if (settings_.feasibility_jump_climbers == 0 || settings_.deterministic || num_integers_ == 0) {
+    return 0;
+  }
+  if (settings_.feasibility_jump_climbers > 0) { return settings_.feasibility_jump_climbers; }
+  // Use the threads left by B&B, if any, so that the machine is not oversubscribed
+  return std::clamp<i_t>(omp_get_max_threads() - settings_.num_threads, 0, 4);
+}
+
+template <typename i_t, typename f_t>
+void feasibility_jump_t<i_t, f_t>::start(i_t num_climbers, callback_t callback)
+{
+  stop();
+  callback_ = std::move(callback);
+  climbers_.clear();
+  for (i_t id = 0; id < num_climbers; ++id) {
+    // The first climber uses the default parameters, the others draw theirs at random
+    const int seed = settings_.random_seed + 7919 * id;
+    std::mt19937 rng(seed);
+    climbers_.push_back(std::make_unique<climber_t>(
+      problem_,
+      initial_assignment(id, rng),
+      seed,
+      id > 0,
+      [this, id](f_t objective, const std::vector<f_t>& assignment) {
+        report_solution(id, objective, assignment);
+      }));
+  }
+  for (i_t id = 0; id < num_climbers; ++id) {
+    threads_.emplace_back(&feasibility_jump_t::run_climber, this, id);
+  }
+}
+
+template <typename i_t, typename f_t>
+void feasibility_jump_t<i_t, f_t>::stop()
+{
+  if (threads_.empty()) { return; }
+  for (auto& climber : climbers_) {
+    climber->stop();
+  }
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+  threads_.clear();
+  settings_.log.debug("Feasibility jump: %d climbers, %ld moves, %d solutions\n",
+                      static_cast<i_t>(climbers_.size()),
+                      static_cast<int64_t>(num_moves_),
+                      static_cast<i_t>(num_solutions_));
+}
+
+// Climbers start from the value closest to zero, the lower bound, the upper bound, or a random
+// value within the bounds, in turn
+template <typename i_t, typename f_t>
+std::vector<f_t> feasibility_jump_t<i_t, f_t>::initial_assignment(i_t id, std::mt19937& rng) const
+{
+  const i_t n = problem_.n_variables;
+  std::vector<f_t> x(n);
+  for (i_t j = 0; j < n; ++j) {
+    const f_t lo = problem_.variable_lower_bounds[j];
+    const f_t up = problem_.variable_upper_bounds[j];
+    f_t value    = std::clamp<f_t>(0.0, lo, up);
+    if (id % 4 == 1 && lo > -inf) {
+      value = lo;
+    } else if (id % 4 == 2 && up < inf) {
+      value = up;
+    } else if (id % 4 == 3 && lo > -inf && up < inf) {
+      value = std::uniform_real_distribution<f_t>(lo, up)(rng);
+      if (problem_.is_integer[j]) { value = std::clamp<f_t>(std::round(value), lo, up); }
+    }
+    x[j] = value;
+  }
+  return x;
+}
+
+template <typename i_t, typename f_t>
+void feasibility_jump_t<i_t, f_t>::run_climber(i_t id)
+{
+  const f_t time_limit = settings_.time_limit < inf
+                           ? std::max<f_t>(0.0, settings_.time_limit - toc(start_time_))
+                           : std::numeric_limits<f_t>::infinity();
+  climbers_[id]->solve(time_limit);
+  num_moves_ += climbers_[id]->num_iterations();
+}
+
+template <typename i_t, typename f_t>
+void feasibility_jump_t<i_t, f_t>::report_solution(i_t id,
+                                                   f_t objective,
+                                                   const std::vector<f_t>& assignment)
+{
+  mutex_solution_.lock();
+  if (objective < best_objective_) {
+    best_objective_ = objective;
+    ++num_solutions_;
+    if (callback_) { callback_(assignment); }
+  }
+  mutex_solution_.unlock();
+  // Any feasible solution is optimal
+  if (objective_is_zero_) { climbers_[id]->stop(); }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class feasibility_jump_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,84 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/types.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <mip_heuristics/feasibility_jump/fj_cpu_host.hpp>
+#include <utilities/omp_helpers.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Feasibility jump [1] on the CPU for the user problem, so it can run alongside B&B without the
+// GPU heuristics. The user problem is converted once to the host problem of the CPU climbers of
+// mip_heuristics (see fj_cpu.cuh), which run on their own threads with different seeds, initial
+// assignments and parameters. Every improving solution is passed to the callback, which is never
+// called by two climbers at the same time.
+//
+// [1] B. Luteberget and G. Sartor, “Feasibility Jump: an LP-free Lagrangian MIP heuristic,”
+// Mathematical Programming Computation, vol. 15, pp. 365–388, 2023.
+template <typename i_t, typename f_t>
+class feasibility_jump_t {
+ public:
+  using callback_t = std::function<void(const std::vector<f_t>&)>;
+
+  feasibility_jump_t(const user_problem_t<i_t, f_t>& problem,
+                     const simplex_solver_settings_t<i_t, f_t>& settings,
+                     f_t start_time);
+  ~feasibility_jump_t();
+
+  // Number of climbers used by `start` for the `feasibility_jump_climbers` setting. Returns 0 if
+  // feasibility jump is disabled, the problem has no integer variable or its bounds are empty, or
+  // in the automatic mode when B&B already uses every thread.
+  i_t num_climbers() const;
+
+  // Starts `num_climbers` climbers in the background. They run until `stop` is called or the
+  // time limit is reached.
+  void start(i_t num_climbers, callback_t callback);
+  void stop();
+
+  i_t num_solutions() const { return num_solutions_; }
+  // Objective of the best solution, in the sense of the user problem
+  f_t get_best_objective() const
+  {
+    return problem_.objective_scaling_factor * (best_objective_ + problem_.objective_offset);
+  }
+  int64_t get_num_moves() const { return num_moves_; }
+
+ private:
+  using climber_t = detail::fj_cpu_host_climber_t<i_t, f_t>;
+
+  std::vector<f_t> initial_assignment(i_t id, std::mt19937& rng) const;
+  void run_climber(i_t id);
+  void report_solution(i_t id, f_t objective, const std::vector<f_t>& assignment);
+
+  const simplex_solver_settings_t<i_t, f_t>& settings_;
+  const f_t start_time_;
+  i_t num_integers_;
+  bool objective_is_zero_;
+  detail::fj_cpu_host_problem_t<i_t, f_t> problem_;
+
+  std::vector<std::unique_ptr<climber_t>> climbers_;
+  std::vector<std::thread> threads_;
+  callback_t callback_;
+  omp_mutex_t mutex_solution_;
+  omp_atomic_t<f_t> best_objective_;
+  omp_atomic_t<i_t> num_solutions_;
+  omp_atomic_t<int64_t> num_moves_;
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <dual_simplex/initial_basis.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
 #include <dual_simplex/types.hpp>
 
 #include <utilities/hashing.hpp>
@@ -33,6 +34,23 @@ enum class rounding_direction_t : int8_t { NONE = -1, DOWN = 0, UP = 1 };
 
 bool inactive_status(node_status_t status);
 
+// Cuts separated at a node, which are only valid in its subtree. The leaf problem of a node
+// contains the rows of the global LP followed by the cuts of its chain, from the oldest to the
+// newest, with a slack column for each cut. So the k-th cut of the chain is the row
+// `num_rows + k` and its slack is the column `num_cols + k` of the leaf problem, where `num_rows`
+// and `num_cols` are the dimensions of the global LP.
+template <typename i_t, typename f_t>
+struct node_cuts_t {
+  // Cuts of the closest ancestor that separated cuts
+  std::shared_ptr<const node_cuts_t> parent;
+  // The cuts and their right-hand side, in the form passed to `add_cuts`. They may contain the
+  // slacks of the cuts of the ancestors.
+  csr_matrix_t<i_t, f_t> rows;
+  std::vector<f_t> rhs;
+  // Number of cuts in the chain, including these ones
+  i_t num_cuts;
+};
+
 template <typename i_t, typename f_t>
 class mip_node_t {
  public:
@@ -88,7 +106,8 @@ class mip_node_t {
       fractional_val(branch_var_value),
       integer_infeasible(integer_inf),
       objective_estimate(parent_node->objective_estimate),
-      vstatus(basis)
+      vstatus(basis),
+      cuts(parent_node->cuts)
   {
     branch_var_lower = branch_direction == rounding_direction_t::DOWN ? problem.lower[branch_var]
                                                                       : std::ceil(branch_var_value);
@@ -245,6 +264,7 @@ class mip_node_t {
     copy.branch_var_lower   = branch_var_lower;
     copy.branch_var_upper   = branch_var_upper;
     copy.fractional_val     = fractional_val;
+    copy.cuts               = cuts;
     copy.parent             = nullptr;
     copy.children[0]        = nullptr;
     copy.children[1]        = nullptr;
@@ -272,6 +292,9 @@ class mip_node_t {
 
   std::vector<variable_status_t> vstatus;
 
+  // Local cuts of the node and its ancestors. `vstatus` includes their slacks.
+  std::shared_ptr<const node_cuts_t<i_t, f_t>> cuts;
+
   // Worker-local identification for deterministic ordering:
   // - origin_worker_id: which worker created this node
   // - creation_seq: sequence number within that worker (cumulative across horizons, serial)
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <branch_and_bound/mip_node.hpp>
+#include <branch_and_bound/node_spill.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -54,6 +56,14 @@ class heap_t {
     return node;
   }
 
+  // Removes the elements for which `pred` is true in O(n)
+  template <typename Pred>
+  void remove_if(Pred pred)
+  {
+    buffer.erase(std::remove_if(buffer.begin(), buffer.end(), pred), buffer.end());
+    std::make_heap(buffer.begin(), buffer.end(), comp);
+  }
+
   size_t size() const { return buffer.size(); }
   T& top() { return buffer.front(); }
   void clear() { buffer.clear(); }
@@ -106,6 +116,36 @@ class node_queue_t {
   heap_t<std::shared_ptr<heap_entry_t>, score_comp> diving_heap;
   omp_mutex_t mutex;
 
+  // Entries of the best-first heap whose node was taken by `pop_best_estimate`. They are removed
+  // once they reach the top.
+  i_t num_stale_best_first = 0;
+
+  // Nodes whose basis was moved out of memory, see `spill_nodes`
+  node_spill_t<i_t, f_t> spill;
+  size_t max_nodes_in_memory = std::numeric_limits<size_t>::max();
+
+  // Upper bound and number of spilled nodes at the last `prune_spilled`
+  f_t spill_pruned_upper_bound     = inf;
+  int64_t spill_pruned_num_spilled = 0;
+
+  size_t num_nodes_in_memory() const { return best_first_heap.size() - num_stale_best_first; }
+
+  // Keeps the node with the lowest lower bound, among all the nodes waiting to be explored, at the
+  // top of the best-first heap
+  void update_top()
+  {
+    while (!best_first_heap.empty() && best_first_heap.top()->node == nullptr) {
+      best_first_heap.pop();
+      --num_stale_best_first;
+    }
+    while (!spill.empty() && (best_first_heap.empty() ||
+                              spill.lower_bound() < best_first_heap.top()->lower_bound)) {
+      auto entry = std::make_shared<heap_entry_t>(spill.reload());
+      best_first_heap.push(entry);
+      diving_heap.push(entry);
+    }
+  }
+
  public:
   void push(mip_node_t<i_t, f_t>* new_node)
   {
@@ -119,12 +159,33 @@ class node_queue_t {
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
     auto entry = best_first_heap.pop();
+    update_top();
 
     if (entry.has_value()) { return std::exchange(entry.value()->node, nullptr); }
 
     return std::nullopt;
   }
 
+  // Pops the node with the best score, like `pop_diving`, but the node is also removed from the
+  // best-first heap and explored by the caller
+  std::optional<mip_node_t<i_t, f_t>*> pop_best_estimate()
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex);
+
+    while (!diving_heap.empty()) {
+      auto entry = diving_heap.pop();
+
+      if (entry.has_value() && entry.value()->node != nullptr) {
+        mip_node_t<i_t, f_t>* node_ptr = std::exchange(entry.value()->node, nullptr);
+        ++num_stale_best_first;
+        update_top();
+        return node_ptr;
+      }
+    }
+
+    return std::nullopt;
+  }
+
   std::optional<mip_node_t<i_t, f_t>*> pop_diving()
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
@@ -149,7 +210,7 @@ class node_queue_t {
   i_t best_first_queue_size()
   {
     std::lock_guard<omp_mutex_t> lock(mutex);
-    return best_first_heap.size();
+    return num_nodes_in_memory() + spill.size();
   }
 
   f_t get_lower_bound()
@@ -163,6 +224,97 @@ class node_queue_t {
     std::lock_guard<omp_mutex_t> lock(mutex);
     return best_first_heap.empty() ? nullptr : best_first_heap.top()->node;
   }
+
+  // Drops all the nodes, e.g., when the tree is discarded on a restart
+  void clear()
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex);
+    best_first_heap.clear();
+    diving_heap.clear();
+    num_stale_best_first = 0;
+    spill.clear();
+    spill_pruned_upper_bound = inf;
+    spill_pruned_num_spilled = 0;
+  }
+
+  // Bounds the memory of the nodes in the queue to `megabytes`, beyond which the bases of the worst
+  // nodes are written to a temporary file (see `spill_nodes`). The bases are compressed against
+  // `reference`. Returns false if the file cannot be created.
+  bool set_memory_limit(f_t megabytes, const std::vector<variable_status_t>& reference)
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex);
+    if (!spill.open(reference)) { return false; }
+    // Approximate footprint of a node in the queue: the node, its basis and its heap entries
+    const f_t node_bytes = sizeof(mip_node_t<i_t, f_t>) +
+                           reference.size() * sizeof(variable_status_t) + sizeof(heap_entry_t) +
+                           4 * sizeof(std::shared_ptr<heap_entry_t>);
+    max_nodes_in_memory =
+      static_cast<size_t>(std::max<f_t>(2.0, megabytes * 1024 * 1024 / node_bytes));
+    return true;
+  }
+
+  // When the queue exceeds its memory limit, moves the bases of the worst half of the nodes, by
+  // lower bound, out of memory. The nodes are reloaded once they have the lowest lower bound of the
+  // queue. Nodes whose basis cannot be spilled, such as the nodes with local cuts, stay in memory.
+  // Since the bases of the nodes in the queue are freed, it must be called by the thread that pops
+  // the nodes. Returns the number of nodes spilled.
+  i_t spill_nodes()
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex);
+    if (num_nodes_in_memory() <= max_nodes_in_memory) { return 0; }
+
+    std::vector<heap_entry_t*> entries;
+    entries.reserve(num_nodes_in_memory());
+    for (const auto& entry : best_first_heap.data()) {
+      if (entry->node != nullptr) { entries.push_back(entry.get()); }
+    }
+    const size_t num_kept = entries.size() / 2;
+    std::nth_element(entries.begin(),
+                     entries.begin() + num_kept,
+                     entries.end(),
+                     [](const heap_entry_t* a, const heap_entry_t* b) {
+                       return a->lower_bound < b->lower_bound;
+                     });
+
+    i_t num_spilled = 0;
+    for (size_t k = num_kept; k < entries.size(); ++k) {
+      const spill_status_t status = spill.spill(entries[k]->node);
+      if (status == spill_status_t::SKIPPED) { continue; }
+      if (status == spill_status_t::WRITE_ERROR) {
+        // The nodes stay in memory if the file cannot be written
+        max_nodes_in_memory = std::numeric_limits<size_t>::max();
+        break;
+      }
+      entries[k]->node = nullptr;
+      ++num_spilled;
+    }
+
+    auto is_stale = [](const std::shared_ptr<heap_entry_t>& entry) {
+      return entry->node == nullptr;
+    };
+    best_first_heap.remove_if(is_stale);
+    diving_heap.remove_if(is_stale);
+    num_stale_best_first = 0;
+    update_top();
+    return num_spilled;
+  }
+
+  // Drops the spilled nodes whose lower bound exceeds `upper_bound`, without reading their basis,
+  // and appends them to `pruned`. Does nothing unless the upper bound improved or nodes were
+  // spilled since the last call. Returns the number of nodes pruned.
+  i_t prune_spilled(f_t upper_bound, std::vector<mip_node_t<i_t, f_t>*>& pruned)
+  {
+    std::lock_guard<omp_mutex_t> lock(mutex);
+    if (spill.empty() || (upper_bound >= spill_pruned_upper_bound &&
+                          spill.num_spilled() == spill_pruned_num_spilled)) {
+      return 0;
+    }
+    spill_pruned_upper_bound = upper_bound;
+    spill_pruned_num_spilled = spill.num_spilled();
+    return spill.prune(upper_bound, pruned);
+  }
+
+  const node_spill_t<i_t, f_t>& spilled_nodes() const { return spill; }
 };
 
 }  // namespace cuopt::linear_programming::dual_simplex
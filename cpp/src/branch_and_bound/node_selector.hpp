@@ -0,0 +1,162 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+
+#include <utilities/omp_helpers.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Rule used to pick the node that starts a plunge
+enum class node_rule_t { BEST_BOUND, BEST_ESTIMATE };
+
+// Adaptive node selection of the best-first workers and limits of the dives (see [1], Chapter 6).
+//
+// The statistics of the search are collected while the workers run and the rules are tuned online:
+// - Without an incumbent, most plunges start from the node with the best pseudocost estimate. Once
+//   there is one, the share of the best-estimate picks shrinks with the relative gap and with the
+//   success rate of the dives, since the diving workers then already find the solutions.
+// - A plunge is handed back to the queue when the lower bound of its next node is too far from the
+//   global lower bound with respect to the gap, or when it is deeper than the maximum plunge depth.
+//   The maximum grows with the ratio between the LP time of the first node of a plunge, which
+//   starts from a new basis, and the LP time of the nodes that continue from their parent.
+// - The node and backtrack limits of the dives are scaled by the success rate of the dives.
+//
+// Each decision is O(1), so a pop of the node queue stays O(log n).
+//
+// [1] T. Achterberg, “Constraint Integer Programming,” PhD, Technischen Universität Berlin,
+// Berlin, 2007. doi: 10.14279/depositonce-1634.
+template <typename i_t, typename f_t>
+class node_selector_t {
+ public:
+  void init(const simplex_solver_settings_t<i_t, f_t>& settings)
+  {
+    enabled_              = settings.adaptive_node_selection != 0 && !settings.deterministic;
+    dive_node_limit_      = settings.diving_settings.node_limit;
+    dive_backtrack_limit_ = settings.diving_settings.backtrack_limit;
+    estimate_credit_      = 0.0;
+  }
+
+  bool enabled() const { return enabled_; }
+
+  // Rule for the next node popped by a best-first worker. Only called by the scheduler.
+  node_rule_t next_rule(f_t rel_gap, bool has_incumbent)
+  {
+    if (!enabled_) { return node_rule_t::BEST_BOUND; }
+    f_t share = no_incumbent_estimate_share;
+    if (has_incumbent) {
+      share = std::min(rel_gap, max_estimate_share) * (1.0 - dive_success_rate());
+    }
+    // The picks follow the share without drawing random numbers
+    estimate_credit_ += share;
+    if (estimate_credit_ < 1.0) { return node_rule_t::BEST_BOUND; }
+    estimate_credit_ -= 1.0;
+    ++num_estimate_picks_;
+    return node_rule_t::BEST_ESTIMATE;
+  }
+
+  // Returns false if the plunge should stop before the node at `plunge_depth` below its start
+  bool continue_plunge(i_t plunge_depth, f_t lower_bound, f_t global_lower_bound, f_t upper_bound)
+  {
+    if (!enabled_ || plunge_depth < min_plunge_depth || !std::isfinite(upper_bound)) {
+      return true;
+    }
+    // The more a new plunge costs, the further the plunge may go
+    const f_t ratio = lp_time_ratio();
+    const f_t depth = std::round(default_plunge_depth * ratio);
+    const f_t gap   = std::min<f_t>(plunge_gap_fraction * ratio, 1.0);
+    if (plunge_depth <= std::clamp<f_t>(depth, min_plunge_depth, max_plunge_depth) &&
+        lower_bound - global_lower_bound <= gap * (upper_bound - global_lower_bound)) {
+      return true;
+    }
+    ++num_plunges_stopped_;
+    return false;
+  }
+
+  i_t dive_node_limit() const
+  {
+    return std::max<i_t>(1, std::round(dive_limit_scale() * dive_node_limit_));
+  }
+
+  i_t dive_backtrack_limit() const
+  {
+    return std::max<i_t>(1, std::round(dive_limit_scale() * dive_backtrack_limit_));
+  }
+
+  // Fraction of the dives that improved the incumbent, starting from 1/2
+  f_t dive_success_rate() const
+  {
+    const f_t rate = (num_dive_incumbents_ + 1.0) / (num_dives_ + 2.0);
+    return std::min<f_t>(rate, 1.0);
+  }
+
+  void record_node_lp(bool first_node, f_t lp_time)
+  {
+    if (first_node) {
+      ++num_first_nodes_;
+      first_node_lp_time_ += lp_time;
+    } else {
+      ++num_next_nodes_;
+      next_node_lp_time_ += lp_time;
+    }
+  }
+
+  void record_dive() { ++num_dives_; }
+  void record_dive_incumbent() { ++num_dive_incumbents_; }
+
+  int64_t num_estimate_picks() const { return num_estimate_picks_; }
+  int64_t num_plunges_stopped() const { return num_plunges_stopped_; }
+
+ private:
+  static constexpr f_t no_incumbent_estimate_share = 0.75;
+  static constexpr f_t max_estimate_share          = 0.5;
+  static constexpr f_t plunge_gap_fraction         = 0.25;
+  static constexpr i_t min_plunge_depth            = 2;
+  static constexpr i_t default_plunge_depth        = 10;
+  static constexpr i_t max_plunge_depth            = 200;
+  static constexpr int64_t min_samples             = 20;
+
+  // Ratio between the LP time of the first node of a plunge and of the next nodes
+  f_t lp_time_ratio() const
+  {
+    const int64_t first_nodes = num_first_nodes_;
+    const int64_t next_nodes  = num_next_nodes_;
+    if (first_nodes < min_samples || next_nodes < min_samples) { return 1.0; }
+    const f_t first_time = first_node_lp_time_ / first_nodes;
+    const f_t next_time  = next_node_lp_time_ / next_nodes;
+    return next_time > 0.0 ? std::max<f_t>(first_time / next_time, 1.0) : 1.0;
+  }
+
+  // The limits of the dives are between 1/4 and 2 times the limits in the settings
+  f_t dive_limit_scale() const
+  {
+    if (!enabled_) { return 1.0; }
+    return std::clamp<f_t>(2.0 * dive_success_rate(), 0.25, 2.0);
+  }
+
+  bool enabled_{false};
+  i_t dive_node_limit_{0};
+  i_t dive_backtrack_limit_{0};
+  f_t estimate_credit_{0.0};
+
+  omp_atomic_t<int64_t> num_first_nodes_{0};
+  omp_atomic_t<int64_t> num_next_nodes_{0};
+  omp_atomic_t<f_t> first_node_lp_time_{0.0};
+  omp_atomic_t<f_t> next_node_lp_time_{0.0};
+  omp_atomic_t<int64_t> num_dives_{0};
+  omp_atomic_t<int64_t> num_dive_incumbents_{0};
+  omp_atomic_t<int64_t> num_estimate_picks_{0};
+  omp_atomic_t<int64_t> num_plunges_stopped_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
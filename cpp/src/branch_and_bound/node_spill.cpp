@@ -0,0 +1,234 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/node_spill.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+namespace {
+
+void write_varint(uint64_t value, std::vector<uint8_t>& buffer)
+{
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<uint8_t>(value));
+}
+
+// Returns false if the varint runs past `end`
+bool read_varint(const uint8_t*& data, const uint8_t* end, uint64_t& value)
+{
+  value     = 0;
+  int shift = 0;
+  while (data < end && shift < 64) {
+    const uint8_t byte = *data++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) { return true; }
+    shift += 7;
+  }
+  return false;
+}
+
+}  // namespace
+
+void encode_basis(const std::vector<variable_status_t>& reference,
+                  const std::vector<variable_status_t>& vstatus,
+                  std::vector<uint8_t>& buffer)
+{
+  size_t last = 0;
+  for (size_t j = 0; j < reference.size(); ++j) {
+    if (vstatus[j] != reference[j]) {
+      write_varint(j - last, buffer);
+      buffer.push_back(static_cast<uint8_t>(vstatus[j]));
+      last = j;
+    }
+  }
+}
+
+bool decode_basis(const uint8_t* data, size_t size, std::vector<variable_status_t>& vstatus)
+{
+  const uint8_t* end = data + size;
+  uint64_t j         = 0;
+  while (data < end) {
+    uint64_t delta;
+    if (!read_varint(data, end, delta) || data == end || j + delta >= vstatus.size()) {
+      return false;
+    }
+    j += delta;
+    vstatus[j] = static_cast<variable_status_t>(static_cast<int8_t>(*data++));
+  }
+  return true;
+}
+
+template <typename i_t, typename f_t>
+bool node_spill_t<i_t, f_t>::open(const std::vector<variable_status_t>& reference)
+{
+  close();
+  std::error_code error;
+  const auto directory = std::filesystem::temp_directory_path(error);
+  if (error) { return false; }
+  std::string path = (directory / "cuopt_nodes_XXXXXX").string();
+  const int fd     = mkstemp(path.data());
+  if (fd < 0) { return false; }
+  unlink(path.c_str());
+  file_ = fdopen(fd, "w+b");
+  if (file_ == nullptr) {
+    ::close(fd);
+    return false;
+  }
+  reference_ = reference;
+  return true;
+}
+
+template <typename i_t, typename f_t>
+void node_spill_t<i_t, f_t>::close()
+{
+  records_.clear();
+  file_size_  = 0;
+  live_bytes_ = 0;
+  if (file_ != nullptr) {
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+template <typename i_t, typename f_t>
+spill_status_t node_spill_t<i_t, f_t>::spill(mip_node_t<i_t, f_t>* node)
+{
+  if (file_ == nullptr) { return spill_status_t::WRITE_ERROR; }
+  if (node->vstatus.size() != reference_.size()) { return spill_status_t::SKIPPED; }
+  compact_if_needed();
+
+  buffer_.clear();
+  encode_basis(reference_, node->vstatus, buffer_);
+
+  if (std::fseek(file_, file_size_, SEEK_SET) != 0 ||
+      std::fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size()) {
+    return spill_status_t::WRITE_ERROR;
+  }
+  records_.push_back({node->lower_bound, node, file_size_, static_cast<uint32_t>(buffer_.size())});
+  std::push_heap(records_.begin(), records_.end(), record_comp);
+  file_size_ += buffer_.size();
+  live_bytes_ += buffer_.size();
+  bytes_written_ += buffer_.size();
+  ++num_spilled_;
+
+  std::vector<variable_status_t>().swap(node->vstatus);
+  return spill_status_t::SPILLED;
+}
+
+template <typename i_t, typename f_t>
+mip_node_t<i_t, f_t>* node_spill_t<i_t, f_t>::reload()
+{
+  if (records_.empty()) { return nullptr; }
+  std::pop_heap(records_.begin(), records_.end(), record_comp);
+  const record_t record = records_.back();
+  records_.pop_back();
+  live_bytes_ -= record.length;
+  ++num_reloaded_;
+
+  buffer_.resize(record.length);
+  const bool ok = std::fseek(file_, record.offset, SEEK_SET) == 0 &&
+                  std::fread(buffer_.data(), 1, buffer_.size(), file_) == buffer_.size();
+  std::vector<variable_status_t> vstatus = reference_;
+  if (!ok || !decode_basis(buffer_.data(), buffer_.size(), vstatus)) { vstatus = reference_; }
+  mip_node_t<i_t, f_t>* node = record.node;
+  node->vstatus              = std::move(vstatus);
+
+  // Every node was reloaded, the file can start over
+  if (records_.empty()) {
+    file_size_  = 0;
+    live_bytes_ = 0;
+  }
+  return node;
+}
+
+template <typename i_t, typename f_t>
+i_t node_spill_t<i_t, f_t>::prune(f_t upper_bound, std::vector<mip_node_t<i_t, f_t>*>& pruned)
+{
+  size_t num_kept = 0;
+  for (size_t k = 0; k < records_.size(); ++k) {
+    if (records_[k].lower_bound > upper_bound) {
+      pruned.push_back(records_[k].node);
+      live_bytes_ -= records_[k].length;
+    } else {
+      records_[num_kept++] = records_[k];
+    }
+  }
+  const i_t num_pruned = records_.size() - num_kept;
+  if (num_pruned == 0) { return 0; }
+  records_.resize(num_kept);
+  std::make_heap(records_.begin(), records_.end(), record_comp);
+  num_pruned_ += num_pruned;
+
+  if (records_.empty()) {
+    file_size_ = 0;
+  } else {
+    compact_if_needed();
+  }
+  return num_pruned;
+}
+
+template <typename i_t, typename f_t>
+void node_spill_t<i_t, f_t>::compact_if_needed()
+{
+  // Small files are left alone, they are reclaimed when the store becomes empty
+  constexpr int64_t min_compaction_size = 1 << 20;
+  if (file_ == nullptr || file_size_ < min_compaction_size || 2 * live_bytes_ > file_size_) {
+    return;
+  }
+
+  // A record only moves toward the front of the file, so the records are moved in place in the
+  // order of their offsets
+  std::sort(records_.begin(), records_.end(), [](const record_t& a, const record_t& b) {
+    return a.offset < b.offset;
+  });
+  int64_t offset = 0;
+  for (auto& record : records_) {
+    buffer_.resize(record.length);
+    const bool ok = std::fseek(file_, record.offset, SEEK_SET) == 0 &&
+                    std::fread(buffer_.data(), 1, buffer_.size(), file_) == buffer_.size() &&
+                    std::fseek(file_, offset, SEEK_SET) == 0 &&
+                    std::fwrite(buffer_.data(), 1, buffer_.size(), file_) == buffer_.size();
+    if (!ok) {
+      // The node starts from the reference basis when it is reloaded
+      record.length = 0;
+    }
+    record.offset = offset;
+    offset += record.length;
+  }
+  std::fflush(file_);
+  std::make_heap(records_.begin(), records_.end(), record_comp);
+  file_size_  = offset;
+  live_bytes_ = offset;
+  if (ftruncate(fileno(file_), file_size_) != 0) {
+    // The file keeps its size, the space past the records is reused by the next records
+  }
+  ++num_compactions_;
+}
+
+template <typename i_t, typename f_t>
+void node_spill_t<i_t, f_t>::clear()
+{
+  records_.clear();
+  file_size_  = 0;
+  live_bytes_ = 0;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class node_spill_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
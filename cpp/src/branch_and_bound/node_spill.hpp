@@ -0,0 +1,123 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <branch_and_bound/mip_node.hpp>
+
+#include <dual_simplex/initial_basis.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Appends the variables whose status in `vstatus` differs from `reference` to `buffer`, each as the
+// varint encoded difference with the index of the previous one followed by its status
+void encode_basis(const std::vector<variable_status_t>& reference,
+                  const std::vector<variable_status_t>& vstatus,
+                  std::vector<uint8_t>& buffer);
+
+// Applies `size` bytes written by `encode_basis` to `vstatus`, which holds a copy of the reference.
+// Returns false if the bytes are corrupted.
+bool decode_basis(const uint8_t* data, size_t size, std::vector<variable_status_t>& vstatus);
+
+// Outcome of `node_spill_t::spill`
+enum class spill_status_t : int8_t {
+  SPILLED,     // the basis was written and freed
+  SKIPPED,     // the basis cannot be encoded against the reference, e.g., the node has local cuts
+  WRITE_ERROR  // the file cannot be written
+};
+
+// Bases of open B&B nodes moved out of memory into a temporary file.
+//
+// The basis of a node is the only part that grows with the problem, the branching decisions are
+// stored one per node along its path in the search tree. A spilled node stays in the tree with an
+// empty basis, and its basis is written as the list of the variables whose status differs from a
+// reference basis, usually the basis of the root, with the indices delta and varint encoded.
+//
+// The file is created in the temporary directory (TMPDIR) and removed as soon as it is opened, so
+// it does not outlive the process. The space of the reloaded and pruned records is reclaimed when
+// the store becomes empty, or by compacting the file once most of it is dead.
+template <typename i_t, typename f_t>
+class node_spill_t {
+ public:
+  node_spill_t() = default;
+  ~node_spill_t() { close(); }
+
+  node_spill_t(const node_spill_t&)            = delete;
+  node_spill_t& operator=(const node_spill_t&) = delete;
+
+  // Creates the spill file. Returns false if it cannot be created.
+  bool open(const std::vector<variable_status_t>& reference);
+  void close();
+  bool is_open() const { return file_ != nullptr; }
+
+  // Writes the basis of `node` and frees it. A node whose basis does not have the size of the
+  // reference is skipped. On a skip or a write error the node keeps its basis.
+  spill_status_t spill(mip_node_t<i_t, f_t>* node);
+
+  // Restores the basis of the spilled node with the lowest lower bound and returns the node. If
+  // the record cannot be read, the node starts from the reference basis, which is dual feasible
+  // for every node since the nodes only differ from the root by their bounds.
+  mip_node_t<i_t, f_t>* reload();
+
+  // Drops the spilled nodes whose lower bound exceeds `upper_bound` and appends them to `pruned`,
+  // then compacts the file if most of it is dead. Returns the number of nodes pruned.
+  i_t prune(f_t upper_bound, std::vector<mip_node_t<i_t, f_t>*>& pruned);
+
+  // Drops the spilled nodes, e.g., when the tree is discarded on a restart
+  void clear();
+
+  size_t size() const { return records_.size(); }
+  bool empty() const { return records_.empty(); }
+  // Lowest lower bound of the spilled nodes, inf if there are none
+  f_t lower_bound() const { return records_.empty() ? inf : records_.front().lower_bound; }
+
+  int64_t num_spilled() const { return num_spilled_; }
+  int64_t num_reloaded() const { return num_reloaded_; }
+  int64_t bytes_written() const { return bytes_written_; }
+  int64_t num_pruned() const { return num_pruned_; }
+  int64_t num_compactions() const { return num_compactions_; }
+  // Size of the file and of the records it still holds
+  int64_t file_size() const { return file_size_; }
+  int64_t live_bytes() const { return live_bytes_; }
+
+ private:
+  struct record_t {
+    f_t lower_bound;
+    mip_node_t<i_t, f_t>* node;
+    int64_t offset;
+    uint32_t length;
+  };
+
+  // Min-heap on the lower bound
+  static bool record_comp(const record_t& a, const record_t& b)
+  {
+    return a.lower_bound > b.lower_bound;
+  }
+
+  // Moves the records to the front of the file, in the order they were written, and truncates it
+  // when more than half of the file is dead
+  void compact_if_needed();
+
+  std::FILE* file_{nullptr};
+  int64_t file_size_{0};
+  int64_t live_bytes_{0};
+  std::vector<variable_status_t> reference_;
+  std::vector<record_t> records_;
+  std::vector<uint8_t> buffer_;
+
+  int64_t num_spilled_{0};
+  int64_t num_reloaded_{0};
+  int64_t bytes_written_{0};
+  int64_t num_pruned_{0};
+  int64_t num_compactions_{0};
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
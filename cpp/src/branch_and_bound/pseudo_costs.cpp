@@ -18,6 +18,8 @@
 
 #include <omp.h>
 
+#include <mutex>
+
 namespace cuopt::linear_programming::dual_simplex {
 
 namespace {
@@ -139,83 +141,6 @@ void strong_branch_helper(i_t start,
   }
 }
 
-template <typename i_t, typename f_t>
-f_t trial_branching(const lp_problem_t<i_t, f_t>& original_lp,
-                    const simplex_solver_settings_t<i_t, f_t>& settings,
-                    const std::vector<variable_type_t>& var_types,
-                    const std::vector<variable_status_t>& vstatus,
-                    const std::vector<f_t>& edge_norms,
-                    const basis_update_mpf_t<i_t, f_t>& basis_factors,
-                    const std::vector<i_t>& basic_list,
-                    const std::vector<i_t>& nonbasic_list,
-                    i_t branch_var,
-                    f_t branch_var_lower,
-                    f_t branch_var_upper,
-                    f_t upper_bound,
-                    i_t bnb_lp_iter_per_node,
-                    f_t start_time,
-                    i_t upper_max_lp_iter,
-                    i_t lower_max_lp_iter,
-                    omp_atomic_t<int64_t>& total_lp_iter)
-{
-  lp_problem_t child_problem      = original_lp;
-  child_problem.lower[branch_var] = branch_var_lower;
-  child_problem.upper[branch_var] = branch_var_upper;
-
-  const bool initialize_basis                        = false;
-  simplex_solver_settings_t<i_t, f_t> child_settings = settings;
-  child_settings.set_log(false);
-  i_t lp_iter_upper              = upper_max_lp_iter;
-  i_t lp_iter_lower              = lower_max_lp_iter;
-  child_settings.iteration_limit = std::clamp(bnb_lp_iter_per_node, lp_iter_lower, lp_iter_upper);
-  child_settings.cut_off         = upper_bound + settings.dual_tol;
-  child_settings.inside_mip      = 2;
-  child_settings.scale_columns   = false;
-
-  lp_solution_t<i_t, f_t> solution(original_lp.num_rows, original_lp.num_cols);
-  i_t iter                                         = 0;
-  std::vector<variable_status_t> child_vstatus     = vstatus;
-  std::vector<f_t> child_edge_norms                = edge_norms;
-  std::vector<i_t> child_basic_list                = basic_list;
-  std::vector<i_t> child_nonbasic_list             = nonbasic_list;
-  basis_update_mpf_t<i_t, f_t> child_basis_factors = basis_factors;
-
-  // Only refactor the basis if we encounter numerical issues.
-  child_basis_factors.set_refactor_frequency(upper_max_lp_iter);
-
-  dual::status_t status = dual_phase2_with_advanced_basis(2,
-                                                          0,
-                                                          initialize_basis,
-                                                          start_time,
-                                                          child_problem,
-                                                          child_settings,
-                                                          child_vstatus,
-                                                          child_basis_factors,
-                                                          child_basic_list,
-                                                          child_nonbasic_list,
-                                                          solution,
-                                                          iter,
-                                                          child_edge_norms);
-  total_lp_iter += iter;
-  settings.log.debug("Trial branching on variable %d. Lo: %e Up: %e. Iter %d. Status %s. Obj %e\n",
-                     branch_var,
-                     child_problem.lower[branch_var],
-                     child_problem.upper[branch_var],
-                     iter,
-                     dual::status_to_string(status).c_str(),
-                     compute_objective(child_problem, solution.x));
-
-  if (status == dual::status_t::DUAL_UNBOUNDED) {
-    // LP was infeasible
-    return std::numeric_limits<f_t>::infinity();
-  } else if (status == dual::status_t::OPTIMAL || status == dual::status_t::ITERATION_LIMIT ||
-             status == dual::status_t::CUTOFF) {
-    return compute_objective(child_problem, solution.x);
-  } else {
-    return std::numeric_limits<f_t>::quiet_NaN();
-  }
-}
-
 }  // namespace
 
 template <typename i_t, typename f_t>
@@ -466,12 +391,16 @@ void pseudo_costs_t<i_t, f_t>::update_pseudo_costs(mip_node_t<i_t, f_t>* node_pt
                               ? node_ptr->fractional_val - std::floor(node_ptr->fractional_val)
                               : std::ceil(node_ptr->fractional_val) - node_ptr->fractional_val;
 
+  // The sum and the count are updated together, so that a checkpoint reads consistent values
+  const i_t j = node_ptr->branch_var;
   if (node_ptr->branch_dir == rounding_direction_t::DOWN) {
-    pseudo_cost_sum_down[node_ptr->branch_var] += change_in_obj / frac;
-    pseudo_cost_num_down[node_ptr->branch_var]++;
+    std::lock_guard<omp_mutex_t> lock(pseudo_cost_mutex_down[j]);
+    pseudo_cost_sum_down[j] += change_in_obj / frac;
+    pseudo_cost_num_down[j]++;
   } else {
-    pseudo_cost_sum_up[node_ptr->branch_var] += change_in_obj / frac;
-    pseudo_cost_num_up[node_ptr->branch_var]++;
+    std::lock_guard<omp_mutex_t> lock(pseudo_cost_mutex_up[j]);
+    pseudo_cost_sum_up[j] += change_in_obj / frac;
+    pseudo_cost_num_up[j]++;
   }
 }
 
@@ -538,6 +467,7 @@ i_t pseudo_costs_t<i_t, f_t>::reliable_variable_selection(
   const branch_and_bound_stats_t<i_t, f_t>& bnb_stats,
   f_t upper_bound,
   int max_num_tasks,
+  trial_branching_pool_t<i_t, f_t>& trial_pool,
   logger_t& log)
 {
   constexpr f_t eps = 1e-6;
@@ -631,33 +561,68 @@ i_t pseudo_costs_t<i_t, f_t>::reliable_variable_selection(
     return branch_var;
   }
 
+  const i_t iteration_limit = std::clamp(branch_and_bound_lp_iter_per_node,
+                                         reliability_branching_settings.lower_max_lp_iter,
+                                         reliability_branching_settings.upper_max_lp_iter);
+  // Only refactor the basis if we encounter numerical issues.
+  const i_t refactor_frequency = reliability_branching_settings.upper_max_lp_iter;
+  trial_branching_t<i_t, f_t> trial(worker->leaf_problem,
+                                    settings,
+                                    node_ptr->vstatus,
+                                    worker->leaf_edge_norms,
+                                    worker->basis_factors,
+                                    worker->basic_list,
+                                    worker->nonbasic_list,
+                                    upper_bound,
+                                    iteration_limit,
+                                    refactor_frequency,
+                                    start_time);
+
+  // A child whose objective exceeds the incumbent is pruned, so any gain beyond the gap of the node
+  // is as good as the gap for choosing the branching variable. The cap is only used to skip the
+  // candidates that cannot win, the pseudo-costs are updated with the actual gain of the trials.
+  const f_t max_gain = std::max(upper_bound - node_ptr->lower_bound, eps);
+
+  // Bound on the score of `j`, assuming that the trials of its unreliable directions reach the
+  // maximum gain. The pseudo-cost after a trial is an average between the current one and the
+  // gain of the trial.
+  auto score_bound = [&](i_t j) {
+    const f_t f_down   = solution[j] - std::floor(solution[j]);
+    const f_t f_up     = std::ceil(solution[j]) - solution[j];
+    const i_t num_down = pseudo_cost_num_down[j];
+    const i_t num_up   = pseudo_cost_num_up[j];
+    const f_t pc_down  = num_down > 0 ? pseudo_cost_sum_down[j] / num_down : pseudo_cost_down_avg;
+    const f_t pc_up    = num_up > 0 ? pseudo_cost_sum_up[j] / num_up : pseudo_cost_up_avg;
+    f_t down_term      = f_down * pc_down;
+    f_t up_term        = f_up * pc_up;
+    if (num_down < reliable_threshold) { down_term = std::max(down_term, max_gain); }
+    if (num_up < reliable_threshold) { up_term = std::max(up_term, max_gain); }
+    return std::max(down_term, eps) * std::max(up_term, eps);
+  };
+
+  auto cannot_win = [&](i_t j) {
+    const f_t bound = score_bound(j);
+    std::lock_guard<omp_mutex_t> lock(score_mutex);
+    return bound <= max_score;
+  };
+
 #pragma omp taskloop if (num_tasks > 1) priority(task_priority) num_tasks(num_tasks) \
-  shared(score_mutex)
+  shared(score_mutex, trial_pool)
   for (i_t i = 0; i < num_candidates; ++i) {
     const i_t j = unreliable_list[i];
 
     if (toc(start_time) > settings.time_limit) { continue; }
+    if (cannot_win(j)) { continue; }
 
     pseudo_cost_mutex_down[j].lock();
     if (pseudo_cost_num_down[j] < reliable_threshold) {
       // Do trial branching on the down branch
-      f_t obj = trial_branching(worker->leaf_problem,
-                                settings,
-                                var_types,
-                                node_ptr->vstatus,
-                                worker->leaf_edge_norms,
-                                worker->basis_factors,
-                                worker->basic_list,
-                                worker->nonbasic_list,
-                                j,
-                                worker->leaf_problem.lower[j],
-                                std::floor(solution[j]),
-                                upper_bound,
-                                branch_and_bound_lp_iter_per_node,
-                                start_time,
-                                reliability_branching_settings.upper_max_lp_iter,
-                                reliability_branching_settings.lower_max_lp_iter,
-                                strong_branching_lp_iter);
+      auto& workspace = trial_pool.get_workspace(
+        worker->leaf_problem, worker->leaf_cuts, refactor_frequency);
+      i_t iter        = 0;
+      f_t obj =
+        trial.solve(workspace, j, worker->leaf_problem.lower[j], std::floor(solution[j]), iter);
+      strong_branching_lp_iter += iter;
 
       if (!std::isnan(obj)) {
         f_t change_in_obj = std::max(obj - node_ptr->lower_bound, eps);
@@ -669,26 +634,16 @@ i_t pseudo_costs_t<i_t, f_t>::reliable_variable_selection(
     pseudo_cost_mutex_down[j].unlock();
 
     if (toc(start_time) > settings.time_limit) { continue; }
+    if (cannot_win(j)) { continue; }
 
     pseudo_cost_mutex_up[j].lock();
     if (pseudo_cost_num_up[j] < reliable_threshold) {
-      f_t obj = trial_branching(worker->leaf_problem,
-                                settings,
-                                var_types,
-                                node_ptr->vstatus,
-                                worker->leaf_edge_norms,
-                                worker->basis_factors,
-                                worker->basic_list,
-                                worker->nonbasic_list,
-                                j,
-                                std::ceil(solution[j]),
-                                worker->leaf_problem.upper[j],
-                                upper_bound,
-                                branch_and_bound_lp_iter_per_node,
-                                start_time,
-                                reliability_branching_settings.upper_max_lp_iter,
-                                reliability_branching_settings.lower_max_lp_iter,
-                                strong_branching_lp_iter);
+      auto& workspace = trial_pool.get_workspace(
+        worker->leaf_problem, worker->leaf_cuts, refactor_frequency);
+      i_t iter        = 0;
+      f_t obj =
+        trial.solve(workspace, j, std::ceil(solution[j]), worker->leaf_problem.upper[j], iter);
+      strong_branching_lp_iter += iter;
 
       if (!std::isnan(obj)) {
         f_t change_in_obj = std::max(obj - node_ptr->lower_bound, eps);
@@ -9,6 +9,7 @@
 
 #include <branch_and_bound/branch_and_bound_worker.hpp>
 #include <branch_and_bound/mip_node.hpp>
+#include <branch_and_bound/trial_branching.hpp>
 
 #include <dual_simplex/basis_updates.hpp>
 #include <dual_simplex/logger.hpp>
@@ -448,12 +449,13 @@ class pseudo_costs_t {
     }
   }
 
+  // Keeps the pseudo-costs of the existing variables, so they carry over a restart of B&B
   void resize(i_t num_variables)
   {
-    pseudo_cost_sum_down.assign(num_variables, 0);
-    pseudo_cost_sum_up.assign(num_variables, 0);
-    pseudo_cost_num_down.assign(num_variables, 0);
-    pseudo_cost_num_up.assign(num_variables, 0);
+    pseudo_cost_sum_down.resize(num_variables, 0);
+    pseudo_cost_sum_up.resize(num_variables, 0);
+    pseudo_cost_num_down.resize(num_variables, 0);
+    pseudo_cost_num_up.resize(num_variables, 0);
     pseudo_cost_mutex_up.resize(num_variables);
     pseudo_cost_mutex_down.resize(num_variables);
   }
@@ -481,6 +483,7 @@ class pseudo_costs_t {
                                   const branch_and_bound_stats_t<i_t, f_t>& bnb_stats,
                                   f_t upper_bound,
                                   int max_num_tasks,
+                                  trial_branching_pool_t<i_t, f_t>& trial_pool,
                                   logger_t& log);
 
   void update_pseudo_costs_from_strong_branching(const std::vector<i_t>& fractional,
@@ -0,0 +1,108 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/trial_branching.hpp>
+
+#include <dual_simplex/phase2.hpp>
+#include <dual_simplex/solve.hpp>
+
+#include <limits>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+trial_branching_t<i_t, f_t>::trial_branching_t(
+  const lp_problem_t<i_t, f_t>& leaf_problem,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  const std::vector<variable_status_t>& vstatus,
+  const std::vector<f_t>& edge_norms,
+  const basis_update_mpf_t<i_t, f_t>& basis_factors,
+  const std::vector<i_t>& basic_list,
+  const std::vector<i_t>& nonbasic_list,
+  f_t upper_bound,
+  i_t iteration_limit,
+  i_t refactor_frequency,
+  f_t start_time)
+  : leaf_problem_(leaf_problem),
+    vstatus_(vstatus),
+    edge_norms_(edge_norms),
+    basis_factors_(basis_factors),
+    basic_list_(basic_list),
+    nonbasic_list_(nonbasic_list),
+    refactor_frequency_(refactor_frequency),
+    start_time_(start_time),
+    child_settings_(settings)
+{
+  child_settings_.set_log(false);
+  child_settings_.iteration_limit = iteration_limit;
+  child_settings_.cut_off         = upper_bound + settings.dual_tol;
+  child_settings_.inside_mip      = 2;
+  child_settings_.scale_columns   = false;
+}
+
+template <typename i_t, typename f_t>
+f_t trial_branching_t<i_t, f_t>::solve(trial_branching_workspace_t<i_t, f_t>& workspace,
+                                       i_t branch_var,
+                                       f_t lower,
+                                       f_t upper,
+                                       i_t& iter) const
+{
+  auto& child_problem             = workspace.problem;
+  child_problem.lower             = leaf_problem_.lower;
+  child_problem.upper             = leaf_problem_.upper;
+  child_problem.lower[branch_var] = lower;
+  child_problem.upper[branch_var] = upper;
+
+  workspace.vstatus       = vstatus_;
+  workspace.edge_norms    = edge_norms_;
+  workspace.basic_list    = basic_list_;
+  workspace.nonbasic_list = nonbasic_list_;
+  workspace.basis_factors = basis_factors_;
+
+  // Only refactor the basis if we encounter numerical issues.
+  workspace.basis_factors.set_refactor_frequency(refactor_frequency_);
+
+  const bool initialize_basis = false;
+  iter                        = 0;
+  dual::status_t status       = dual_phase2_with_advanced_basis(2,
+                                                          0,
+                                                          initialize_basis,
+                                                          start_time_,
+                                                          child_problem,
+                                                          child_settings_,
+                                                          workspace.vstatus,
+                                                          workspace.basis_factors,
+                                                          workspace.basic_list,
+                                                          workspace.nonbasic_list,
+                                                          workspace.solution,
+                                                          iter,
+                                                          workspace.edge_norms);
+  child_settings_.log.debug(
+    "Trial branching on variable %d. Lo: %e Up: %e. Iter %d. Status %s. Obj %e\n",
+    branch_var,
+    lower,
+    upper,
+    iter,
+    dual::status_to_string(status).c_str(),
+    compute_objective(child_problem, workspace.solution.x));
+
+  if (status == dual::status_t::DUAL_UNBOUNDED) {
+    // LP was infeasible
+    return std::numeric_limits<f_t>::infinity();
+  } else if (status == dual::status_t::OPTIMAL || status == dual::status_t::ITERATION_LIMIT ||
+             status == dual::status_t::CUTOFF) {
+    return compute_objective(child_problem, workspace.solution.x);
+  } else {
+    return std::numeric_limits<f_t>::quiet_NaN();
+  }
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+template class trial_branching_t<int, double>;
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
@@ -0,0 +1,120 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/basis_updates.hpp>
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solution.hpp>
+#include <dual_simplex/types.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Buffers to solve the LP of a trial branch. The constraints of the LP are copied once, when the
+// workspace is created. Afterwards, a trial only copies the bounds, the basis and the edge norms of
+// the node into the existing buffers.
+template <typename i_t, typename f_t>
+struct trial_branching_workspace_t {
+  trial_branching_workspace_t(const lp_problem_t<i_t, f_t>& lp, i_t refactor_frequency)
+    : problem(lp),
+      solution(lp.num_rows, lp.num_cols),
+      basis_factors(lp.num_rows, refactor_frequency)
+  {
+  }
+
+  lp_problem_t<i_t, f_t> problem;
+  lp_solution_t<i_t, f_t> solution;
+  basis_update_mpf_t<i_t, f_t> basis_factors;
+  std::vector<variable_status_t> vstatus;
+  std::vector<f_t> edge_norms;
+  std::vector<i_t> basic_list;
+  std::vector<i_t> nonbasic_list;
+  // Local cuts in the rows of `problem`, if any
+  std::shared_ptr<const void> local_cuts;
+};
+
+// One workspace per thread, shared by all the B&B workers, since their leaf problems only differ in
+// the bounds and the local cuts. A trial does not contain any OpenMP task scheduling point, so a
+// thread never solves two trials at the same time. The pool must be initialized again when the LP
+// changes, e.g., after a restart.
+template <typename i_t, typename f_t>
+class trial_branching_pool_t {
+ public:
+  void init(i_t num_threads)
+  {
+    workspaces_.clear();
+    workspaces_.resize(std::max<i_t>(num_threads, 1));
+  }
+
+  // `local_cuts` are the cuts in the rows of `lp` that are not in the LP of the B&B. The
+  // workspace is created again when they differ from the ones of the last trial of the thread. It
+  // holds them, so their address cannot be reused by other cuts in the meantime.
+  trial_branching_workspace_t<i_t, f_t>& get_workspace(const lp_problem_t<i_t, f_t>& lp,
+                                                       std::shared_ptr<const void> local_cuts,
+                                                       i_t refactor_frequency)
+  {
+    const size_t thread_id = omp_get_thread_num();
+    assert(thread_id < workspaces_.size());
+    auto& workspace = workspaces_[thread_id];
+    if (!workspace || workspace->local_cuts != local_cuts) {
+      workspace = std::make_unique<trial_branching_workspace_t<i_t, f_t>>(lp, refactor_frequency);
+      workspace->local_cuts = std::move(local_cuts);
+    }
+    return *workspace;
+  }
+
+ private:
+  std::vector<std::unique_ptr<trial_branching_workspace_t<i_t, f_t>>> workspaces_;
+};
+
+// Trial branching on the fractional variables of a node. Each trial solves the LP of a child with a
+// limited number of dual simplex iterations, warm-started from the basis of the node. The settings
+// of the trials are prepared once per node.
+template <typename i_t, typename f_t>
+class trial_branching_t {
+ public:
+  trial_branching_t(const lp_problem_t<i_t, f_t>& leaf_problem,
+                    const simplex_solver_settings_t<i_t, f_t>& settings,
+                    const std::vector<variable_status_t>& vstatus,
+                    const std::vector<f_t>& edge_norms,
+                    const basis_update_mpf_t<i_t, f_t>& basis_factors,
+                    const std::vector<i_t>& basic_list,
+                    const std::vector<i_t>& nonbasic_list,
+                    f_t upper_bound,
+                    i_t iteration_limit,
+                    i_t refactor_frequency,
+                    f_t start_time);
+
+  // Returns the objective of the child where `branch_var` is in [lower, upper], infinity if the
+  // child is infeasible, or NaN if the LP could not be solved.
+  f_t solve(trial_branching_workspace_t<i_t, f_t>& workspace,
+            i_t branch_var,
+            f_t lower,
+            f_t upper,
+            i_t& iter) const;
+
+ private:
+  const lp_problem_t<i_t, f_t>& leaf_problem_;
+  const std::vector<variable_status_t>& vstatus_;
+  const std::vector<f_t>& edge_norms_;
+  const basis_update_mpf_t<i_t, f_t>& basis_factors_;
+  const std::vector<i_t>& basic_list_;
+  const std::vector<i_t>& nonbasic_list_;
+  const i_t refactor_frequency_;
+  const f_t start_time_;
+  simplex_solver_settings_t<i_t, f_t> child_settings_;
+};
+
+}  // namespace cuopt::linear_programming::dual_simplex
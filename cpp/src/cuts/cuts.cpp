@@ -12,6 +12,8 @@
 
 #include <barrier/dense_matrix.hpp>
 
+#include <functional>
+
 namespace cuopt::linear_programming::dual_simplex {
 
 template <typename i_t, typename f_t>
@@ -46,7 +48,7 @@ template <typename i_t, typename f_t>
 f_t cut_pool_t<i_t, f_t>::cut_distance(i_t row,
                                        const std::vector<f_t>& x,
                                        f_t& cut_violation,
-                                       f_t& cut_norm)
+                                       f_t& cut_norm) const
 {
   const i_t row_start = cut_storage_.row_start[row];
   const i_t row_end   = cut_storage_.row_start[row + 1];
@@ -183,6 +185,71 @@ i_t cut_pool_t<i_t, f_t>::get_best_cuts(csr_matrix_t<i_t, f_t>& best_cuts,
   return static_cast<i_t>(best_cuts_.size());
 }
 
+template <typename i_t, typename f_t>
+i_t cut_pool_t<i_t, f_t>::get_violated_cuts(const std::vector<f_t>& x,
+                                            i_t max_cuts,
+                                            csr_matrix_t<i_t, f_t>& violated_cuts,
+                                            std::vector<f_t>& violated_rhs,
+                                            std::vector<cut_type_t>& violated_cut_types) const
+{
+  const f_t min_cut_distance = 1e-4;
+  std::vector<f_t> distances(cut_storage_.m, 0.0);
+  std::vector<f_t> norms(cut_storage_.m, 0.0);
+  for (i_t i = 0; i < cut_storage_.m; i++) {
+    f_t violation;
+    const f_t cut_dist = cut_distance(i, x, violation, norms[i]);
+    distances[i]       = cut_dist <= min_cut_distance ? 0.0 : cut_dist;
+  }
+
+  std::vector<i_t> sorted_indices;
+  best_score_last_permutation(distances, sorted_indices);
+
+  // Same selection as score_cuts: the most violated cuts first, skipping the cuts that are almost
+  // parallel to the ones already selected
+  const f_t min_orthogonality = settings_.cut_min_orthogonality;
+  std::vector<i_t> selected;
+  std::vector<f_t> scatter(original_vars_, 0.0);
+  while (static_cast<i_t>(selected.size()) < max_cuts && !sorted_indices.empty()) {
+    const i_t i = sorted_indices.back();
+    sorted_indices.pop_back();
+    if (distances[i] <= min_cut_distance) { break; }
+
+    const i_t i_start = cut_storage_.row_start[i];
+    const i_t i_end   = cut_storage_.row_start[i + 1];
+    for (i_t p = i_start; p < i_end; p++) {
+      scatter[cut_storage_.j[p]] = cut_storage_.x[p];
+    }
+    f_t cut_ortho = 1.0;
+    for (i_t k : selected) {
+      f_t dot = 0.0;
+      for (i_t p = cut_storage_.row_start[k]; p < cut_storage_.row_start[k + 1]; p++) {
+        dot += cut_storage_.x[p] * scatter[cut_storage_.j[p]];
+      }
+      cut_ortho = std::min(cut_ortho, 1.0 - std::abs(dot) / (norms[i] * norms[k]));
+    }
+    for (i_t p = i_start; p < i_end; p++) {
+      scatter[cut_storage_.j[p]] = 0.0;
+    }
+    if (cut_ortho >= min_orthogonality) { selected.push_back(i); }
+  }
+
+  violated_cuts.m = 0;
+  violated_cuts.n = original_vars_;
+  violated_cuts.row_start.assign(1, 0);
+  violated_cuts.j.clear();
+  violated_cuts.x.clear();
+  violated_rhs.clear();
+  violated_cut_types.clear();
+  for (i_t i : selected) {
+    sparse_vector_t<i_t, f_t> cut(cut_storage_, i);
+    cut.negate();
+    violated_cuts.append_row(cut);
+    violated_rhs.push_back(-rhs_storage_[i]);
+    violated_cut_types.push_back(cut_type_[i]);
+  }
+  return static_cast<i_t>(selected.size());
+}
+
 template <typename i_t, typename f_t>
 void cut_pool_t<i_t, f_t>::age_cuts()
 {
@@ -351,6 +418,18 @@ i_t knapsack_generation_t<i_t, f_t>::generate_knapsack_cuts(
   cut.i.reserve(cover_size);
   cut.x.reserve(cover_size);
 
+  // The items outside of the cover are lifted with g(z) = max{h : mu_h <= z}, where mu_h is the sum
+  // of the h largest weights in the cover. Any h items of the cover weigh at most mu_h, so an item
+  // of weight z >= mu_h forces at least h + 1 items of the cover out of the knapsack. Since g is
+  // superadditive, the lifting coefficients do not depend on the order of the items.
+  std::vector<f_t> cover_weights;
+  cover_weights.reserve(cover_size);
+  for (i_t k = 0; k < solution.size(); k++) {
+    if (solution[k] == 0.0) { cover_weights.push_back(weights[k]); }
+  }
+  std::sort(cover_weights.begin(), cover_weights.end(), std::greater<f_t>());
+  std::partial_sum(cover_weights.begin(), cover_weights.end(), cover_weights.begin());
+
   h = 0;
   for (i_t k = 0; k < knapsack_inequality.i.size(); k++) {
     const i_t j = knapsack_inequality.i[k];
@@ -358,6 +437,14 @@ i_t knapsack_generation_t<i_t, f_t>::generate_knapsack_cuts(
       if (solution[h] == 0.0) {
         cut.i.push_back(j);
         cut.x.push_back(-1.0);
+      } else {
+        const i_t lifted_coeff =
+          std::upper_bound(cover_weights.begin(), cover_weights.end(), weights[h]) -
+          cover_weights.begin();
+        if (lifted_coeff > 0) {
+          cut.i.push_back(j);
+          cut.x.push_back(-static_cast<f_t>(lifted_coeff));
+        }
       }
       h++;
     }
@@ -365,8 +452,9 @@ i_t knapsack_generation_t<i_t, f_t>::generate_knapsack_cuts(
   cut_rhs = -cover_size + 1;
   cut.sort();
 
-  // The cut is in the form: - sum_{j in cover} x_j >= -cover_size + 1
-  // Which is equivalent to: sum_{j in cover} x_j <= cover_size - 1
+  // The cut is in the form: - sum_{j in cover} x_j - sum_{j not in cover} g(a_j) x_j >=
+  // -cover_size + 1
+  // Which is equivalent to: sum_{j in cover} x_j + sum_{j not in cover} g(a_j) x_j <= cover_size - 1
 
   // Verify the cut is violated
   f_t dot       = cut.dot(xstar);
@@ -552,6 +640,328 @@ f_t knapsack_generation_t<i_t, f_t>::solve_knapsack_problem(const std::vector<f_
   return objective;
 }
 
+template <typename i_t, typename f_t>
+flow_cover_generation_t<i_t, f_t>::flow_cover_generation_t(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<i_t>& new_slacks,
+  const std::vector<variable_type_t>& var_types)
+  : vub_var_(lp.num_cols, -1),
+    vub_coeff_(lp.num_cols, 0.0),
+    workspace_(lp.num_cols, 0.0),
+    workspace_mark_(lp.num_cols, 0),
+    settings_(settings)
+{
+  is_slack_.resize(lp.num_cols, 0);
+  for (i_t j : new_slacks) {
+    is_slack_[j] = 1;
+  }
+
+  // Find the variable upper bounds: rows a_y y + a_x x <= 0, with a continuous y >= 0, a binary x,
+  // a_y > 0 and a_x < 0. When a variable has several of them, the tightest one is kept.
+  for (i_t i = 0; i < lp.num_rows; i++) {
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+    i_t y               = -1;
+    i_t x               = -1;
+    f_t a_y             = 0.0;
+    f_t a_x             = 0.0;
+    i_t num_vars        = 0;
+    for (i_t p = row_start; p < row_end; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack_[j]) { continue; }
+      num_vars++;
+      if (var_types[j] == variable_type_t::CONTINUOUS) {
+        y   = j;
+        a_y = Arow.x[p];
+      } else {
+        x   = j;
+        a_x = Arow.x[p];
+      }
+    }
+    if (num_vars != 2 || y < 0 || x < 0 || lp.lower[y] < 0.0 || !is_binary(lp, var_types, x)) {
+      continue;
+    }
+    for (i_t sign : {1, -1}) {
+      f_t b;
+      if (!row_upper_bound(lp, Arow, i, sign, b) || b != 0.0) { continue; }
+      if (sign * a_y <= 0.0 || sign * a_x >= 0.0) { continue; }
+      const f_t u = -a_x / a_y;
+      if (vub_var_[y] < 0 || u < vub_coeff_[y]) {
+        vub_var_[y]   = x;
+        vub_coeff_[y] = u;
+      }
+    }
+  }
+
+  // The flow rows have a continuous variable with a variable upper bound and at least three
+  // variables, all of them binary or nonnegative continuous variables
+  for (i_t i = 0; i < lp.num_rows; i++) {
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+    i_t num_vars        = 0;
+    bool has_vub        = false;
+    bool is_flow_row    = true;
+    for (i_t p = row_start; p < row_end; p++) {
+      const i_t j = Arow.j[p];
+      if (is_slack_[j]) { continue; }
+      num_vars++;
+      if (var_types[j] == variable_type_t::CONTINUOUS) {
+        if (lp.lower[j] < 0.0) {
+          is_flow_row = false;
+          break;
+        }
+        if (vub_var_[j] >= 0) { has_vub = true; }
+      } else if (!is_binary(lp, var_types, j)) {
+        is_flow_row = false;
+        break;
+      }
+    }
+    if (is_flow_row && has_vub && num_vars >= 3) { flow_rows_.push_back(i); }
+  }
+
+#ifdef PRINT_FLOW_COVER_INFO
+  settings.log.printf("Number of flow rows %d\n", static_cast<i_t>(flow_rows_.size()));
+#endif
+}
+
+template <typename i_t, typename f_t>
+bool flow_cover_generation_t<i_t, f_t>::row_upper_bound(const lp_problem_t<i_t, f_t>& lp,
+                                                        csr_matrix_t<i_t, f_t>& Arow,
+                                                        i_t i,
+                                                        i_t sign,
+                                                        f_t& b) const
+{
+  // sum_j a_j v_j = rhs - a_s s with l_s <= s <= u_s
+  f_t slack_lower = 0.0;
+  f_t slack_upper = 0.0;
+  for (i_t p = Arow.row_start[i]; p < Arow.row_start[i + 1]; p++) {
+    const i_t j = Arow.j[p];
+    if (!is_slack_[j]) { continue; }
+    const f_t a_s = Arow.x[p];
+    slack_lower   = a_s > 0.0 ? a_s * lp.lower[j] : a_s * lp.upper[j];
+    slack_upper   = a_s > 0.0 ? a_s * lp.upper[j] : a_s * lp.lower[j];
+    break;
+  }
+  const f_t slack_bound = sign > 0 ? slack_lower : -slack_upper;
+  if (slack_bound == -inf) { return false; }
+  b = sign * lp.rhs[i] - slack_bound;
+  return true;
+}
+
+template <typename i_t, typename f_t>
+i_t flow_cover_generation_t<i_t, f_t>::generate_flow_cover_cut(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<variable_type_t>& var_types,
+  const std::vector<f_t>& xstar,
+  i_t flow_row,
+  i_t sign,
+  sparse_vector_t<i_t, f_t>& cut,
+  f_t& cut_rhs)
+{
+  f_t b;
+  if (!row_upper_bound(lp, Arow, flow_row, sign, b)) { return -1; }
+
+  std::vector<flow_t> inflows;
+  std::vector<flow_t> outflows;
+  for (i_t p = Arow.row_start[flow_row]; p < Arow.row_start[flow_row + 1]; p++) {
+    const i_t j = Arow.j[p];
+    if (is_slack_[j]) { continue; }
+    const f_t a = sign * Arow.x[p];
+    if (a == 0.0) { continue; }
+    flow_t flow;
+    flow.a = std::abs(a);
+    if (var_types[j] != variable_type_t::CONTINUOUS) {
+      if (!is_binary(lp, var_types, j)) { return -1; }
+      flow.y        = -1;
+      flow.x        = j;
+      flow.capacity = flow.a;
+      flow.flow     = flow.a * xstar[j];
+      flow.x_value  = xstar[j];
+    } else {
+      if (lp.lower[j] < 0.0) { return -1; }
+      flow.y    = j;
+      flow.flow = flow.a * xstar[j];
+      if (vub_var_[j] >= 0 && is_binary(lp, var_types, vub_var_[j])) {
+        flow.x        = vub_var_[j];
+        flow.capacity = flow.a * std::min(vub_coeff_[j], lp.upper[j]);
+        flow.x_value  = xstar[flow.x];
+      } else {
+        flow.x        = -1;
+        flow.capacity = flow.a * lp.upper[j];
+        flow.x_value  = 1.0;
+      }
+    }
+    flow.x_value = std::min<f_t>(1.0, std::max<f_t>(0.0, flow.x_value));
+    if (a > 0.0) {
+      if (flow.capacity == inf) { return -1; }
+      inflows.push_back(flow);
+    } else {
+      outflows.push_back(flow);
+    }
+  }
+  if (inflows.empty()) { return -1; }
+
+  // Choose the cover C+ among the inflows, preferring the flows that are open in the relaxation,
+  // until the capacity of the cover exceeds b by lambda > 0
+  std::sort(inflows.begin(), inflows.end(), [](const flow_t& a, const flow_t& b) {
+    if (a.x_value != b.x_value) { return a.x_value > b.x_value; }
+    return a.capacity > b.capacity;
+  });
+  const f_t tol        = 1e-6;
+  const f_t lambda_tol = tol * std::max<f_t>(1.0, std::abs(b));
+  f_t cover_capacity   = 0.0;
+  i_t cover_size       = 0;
+  while (cover_size < static_cast<i_t>(inflows.size()) && cover_capacity - b <= lambda_tol) {
+    if (inflows[cover_size].x_value <= 0.0) { break; }
+    cover_capacity += inflows[cover_size].capacity;
+    cover_size++;
+  }
+  const f_t lambda = cover_capacity - b;
+  if (lambda <= lambda_tol) { return -1; }
+
+  // Lifting function of the flow cover inequality. With M_h the sum of the h largest capacities
+  // U_k > lambda in the cover, and r the number of these capacities,
+  //   F(z) = h lambda + max(0, z - (M_{h+1} - lambda))  for M_h <= z <= M_{h+1}, h < r
+  //   F(z) = r lambda + z - M_r                        for z >= M_r
+  // F is superadditive, so the inflows outside of the cover are lifted independently.
+  std::vector<f_t> cover_sums;
+  cover_sums.reserve(cover_size + 1);
+  for (i_t k = 0; k < cover_size; k++) {
+    if (inflows[k].capacity > lambda) { cover_sums.push_back(inflows[k].capacity); }
+  }
+  std::sort(cover_sums.begin(), cover_sums.end(), std::greater<f_t>());
+  cover_sums.insert(cover_sums.begin(), 0.0);
+  std::partial_sum(cover_sums.begin(), cover_sums.end(), cover_sums.begin());
+  const i_t r  = cover_sums.size() - 1;
+  auto lifting = [&](f_t z) {
+    for (i_t h = 0; h < r; h++) {
+      if (z <= cover_sums[h + 1]) {
+        return h * lambda + std::max<f_t>(0.0, z - (cover_sums[h + 1] - lambda));
+      }
+    }
+    return r * lambda + z - cover_sums[r];
+  };
+
+  // The cut is built on the flows and the binaries, in the form
+  //   sum_k flow_coeff_k f_k + sum_k x_coeff_k x_k <= rhs
+  // Two inequalities are compared:
+  // the lifted flow cover inequality
+  //   sum_{C+} (f_k + (U_k - lambda)^+ (1 - x_k)) + sum_{N+ \ C+} (f_k - (U_k - F(U_k)) x_k)
+  //     <= b + sum_{N-} f_k
+  // and the simple generalized flow cover inequality
+  //   sum_{C+} (f_k + (U_k - lambda)^+ (1 - x_k)) <= b + lambda sum_{L-} x_k + sum_{N- \ L-} f_k
+  // where L- are the outflows with lambda x_k < f_k. The terms of N+ \ C+ are only added when they
+  // increase the violation. The lifting is not valid with L-, as an outflow may then open more
+  // capacity than it pays for.
+  f_t cover_lhs = 0.0;
+  f_t cover_rhs = b;
+  for (i_t k = 0; k < cover_size; k++) {
+    const flow_t& flow = inflows[k];
+    const f_t excess   = std::max<f_t>(0.0, flow.capacity - lambda);
+    cover_lhs += flow.flow + excess * (1.0 - flow.x_value);
+  }
+  f_t lifted_lhs = cover_lhs;
+  std::vector<std::pair<i_t, f_t>> lifted_flows;
+  for (i_t k = cover_size; k < static_cast<i_t>(inflows.size()); k++) {
+    const flow_t& flow = inflows[k];
+    const f_t alpha    = flow.capacity - lifting(flow.capacity);
+    const f_t term     = flow.flow - alpha * flow.x_value;
+    if (term > tol) {
+      lifted_flows.push_back({k, alpha});
+      lifted_lhs += term;
+    }
+  }
+  f_t outflow        = 0.0;
+  f_t simple_outflow = 0.0;
+  for (const flow_t& flow : outflows) {
+    outflow += flow.flow;
+    simple_outflow += std::min(flow.flow, lambda * flow.x_value);
+  }
+  const f_t lifted_violation = lifted_lhs - cover_rhs - outflow;
+  const f_t simple_violation = cover_lhs - cover_rhs - simple_outflow;
+  const bool use_lifting     = lifted_violation >= simple_violation;
+  if (std::max(lifted_violation, simple_violation) <= tol) { return -1; }
+
+  // Write the cut on the original variables
+  std::vector<i_t> indices;
+  f_t rhs  = b;
+  auto add = [&](i_t j, f_t coeff) {
+    if (!workspace_mark_[j]) {
+      workspace_mark_[j] = 1;
+      indices.push_back(j);
+    }
+    workspace_[j] += coeff;
+  };
+  auto add_flow = [&](const flow_t& flow, f_t coeff) {
+    add(flow.y >= 0 ? flow.y : flow.x, coeff * flow.a);
+  };
+  auto add_binary = [&](const flow_t& flow, f_t coeff) {
+    if (flow.x >= 0) {
+      add(flow.x, coeff);
+    } else {
+      rhs -= coeff;
+    }
+  };
+  for (i_t k = 0; k < cover_size; k++) {
+    const flow_t& flow = inflows[k];
+    const f_t excess   = std::max<f_t>(0.0, flow.capacity - lambda);
+    add_flow(flow, 1.0);
+    add_binary(flow, -excess);
+    rhs -= excess;
+  }
+  if (use_lifting) {
+    for (const auto& [k, alpha] : lifted_flows) {
+      add_flow(inflows[k], 1.0);
+      add_binary(inflows[k], -alpha);
+    }
+    for (const flow_t& flow : outflows) {
+      add_flow(flow, -1.0);
+    }
+  } else {
+    for (const flow_t& flow : outflows) {
+      if (lambda * flow.x_value < flow.flow) {
+        add_binary(flow, -lambda);
+      } else {
+        add_flow(flow, -1.0);
+      }
+    }
+  }
+
+  // Return the cut in the form cut'*x >= cut_rhs
+  cut.i.clear();
+  cut.x.clear();
+  std::sort(indices.begin(), indices.end());
+  for (i_t j : indices) {
+    if (workspace_[j] != 0.0) {
+      cut.i.push_back(j);
+      cut.x.push_back(-workspace_[j]);
+    }
+    workspace_[j]      = 0.0;
+    workspace_mark_[j] = 0;
+  }
+  cut_rhs = -rhs;
+  if (cut.i.empty()) { return -1; }
+
+  const f_t violation = cut.dot(xstar) - cut_rhs;
+  if (violation >= -tol) { return -1; }
+
+#ifdef PRINT_FLOW_COVER_CUT
+  settings.log.printf(
+    "flow cover cut row %d sign %d cover %d lambda %e violation %e lifted %d\n",
+    flow_row,
+    sign,
+    cover_size,
+    lambda,
+    violation,
+    use_lifting);
+#endif
+  return 0;
+}
+
 template <typename i_t, typename f_t>
 void cut_generation_t<i_t, f_t>::generate_cuts(const lp_problem_t<i_t, f_t>& lp,
                                                const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -584,6 +994,16 @@ void cut_generation_t<i_t, f_t>::generate_cuts(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
+  // Generate flow cover cuts
+  if (settings.flow_cover_cuts != 0) {
+    f_t cut_start_time = tic();
+    generate_flow_cover_cuts(lp, settings, Arow, var_types, xstar);
+    f_t cut_generation_time = toc(cut_start_time);
+    if (cut_generation_time > 1.0) {
+      settings.log.debug("Flow cover cut generation time %.2f seconds\n", cut_generation_time);
+    }
+  }
+
   // Generate MIR and CG cuts
   if (settings.mir_cuts != 0 || settings.strong_chvatal_gomory_cuts != 0) {
     f_t cut_start_time = tic();
@@ -615,6 +1035,25 @@ void cut_generation_t<i_t, f_t>::generate_knapsack_cuts(
   }
 }
 
+template <typename i_t, typename f_t>
+void cut_generation_t<i_t, f_t>::generate_flow_cover_cuts(
+  const lp_problem_t<i_t, f_t>& lp,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<variable_type_t>& var_types,
+  const std::vector<f_t>& xstar)
+{
+  for (i_t flow_row : flow_cover_generation_.get_flow_rows()) {
+    for (i_t sign : {1, -1}) {
+      sparse_vector_t<i_t, f_t> cut(lp.num_cols, 0);
+      f_t cut_rhs;
+      i_t flow_cover_status = flow_cover_generation_.generate_flow_cover_cut(
+        lp, settings, Arow, var_types, xstar, flow_row, sign, cut, cut_rhs);
+      if (flow_cover_status == 0) { cut_pool_.add_cut(cut_type_t::FLOW_COVER, cut, cut_rhs); }
+    }
+  }
+}
+
 template <typename i_t, typename f_t>
 void cut_generation_t<i_t, f_t>::generate_mir_cuts(
   const lp_problem_t<i_t, f_t>& lp,
@@ -2783,6 +3222,7 @@ void verify_cuts_against_saved_solution(const csr_matrix_t<i_t, f_t>& cuts,
 template class cut_pool_t<int, double>;
 template class cut_generation_t<int, double>;
 template class knapsack_generation_t<int, double>;
+template class flow_cover_generation_t<int, double>;
 template class tableau_equality_t<int, double>;
 template class mixed_integer_rounding_cut_t<int, double>;
 
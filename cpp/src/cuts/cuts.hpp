@@ -29,7 +29,8 @@ enum cut_type_t : int8_t {
   MIXED_INTEGER_ROUNDING = 1,
   KNAPSACK               = 2,
   CHVATAL_GOMORY         = 3,
-  MAX_CUT_TYPE           = 4
+  FLOW_COVER             = 4,
+  MAX_CUT_TYPE           = 5
 };
 
 template <typename i_t, typename f_t>
@@ -48,7 +49,8 @@ struct cut_info_t {
       num_cuts[static_cast<int>(cut_type)]++;
     }
   }
-  const char* cut_type_names[MAX_CUT_TYPE] = {"Gomory   ", "MIR      ", "Knapsack ", "Strong CG"};
+  const char* cut_type_names[MAX_CUT_TYPE] = {
+    "Gomory   ", "MIR      ", "Knapsack ", "Strong CG", "Flow cov "};
   std::array<i_t, MAX_CUT_TYPE> num_cuts   = {0};
 };
 
@@ -145,16 +147,35 @@ class cut_pool_t {
                     std::vector<f_t>& best_rhs,
                     std::vector<cut_type_t>& best_cut_types);
 
+  // Returns up to max_cuts cuts violated by x, in the same form as get_best_cuts. Unlike
+  // score_cuts, the pool is not modified, so the B&B workers may call it concurrently while no cut
+  // is added to the pool.
+  i_t get_violated_cuts(const std::vector<f_t>& x,
+                        i_t max_cuts,
+                        csr_matrix_t<i_t, f_t>& violated_cuts,
+                        std::vector<f_t>& violated_rhs,
+                        std::vector<cut_type_t>& violated_cut_types) const;
+
   void age_cuts();
 
   void drop_cuts();
 
   i_t pool_size() const { return cut_storage_.m; }
 
+  // Copies every cut of the pool, in the same form as add_cut
+  void get_cuts(csr_matrix_t<i_t, f_t>& cuts,
+                std::vector<f_t>& rhs,
+                std::vector<cut_type_t>& cut_types) const
+  {
+    cuts      = cut_storage_;
+    rhs       = rhs_storage_;
+    cut_types = cut_type_;
+  }
+
   void print_cutpool_types() { print_cut_types("In cut pool", cut_type_, settings_); }
 
  private:
-  f_t cut_distance(i_t row, const std::vector<f_t>& x, f_t& cut_violation, f_t& cut_norm);
+  f_t cut_distance(i_t row, const std::vector<f_t>& x, f_t& cut_violation, f_t& cut_norm) const;
   f_t cut_density(i_t row);
   f_t cut_orthogonality(i_t i, i_t j);
 
@@ -214,6 +235,72 @@ class knapsack_generation_t {
   const simplex_solver_settings_t<i_t, f_t>& settings_;
 };
 
+// Flow cover cuts on single-node flow structures. A flow row, read as a <= inequality after moving
+// its slack to one of its bounds, is
+//   sum_{j in N+} f_j - sum_{j in N-} f_j <= b,  0 <= f_j <= U_j x_j,  x_j in {0, 1}
+// where a flow f_j is either a binary variable times its coefficient, or a nonnegative continuous
+// variable times its coefficient. The binary x_j of a continuous variable comes from a variable
+// upper bound row y_j <= u_j x_j of the LP, or is the constant 1 when y_j only has a finite upper
+// bound.
+template <typename i_t, typename f_t>
+class flow_cover_generation_t {
+ public:
+  flow_cover_generation_t(const lp_problem_t<i_t, f_t>& lp,
+                          const simplex_solver_settings_t<i_t, f_t>& settings,
+                          csr_matrix_t<i_t, f_t>& Arow,
+                          const std::vector<i_t>& new_slacks,
+                          const std::vector<variable_type_t>& var_types);
+
+  // Generates a lifted flow cover cut from the flow row `flow_row`. When `sign` is -1, the row is
+  // read as a >= inequality and negated. Returns 0 if the cut is violated by xstar.
+  i_t generate_flow_cover_cut(const lp_problem_t<i_t, f_t>& lp,
+                              const simplex_solver_settings_t<i_t, f_t>& settings,
+                              csr_matrix_t<i_t, f_t>& Arow,
+                              const std::vector<variable_type_t>& var_types,
+                              const std::vector<f_t>& xstar,
+                              i_t flow_row,
+                              i_t sign,
+                              sparse_vector_t<i_t, f_t>& cut,
+                              f_t& cut_rhs);
+
+  i_t num_flow_rows() const { return flow_rows_.size(); }
+  const std::vector<i_t>& get_flow_rows() const { return flow_rows_; }
+
+ private:
+  struct flow_t {
+    i_t y;         // Continuous variable of the flow, or -1 if the flow is a binary variable
+    i_t x;         // Binary variable of the flow, or -1 if it is the constant 1
+    f_t a;         // Absolute value of the coefficient in the row
+    f_t capacity;  // U_j
+    f_t flow;      // Value of f_j in the relaxation
+    f_t x_value;   // Value of x_j in the relaxation
+  };
+
+  // Reads the row `i` as sum_j a_j v_j <= b, with the sign of the row given by `sign`. Returns
+  // false if the slack of the row has no finite bound in this direction.
+  bool row_upper_bound(const lp_problem_t<i_t, f_t>& lp,
+                       csr_matrix_t<i_t, f_t>& Arow,
+                       i_t i,
+                       i_t sign,
+                       f_t& b) const;
+
+  bool is_binary(const lp_problem_t<i_t, f_t>& lp,
+                 const std::vector<variable_type_t>& var_types,
+                 i_t j) const
+  {
+    return var_types[j] != variable_type_t::CONTINUOUS && lp.lower[j] >= 0.0 &&
+           lp.upper[j] <= 1.0;
+  }
+
+  std::vector<i_t> is_slack_;
+  std::vector<i_t> vub_var_;    // x_j of the variable upper bound y_j <= u_j x_j, or -1
+  std::vector<f_t> vub_coeff_;  // u_j
+  std::vector<i_t> flow_rows_;
+  std::vector<f_t> workspace_;
+  std::vector<i_t> workspace_mark_;
+  const simplex_solver_settings_t<i_t, f_t>& settings_;
+};
+
 // Forward declaration
 template <typename i_t, typename f_t>
 class mixed_integer_rounding_cut_t;
@@ -227,7 +314,9 @@ class cut_generation_t {
                    csr_matrix_t<i_t, f_t>& Arow,
                    const std::vector<i_t>& new_slacks,
                    const std::vector<variable_type_t>& var_types)
-    : cut_pool_(cut_pool), knapsack_generation_(lp, settings, Arow, new_slacks, var_types)
+    : cut_pool_(cut_pool),
+      knapsack_generation_(lp, settings, Arow, new_slacks, var_types),
+      flow_cover_generation_(lp, settings, Arow, new_slacks, var_types)
   {
   }
 
@@ -269,8 +358,16 @@ class cut_generation_t {
                               const std::vector<variable_type_t>& var_types,
                               const std::vector<f_t>& xstar);
 
+  // Generate all flow cover cuts
+  void generate_flow_cover_cuts(const lp_problem_t<i_t, f_t>& lp,
+                                const simplex_solver_settings_t<i_t, f_t>& settings,
+                                csr_matrix_t<i_t, f_t>& Arow,
+                                const std::vector<variable_type_t>& var_types,
+                                const std::vector<f_t>& xstar);
+
   cut_pool_t<i_t, f_t>& cut_pool_;
   knapsack_generation_t<i_t, f_t> knapsack_generation_;
+  flow_cover_generation_t<i_t, f_t> flow_cover_generation_;
 };
 
 template <typename i_t, typename f_t>
@@ -1332,6 +1332,7 @@ i_t basis_update_mpf_t<i_t, f_t>::append_cuts(const csr_matrix_t<i_t, f_t>& cuts
   U0_.m                           = m + cuts_basic.m;
 
   compute_transposes();
+  reset_stats();
 
   // Adjust row_permutation_ and inverse_row_permutation_
   row_permutation_.resize(m + cuts_basic.m);
@@ -1348,6 +1349,9 @@ i_t basis_update_mpf_t<i_t, f_t>::append_cuts(const csr_matrix_t<i_t, f_t>& cuts
   x_workspace_.resize(m + cuts_basic.m, 0.0);
   work_estimate_ += 3 * (m + cuts_basic.m);
 
+  // The updates were rewritten for the new rows
+  history_id_ = new_history_id();
+
   return 0;
 }
 
@@ -1608,12 +1612,12 @@ i_t basis_update_mpf_t<i_t, f_t>::b_transpose_solve(const sparse_vector_t<i_t, f
 {
   // Solve for r such that U'*r = c
 
-  bool use_hypersparse = false;
-  const f_t input_size = static_cast<f_t>(rhs.i.size());
-  estimate_solution_density(input_size, sum_U_transpose_, num_calls_U_transpose_, use_hypersparse);
-  if (use_hypersparse) {
+  const f_t input_size           = static_cast<f_t>(rhs.i.size());
+  triangle_solve_method_t method = U_transpose_model_.choose(input_size, hypersparse_threshold_);
+  f_t work_start                 = work_estimate_;
+  if (method != triangle_solve_method_t::DENSE) {
     solution = rhs;
-    u_transpose_solve(solution);
+    u_transpose_solve(solution, method);
   } else {
     std::vector<f_t> solution_dense;
     rhs.to_dense(solution_dense);
@@ -1621,7 +1625,8 @@ i_t basis_update_mpf_t<i_t, f_t>::b_transpose_solve(const sparse_vector_t<i_t, f
     solution.from_dense(solution_dense);
   }
   UTsol = solution;
-  sum_U_transpose_ += static_cast<f_t>(solution.i.size()) / input_size;
+  U_transpose_model_.record(
+    method, input_size, static_cast<f_t>(solution.i.size()), work_estimate_ - work_start);
 
 #ifdef CHECK_U_TRANSPOSE_SOLVE
   std::vector<f_t> UTsol_dense;
@@ -1641,16 +1646,18 @@ i_t basis_update_mpf_t<i_t, f_t>::b_transpose_solve(const sparse_vector_t<i_t, f
   solution.to_dense(r_dense);
 #endif
   const f_t rhs_size = static_cast<f_t>(solution.i.size());
-  estimate_solution_density(rhs_size, sum_L_transpose_, num_calls_L_transpose_, use_hypersparse);
-  if (use_hypersparse) {
-    l_transpose_solve(solution);
+  method             = L_transpose_model_.choose(rhs_size, hypersparse_threshold_);
+  work_start         = work_estimate_;
+  if (method != triangle_solve_method_t::DENSE) {
+    l_transpose_solve(solution, method);
   } else {
     std::vector<f_t> solution_dense;
     solution.to_dense(solution_dense);
     l_transpose_solve(solution_dense);
     solution.from_dense(solution_dense);
   }
-  sum_L_transpose_ += static_cast<f_t>(solution.i.size()) / rhs_size;
+  L_transpose_model_.record(
+    method, rhs_size, static_cast<f_t>(solution.i.size()), work_estimate_ - work_start);
 
 #ifdef CHECK_L_TRANSPOSE_SOLVE
   std::vector<f_t> solution_dense;
@@ -1660,14 +1667,14 @@ i_t basis_update_mpf_t<i_t, f_t>::b_transpose_solve(const sparse_vector_t<i_t, f
   for (i_t k = 0; k < L0_.m; ++k) {
     if (std::abs(solution_dense[k] - r_dense[k]) > 1e-4) {
       printf(
-        "B transpose solve L transpose solve error %e: index %d multiply %e rhs %e. update %d. use "
-        "hypersparse %d\n",
+        "B transpose solve L transpose solve error %e: index %d multiply %e rhs %e. update %d. "
+        "method %d\n",
         std::abs(solution_dense[k] - r_dense[k]),
         k,
         solution_dense[k],
         r_dense[k],
         num_updates_,
-        use_hypersparse);
+        static_cast<int>(method));
     }
 
     max_error = std::max(max_error, std::abs(solution_dense[k] - r_dense[k]));
@@ -1688,13 +1695,25 @@ i_t basis_update_mpf_t<i_t, f_t>::u_transpose_solve(std::vector<f_t>& rhs) const
 }
 
 template <typename i_t, typename f_t>
-i_t basis_update_mpf_t<i_t, f_t>::u_transpose_solve(sparse_vector_t<i_t, f_t>& rhs) const
+i_t basis_update_mpf_t<i_t, f_t>::u_transpose_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                                    triangle_solve_method_t method) const
 {
-  total_sparse_U_transpose_++;
   // U0'*x = y
   // Solve U0'*x0 = y
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
-    rhs, std::nullopt, xi_workspace_, U0_transpose_, x_workspace_.data(), work_estimate_);
+  i_t top;
+  if (method == triangle_solve_method_t::BITSET_REACH) {
+    total_bitset_U_transpose_++;
+    top = dual_simplex::bitset_triangle_solve<i_t, f_t, true>(rhs,
+                                                              U0_transpose_symbolic_,
+                                                              xi_workspace_,
+                                                              U0_transpose_,
+                                                              x_workspace_.data(),
+                                                              work_estimate_);
+  } else {
+    total_sparse_U_transpose_++;
+    top = dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
+      rhs, std::nullopt, xi_workspace_, U0_transpose_, x_workspace_.data(), work_estimate_);
+  }
   solve_to_sparse_vector(top, rhs);
   return 0;
 }
@@ -1733,9 +1752,9 @@ i_t basis_update_mpf_t<i_t, f_t>::l_transpose_solve(std::vector<f_t>& rhs) const
 }
 
 template <typename i_t, typename f_t>
-i_t basis_update_mpf_t<i_t, f_t>::l_transpose_solve(sparse_vector_t<i_t, f_t>& rhs) const
+i_t basis_update_mpf_t<i_t, f_t>::l_transpose_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                                    triangle_solve_method_t method) const
 {
-  total_sparse_L_transpose_++;
   const i_t m = L0_.m;
   // L'*x = b
   // L0^T * x = T_0^-T * T_1^-T * ... * T_{num_updates_ - 1}^-T * b = b'
@@ -1800,8 +1819,16 @@ i_t basis_update_mpf_t<i_t, f_t>::l_transpose_solve(sparse_vector_t<i_t, f_t>& r
   sparse_vector_t<i_t, f_t> b(m, nz);
   work_estimate_ += nz;
   gather_into_sparse_vector(nz, b);
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
-    b, std::nullopt, xi_workspace_, L0_transpose_, x_workspace_.data(), work_estimate_);
+  i_t top;
+  if (method == triangle_solve_method_t::BITSET_REACH) {
+    total_bitset_L_transpose_++;
+    top = dual_simplex::bitset_triangle_solve<i_t, f_t, false>(
+      b, L0_transpose_symbolic_, xi_workspace_, L0_transpose_, x_workspace_.data(), work_estimate_);
+  } else {
+    total_sparse_L_transpose_++;
+    top = dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
+      b, std::nullopt, xi_workspace_, L0_transpose_, x_workspace_.data(), work_estimate_);
+  }
   solve_to_sparse_vector(top, rhs);
 
 #ifdef CHECK_SPARSE_SOLVE
@@ -1921,11 +1948,11 @@ i_t basis_update_mpf_t<i_t, f_t>::b_solve(const sparse_vector_t<i_t, f_t>& rhs,
   solution.to_dense(l_solve_rhs);
 #endif
 
-  bool use_hypersparse;
-  const f_t input_size = static_cast<f_t>(rhs.i.size());
-  estimate_solution_density(input_size, sum_L_, num_calls_L_, use_hypersparse);
-  if (use_hypersparse) {
-    l_solve(solution);
+  const f_t input_size           = static_cast<f_t>(rhs.i.size());
+  triangle_solve_method_t method = L_model_.choose(input_size, hypersparse_threshold_);
+  f_t work_start                 = work_estimate_;
+  if (method != triangle_solve_method_t::DENSE) {
+    l_solve(solution, method);
   } else {
     std::vector<f_t> solution_dense;
     solution.to_dense(solution_dense);
@@ -1934,11 +1961,12 @@ i_t basis_update_mpf_t<i_t, f_t>::b_solve(const sparse_vector_t<i_t, f_t>& rhs,
     solution.from_dense(solution_dense);
     work_estimate_ += solution_dense.size();
   }
+  L_model_.record(
+    method, input_size, static_cast<f_t>(solution.i.size()), work_estimate_ - work_start);
   if (need_Lsol) {
     Lsol = solution;
     work_estimate_ += 2 * solution.i.size();
   }
-  sum_L_ += static_cast<f_t>(solution.i.size()) / input_size;
 
 #ifdef CHECK_L_SOLVE
   std::vector<f_t> l_solve_dense;
@@ -1959,9 +1987,10 @@ i_t basis_update_mpf_t<i_t, f_t>::b_solve(const sparse_vector_t<i_t, f_t>& rhs,
 #endif
 
   const f_t rhs_size = static_cast<f_t>(solution.i.size());
-  estimate_solution_density(rhs_size, sum_U_, num_calls_U_, use_hypersparse);
-  if (use_hypersparse) {
-    u_solve(solution);
+  method             = U_model_.choose(rhs_size, hypersparse_threshold_);
+  work_start         = work_estimate_;
+  if (method != triangle_solve_method_t::DENSE) {
+    u_solve(solution, method);
   } else {
     std::vector<f_t> solution_dense;
     solution.to_dense(solution_dense);
@@ -1970,7 +1999,8 @@ i_t basis_update_mpf_t<i_t, f_t>::b_solve(const sparse_vector_t<i_t, f_t>& rhs,
     solution.from_dense(solution_dense);
     work_estimate_ += solution_dense.size();
   }
-  sum_U_ += static_cast<f_t>(solution.i.size()) / rhs_size;
+  U_model_.record(
+    method, rhs_size, static_cast<f_t>(solution.i.size()), work_estimate_ - work_start);
 
 #ifdef CHECK_U_SOLVE
   std::vector<f_t> solution_dense;
@@ -1996,15 +2026,22 @@ i_t basis_update_mpf_t<i_t, f_t>::u_solve(std::vector<f_t>& rhs) const
 }
 
 template <typename i_t, typename f_t>
-i_t basis_update_mpf_t<i_t, f_t>::u_solve(sparse_vector_t<i_t, f_t>& rhs) const
+i_t basis_update_mpf_t<i_t, f_t>::u_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                          triangle_solve_method_t method) const
 {
-  total_sparse_U_++;
-  const i_t m = L0_.m;
   // U*x = y
 
   // Solve U0*x = y
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
-    rhs, std::nullopt, xi_workspace_, U0_, x_workspace_.data(), work_estimate_);
+  i_t top;
+  if (method == triangle_solve_method_t::BITSET_REACH) {
+    total_bitset_U_++;
+    top = dual_simplex::bitset_triangle_solve<i_t, f_t, false>(
+      rhs, U0_symbolic_, xi_workspace_, U0_, x_workspace_.data(), work_estimate_);
+  } else {
+    total_sparse_U_++;
+    top = dual_simplex::sparse_triangle_solve<i_t, f_t, false>(
+      rhs, std::nullopt, xi_workspace_, U0_, x_workspace_.data(), work_estimate_);
+  }
   solve_to_sparse_vector(top, rhs);
 
   return 0;
@@ -2066,16 +2103,24 @@ i_t basis_update_mpf_t<i_t, f_t>::l_solve(std::vector<f_t>& rhs) const
 }
 
 template <typename i_t, typename f_t>
-i_t basis_update_mpf_t<i_t, f_t>::l_solve(sparse_vector_t<i_t, f_t>& rhs) const
+i_t basis_update_mpf_t<i_t, f_t>::l_solve(sparse_vector_t<i_t, f_t>& rhs,
+                                          triangle_solve_method_t method) const
 {
-  total_sparse_L_++;
   const i_t m = L0_.m;
   // L*x = y
   // L0 * T0 * T1 * ... * T_{num_updates_ - 1} * x = y
 
   // First solve L0*x0 = y
-  i_t top = dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
-    rhs, std::nullopt, xi_workspace_, L0_, x_workspace_.data(), work_estimate_);
+  i_t top;
+  if (method == triangle_solve_method_t::BITSET_REACH) {
+    total_bitset_L_++;
+    top = dual_simplex::bitset_triangle_solve<i_t, f_t, true>(
+      rhs, L0_symbolic_, xi_workspace_, L0_, x_workspace_.data(), work_estimate_);
+  } else {
+    total_sparse_L_++;
+    top = dual_simplex::sparse_triangle_solve<i_t, f_t, true>(
+      rhs, std::nullopt, xi_workspace_, L0_, x_workspace_.data(), work_estimate_);
+  }
   solve_to_workspace(top);  // Uses xi_workspace_ and x_workspace_ to fill rhs
   i_t nz = m - top;
   // Then T0 * T1 * ... * T_{num_updates_ - 1} * x = x0
@@ -2369,7 +2414,7 @@ int basis_update_mpf_t<i_t, f_t>::refactor_basis(
                                q,
                                deficient,
                                slacks_needed,
-                               work_estimate_);
+                               factorization_work_estimate_);
   if (status == CONCURRENT_HALT_RETURN) { return CONCURRENT_HALT_RETURN; }
   if (status == TIME_LIMIT_RETURN) { return TIME_LIMIT_RETURN; }
   if (status == -1) {
@@ -2384,7 +2429,7 @@ int basis_update_mpf_t<i_t, f_t>::refactor_basis(
                  nonbasic_list,
                  superbasic_list,
                  vstatus,
-                 work_estimate_);
+                 factorization_work_estimate_);
 
 #ifdef CHECK_BASIS_REPAIR
     const i_t m = A.m;
@@ -2414,7 +2459,7 @@ int basis_update_mpf_t<i_t, f_t>::refactor_basis(
                              q,
                              deficient,
                              slacks_needed,
-                             work_estimate_);
+                             factorization_work_estimate_);
     if (status == CONCURRENT_HALT_RETURN) { return CONCURRENT_HALT_RETURN; }
     if (status == TIME_LIMIT_RETURN) { return TIME_LIMIT_RETURN; }
     if (status == -1) {
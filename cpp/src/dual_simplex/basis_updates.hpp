@@ -11,8 +11,12 @@
 #include <dual_simplex/simplex_solver_settings.hpp>
 #include <dual_simplex/sparse_matrix.hpp>
 #include <dual_simplex/sparse_vector.hpp>
+#include <dual_simplex/triangle_solve.hpp>
 #include <dual_simplex/types.hpp>
 
+#include <atomic>
+#include <cassert>
+#include <cstdint>
 #include <numeric>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -187,6 +191,10 @@ class basis_update_mpf_t {
       total_dense_U_transpose_(0),
       total_sparse_U_(0),
       total_dense_U_(0),
+      total_bitset_L_transpose_(0),
+      total_bitset_L_(0),
+      total_bitset_U_transpose_(0),
+      total_bitset_U_(0),
       hypersparse_threshold_(0.05)
   {
     clear();
@@ -215,6 +223,10 @@ class basis_update_mpf_t {
       total_dense_U_transpose_(0),
       total_sparse_U_(0),
       total_dense_U_(0),
+      total_bitset_L_transpose_(0),
+      total_bitset_L_(0),
+      total_bitset_U_transpose_(0),
+      total_bitset_U_(0),
       hypersparse_threshold_(0.05)
   {
     inverse_permutation(row_permutation_, inverse_row_permutation_);
@@ -228,32 +240,36 @@ class basis_update_mpf_t {
 
   void print_stats() const
   {
-    i_t total_L_transpose_calls = total_sparse_L_transpose_ + total_dense_L_transpose_;
-    i_t total_U_transpose_calls = total_sparse_U_transpose_ + total_dense_U_transpose_;
-    i_t total_L_calls           = total_sparse_L_ + total_dense_L_;
-    i_t total_U_calls           = total_sparse_U_ + total_dense_U_;
+    i_t total_L_transpose_calls =
+      total_sparse_L_transpose_ + total_bitset_L_transpose_ + total_dense_L_transpose_;
+    i_t total_U_transpose_calls =
+      total_sparse_U_transpose_ + total_bitset_U_transpose_ + total_dense_U_transpose_;
+    i_t total_L_calls = total_sparse_L_ + total_bitset_L_ + total_dense_L_;
+    i_t total_U_calls = total_sparse_U_ + total_bitset_U_ + total_dense_U_;
     // clang-format off
     printf("sparse L transpose  %8d %8.2f%%\n", total_sparse_L_transpose_, 100.0 * total_sparse_L_transpose_ / total_L_transpose_calls);
+    printf("bitset L transpose  %8d %8.2f%%\n", total_bitset_L_transpose_, 100.0 * total_bitset_L_transpose_ / total_L_transpose_calls);
     printf("dense  L transpose  %8d %8.2f%%\n", total_dense_L_transpose_, 100.0 * total_dense_L_transpose_ / total_L_transpose_calls);
     printf("sparse U transpose  %8d %8.2f%%\n", total_sparse_U_transpose_, 100.0 * total_sparse_U_transpose_ / total_U_transpose_calls);
+    printf("bitset U transpose  %8d %8.2f%%\n", total_bitset_U_transpose_, 100.0 * total_bitset_U_transpose_ / total_U_transpose_calls);
     printf("dense  U transpose  %8d %8.2f%%\n", total_dense_U_transpose_, 100.0 * total_dense_U_transpose_ / total_U_transpose_calls);
     printf("sparse L            %8d %8.2f%%\n", total_sparse_L_, 100.0 * total_sparse_L_ / total_L_calls);
+    printf("bitset L            %8d %8.2f%%\n", total_bitset_L_, 100.0 * total_bitset_L_ / total_L_calls);
     printf("dense  L            %8d %8.2f%%\n", total_dense_L_, 100.0 * total_dense_L_ / total_L_calls);
     printf("sparse U            %8d %8.2f%%\n", total_sparse_U_, 100.0 * total_sparse_U_ / total_U_calls);
+    printf("bitset U            %8d %8.2f%%\n", total_bitset_U_, 100.0 * total_bitset_U_ / total_U_calls);
     printf("dense  U            %8d %8.2f%%\n", total_dense_U_, 100.0 * total_dense_U_ / total_U_calls);
     // clang-format on
   }
 
+  // Reset the solve cost models. Called after every factorization, as the
+  // growth of the solutions depends on the factors.
   void reset_stats()
   {
-    num_calls_L_           = 0;
-    num_calls_U_           = 0;
-    num_calls_L_transpose_ = 0;
-    num_calls_U_transpose_ = 0;
-    sum_L_                 = 0.0;
-    sum_U_                 = 0.0;
-    sum_L_transpose_       = 0.0;
-    sum_U_transpose_       = 0.0;
+    L_model_.reset(L0_symbolic_);
+    U_model_.reset(U0_symbolic_);
+    L_transpose_model_.reset(L0_transpose_symbolic_);
+    U_transpose_model_.reset(U0_transpose_symbolic_);
   }
 
   i_t reset(const csc_matrix_t<i_t, f_t>& Linit,
@@ -297,16 +313,6 @@ class basis_update_mpf_t {
 
   i_t append_cuts(const csr_matrix_t<i_t, f_t>& cuts_basic);
 
-  f_t estimate_solution_density(f_t rhs_nz, f_t sum, i_t& num_calls, bool& use_hypersparse) const
-  {
-    num_calls++;
-    const f_t average_growth    = std::max(1.0, sum / static_cast<f_t>(num_calls));
-    const f_t predicted_nz      = rhs_nz * average_growth;
-    const f_t predicted_density = predicted_nz / static_cast<f_t>(L0_.m);
-    use_hypersparse             = predicted_density < hypersparse_threshold_;
-    return predicted_nz;
-  }
-
   // Solves for x such that B*x = b, where B is the basis matrix
   i_t b_solve(const std::vector<f_t>& rhs, std::vector<f_t>& solution) const;
   i_t b_solve(const sparse_vector_t<i_t, f_t>& rhs, sparse_vector_t<i_t, f_t>& solution) const;
@@ -333,25 +339,29 @@ class basis_update_mpf_t {
   i_t l_solve(std::vector<f_t>& rhs) const;
 
   // Solve for x such that L*x = y
-  i_t l_solve(sparse_vector_t<i_t, f_t>& rhs) const;
+  i_t l_solve(sparse_vector_t<i_t, f_t>& rhs,
+              triangle_solve_method_t method = triangle_solve_method_t::DFS_REACH) const;
 
   // Solve for x such that L'*x = y
   i_t l_transpose_solve(std::vector<f_t>& rhs) const;
 
   // Solve for x such that L'*x = y
-  i_t l_transpose_solve(sparse_vector_t<i_t, f_t>& rhs) const;
+  i_t l_transpose_solve(sparse_vector_t<i_t, f_t>& rhs,
+                        triangle_solve_method_t method = triangle_solve_method_t::DFS_REACH) const;
 
   // Solve for x such that U*x = y
   i_t u_solve(std::vector<f_t>& rhs) const;
 
   // Solve for x such that U*x = y
-  i_t u_solve(sparse_vector_t<i_t, f_t>& rhs) const;
+  i_t u_solve(sparse_vector_t<i_t, f_t>& rhs,
+              triangle_solve_method_t method = triangle_solve_method_t::DFS_REACH) const;
 
   // Solve for x such that U'*x = y
   i_t u_transpose_solve(std::vector<f_t>& rhs) const;
 
   // Solve for x such that U'*x = y
-  i_t u_transpose_solve(sparse_vector_t<i_t, f_t>& rhs) const;
+  i_t u_transpose_solve(sparse_vector_t<i_t, f_t>& rhs,
+                        triangle_solve_method_t method = triangle_solve_method_t::DFS_REACH) const;
 
   // Replace the column B(:, leaving_index) with the vector abar. Pass in utilde such that L*utilde
   // = abar
@@ -365,6 +375,21 @@ class basis_update_mpf_t {
 
   i_t num_updates() const { return num_updates_; }
 
+  // Identifies the factors L0 and U0 the updates apply to. It changes every time they are
+  // recomputed or cuts are appended, so (history_id(), num_updates()) identifies a basis that
+  // `rollback` can return to while the history is unchanged.
+  uint64_t history_id() const { return history_id_; }
+
+  // Discards the updates after the first `num_updates` ones. The updates only append to S and mu,
+  // so this returns to the factorization of the basis before those updates.
+  void rollback(i_t num_updates)
+  {
+    assert(num_updates >= 0 && num_updates <= num_updates_);
+    num_updates_ = num_updates;
+    S_.n         = 2 * num_updates;
+    mu_values_.resize(num_updates);
+  }
+
   const std::vector<i_t>& row_permutation() const { return row_permutation_; }
   const std::vector<i_t>& inverse_row_permutation() const { return inverse_row_permutation_; }
 
@@ -373,6 +398,7 @@ class basis_update_mpf_t {
     L0_.transpose(L0_transpose_);
     U0_.transpose(U0_transpose_);
     work_estimate_ += 6 * L0_.col_start[L0_.n] + 6 * U0_.col_start[U0_.n];
+    analyze_factors();
   }
 
   void multiply_lu(csc_matrix_t<i_t, f_t>& out) const;
@@ -389,8 +415,14 @@ class basis_update_mpf_t {
 
   void set_refactor_frequency(i_t new_frequency) { refactor_frequency_ = new_frequency; }
 
-  f_t work_estimate() const { return work_estimate_; }
-  void clear_work_estimate() { work_estimate_ = 0.0; }
+  // Work of the solves and updates plus the work of the factorizations
+  f_t work_estimate() const { return work_estimate_ + factorization_work_estimate_; }
+  f_t factorization_work_estimate() const { return factorization_work_estimate_; }
+  void clear_work_estimate()
+  {
+    work_estimate_               = 0.0;
+    factorization_work_estimate_ = 0.0;
+  }
 
  private:
   void clear()
@@ -406,6 +438,7 @@ class basis_update_mpf_t {
     mu_values_.clear();
     mu_values_.reserve(refactor_frequency_);
     num_updates_ = 0;
+    history_id_  = new_history_id();
     work_estimate_ += 2 * refactor_frequency_;
 
     std::fill(xi_workspace_.begin(), xi_workspace_.end(), 0);
@@ -413,6 +446,23 @@ class basis_update_mpf_t {
     work_estimate_ += xi_workspace_.size() + x_workspace_.size();
   }
 
+  // Compute the symbolic information used by the sparse solves. The factors
+  // L0 and U0 are fixed until the next factorization, so this is done once
+  // per factorization.
+  void analyze_factors()
+  {
+    L0_symbolic_.analyze(L0_, true, work_estimate_);
+    U0_symbolic_.analyze(U0_, false, work_estimate_);
+    L0_transpose_symbolic_.analyze(L0_transpose_, false, work_estimate_);
+    U0_transpose_symbolic_.analyze(U0_transpose_, true, work_estimate_);
+  }
+
+  static uint64_t new_history_id()
+  {
+    static std::atomic<uint64_t> next_id{0};
+    return ++next_id;
+  }
+
   void grow_storage(i_t nz, i_t& S_start, i_t& S_nz);
   i_t index_map(i_t leaving) const;
   f_t u_diagonal(i_t j) const;
@@ -446,6 +496,7 @@ class basis_update_mpf_t {
   void l_transpose_multiply(std::vector<f_t>& inout) const;
 
   i_t num_updates_;                    // Number of rank-1 updates to L0
+  uint64_t history_id_;                // See history_id()
   i_t refactor_frequency_;             // Average updates before refactoring
   mutable csc_matrix_t<i_t, f_t> L0_;  // Sparse lower triangular matrix from initial factorization
   mutable csc_matrix_t<i_t, f_t> U0_;  // Sparse upper triangular matrix from initial factorization
@@ -469,19 +520,27 @@ class basis_update_mpf_t {
   mutable i_t total_sparse_U_;
   mutable i_t total_dense_U_;
 
-  mutable i_t num_calls_L_;
-  mutable i_t num_calls_U_;
-  mutable i_t num_calls_L_transpose_;
-  mutable i_t num_calls_U_transpose_;
+  mutable i_t total_bitset_L_transpose_;
+  mutable i_t total_bitset_L_;
+  mutable i_t total_bitset_U_transpose_;
+  mutable i_t total_bitset_U_;
+
+  // Symbolic information about L0, U0 and their transposes. Recomputed every factorization
+  triangle_symbolic_t<i_t, f_t> L0_symbolic_;
+  triangle_symbolic_t<i_t, f_t> U0_symbolic_;
+  triangle_symbolic_t<i_t, f_t> L0_transpose_symbolic_;
+  triangle_symbolic_t<i_t, f_t> U0_transpose_symbolic_;
 
-  mutable f_t sum_L_;
-  mutable f_t sum_U_;
-  mutable f_t sum_L_transpose_;
-  mutable f_t sum_U_transpose_;
+  // Cost models used to choose between the sparse, bitset and dense solves
+  mutable triangle_solve_cost_model_t<i_t, f_t> L_model_;
+  mutable triangle_solve_cost_model_t<i_t, f_t> U_model_;
+  mutable triangle_solve_cost_model_t<i_t, f_t> L_transpose_model_;
+  mutable triangle_solve_cost_model_t<i_t, f_t> U_transpose_model_;
 
   f_t hypersparse_threshold_;
 
   mutable f_t work_estimate_{0.0};
+  f_t factorization_work_estimate_{0.0};
 };
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -54,18 +54,10 @@ void print_bounds_stats(const std::vector<f_t>& lower,
 }
 
 template <typename i_t, typename f_t>
-bounds_strengthening_t<i_t, f_t>::bounds_strengthening_t(
-  const lp_problem_t<i_t, f_t>& problem,
-  const csr_matrix_t<i_t, f_t>& Arow,
-  const std::vector<char>& row_sense,
-  const std::vector<variable_type_t>& var_types)
-  : A(problem.A),
-    Arow(Arow),
-    var_types(var_types),
-    delta_min_activity(problem.num_rows),
-    delta_max_activity(problem.num_rows),
-    constraint_lb(problem.num_rows),
-    constraint_ub(problem.num_rows)
+static void set_constraint_bounds(const lp_problem_t<i_t, f_t>& problem,
+                                  const std::vector<char>& row_sense,
+                                  std::vector<f_t>& constraint_lb,
+                                  std::vector<f_t>& constraint_ub)
 {
   const bool is_row_sense_empty = row_sense.empty();
   if (is_row_sense_empty) {
@@ -88,6 +80,23 @@ bounds_strengthening_t<i_t, f_t>::bounds_strengthening_t(
   }
 }
 
+template <typename i_t, typename f_t>
+bounds_strengthening_t<i_t, f_t>::bounds_strengthening_t(
+  const lp_problem_t<i_t, f_t>& problem,
+  const csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<char>& row_sense,
+  const std::vector<variable_type_t>& var_types)
+  : A(problem.A),
+    Arow(Arow),
+    var_types(var_types),
+    delta_min_activity(problem.num_rows),
+    delta_max_activity(problem.num_rows),
+    constraint_lb(problem.num_rows),
+    constraint_ub(problem.num_rows)
+{
+  set_constraint_bounds(problem, row_sense, constraint_lb, constraint_ub);
+}
+
 template <typename i_t, typename f_t>
 bool bounds_strengthening_t<i_t, f_t>::bounds_strengthening(
   const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -290,8 +299,317 @@ bool bounds_strengthening_t<i_t, f_t>::bounds_strengthening(
   return true;
 }
 
+// Adds (sign = 1) or removes (sign = -1) the contribution of a_ij * x_j, with x_j in
+// [lower, upper], to the activities of a row
+template <typename i_t, typename f_t>
+static inline void update_row_activity(f_t a_ij,
+                                       f_t lower,
+                                       f_t upper,
+                                       i_t sign,
+                                       f_t& min_a,
+                                       i_t& min_inf,
+                                       f_t& max_a,
+                                       i_t& max_inf)
+{
+  const f_t min_bound = a_ij > 0 ? lower : upper;
+  const f_t max_bound = a_ij > 0 ? upper : lower;
+  if (std::isinf(min_bound)) {
+    min_inf += sign;
+  } else {
+    min_a += sign * a_ij * min_bound;
+  }
+  if (std::isinf(max_bound)) {
+    max_inf += sign;
+  } else {
+    max_a += sign * a_ij * max_bound;
+  }
+}
+
+template <typename i_t, typename f_t>
+incremental_bounds_strengthening_t<i_t, f_t>::incremental_bounds_strengthening_t(
+  const lp_problem_t<i_t, f_t>& problem,
+  const csr_matrix_t<i_t, f_t>& Arow,
+  const std::vector<char>& row_sense,
+  const std::vector<variable_type_t>& var_types)
+  : A(problem.A),
+    Arow(Arow),
+    var_types(var_types),
+    constraint_lb(problem.num_rows),
+    constraint_ub(problem.num_rows),
+    min_activity(problem.num_rows, 0.0),
+    max_activity(problem.num_rows, 0.0),
+    min_infinite(problem.num_rows, 0),
+    max_infinite(problem.num_rows, 0),
+    queued(problem.num_rows, 0)
+{
+  set_constraint_bounds(problem, row_sense, constraint_lb, constraint_ub);
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::reset(const std::vector<bool>& bounds_changed,
+                                                         const std::vector<f_t>& lower_bounds,
+                                                         const std::vector<f_t>& upper_bounds)
+{
+  const i_t m = A.m;
+  const i_t n = A.n;
+  trail.clear();
+  clear_queue();
+
+  for (i_t i = 0; i < m; ++i) {
+    const i_t row_start = Arow.row_start[i];
+    const i_t row_end   = Arow.row_start[i + 1];
+    min_activity[i]     = 0.0;
+    max_activity[i]     = 0.0;
+    min_infinite[i]     = 0;
+    max_infinite[i]     = 0;
+    for (i_t p = row_start; p < row_end; ++p) {
+      const i_t j = Arow.j[p];
+      update_row_activity<i_t, f_t>(Arow.x[p],
+                                    lower_bounds[j],
+                                    upper_bounds[j],
+                                    1,
+                                    min_activity[i],
+                                    min_infinite[i],
+                                    max_activity[i],
+                                    max_infinite[i]);
+    }
+    nnz_processed += row_end - row_start;
+  }
+
+  if (bounds_changed.empty()) {
+    for (i_t i = 0; i < m; ++i) {
+      queued[i] = 1;
+      next_queue.push_back(i);
+    }
+    return;
+  }
+  for (i_t j = 0; j < n; ++j) {
+    if (!bounds_changed[j]) { continue; }
+    const i_t col_start = A.col_start[j];
+    const i_t col_end   = A.col_start[j + 1];
+    for (i_t p = col_start; p < col_end; ++p) {
+      const i_t i = A.i[p];
+      if (!queued[i]) {
+        queued[i] = 1;
+        next_queue.push_back(i);
+      }
+    }
+    nnz_processed += col_end - col_start;
+  }
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::tighten_bounds(i_t j,
+                                                                  f_t lower,
+                                                                  f_t upper,
+                                                                  std::vector<f_t>& lower_bounds,
+                                                                  std::vector<f_t>& upper_bounds)
+{
+  lower = std::max(lower, lower_bounds[j]);
+  upper = std::min(upper, upper_bounds[j]);
+  if (lower == lower_bounds[j] && upper == upper_bounds[j]) { return; }
+  set_bounds(j, lower, upper, lower_bounds, upper_bounds);
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::set_bounds(i_t j,
+                                                              f_t lower,
+                                                              f_t upper,
+                                                              std::vector<f_t>& lower_bounds,
+                                                              std::vector<f_t>& upper_bounds)
+{
+  trail.push_back({j, lower_bounds[j], upper_bounds[j]});
+  update_activities(j, lower_bounds[j], upper_bounds[j], lower, upper);
+  lower_bounds[j] = lower;
+  upper_bounds[j] = upper;
+
+  const i_t col_start = A.col_start[j];
+  const i_t col_end   = A.col_start[j + 1];
+  for (i_t p = col_start; p < col_end; ++p) {
+    const i_t i = A.i[p];
+    if (!queued[i]) {
+      queued[i] = 1;
+      next_queue.push_back(i);
+    }
+  }
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::update_activities(
+  i_t j, f_t old_lower, f_t old_upper, f_t new_lower, f_t new_upper)
+{
+  const i_t col_start = A.col_start[j];
+  const i_t col_end   = A.col_start[j + 1];
+  for (i_t p = col_start; p < col_end; ++p) {
+    const i_t i = A.i[p];
+    update_row_activity<i_t, f_t>(A.x[p],
+                                  old_lower,
+                                  old_upper,
+                                  -1,
+                                  min_activity[i],
+                                  min_infinite[i],
+                                  max_activity[i],
+                                  max_infinite[i]);
+    update_row_activity<i_t, f_t>(A.x[p],
+                                  new_lower,
+                                  new_upper,
+                                  1,
+                                  min_activity[i],
+                                  min_infinite[i],
+                                  max_activity[i],
+                                  max_infinite[i]);
+  }
+  nnz_processed += col_end - col_start;
+}
+
+template <typename i_t, typename f_t>
+bool incremental_bounds_strengthening_t<i_t, f_t>::propagate_row(
+  i_t i,
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  std::vector<f_t>& lower_bounds,
+  std::vector<f_t>& upper_bounds)
+{
+  const f_t cnst_lb   = constraint_lb[i];
+  const f_t cnst_ub   = constraint_ub[i];
+  const i_t row_start = Arow.row_start[i];
+  const i_t row_end   = Arow.row_start[i + 1];
+  nnz_processed += row_end - row_start;
+
+  const f_t min_a = min_infinite[i] == 0 ? min_activity[i] : -inf;
+  const f_t max_a = max_infinite[i] == 0 ? max_activity[i] : inf;
+  if (check_infeasibility<i_t, f_t>(min_a, max_a, cnst_lb, cnst_ub, settings.primal_tol)) {
+    settings.log.debug("Infeasible constraint %d, cnst_lb %e, cnst_ub %e, min_a %e, max_a %e\n",
+                       i,
+                       cnst_lb,
+                       cnst_ub,
+                       min_a,
+                       max_a);
+    return false;
+  }
+
+  // A bound is implied for x_j only if the activity of the rest of the row is finite
+  const bool use_ub = cnst_ub < inf && min_infinite[i] <= 1;
+  const bool use_lb = cnst_lb > -inf && max_infinite[i] <= 1;
+  if (!use_ub && !use_lb) { return true; }
+
+  const f_t threshold = 1e3 * settings.primal_tol;
+  for (i_t p = row_start; p < row_end; ++p) {
+    const i_t j    = Arow.j[p];
+    const f_t a_ij = Arow.x[p];
+    if (a_ij == 0) { continue; }
+    const f_t old_lb = lower_bounds[j];
+    const f_t old_ub = upper_bounds[j];
+    f_t new_lb       = old_lb;
+    f_t new_ub       = old_ub;
+
+    if (use_ub) {
+      const f_t min_bound = a_ij > 0 ? old_lb : old_ub;
+      const bool infinite = std::isinf(min_bound);
+      if (min_infinite[i] == (infinite ? 1 : 0)) {
+        const f_t rest_min_a = infinite ? min_activity[i] : min_activity[i] - a_ij * min_bound;
+        const f_t bound      = (cnst_ub - rest_min_a) / a_ij;
+        if (a_ij > 0) {
+          new_ub = std::min(new_ub, bound);
+        } else {
+          new_lb = std::max(new_lb, bound);
+        }
+      }
+    }
+    if (use_lb) {
+      const f_t max_bound = a_ij > 0 ? old_ub : old_lb;
+      const bool infinite = std::isinf(max_bound);
+      if (max_infinite[i] == (infinite ? 1 : 0)) {
+        const f_t rest_max_a = infinite ? max_activity[i] : max_activity[i] - a_ij * max_bound;
+        const f_t bound      = (cnst_lb - rest_max_a) / a_ij;
+        if (a_ij > 0) {
+          new_lb = std::max(new_lb, bound);
+        } else {
+          new_ub = std::min(new_ub, bound);
+        }
+      }
+    }
+
+    // Integer rounding
+    if (!var_types.empty() &&
+        (var_types[j] == variable_type_t::INTEGER || var_types[j] == variable_type_t::BINARY)) {
+      new_lb = std::ceil(new_lb - settings.integer_tol);
+      new_ub = std::floor(new_ub + settings.integer_tol);
+    }
+
+    // Small changes are ignored, so the propagation cannot stall on a sequence of tiny steps
+    const bool lb_updated = new_lb > old_lb + threshold;
+    const bool ub_updated = new_ub < old_ub - threshold;
+    if (!lb_updated && !ub_updated) { continue; }
+    if (!lb_updated) { new_lb = old_lb; }
+    if (!ub_updated) { new_ub = old_ub; }
+
+    if (new_lb > new_ub + settings.primal_tol) {
+      settings.log.debug("Infeasible variable after update %d, %e > %e\n", j, new_lb, new_ub);
+      return false;
+    }
+    set_bounds(j, std::min(new_lb, new_ub), std::max(new_lb, new_ub), lower_bounds, upper_bounds);
+  }
+  return true;
+}
+
+template <typename i_t, typename f_t>
+bool incremental_bounds_strengthening_t<i_t, f_t>::propagate(
+  const simplex_solver_settings_t<i_t, f_t>& settings,
+  std::vector<f_t>& lower_bounds,
+  std::vector<f_t>& upper_bounds)
+{
+  bool feasible        = true;
+  const i_t iter_limit = 10;
+  last_infeasible_row  = -1;
+  for (i_t iter = 0; iter < iter_limit && feasible && !next_queue.empty(); ++iter) {
+    std::swap(queue, next_queue);
+    next_queue.clear();
+    for (size_t k = 0; k < queue.size() && feasible; ++k) {
+      const i_t i = queue[k];
+      queued[i]   = 0;
+      feasible    = propagate_row(i, settings, lower_bounds, upper_bounds);
+      if (!feasible) { last_infeasible_row = i; }
+    }
+  }
+  clear_queue();
+
+  last_nnz_processed = nnz_processed;
+  nnz_processed      = 0;
+  return feasible;
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::backtrack(size_t mark,
+                                                             std::vector<f_t>& lower_bounds,
+                                                             std::vector<f_t>& upper_bounds)
+{
+  clear_queue();
+  while (trail.size() > mark) {
+    const trail_entry_t& entry = trail.back();
+    const i_t j                = entry.j;
+    update_activities(j, lower_bounds[j], upper_bounds[j], entry.lower, entry.upper);
+    lower_bounds[j] = entry.lower;
+    upper_bounds[j] = entry.upper;
+    trail.pop_back();
+  }
+}
+
+template <typename i_t, typename f_t>
+void incremental_bounds_strengthening_t<i_t, f_t>::clear_queue()
+{
+  for (const i_t i : queue) {
+    queued[i] = 0;
+  }
+  for (const i_t i : next_queue) {
+    queued[i] = 0;
+  }
+  queue.clear();
+  next_queue.clear();
+}
+
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 template class bounds_strengthening_t<int, double>;
+template class incremental_bounds_strengthening_t<int, double>;
 #endif
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -42,4 +42,87 @@ class bounds_strengthening_t {
   std::vector<f_t> constraint_lb;
   std::vector<f_t> constraint_ub;
 };
+
+// Bounds strengthening for a sequence of nodes along a path of the search tree. The minimum and
+// maximum activity of every row are kept up to date, so a bound change costs O(nnz of the column)
+// and only the rows it touches are propagated. Every change is recorded on a trail, so the
+// bounds and the activities of an ancestor are restored by undoing the changes made since then.
+//
+// The bounds are owned by the caller and passed to every call. They must not be modified outside
+// of this class between reset() and the next reset().
+template <typename i_t, typename f_t>
+class incremental_bounds_strengthening_t {
+ public:
+  incremental_bounds_strengthening_t(const lp_problem_t<i_t, f_t>& problem,
+                                     const csr_matrix_t<i_t, f_t>& Arow,
+                                     const std::vector<char>& row_sense,
+                                     const std::vector<variable_type_t>& var_types);
+
+  // Computes the activities from scratch and clears the trail. The rows containing a variable
+  // marked in bounds_changed are queued for propagation (all the rows if bounds_changed is empty).
+  void reset(const std::vector<bool>& bounds_changed,
+             const std::vector<f_t>& lower_bounds,
+             const std::vector<f_t>& upper_bounds);
+
+  // Intersects the bounds of variable j with [lower, upper] and queues the rows of j
+  void tighten_bounds(i_t j,
+                      f_t lower,
+                      f_t upper,
+                      std::vector<f_t>& lower_bounds,
+                      std::vector<f_t>& upper_bounds);
+
+  // Propagates the queued rows until no bound changes or the iteration limit is reached.
+  // Returns false if the bounds are infeasible.
+  bool propagate(const simplex_solver_settings_t<i_t, f_t>& settings,
+                 std::vector<f_t>& lower_bounds,
+                 std::vector<f_t>& upper_bounds);
+
+  // Position on the trail, to be passed to backtrack()
+  size_t mark() const { return trail.size(); }
+
+  // Undoes all the bound changes made after the mark
+  void backtrack(size_t mark, std::vector<f_t>& lower_bounds, std::vector<f_t>& upper_bounds);
+
+  size_t last_nnz_processed{0};
+  // Row proving the infeasibility found by the last propagate(), -1 if the bounds are feasible
+  i_t last_infeasible_row{-1};
+
+ private:
+  struct trail_entry_t {
+    i_t j;
+    f_t lower;
+    f_t upper;
+  };
+
+  void set_bounds(i_t j,
+                  f_t lower,
+                  f_t upper,
+                  std::vector<f_t>& lower_bounds,
+                  std::vector<f_t>& upper_bounds);
+  void update_activities(i_t j, f_t old_lower, f_t old_upper, f_t new_lower, f_t new_upper);
+  bool propagate_row(i_t i,
+                     const simplex_solver_settings_t<i_t, f_t>& settings,
+                     std::vector<f_t>& lower_bounds,
+                     std::vector<f_t>& upper_bounds);
+  void clear_queue();
+
+  const csc_matrix_t<i_t, f_t>& A;
+  const csr_matrix_t<i_t, f_t>& Arow;
+  const std::vector<variable_type_t>& var_types;
+
+  std::vector<f_t> constraint_lb;
+  std::vector<f_t> constraint_ub;
+
+  // Finite part of the activities and number of infinite contributions
+  std::vector<f_t> min_activity;
+  std::vector<f_t> max_activity;
+  std::vector<i_t> min_infinite;
+  std::vector<i_t> max_infinite;
+
+  std::vector<trail_entry_t> trail;
+  std::vector<i_t> queue;
+  std::vector<i_t> next_queue;
+  std::vector<char> queued;
+  size_t nnz_processed{0};
+};
 }  // namespace cuopt::linear_programming::dual_simplex
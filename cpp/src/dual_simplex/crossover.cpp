@@ -12,11 +12,15 @@
 #include <dual_simplex/initial_basis.hpp>
 #include <dual_simplex/phase2.hpp>
 #include <dual_simplex/primal.hpp>
+#include <dual_simplex/random.hpp>
 #include <dual_simplex/solve.hpp>
 #include <dual_simplex/tic_toc.hpp>
 
+#include <utilities/scope_guard.hpp>
+
 #include <raft/core/nvtx.hpp>
 
+#include <algorithm>
 #include <array>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -215,22 +219,23 @@ f_t dual_residual(const lp_problem_t<i_t, f_t>& lp, const lp_solution_t<i_t, f_t
   return vector_norm_inf<i_t, f_t>(dual_residual);
 }
 
+// Ratio test over the nonbasic variables nonbasic_list[k_start], ..., nonbasic_list[k_end - 1]
 template <typename i_t, typename f_t>
-f_t dual_ratio_test(const lp_problem_t<i_t, f_t>& lp,
-                    const simplex_solver_settings_t<i_t, f_t>& settings,
-                    const std::vector<i_t>& nonbasic_list,
-                    const std::vector<variable_status_t>& vstatus,
-                    const std::vector<f_t>& z,
-                    const std::vector<f_t>& delta_zN,
-                    i_t& entering_index,
-                    i_t& nonbasic_entering_index)
+f_t dual_ratio_test_range(const lp_problem_t<i_t, f_t>& lp,
+                          const simplex_solver_settings_t<i_t, f_t>& settings,
+                          const std::vector<i_t>& nonbasic_list,
+                          const std::vector<variable_status_t>& vstatus,
+                          const std::vector<f_t>& z,
+                          const std::vector<f_t>& delta_zN,
+                          i_t k_start,
+                          i_t k_end,
+                          i_t& entering_index,
+                          i_t& nonbasic_entering_index)
 {
-  i_t m                   = lp.num_rows;
-  i_t n                   = lp.num_cols;
   f_t step_length         = 1.0;
   entering_index          = -1;
   nonbasic_entering_index = -1;
-  for (i_t k = 0; k < n - m; ++k) {
+  for (i_t k = k_start; k < k_end; ++k) {
     const i_t j             = nonbasic_list[k];
     const f_t zj            = z[j];
     const f_t dz            = delta_zN[k];
@@ -281,6 +286,28 @@ f_t dual_ratio_test(const lp_problem_t<i_t, f_t>& lp,
   return step_length;
 }
 
+template <typename i_t, typename f_t>
+f_t dual_ratio_test(const lp_problem_t<i_t, f_t>& lp,
+                    const simplex_solver_settings_t<i_t, f_t>& settings,
+                    const std::vector<i_t>& nonbasic_list,
+                    const std::vector<variable_status_t>& vstatus,
+                    const std::vector<f_t>& z,
+                    const std::vector<f_t>& delta_zN,
+                    i_t& entering_index,
+                    i_t& nonbasic_entering_index)
+{
+  return dual_ratio_test_range(lp,
+                               settings,
+                               nonbasic_list,
+                               vstatus,
+                               z,
+                               delta_zN,
+                               0,
+                               lp.num_cols - lp.num_rows,
+                               entering_index,
+                               nonbasic_entering_index);
+}
+
 template <typename i_t, typename f_t>
 void compute_dual_solution_from_basis(const lp_problem_t<i_t, f_t>& lp,
                                       basis_update_mpf_t<i_t, f_t>& ft,
@@ -661,21 +688,22 @@ void find_primal_superbasic_variables(const lp_problem_t<i_t, f_t>& lp,
   }
 }
 
+// Ratio test over the nonzeros delta_xB.i[k_start], ..., delta_xB.i[k_end - 1]
 template <typename i_t, typename f_t>
-f_t primal_ratio_test(const lp_problem_t<i_t, f_t>& lp,
-                      const simplex_solver_settings_t<i_t, f_t>& settings,
-                      const std::vector<i_t>& basic_list,
-                      const std::vector<f_t>& x,
-                      const sparse_vector_t<i_t, f_t>& delta_xB,
-                      i_t& leaving_index,
-                      i_t& basic_leaving_index,
-                      i_t& bound)
+f_t primal_ratio_test_range(const lp_problem_t<i_t, f_t>& lp,
+                            const simplex_solver_settings_t<i_t, f_t>& settings,
+                            const std::vector<i_t>& basic_list,
+                            const std::vector<f_t>& x,
+                            const sparse_vector_t<i_t, f_t>& delta_xB,
+                            i_t k_start,
+                            i_t k_end,
+                            i_t& leaving_index,
+                            i_t& basic_leaving_index,
+                            i_t& bound)
 {
-  const i_t m             = lp.num_rows;
-  const i_t n             = lp.num_cols;
   f_t step_length         = 1.0;
   constexpr f_t pivot_tol = 1e-9;
-  for (i_t k = 0; k < delta_xB.i.size(); ++k) {
+  for (i_t k = k_start; k < k_end; ++k) {
     const i_t j = basic_list[delta_xB.i[k]];
     if (x[j] <= lp.upper[j] && delta_xB.x[k] > pivot_tol && lp.upper[j] < inf) {
       const f_t ratio = (lp.upper[j] - x[j]) / delta_xB.x[k];
@@ -712,6 +740,71 @@ f_t primal_ratio_test(const lp_problem_t<i_t, f_t>& lp,
   return step_length;
 }
 
+template <typename i_t, typename f_t>
+f_t primal_ratio_test(const lp_problem_t<i_t, f_t>& lp,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      const std::vector<i_t>& basic_list,
+                      const std::vector<f_t>& x,
+                      const sparse_vector_t<i_t, f_t>& delta_xB,
+                      i_t& leaving_index,
+                      i_t& basic_leaving_index,
+                      i_t& bound)
+{
+  return primal_ratio_test_range(lp,
+                                 settings,
+                                 basic_list,
+                                 x,
+                                 delta_xB,
+                                 0,
+                                 static_cast<i_t>(delta_xB.i.size()),
+                                 leaving_index,
+                                 basic_leaving_index,
+                                 bound);
+}
+
+template <typename i_t, typename f_t>
+void compute_primal_solution_from_basis(const lp_problem_t<i_t, f_t>& lp,
+                                        const simplex_solver_settings_t<i_t, f_t>& settings,
+                                        basis_update_mpf_t<i_t, f_t>& ft,
+                                        const std::vector<i_t>& basic_list,
+                                        const std::vector<i_t>& nonbasic_list,
+                                        std::vector<f_t>& x)
+{
+  const i_t m = lp.num_rows;
+  const i_t n = lp.num_cols;
+
+  // Solve for xB such that B*xB = b - N*xN
+  std::vector<f_t> rhs = lp.rhs;
+  settings.log.debug("n %d m %d basic %ld nonbasic %ld n-m %d\n",
+                     n,
+                     m,
+                     basic_list.size(),
+                     nonbasic_list.size(),
+                     n - m);
+  assert(nonbasic_list.size() == n - m);
+  for (i_t k = 0; k < n - m; ++k) {
+    const i_t j         = nonbasic_list[k];
+    const i_t col_start = lp.A.col_start[j];
+    const i_t col_end   = lp.A.col_start[j + 1];
+    for (i_t p = col_start; p < col_end; ++p) {
+      const i_t i = lp.A.i[p];
+      rhs[i] -= lp.A.x[p] * x[j];
+    }
+  }
+  std::vector<f_t> xB(m);
+  ft.b_solve(rhs, xB);
+  std::vector<f_t> x_compare(n);
+  for (i_t k = 0; k < m; ++k) {
+    const i_t j  = basic_list[k];
+    x_compare[j] = xB[k];
+  }
+  for (i_t k = 0; k < n - m; ++k) {
+    const i_t j  = nonbasic_list[k];
+    x_compare[j] = x[j];
+  }
+  x = x_compare;
+}
+
 template <typename i_t, typename f_t>
 i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
                 const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -970,41 +1063,714 @@ i_t primal_push(const lp_problem_t<i_t, f_t>& lp,
   }
 
   verify_basis<i_t, f_t>(m, n, vstatus);
+  compute_primal_solution_from_basis(lp, settings, ft, basic_list, nonbasic_list, solution.x);
+  solution.iterations += num_pushes;
+  return 0;
+}
 
-  // Solve for xB such that B*xB = b - N*xN
-  std::vector<f_t> rhs = lp.rhs;
-  settings.log.debug("n %d m %d basic %ld nonbasic %ld n-m %d\n",
-                     n,
-                     m,
-                     basic_list.size(),
-                     nonbasic_list.size(),
-                     n - m);
-  assert(nonbasic_list.size() == n - m);
-  for (i_t k = 0; k < n - m; ++k) {
-    const i_t j         = nonbasic_list[k];
-    const i_t col_start = lp.A.col_start[j];
-    const i_t col_end   = lp.A.col_start[j + 1];
+// Superbasics pushed together in one batch of the parallel crossover
+constexpr int crossover_batch_size = 64;
+// Below this many candidates the ratio tests and the pricing run on a single thread
+constexpr int parallel_crossover_min_size = 10000;
+
+// Greedily select up to max_batch_size variables from the back of pending whose columns in A
+// share no rows. The selected variables are removed from pending, the others keep their order.
+template <typename i_t, typename f_t>
+void select_independent_batch(const csc_matrix_t<i_t, f_t>& A,
+                              i_t max_batch_size,
+                              i_t batch_id,
+                              std::vector<i_t>& pending,
+                              std::vector<i_t>& row_mark,
+                              std::vector<i_t>& batch)
+{
+  batch.clear();
+  std::vector<i_t> deferred;
+  const i_t max_candidates = 4 * max_batch_size;
+  i_t num_candidates       = 0;
+  while (!pending.empty() && static_cast<i_t>(batch.size()) < max_batch_size &&
+         num_candidates < max_candidates) {
+    const i_t j = pending.back();
+    pending.pop_back();
+    num_candidates++;
+    const i_t col_start = A.col_start[j];
+    const i_t col_end   = A.col_start[j + 1];
+    bool independent    = true;
     for (i_t p = col_start; p < col_end; ++p) {
-      const i_t i = lp.A.i[p];
-      rhs[i] -= lp.A.x[p] * solution.x[j];
+      if (row_mark[A.i[p]] == batch_id) {
+        independent = false;
+        break;
+      }
+    }
+    if (independent) {
+      for (i_t p = col_start; p < col_end; ++p) {
+        row_mark[A.i[p]] = batch_id;
+      }
+      batch.push_back(j);
+    } else {
+      deferred.push_back(j);
     }
   }
-  std::vector<f_t> xB(m);
-  ft.b_solve(rhs, xB);
-  std::vector<f_t> x_compare(n);
+  pending.insert(pending.end(), deferred.rbegin(), deferred.rend());
+}
+
+// The ratio tests are split into contiguous ranges, one per thread. Each thread keeps the first
+// minimum ratio in its range and the ranges are merged in order, so the result is identical to
+// the serial ratio test for any number of threads.
+template <typename i_t, typename f_t>
+f_t parallel_dual_ratio_test(const lp_problem_t<i_t, f_t>& lp,
+                             const simplex_solver_settings_t<i_t, f_t>& settings,
+                             i_t num_threads,
+                             const std::vector<i_t>& nonbasic_list,
+                             const std::vector<variable_status_t>& vstatus,
+                             const std::vector<f_t>& z,
+                             const std::vector<f_t>& delta_zN,
+                             i_t& entering_index,
+                             i_t& nonbasic_entering_index)
+{
+  const i_t num_nonbasic = lp.num_cols - lp.num_rows;
+  if (num_threads <= 1 || num_nonbasic < parallel_crossover_min_size) {
+    return dual_ratio_test(
+      lp, settings, nonbasic_list, vstatus, z, delta_zN, entering_index, nonbasic_entering_index);
+  }
+  std::vector<f_t> thread_step(num_threads, 1.0);
+  std::vector<i_t> thread_entering(num_threads, -1);
+  std::vector<i_t> thread_nonbasic_entering(num_threads, -1);
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+  for (i_t t = 0; t < num_threads; ++t) {
+    const int64_t size = num_nonbasic;
+    const i_t k_start  = static_cast<i_t>((size * t) / num_threads);
+    const i_t k_end    = static_cast<i_t>((size * (t + 1)) / num_threads);
+    thread_step[t]     = dual_ratio_test_range(lp,
+                                               settings,
+                                               nonbasic_list,
+                                               vstatus,
+                                               z,
+                                               delta_zN,
+                                               k_start,
+                                               k_end,
+                                               thread_entering[t],
+                                               thread_nonbasic_entering[t]);
+  }
+  f_t step_length         = 1.0;
+  entering_index          = -1;
+  nonbasic_entering_index = -1;
+  for (i_t t = 0; t < num_threads; ++t) {
+    if (thread_entering[t] != -1 && thread_step[t] < step_length) {
+      step_length             = thread_step[t];
+      entering_index          = thread_entering[t];
+      nonbasic_entering_index = thread_nonbasic_entering[t];
+    }
+  }
+  return step_length;
+}
+
+template <typename i_t, typename f_t>
+f_t parallel_primal_ratio_test(const lp_problem_t<i_t, f_t>& lp,
+                               const simplex_solver_settings_t<i_t, f_t>& settings,
+                               i_t num_threads,
+                               const std::vector<i_t>& basic_list,
+                               const std::vector<f_t>& x,
+                               const sparse_vector_t<i_t, f_t>& delta_xB,
+                               i_t& leaving_index,
+                               i_t& basic_leaving_index,
+                               i_t& bound)
+{
+  const i_t nz        = delta_xB.i.size();
+  leaving_index       = -1;
+  basic_leaving_index = -1;
+  bound               = 0;
+  if (num_threads <= 1 || nz < parallel_crossover_min_size) {
+    return primal_ratio_test(
+      lp, settings, basic_list, x, delta_xB, leaving_index, basic_leaving_index, bound);
+  }
+  std::vector<f_t> thread_step(num_threads, 1.0);
+  std::vector<i_t> thread_leaving(num_threads, -1);
+  std::vector<i_t> thread_basic_leaving(num_threads, -1);
+  std::vector<i_t> thread_bound(num_threads, 0);
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+  for (i_t t = 0; t < num_threads; ++t) {
+    const i_t k_start = static_cast<i_t>((static_cast<int64_t>(nz) * t) / num_threads);
+    const i_t k_end   = static_cast<i_t>((static_cast<int64_t>(nz) * (t + 1)) / num_threads);
+    thread_step[t]    = primal_ratio_test_range(lp,
+                                                settings,
+                                                basic_list,
+                                                x,
+                                                delta_xB,
+                                                k_start,
+                                                k_end,
+                                                thread_leaving[t],
+                                                thread_basic_leaving[t],
+                                                thread_bound[t]);
+  }
+  f_t step_length = 1.0;
+  for (i_t t = 0; t < num_threads; ++t) {
+    if (thread_leaving[t] != -1 && thread_step[t] < step_length) {
+      step_length         = thread_step[t];
+      leaving_index       = thread_leaving[t];
+      basic_leaving_index = thread_basic_leaving[t];
+      bound               = thread_bound[t];
+    }
+  }
+  return step_length;
+}
+
+// Refactor the basis during a push. Returns 0 if the basis was refactored, 1 if it also had to be
+// repaired (the caller must rebuild its superbasic lists from vstatus), and a negative return code
+// on failure.
+template <typename i_t, typename f_t>
+i_t refactor_push_basis(const lp_problem_t<i_t, f_t>& lp,
+                        const simplex_solver_settings_t<i_t, f_t>& settings,
+                        f_t start_time,
+                        basis_update_mpf_t<i_t, f_t>& ft,
+                        std::vector<i_t>& basic_list,
+                        std::vector<i_t>& nonbasic_list,
+                        std::vector<i_t>& superbasic_list,
+                        std::vector<variable_status_t>& vstatus)
+{
+  const i_t m = lp.num_rows;
+  csc_matrix_t<i_t, f_t> L(m, m, 1);
+  csc_matrix_t<i_t, f_t> U(m, m, 1);
+  std::vector<i_t> p(m);
+  std::vector<i_t> pinv(m);
+  std::vector<i_t> q(m);
+  std::vector<i_t> deficient;
+  std::vector<i_t> slacks_needed;
+  f_t work_estimate = 0;
+  bool repaired     = false;
+  i_t rank          = factorize_basis(lp.A,
+                             settings,
+                             basic_list,
+                             start_time,
+                             L,
+                             U,
+                             p,
+                             pinv,
+                             q,
+                             deficient,
+                             slacks_needed,
+                             work_estimate);
+  if (rank < 0) { return rank; }
+  if (rank != m) {
+    settings.log.debug("Failed to factorize basis. rank %d m %d\n", rank, m);
+    basis_repair(lp.A,
+                 settings,
+                 lp.lower,
+                 lp.upper,
+                 deficient,
+                 slacks_needed,
+                 basic_list,
+                 nonbasic_list,
+                 superbasic_list,
+                 vstatus,
+                 work_estimate);
+    rank = factorize_basis(lp.A,
+                           settings,
+                           basic_list,
+                           start_time,
+                           L,
+                           U,
+                           p,
+                           pinv,
+                           q,
+                           deficient,
+                           slacks_needed,
+                           work_estimate);
+    if (rank < 0) { return rank; }
+    settings.log.debug("Basis repaired\n");
+    repaired = true;
+  }
+  reorder_basic_list(q, basic_list);
+  ft.reset(L, U, p);
+  return repaired ? 1 : 0;
+}
+
+template <typename i_t, typename f_t>
+variable_status_t superbasic_to_nonbasic_status(const lp_problem_t<i_t, f_t>& lp,
+                                                const simplex_solver_settings_t<i_t, f_t>& settings,
+                                                const std::vector<f_t>& x,
+                                                i_t s)
+{
+  const f_t lower_slack = x[s] - lp.lower[s];
+  const f_t upper_slack = lp.upper[s] - x[s];
+  constexpr f_t tol     = 1e-6;
+  if (std::abs(lp.lower[s] - lp.upper[s]) < settings.fixed_tol) {
+    return variable_status_t::NONBASIC_FIXED;
+  } else if (lower_slack < tol && lp.lower[s] > -inf) {
+    return variable_status_t::NONBASIC_LOWER;
+  } else if (upper_slack < tol && lp.upper[s] < inf) {
+    return variable_status_t::NONBASIC_UPPER;
+  } else if (upper_slack < lower_slack) {
+    return variable_status_t::NONBASIC_UPPER;
+  } else {
+    return variable_status_t::NONBASIC_LOWER;
+  }
+}
+
+// Dual push on batches of basic superbasics whose columns share no rows. Each batch is driven to
+// zero reduced cost along the combined direction B^T delta_y = z_S, so a single BTRAN, pricing
+// pass and ratio test serve the whole batch. When a nonbasic variable blocks, it replaces the
+// batch member with the largest pivot and the remaining members continue from the new basis.
+template <typename i_t, typename f_t>
+i_t batched_dual_push(const lp_problem_t<i_t, f_t>& lp,
+                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                      f_t start_time,
+                      i_t num_threads,
+                      lp_solution_t<i_t, f_t>& solution,
+                      basis_update_mpf_t<i_t, f_t>& ft,
+                      std::vector<i_t>& basic_list,
+                      std::vector<i_t>& nonbasic_list,
+                      std::vector<variable_status_t>& vstatus)
+{
+  const i_t m             = lp.num_rows;
+  const i_t n             = lp.num_cols;
+  constexpr f_t tol       = 1e-6;
+  constexpr f_t pivot_tol = 1e-9;
+
+  std::vector<f_t>& z       = solution.z;
+  std::vector<f_t>& y       = solution.y;
+  const std::vector<f_t>& x = solution.x;
+
+  // basic_position[j] = k if basic_list[k] = j, -1 if j is nonbasic
+  std::vector<i_t> basic_position(n, -1);
+  std::vector<i_t> pending;
   for (i_t k = 0; k < m; ++k) {
-    const i_t j  = basic_list[k];
-    x_compare[j] = xB[k];
+    const i_t j       = basic_list[k];
+    basic_position[j] = k;
+    if (std::abs(z[j]) > tol) { pending.push_back(j); }
   }
-  for (i_t k = 0; k < n - m; ++k) {
-    const i_t j  = nonbasic_list[k];
-    x_compare[j] = solution.x[j];
+
+  const i_t total_superbasics = pending.size();
+  settings.log.debug("Batched dual push: superbasics %d\n", total_superbasics);
+  verify_basis<i_t, f_t>(m, n, vstatus);
+  compare_vstatus_with_lists<i_t, f_t>(m, n, basic_list, nonbasic_list, vstatus);
+
+  std::vector<i_t> row_mark(m, -1);
+  std::vector<i_t> batch;
+  std::vector<i_t> no_superbasics;
+  std::vector<f_t> delta_y(m, 0.0);
+  std::vector<f_t> delta_zN(n - m);
+  std::vector<f_t> alpha(m, 0.0);
+  i_t max_batch_size  = crossover_batch_size;
+  i_t num_pushes      = 0;
+  i_t num_directions  = 0;
+  i_t num_batches     = 0;
+  f_t last_print_time = tic();
+  while (!pending.empty()) {
+    select_independent_batch(lp.A, max_batch_size, num_batches, pending, row_mark, batch);
+    num_batches++;
+    while (!batch.empty()) {
+      // B^T delta_y = -delta_zB, where delta_z_s = -z_s for each s in the batch
+      sparse_vector_t<i_t, f_t> rhs_sparse(m, 0);
+      for (i_t s : batch) {
+        rhs_sparse.i.push_back(basic_position[s]);
+        rhs_sparse.x.push_back(z[s]);
+      }
+      sparse_vector_t<i_t, f_t> delta_y_sparse(m, 0);
+      ft.b_transpose_solve(rhs_sparse, delta_y_sparse);
+      delta_y_sparse.scatter(delta_y);
+
+      // delta_zN = -N^T delta_y
+#pragma omp parallel for schedule(static) num_threads(num_threads) \
+  if (num_threads > 1 && n - m >= parallel_crossover_min_size)
+      for (i_t k = 0; k < n - m; ++k) {
+        const i_t j         = nonbasic_list[k];
+        const i_t col_start = lp.A.col_start[j];
+        const i_t col_end   = lp.A.col_start[j + 1];
+        f_t dot             = 0.0;
+        for (i_t p = col_start; p < col_end; ++p) {
+          dot += lp.A.x[p] * delta_y[lp.A.i[p]];
+        }
+        delta_zN[k] = -dot;
+      }
+
+      i_t entering_index          = -1;
+      i_t nonbasic_entering_index = -1;
+      const f_t step_length       = parallel_dual_ratio_test(lp,
+                                                             settings,
+                                                             num_threads,
+                                                             nonbasic_list,
+                                                             vstatus,
+                                                             z,
+                                                             delta_zN,
+                                                             entering_index,
+                                                             nonbasic_entering_index);
+      assert(step_length >= -1e-6);
+      num_directions++;
+
+      // y <- y + step_length * delta_y
+      for (i_t k = 0; k < delta_y_sparse.i.size(); ++k) {
+        const i_t i = delta_y_sparse.i[k];
+        y[i] += step_length * delta_y[i];
+        delta_y[i] = 0.0;
+      }
+      // z <- z + step_length * delta_z
+      for (i_t k = 0; k < n - m; ++k) {
+        z[nonbasic_list[k]] += step_length * delta_zN[k];
+      }
+      for (i_t s : batch) {
+        z[s] -= step_length * z[s];
+      }
+
+      if (entering_index == -1) {
+        // The full step zeroes the reduced cost of every superbasic in the batch
+        for (i_t s : batch) {
+          z[s] = 0.0;
+        }
+        num_pushes += batch.size();
+        batch.clear();
+      } else {
+        assert(std::abs(z[entering_index]) < 1e-4);
+        z[entering_index] = 0.0;
+
+        // alpha = B^{-1} a_j. The entering variable replaces the batch member with the largest
+        // pivot. Since delta_z_j = -alpha^T z_B is nonzero, at least one pivot is nonzero.
+        sparse_vector_t<i_t, f_t> aj_sparse(lp.A, entering_index);
+        sparse_vector_t<i_t, f_t> alpha_sparse(m, 0);
+        sparse_vector_t<i_t, f_t> utilde_sparse(m, 0);
+        ft.b_solve(aj_sparse, alpha_sparse, utilde_sparse);
+        alpha_sparse.scatter(alpha);
+        i_t leaving   = -1;
+        f_t max_pivot = 0.0;
+        for (i_t b = 0; b < batch.size(); ++b) {
+          const f_t pivot = std::abs(alpha[basic_position[batch[b]]]);
+          if (pivot > max_pivot) {
+            max_pivot = pivot;
+            leaving   = b;
+          }
+        }
+        for (i_t k = 0; k < alpha_sparse.i.size(); ++k) {
+          alpha[alpha_sparse.i[k]] = 0.0;
+        }
+        if (leaving == -1 || max_pivot < pivot_tol) {
+          // No usable pivot in the batch. Fall back to pushing one superbasic at a time.
+          settings.log.debug("Batched dual push: max pivot %e. Disabling batches\n", max_pivot);
+          pending.insert(pending.end(), batch.rbegin(), batch.rend());
+          batch.clear();
+          max_batch_size = 1;
+          continue;
+        }
+
+        const i_t s                   = batch[leaving];
+        const i_t basic_leaving_index = basic_position[s];
+        batch.erase(batch.begin() + leaving);
+        basic_list[basic_leaving_index]        = entering_index;
+        nonbasic_list[nonbasic_entering_index] = s;
+        basic_position[entering_index]         = basic_leaving_index;
+        basic_position[s]                      = -1;
+        vstatus[entering_index]                = variable_status_t::BASIC;
+        vstatus[s] = superbasic_to_nonbasic_status(lp, settings, x, s);
+        num_pushes++;
+
+        // Refactor or Update
+        bool should_refactor = ft.num_updates() > settings.refactor_frequency;
+        if (!should_refactor) {
+          sparse_vector_t<i_t, f_t> er_sparse(m, 1);
+          er_sparse.i[0] = basic_leaving_index;
+          er_sparse.x[0] = 1.0;
+          sparse_vector_t<i_t, f_t> rho_sparse(m, 0);
+          sparse_vector_t<i_t, f_t> UTsol_sparse(m, 0);
+          ft.b_transpose_solve(er_sparse, rho_sparse, UTsol_sparse);
+          i_t recommend_refactor = ft.update(utilde_sparse, UTsol_sparse, basic_leaving_index);
+          should_refactor        = recommend_refactor == 1;
+        }
+        if (should_refactor) {
+          const i_t status = refactor_push_basis(
+            lp, settings, start_time, ft, basic_list, nonbasic_list, no_superbasics, vstatus);
+          if (status < 0) { return status; }
+          std::fill(basic_position.begin(), basic_position.end(), -1);
+          for (i_t k = 0; k < m; ++k) {
+            basic_position[basic_list[k]] = k;
+          }
+          if (status == 1) {
+            // The repair may have removed superbasics from the basis
+            auto not_basic = [&](i_t j) { return vstatus[j] != variable_status_t::BASIC; };
+            batch.erase(std::remove_if(batch.begin(), batch.end(), not_basic), batch.end());
+            pending.erase(std::remove_if(pending.begin(), pending.end(), not_basic),
+                          pending.end());
+          }
+        }
+      }
+
+      if (num_directions % settings.iteration_log_frequency == 0 ||
+          toc(last_print_time) > 10.0 || (pending.empty() && batch.empty())) {
+        settings.log.printf("%d of %d dual pushes in %d batches %.2fs\n",
+                            num_pushes,
+                            total_superbasics,
+                            num_batches,
+                            toc(start_time));
+        last_print_time = tic();
+      }
+      if (toc(start_time) > settings.time_limit) {
+        settings.log.printf("Crossover time exceeded\n");
+        return TIME_LIMIT_RETURN;
+      }
+      if (settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1) {
+        settings.log.printf("Concurrent halt\n");
+        return CONCURRENT_HALT_RETURN;
+      }
+    }
   }
-  solution.x = x_compare;
-  solution.iterations += num_pushes;
+
+  verify_basis<i_t, f_t>(m, n, vstatus);
+  compute_dual_solution_from_basis(lp, ft, basic_list, nonbasic_list, solution.y, solution.z);
+  solution.iterations += num_directions;
   return 0;
 }
 
+// Primal push on batches of superbasics whose columns share no rows. Every superbasic in the batch
+// moves towards its closest finite bound along the combined direction B delta_xB = -A_S delta_xS,
+// whose right-hand side is a plain concatenation of the batch columns. If a basic variable blocks,
+// it leaves and is replaced by the batch member with the largest pivot in its row of B^{-1} A_S.
+template <typename i_t, typename f_t>
+i_t batched_primal_push(const lp_problem_t<i_t, f_t>& lp,
+                        const simplex_solver_settings_t<i_t, f_t>& settings,
+                        f_t start_time,
+                        i_t num_threads,
+                        lp_solution_t<i_t, f_t>& solution,
+                        basis_update_mpf_t<i_t, f_t>& ft,
+                        std::vector<i_t>& basic_list,
+                        std::vector<i_t>& nonbasic_list,
+                        std::vector<i_t>& superbasic_list,
+                        std::vector<variable_status_t>& vstatus)
+{
+  const i_t m             = lp.num_rows;
+  const i_t n             = lp.num_cols;
+  constexpr f_t pivot_tol = 1e-9;
+
+  settings.log.debug("Batched primal push: superbasic %ld\n", superbasic_list.size());
+
+  std::vector<f_t>& x = solution.x;
+
+  std::vector<i_t> pending = superbasic_list;
+  std::vector<i_t> row_mark(m, -1);
+  std::vector<i_t> batch;
+  std::vector<f_t> delta_xS;
+  std::vector<variable_status_t> target_status;
+  std::vector<f_t> rho(m, 0.0);
+  const i_t total_superbasics = pending.size();
+  i_t max_batch_size          = crossover_batch_size;
+  i_t num_pushes              = 0;
+  i_t num_directions          = 0;
+  i_t num_batches             = 0;
+  f_t last_print_time         = tic();
+  while (!pending.empty()) {
+    select_independent_batch(lp.A, max_batch_size, num_batches, pending, row_mark, batch);
+    num_batches++;
+    while (!batch.empty()) {
+      // Move each superbasic towards its closest finite bound
+      delta_xS.resize(batch.size());
+      target_status.resize(batch.size());
+      sparse_vector_t<i_t, f_t> rhs_sparse(m, 0);
+      for (i_t b = 0; b < batch.size(); ++b) {
+        const i_t s        = batch[b];
+        const f_t to_lower = lp.lower[s] > -inf ? x[s] - lp.lower[s] : inf;
+        const f_t to_upper = lp.upper[s] < inf ? lp.upper[s] - x[s] : inf;
+        if (to_lower <= to_upper) {
+          delta_xS[b]      = lp.lower[s] - x[s];
+          target_status[b] = variable_status_t::NONBASIC_LOWER;
+        } else {
+          delta_xS[b]      = lp.upper[s] - x[s];
+          target_status[b] = variable_status_t::NONBASIC_UPPER;
+        }
+        const i_t col_start = lp.A.col_start[s];
+        const i_t col_end   = lp.A.col_start[s + 1];
+        for (i_t p = col_start; p < col_end; ++p) {
+          rhs_sparse.i.push_back(lp.A.i[p]);
+          rhs_sparse.x.push_back(lp.A.x[p] * delta_xS[b]);
+        }
+      }
+      // B*delta_xB = -A_S*delta_xS
+      sparse_vector_t<i_t, f_t> delta_xB(m, 0);
+      ft.b_solve(rhs_sparse, delta_xB);
+      delta_xB.negate();
+
+      i_t leaving_index       = -1;
+      i_t basic_leaving_index = -1;
+      i_t bound               = 0;
+      const f_t step_length   = parallel_primal_ratio_test(lp,
+                                                           settings,
+                                                           num_threads,
+                                                           basic_list,
+                                                           x,
+                                                           delta_xB,
+                                                           leaving_index,
+                                                           basic_leaving_index,
+                                                           bound);
+      num_directions++;
+
+      // xB <- xB + step_length * delta_xB
+      for (i_t k = 0; k < delta_xB.i.size(); ++k) {
+        x[basic_list[delta_xB.i[k]]] += step_length * delta_xB.x[k];
+      }
+
+      if (leaving_index == -1) {
+        // The full step moves every superbasic in the batch to its bound
+        for (i_t b = 0; b < batch.size(); ++b) {
+          const i_t s = batch[b];
+          vstatus[s]  = target_status[b];
+          x[s] = target_status[b] == variable_status_t::NONBASIC_LOWER ? lp.lower[s] : lp.upper[s];
+          nonbasic_list.push_back(s);
+        }
+        num_pushes += batch.size();
+        batch.clear();
+      } else {
+        for (i_t b = 0; b < batch.size(); ++b) {
+          x[batch[b]] += step_length * delta_xS[b];
+        }
+
+        // rho = B^{-T} e_r. The entering variable is the batch member with the largest pivot
+        // rho^T a_s. Since delta_xB_r = -sum_s (rho^T a_s) delta_xs is nonzero, one pivot is.
+        sparse_vector_t<i_t, f_t> er_sparse(m, 1);
+        er_sparse.i[0] = basic_leaving_index;
+        er_sparse.x[0] = 1.0;
+        sparse_vector_t<i_t, f_t> rho_sparse(m, 0);
+        sparse_vector_t<i_t, f_t> UTsol_sparse(m, 0);
+        ft.b_transpose_solve(er_sparse, rho_sparse, UTsol_sparse);
+        rho_sparse.scatter(rho);
+        i_t entering  = -1;
+        f_t max_pivot = 0.0;
+        for (i_t b = 0; b < batch.size(); ++b) {
+          const i_t s         = batch[b];
+          const i_t col_start = lp.A.col_start[s];
+          const i_t col_end   = lp.A.col_start[s + 1];
+          f_t dot             = 0.0;
+          for (i_t p = col_start; p < col_end; ++p) {
+            dot += lp.A.x[p] * rho[lp.A.i[p]];
+          }
+          if (std::abs(dot) > max_pivot) {
+            max_pivot = std::abs(dot);
+            entering  = b;
+          }
+        }
+        for (i_t k = 0; k < rho_sparse.i.size(); ++k) {
+          rho[rho_sparse.i[k]] = 0.0;
+        }
+        if (entering == -1 || max_pivot < pivot_tol) {
+          // No usable pivot in the batch. Fall back to pushing one superbasic at a time.
+          settings.log.debug("Batched primal push: max pivot %e. Disabling batches\n", max_pivot);
+          pending.insert(pending.end(), batch.rbegin(), batch.rend());
+          batch.clear();
+          max_batch_size = 1;
+          continue;
+        }
+
+        // Move the superbasic variable into the basis
+        const i_t s = batch[entering];
+        batch.erase(batch.begin() + entering);
+        vstatus[s] = variable_status_t::BASIC;
+        if (std::abs(lp.lower[leaving_index] - lp.upper[leaving_index]) > settings.fixed_tol) {
+          vstatus[leaving_index] =
+            bound == -1 ? variable_status_t::NONBASIC_LOWER : variable_status_t::NONBASIC_UPPER;
+        } else {
+          vstatus[leaving_index] = variable_status_t::NONBASIC_FIXED;
+        }
+        basic_list[basic_leaving_index] = s;
+        nonbasic_list.push_back(leaving_index);
+        num_pushes++;
+
+        // Refactor or Update
+        bool should_refactor = ft.num_updates() > settings.refactor_frequency;
+        if (!should_refactor) {
+          sparse_vector_t<i_t, f_t> As_sparse(lp.A, s);
+          sparse_vector_t<i_t, f_t> utilde_sparse(m, 0);
+          As_sparse.inverse_permute_vector(ft.inverse_row_permutation(), utilde_sparse);
+          ft.l_solve(utilde_sparse);
+          i_t recommend_refactor = ft.update(utilde_sparse, UTsol_sparse, basic_leaving_index);
+          should_refactor        = recommend_refactor == 1;
+        }
+        if (should_refactor) {
+          superbasic_list = pending;
+          superbasic_list.insert(superbasic_list.end(), batch.begin(), batch.end());
+          const i_t status = refactor_push_basis(
+            lp, settings, start_time, ft, basic_list, nonbasic_list, superbasic_list, vstatus);
+          if (status < 0) { return status; }
+          if (status == 1) {
+            // The repair may have changed the superbasic variables
+            find_primal_superbasic_variables(
+              lp, settings, solution, solution, vstatus, nonbasic_list, superbasic_list);
+            pending = superbasic_list;
+            batch.clear();
+          }
+        }
+      }
+
+      if (num_directions % settings.iteration_log_frequency == 0 ||
+          toc(last_print_time) > 10.0 || (pending.empty() && batch.empty())) {
+        settings.log.printf("%d of %d primal pushes in %d batches %.2f seconds\n",
+                            num_pushes,
+                            total_superbasics,
+                            num_batches,
+                            toc(start_time));
+        last_print_time = tic();
+      }
+      if (toc(start_time) > settings.time_limit) {
+        settings.log.printf("Crossover time limit exceeded\n");
+        return TIME_LIMIT_RETURN;
+      }
+      if (settings.concurrent_halt != nullptr && *settings.concurrent_halt == 1) {
+        settings.log.printf("Concurrent halt\n");
+        return CONCURRENT_HALT_RETURN;
+      }
+    }
+  }
+  superbasic_list.clear();
+
+  verify_basis<i_t, f_t>(m, n, vstatus);
+  compute_primal_solution_from_basis(lp, settings, ft, basic_list, nonbasic_list, x);
+  solution.iterations += num_directions;
+  return 0;
+}
+
+// Dual simplex cleanup with relaxed bounds. The pushes from an interior point leave many primal
+// degenerate basic variables, and perturbing the finite bounds outwards by a small random amount
+// lets dual simplex make progress on them without stalling. The perturbation is then removed and
+// dual simplex restores primal feasibility for the original bounds, starting from the optimal
+// basis and edge norms of the perturbed problem. Relaxing the bounds keeps the basis dual feasible.
+template <typename i_t, typename f_t>
+dual::status_t perturbed_dual_cleanup(const lp_problem_t<i_t, f_t>& lp,
+                                      const simplex_solver_settings_t<i_t, f_t>& settings,
+                                      f_t start_time,
+                                      std::vector<variable_status_t>& vstatus,
+                                      lp_solution_t<i_t, f_t>& solution,
+                                      i_t& iter)
+{
+  const i_t n                         = lp.num_cols;
+  constexpr f_t perturbation_scale    = 1e-6;
+  lp_problem_t<i_t, f_t> perturbed_lp = lp;
+  random_t<i_t, f_t> random(settings.random_seed);
+  i_t num_perturbed = 0;
+  for (i_t j = 0; j < n; ++j) {
+    if (std::abs(lp.upper[j] - lp.lower[j]) < settings.fixed_tol) { continue; }
+    if (lp.lower[j] > -inf) {
+      perturbed_lp.lower[j] -=
+        perturbation_scale * (1.0 + random.random()) * (1.0 + std::abs(lp.lower[j]));
+      num_perturbed++;
+    }
+    if (lp.upper[j] < inf) {
+      perturbed_lp.upper[j] +=
+        perturbation_scale * (1.0 + random.random()) * (1.0 + std::abs(lp.upper[j]));
+      num_perturbed++;
+    }
+  }
+  settings.log.printf("Perturbed %d bounds for clean up\n", num_perturbed);
+
+  std::vector<f_t> edge_norms;
+  i_t perturbed_iter = 0;
+  dual::status_t status = dual_phase2(
+    2, 0, start_time, perturbed_lp, settings, vstatus, solution, perturbed_iter, edge_norms);
+  iter += perturbed_iter;
+  if (status == dual::status_t::TIME_LIMIT || status == dual::status_t::CONCURRENT_LIMIT) {
+    return status;
+  }
+  settings.log.debug("Perturbed clean up status %d iterations %d\n", status, perturbed_iter);
+
+  i_t final_iter = 0;
+  status =
+    dual_phase2(2, 0, start_time, lp, settings, vstatus, solution, final_iter, edge_norms);
+  iter += final_iter;
+  return status;
+}
+
 template <typename i_t, typename f_t>
 i_t find_candidate_columns(const lp_problem_t<i_t, f_t>& lp,
                            const simplex_solver_settings_t<i_t, f_t>& settings,
@@ -1189,6 +1955,9 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
   const i_t n         = lp.num_cols;
   f_t crossover_start = tic();
   f_t work_estimate   = 0;
+  // Set on every return, including the time limit, the concurrent halt and the failures
+  auto crossover_time_guard =
+    cuopt::scope_guard([&]() { solution.crossover_time = toc(crossover_start); });
 
   settings.log.printf("\n");
   settings.log.printf("Starting crossover\n");
@@ -1328,11 +2097,31 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
     return crossover_status_t::CONCURRENT_LIMIT;
   }
 
+  const i_t num_threads = std::max(1, settings.num_threads);
+  const bool batched    = settings.parallel_crossover == 1;
+  if (batched) { settings.log.printf("Batched crossover with %d threads\n", num_threads); }
+
   basis_update_mpf_t ft(L, U, p, settings.refactor_frequency);
   verify_basis<i_t, f_t>(m, n, vstatus);
   compare_vstatus_with_lists<i_t, f_t>(m, n, basic_list, nonbasic_list, vstatus);
-  i_t dual_push_status = dual_push(
-    lp, settings, start_time, solution, ft, basic_list, nonbasic_list, superbasic_list, vstatus);
+  i_t dual_push_status = batched ? batched_dual_push(lp,
+                                                     settings,
+                                                     start_time,
+                                                     num_threads,
+                                                     solution,
+                                                     ft,
+                                                     basic_list,
+                                                     nonbasic_list,
+                                                     vstatus)
+                                 : dual_push(lp,
+                                             settings,
+                                             start_time,
+                                             solution,
+                                             ft,
+                                             basic_list,
+                                             nonbasic_list,
+                                             superbasic_list,
+                                             vstatus);
   if (dual_push_status < 0) { return return_to_status(dual_push_status); }
   settings.log.debug("basic list size %ld m %d\n", basic_list.size(), m);
   settings.log.debug("nonbasic list size %ld n - m %d\n", nonbasic_list.size(), n - m);
@@ -1343,8 +2132,25 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
 
   if (superbasic_list.size() > 0) {
     std::vector<f_t> save_x = solution.x;
-    i_t primal_push_status  = primal_push(
-      lp, settings, start_time, solution, ft, basic_list, nonbasic_list, superbasic_list, vstatus);
+    i_t primal_push_status  = batched ? batched_primal_push(lp,
+                                                           settings,
+                                                           start_time,
+                                                           num_threads,
+                                                           solution,
+                                                           ft,
+                                                           basic_list,
+                                                           nonbasic_list,
+                                                           superbasic_list,
+                                                           vstatus)
+                                      : primal_push(lp,
+                                                    settings,
+                                                    start_time,
+                                                    solution,
+                                                    ft,
+                                                    basic_list,
+                                                    nonbasic_list,
+                                                    superbasic_list,
+                                                    vstatus);
     if (primal_push_status < 0) { return return_to_status(primal_push_status); }
     compute_dual_solution_from_basis(lp, ft, basic_list, nonbasic_list, solution.y, solution.z);
     print_crossover_info(lp, settings, vstatus, solution, "Primal push complete");
@@ -1372,7 +2178,9 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
     i_t dual_iter = 0;
     std::vector<f_t> edge_norms;
     dual::status_t status =
-      dual_phase2(2, 0, start_time, lp, settings, vstatus, solution, dual_iter, edge_norms);
+      batched
+        ? perturbed_dual_cleanup(lp, settings, start_time, vstatus, solution, dual_iter)
+        : dual_phase2(2, 0, start_time, lp, settings, vstatus, solution, dual_iter, edge_norms);
     if (toc(start_time) > settings.time_limit) {
       settings.log.printf("Time limit exceeded\n");
       return crossover_status_t::TIME_LIMIT;
@@ -1559,7 +2367,8 @@ crossover_status_t crossover(const lp_problem_t<i_t, f_t>& lp,
     }
   }
 
-  settings.log.printf("Crossover time %.2f seconds\n", toc(crossover_start));
+  solution.crossover_time = toc(crossover_start);
+  settings.log.printf("Crossover time %.2f seconds\n", solution.crossover_time);
   settings.log.printf("Total time %.2f seconds\n", toc(start_time));
 
   crossover_status_t status = crossover_status_t::NUMERICAL_ISSUES;
@@ -11,6 +11,10 @@
 #include <utilities/logger.hpp>
 #endif
 
+#include <utilities/async_log_sink.hpp>
+
+#include <algorithm>
+#include <functional>
 #include <string>
 
 #include <cstdarg>
@@ -32,7 +36,7 @@ class logger_t {
 
   void enable_log_to_file(const char* mode = "w")
   {
-    if (log_file != nullptr) { std::fclose(log_file); }
+    if (log_file != nullptr) { close_file(); }
     log_file    = std::fopen(log_filename.c_str(), mode);
     log_to_file = true;
   }
@@ -45,7 +49,7 @@ class logger_t {
 
   void close_log_file()
   {
-    if (log_file != nullptr) { std::fclose(log_file); }
+    if (log_file != nullptr) { close_file(); }
     log_file    = nullptr;
     log_to_file = false;
   }
@@ -69,17 +73,23 @@ class logger_t {
       if (log_to_console) {
         std::va_list args;
         va_start(args, fmt);
-        std::vprintf(fmt, args);
+        write(stdout, fmt, args);
         va_end(args);
-        fflush(stdout);
       }
 #endif
       if (log_to_file && log_file != nullptr) {
         std::va_list args;
         va_start(args, fmt);
-        std::vfprintf(log_file, fmt, args);
+        write(log_file, fmt, args);
+        va_end(args);
+      }
+      if (log_callback) {
+        char buffer[1024];
+        std::va_list args;
+        va_start(args, fmt);
+        std::vsnprintf(buffer, sizeof(buffer), fmt, args);
         va_end(args);
-        fflush(log_file);
+        log_callback(buffer);
       }
     }
   }
@@ -103,17 +113,15 @@ class logger_t {
       if (log_to_console) {
         std::va_list args;
         va_start(args, fmt);
-        std::vprintf(fmt, args);
+        write(stdout, fmt, args);
         va_end(args);
-        fflush(stdout);
       }
 #endif
       if (log_to_file && log_file != nullptr) {
         std::va_list args;
         va_start(args, fmt);
-        std::vfprintf(log_file, fmt, args);
+        write(log_file, fmt, args);
         va_end(args);
-        fflush(log_file);
       }
     }
   }
@@ -121,8 +129,48 @@ class logger_t {
   bool log;
   bool log_to_console;
   std::string log_prefix;
+  // Receives every formatted printf message in addition to the console and file outputs.
+  // Must be thread safe when the solver logs from several threads
+  std::function<void(const char*)> log_callback;
 
  private:
+  // Queues the message in the asynchronous sink if it is on, writes and flushes it otherwise
+  void write(std::FILE* file, const char* fmt, std::va_list args)
+  {
+    async_log_sink_t* sink = async_log_sink();
+    if (sink != nullptr) {
+      char buffer[1024];
+      std::va_list args_copy;
+      va_copy(args_copy, args);
+      const int length = std::vsnprintf(buffer, sizeof(buffer), fmt, args);
+      // A message that cannot be formatted, e.g. a wide string invalid in the locale, is dropped
+      if (length < 0) {
+        va_end(args_copy);
+        return;
+      }
+      if (static_cast<size_t>(length) < sizeof(buffer)) {
+        if (length > 0) { sink->write(file, buffer, length); }
+      } else {
+        // Long messages, e.g. the settings and statistics dumps, are not truncated
+        std::string message(length, '\0');
+        std::vsnprintf(message.data(), length + 1, fmt, args_copy);
+        sink->write(file, message.data(), length);
+      }
+      va_end(args_copy);
+    } else {
+      std::vfprintf(file, fmt, args);
+      std::fflush(file);
+    }
+  }
+
+  void close_file()
+  {
+    // The asynchronous sink may still hold messages for the file
+    async_log_sink_t* sink = async_log_sink();
+    if (sink != nullptr) { sink->flush(); }
+    std::fclose(log_file);
+  }
+
   bool log_to_file;
   std::string log_filename;
   std::FILE* log_file;
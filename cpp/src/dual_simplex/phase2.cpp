@@ -2431,6 +2431,29 @@ class phase2_timers_t {
   bool record_time;
 };
 
+// Hands the work counted since the last call to the work unit context, split by kernel so that a
+// calibrated work unit model can weight them separately, and resets the counters
+template <typename i_t, typename f_t>
+void record_work(work_limit_context_t* work_unit_context,
+                 basis_update_mpf_t<i_t, f_t>& ft,
+                 f_t& iteration_work,
+                 f_t& ratio_test_work)
+{
+  if (work_unit_context) {
+    const f_t factorization_work = ft.factorization_work_estimate();
+    const f_t solve_work         = ft.work_estimate() - factorization_work;
+    work_counts_t counts{};
+    counts[static_cast<int>(work_kernel_t::SIMPLEX_ITERATION)]   = iteration_work;
+    counts[static_cast<int>(work_kernel_t::BASIS_SOLVE)]         = solve_work;
+    counts[static_cast<int>(work_kernel_t::BASIS_FACTORIZATION)] = factorization_work;
+    counts[static_cast<int>(work_kernel_t::RATIO_TEST)]          = ratio_test_work;
+    work_unit_context->record_work_counts(counts);
+  }
+  ft.clear_work_estimate();
+  iteration_work  = 0.0;
+  ratio_test_work = 0.0;
+}
+
 }  // namespace phase2
 
 template <typename i_t, typename f_t>
@@ -2497,6 +2520,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
   assert(lp.upper.size() == n);
   assert(lp.rhs.size() == m);
   f_t phase2_work_estimate = 0.0;
+  f_t ratio_test_work      = 0.0;
   ft.clear_work_estimate();
 
   std::vector<f_t>& x = sol.x;
@@ -2727,12 +2751,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
   [[maybe_unused]] f_t interval_start_time = toc(start_time);
   i_t last_feature_log_iter                = iter;
 
-  phase2_work_estimate += ft.work_estimate();
-  ft.clear_work_estimate();
-  if (work_unit_context) {
-    work_unit_context->record_work_sync_on_horizon((phase2_work_estimate) / 1e8);
-  }
-  phase2_work_estimate = 0.0;
+  phase2::record_work(work_unit_context, ft, phase2_work_estimate, ratio_test_work);
 
   if (phase == 2) {
     settings.log.printf("%5d %+.16e %7d %.8e %.2e %.2f\n",
@@ -2969,7 +2988,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                    delta_z_indices,
                                                    nonbasic_mark);
         entering_index = bfrt.compute_step_length(step_length, nonbasic_entering_index);
-        phase2_work_estimate += bfrt.work_estimate();
+        ratio_test_work += bfrt.work_estimate();
         if (entering_index == RATIO_TEST_NUMERICAL_ISSUES) {
           settings.log.printf("Numerical issues encountered in ratio test.\n");
           return dual::status_t::NUMERICAL;
@@ -3160,6 +3179,9 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
           "Numerical issues encountered. No entering variable found with large infeasibility.\n");
         return dual::status_t::NUMERICAL;
       }
+      // The row of the basis inverse of the leaving variable is an unbounded direction of the
+      // dual. Return it in place of the dual solution, as it proves that the primal is infeasible.
+      if (phase == 2) { delta_y_sparse.to_dense(sol.y); }
       return dual::status_t::DUAL_UNBOUNDED;
     }
 
@@ -3500,10 +3522,7 @@ dual::status_t dual_phase2_with_advanced_basis(i_t phase,
     if ((iter % FEATURE_LOG_INTERVAL) == 0 && work_unit_context) {
       [[maybe_unused]] i_t iters_elapsed = iter - last_feature_log_iter;
 
-      phase2_work_estimate += ft.work_estimate();
-      ft.clear_work_estimate();
-      work_unit_context->record_work_sync_on_horizon(phase2_work_estimate / 1e8);
-      phase2_work_estimate = 0.0;
+      phase2::record_work(work_unit_context, ft, phase2_work_estimate, ratio_test_work);
 
       last_feature_log_iter = iter;
     }
@@ -65,6 +65,8 @@ dual::status_t dual_phase2(i_t phase,
                            std::vector<f_t>& steepest_edge_norms,
                            work_limit_context_t* work_unit_context = nullptr);
 
+// When phase 2 returns DUAL_UNBOUNDED, sol.y holds a dual ray y: the aggregated row
+// y'*A*x = y'*b cannot be satisfied within the bounds, up to the sign of y.
 template <typename i_t, typename f_t>
 dual::status_t dual_phase2_with_advanced_basis(i_t phase,
                                                i_t slack_basis,
@@ -320,17 +320,15 @@ i_t convert_greater_to_less(const user_problem_t<i_t, f_t>& user_problem,
   // We transform this into the constraint
   // sum_{j : a_ij != 0} -a_ij * x_j <= -beta
 
-  // First construct a compressed sparse row representation of the A matrix
-  csr_matrix_t<i_t, f_t> Arow(0, 0, 0);
-  problem.A.to_compressed_row(Arow);
+  // Negating a row only touches the values, so it is done in place on the
+  // compressed sparse column matrix instead of through a row-wise copy of A
+  const i_t nz = problem.A.col_start[problem.A.n];
+  for (i_t p = 0; p < nz; p++) {
+    if (row_sense[problem.A.i[p]] == 'G') { problem.A.x[p] *= -1; }
+  }
 
   for (i_t i = 0; i < problem.num_rows; i++) {
     if (row_sense[i] == 'G') {
-      i_t row_start = Arow.row_start[i];
-      i_t row_end   = Arow.row_start[i + 1];
-      for (i_t p = Arow.row_start[i]; p < row_end; p++) {
-        Arow.x[p] *= -1;
-      }
       problem.rhs[i] *= -1;
       row_sense[i] = 'L';
       greater_rows--;
@@ -338,10 +336,6 @@ i_t convert_greater_to_less(const user_problem_t<i_t, f_t>& user_problem,
     }
   }
 
-  // Now convert the compressed sparse row representation back to compressed
-  // sparse column
-  Arow.to_compressed_col(problem.A);
-
   return 0;
 }
 
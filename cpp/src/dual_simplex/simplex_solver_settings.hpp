@@ -16,6 +16,7 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <string>
 #include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -83,6 +84,7 @@ struct simplex_solver_settings_t {
       cudss_deterministic(false),
       deterministic(false),
       barrier(false),
+      cpu_barrier(-1),
       eliminate_dense_columns(true),
       num_gpus(1),
       folding(-1),
@@ -92,6 +94,7 @@ struct simplex_solver_settings_t {
       barrier_dual_initial_point(-1),
       check_Q(false),
       crossover(false),
+      parallel_crossover(0),
       refactor_frequency(100),
       iteration_log_frequency(1000),
       first_iteration_log(2),
@@ -100,12 +103,28 @@ struct simplex_solver_settings_t {
       mir_cuts(-1),
       mixed_integer_gomory_cuts(-1),
       knapsack_cuts(-1),
+      flow_cover_cuts(-1),
       strong_chvatal_gomory_cuts(-1),
       reduced_cost_strengthening(-1),
+      conflict_analysis(-1),
+      max_restarts(-1),
+      restart_fixing_fraction(0.1),
+      restart_node_limit(1000),
+      basis_cache_size(4),
+      adaptive_node_selection(-1),
+      node_memory_limit(std::numeric_limits<f_t>::infinity()),
+      checkpoint_interval(600.0),
+      deterministic_horizon_step(0.5),
+      node_cut_passes(-1),
+      node_cut_max_depth(10),
+      node_cut_generation(0),
+      node_cut_effort(0.1),
       cut_change_threshold(1e-3),
       cut_min_orthogonality(0.5),
       random_seed(0),
       reliability_branching(-1),
+      feasibility_jump_climbers(-1),
+      concurrent_root_lp(-1),
       inside_mip(0),
       sub_mip(0),
       solution_callback(nullptr),
@@ -157,6 +176,7 @@ struct simplex_solver_settings_t {
   bool barrier_presolve;      // true to use barrier presolve
   bool cudss_deterministic;   // true to use cuDSS deterministic mode, false for non-deterministic
   bool barrier;               // true to use barrier method, false to use dual simplex method
+  i_t cpu_barrier;            // -1 automatic, 0 to use the GPU barrier, 1 to use the CPU barrier
   bool deterministic;  // true to use B&B deterministic mode, false to use non-deterministic mode
   bool eliminate_dense_columns;  // true to eliminate dense columns from A*D*A^T
   int num_gpus;   // Number of GPUs to use (maximum of 2 gpus are supported at the moment)
@@ -168,6 +188,8 @@ struct simplex_solver_settings_t {
                                    // point, 1 to use initial point form dual least squares problem
   bool check_Q;                    // true to check if Q is positive semidefinite
   bool crossover;                  // true to do crossover, false to not
+  i_t parallel_crossover;          // 0 to push one superbasic at a time, 1 to push batches of
+                                   // independent superbasics in parallel
   i_t refactor_frequency;          // number of basis updates before refactorization
   i_t iteration_log_frequency;     // number of iterations between log updates
   i_t first_iteration_log;         // number of iterations to log at beginning of solve
@@ -178,10 +200,34 @@ struct simplex_solver_settings_t {
   i_t mixed_integer_gomory_cuts;   // -1 automatic, 0 to disable, >0 to enable mixed integer Gomory
                                    // cuts
   i_t knapsack_cuts;               // -1 automatic, 0 to disable, >0 to enable knapsack cuts
+  i_t flow_cover_cuts;             // -1 automatic, 0 to disable, >0 to enable flow cover cuts
   i_t strong_chvatal_gomory_cuts;  // -1 automatic, 0 to disable, >0 to enable strong Chvatal Gomory
                                    // cuts
   i_t reduced_cost_strengthening;  // -1 automatic, 0 to disable, >0 to enable reduced cost
                                    // strengthening
+  i_t conflict_analysis;           // -1 automatic, 0 to disable, 1 to learn conflicts from the
+                                   // infeasible nodes of B&B
+  i_t max_restarts;                // -1 automatic, 0 to disable, >0 maximum number of restarts of
+                                   // B&B
+  f_t restart_fixing_fraction;     // restart B&B when the reduced costs fix this fraction of the
+                                   // unfixed integer variables
+  i_t restart_node_limit;          // only restart B&B within this number of explored nodes
+  i_t basis_cache_size;            // number of node LP bases each B&B worker can roll back to,
+                                   // 0 to disable
+  i_t adaptive_node_selection;     // -1 automatic, 0 to disable, 1 to tune the node selection rule
+                                   // and the plunge and dive limits during B&B
+  f_t node_memory_limit;           // memory in MB of the open nodes of B&B, beyond which the bases
+                                   // of the worst nodes are spilled to a temporary file
+  f_t checkpoint_interval;         // seconds between two checkpoints of B&B, work units in the
+                                   // deterministic mode
+  f_t deterministic_horizon_step;  // work units between two sync points of the deterministic B&B
+  i_t node_cut_passes;             // -1 automatic, 0 to disable, >0 number of local cut passes at
+                                   // the nodes of B&B
+  i_t node_cut_max_depth;          // only separate cuts at the nodes up to this depth
+  i_t node_cut_generation;         // 0 to only use the root cut pool at the nodes, 1 to also
+                                   // generate Gomory and MIR cuts from the node LP
+  f_t node_cut_effort;             // maximum ratio between the LP iterations of the local cut
+                                   // passes and the LP iterations of B&B
   f_t cut_change_threshold;        // threshold for cut change
   f_t cut_min_orthogonality;       // minimum orthogonality for cuts
   i_t mip_batch_pdlp_strong_branching{0};  // 0 if not using batch PDLP for strong branching, 1 if
@@ -195,9 +241,27 @@ struct simplex_solver_settings_t {
   // - k > 0, a variable is considered reliable if it has been branched on k times.
   i_t reliability_branching;
 
+  // Number of feasibility jump climbers running alongside B&B in the CPU solver.
+  // - -1: automatic, up to 4 climbers on the threads not used by B&B (none if there are none left)
+  // - 0: disable
+  // - k > 0: run k climbers on their own threads
+  i_t feasibility_jump_climbers;
+
+  // Concurrent solve of the root LP on the CPU, when no GPU solver races dual simplex on the root.
+  // - -1: automatic, enabled outside of the deterministic mode and the sub-MIPs, with at least 3
+  //   threads
+  // - 0: disable, only run dual simplex
+  // - 1: race dual simplex, dual simplex with column scaling and the CPU barrier with crossover.
+  //   The barrier runs on num_threads - 2 threads, the dual simplex solvers on one thread each.
+  i_t concurrent_root_lp;
+
   i_t inside_mip;  // 0 if outside MIP, 1 if inside MIP at root node, 2 if inside MIP at leaf node
   i_t sub_mip;     // 0 if in regular MIP solve, 1 if in sub-MIP solve
 
+  std::string tree_trace_file;  // B&B trace written during the search if not empty
+  std::string checkpoint_file;  // B&B checkpoints written during the search if not empty
+  std::string resume_file;      // checkpoint from which B&B resumes if not empty
+
   std::function<void(std::vector<f_t>&, f_t)> solution_callback;
   std::function<void(const std::vector<f_t>&, f_t)> node_processed_callback;
   std::function<void()> heuristic_preemption_callback;
@@ -24,7 +24,8 @@ class lp_solution_t {
       user_objective(std::numeric_limits<f_t>::quiet_NaN()),
       iterations(0),
       l2_primal_residual(std::numeric_limits<f_t>::quiet_NaN()),
-      l2_dual_residual(std::numeric_limits<f_t>::quiet_NaN())
+      l2_dual_residual(std::numeric_limits<f_t>::quiet_NaN()),
+      crossover_time(0.0)
   {
   }
 
@@ -46,6 +47,8 @@ class lp_solution_t {
   i_t iterations;
   f_t l2_primal_residual;
   f_t l2_dual_residual;
+  // Wall clock time spent in crossover (seconds). Zero if crossover was not run.
+  f_t crossover_time;
 };
 
 template <typename i_t, typename f_t>
@@ -74,6 +77,8 @@ class mip_solution_t {
   f_t lower_bound;
   int64_t nodes_explored;
   int64_t simplex_iterations;
+  // Number of times B&B restarted from the root (see `simplex_solver_settings_t::max_restarts`)
+  i_t num_restarts{0};
   bool has_incumbent;
 };
 
@@ -8,8 +8,10 @@
 #include <dual_simplex/solve.hpp>
 
 #include <barrier/barrier.hpp>
+#include <barrier/cpu_barrier.hpp>
 
 #include <branch_and_bound/branch_and_bound.hpp>
+#include <branch_and_bound/feasibility_jump.hpp>
 
 #include <dual_simplex/basis_solves.hpp>
 #include <dual_simplex/crossover.hpp>
@@ -61,6 +63,20 @@ void write_matlab(const std::string& filename, const dual_simplex::lp_problem_t<
   fclose(fid);
 }
 
+// Feeds the solutions of the feasibility jump climbers to B&B
+template <typename i_t, typename f_t>
+void start_feasibility_jump(feasibility_jump_t<i_t, f_t>& feasibility_jump,
+                            branch_and_bound_t<i_t, f_t>& branch_and_bound)
+{
+  // The climbers are not work unit producers, so the deterministic B&B has none to wait for
+  branch_and_bound.get_producer_sync().registration_complete();
+  const i_t num_climbers = feasibility_jump.num_climbers();
+  if (num_climbers == 0) { return; }
+  feasibility_jump.start(num_climbers, [&branch_and_bound](const std::vector<f_t>& solution) {
+    branch_and_bound.set_new_solution(solution);
+  });
+}
+
 }  // namespace
 
 template <typename i_t, typename f_t>
@@ -381,10 +397,27 @@ lp_status_t solve_linear_program_with_barrier(const user_problem_t<i_t, f_t>& us
     }
   }
 
-  barrier_solver_t<i_t, f_t> barrier_solver(barrier_lp, presolve_info, barrier_settings);
   barrier_solver_settings_t<i_t, f_t> barrier_solver_settings;
-  lp_status_t barrier_status =
-    barrier_solver.solve(start_time, barrier_solver_settings, barrier_solution);
+  bool use_cpu_barrier =
+    settings.cpu_barrier == 1 || (settings.cpu_barrier == -1 && user_problem.handle_ptr == nullptr);
+  if (use_cpu_barrier && barrier_lp.Q.n > 0) {
+    // The GPU barrier needs a handle, without one a QP cannot be solved with barrier
+    if (user_problem.handle_ptr == nullptr) {
+      settings.log.printf(
+        "CPU barrier does not support quadratic objectives and no GPU is available\n");
+      return lp_status_t::NUMERICAL_ISSUES;
+    }
+    settings.log.printf("CPU barrier does not support quadratic objectives. Using GPU barrier\n");
+    use_cpu_barrier = false;
+  }
+  lp_status_t barrier_status;
+  if (use_cpu_barrier) {
+    cpu_barrier_solver_t<i_t, f_t> barrier_solver(barrier_lp, presolve_info, barrier_settings);
+    barrier_status = barrier_solver.solve(start_time, barrier_solver_settings, barrier_solution);
+  } else {
+    barrier_solver_t<i_t, f_t> barrier_solver(barrier_lp, presolve_info, barrier_settings);
+    barrier_status = barrier_solver.solve(start_time, barrier_solver_settings, barrier_solution);
+  }
   if (barrier_status == lp_status_t::OPTIMAL) {
 #ifdef COMPUTE_SCALED_RESIDUALS
     std::vector<f_t> scaled_residual = barrier_lp.rhs;
@@ -649,6 +682,7 @@ lp_status_t solve_linear_program_with_barrier(const user_problem_t<i_t, f_t>& us
     crossover_status_t crossover_status = crossover(
       original_lp, barrier_settings, lp_solution, start_time, crossover_solution, vstatus);
     settings.log.printf("Crossover status: %d\n", crossover_status);
+    solution.crossover_time = crossover_solution.crossover_time;
     if (crossover_status == crossover_status_t::OPTIMAL) { barrier_status = lp_status_t::OPTIMAL; }
   }
   return barrier_status;
@@ -706,9 +740,13 @@ i_t solve(const user_problem_t<i_t, f_t>& problem,
 {
   i_t status;
   if (is_mip(problem) && !settings.relaxation) {
-    branch_and_bound_t branch_and_bound(problem, settings, tic());
+    const f_t start_time = tic();
+    branch_and_bound_t branch_and_bound(problem, settings, start_time);
+    feasibility_jump_t<i_t, f_t> feasibility_jump(problem, settings, start_time);
+    start_feasibility_jump(feasibility_jump, branch_and_bound);
     mip_solution_t<i_t, f_t> mip_solution(problem.num_cols);
     mip_status_t mip_status = branch_and_bound.solve(mip_solution);
+    feasibility_jump.stop();
     if (mip_status == mip_status_t::OPTIMAL) {
       status = 0;
     } else {
@@ -745,9 +783,13 @@ i_t solve_mip_with_guess(const user_problem_t<i_t, f_t>& problem,
 {
   i_t status;
   if (is_mip(problem)) {
-    branch_and_bound_t branch_and_bound(problem, settings, tic());
+    const f_t start_time = tic();
+    branch_and_bound_t branch_and_bound(problem, settings, start_time);
     branch_and_bound.set_initial_guess(guess);
+    feasibility_jump_t<i_t, f_t> feasibility_jump(problem, settings, start_time);
+    start_feasibility_jump(feasibility_jump, branch_and_bound);
     mip_status_t mip_status = branch_and_bound.solve(solution);
+    feasibility_jump.stop();
     if (mip_status == mip_status_t::OPTIMAL) {
       status = 0;
     } else {
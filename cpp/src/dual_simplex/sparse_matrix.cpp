@@ -108,33 +108,45 @@ i_t csc_matrix_t<i_t, f_t>::to_compressed_row(csr_matrix_t<i_t, f_t>& Arow) cons
 }
 
 template <typename i_t, typename f_t>
-i_t csr_matrix_t<i_t, f_t>::to_compressed_col(csc_matrix_t<i_t, f_t>& Acol) const
+i_t csr_to_csc(i_t m,
+               i_t n,
+               const i_t* row_start,
+               const i_t* col_index,
+               const f_t* values,
+               csc_matrix_t<i_t, f_t>& A)
 {
-  i_t m = Acol.m = this->m;
-  i_t n = Acol.n = this->n;
-  i_t nz         = this->row_start[m];
-  Acol.col_start.resize(n + 1);
-  Acol.i.resize(nz);
-  Acol.x.resize(nz);
+  const i_t nz = m > 0 ? row_start[m] : 0;
+  A.m          = m;
+  A.n          = n;
+  A.nz_max     = nz;
+  A.col_start.resize(n + 1);
+  A.i.resize(nz);
+  A.x.resize(nz);
 
   std::vector<i_t> workspace(n, 0);
   for (i_t p = 0; p < nz; ++p) {
-    workspace[this->j[p]]++;
+    workspace[col_index[p]]++;
   }
-  cumulative_sum(workspace, Acol.col_start);
+  cumulative_sum(workspace, A.col_start);
   for (i_t i = 0; i < m; ++i) {
-    i_t row_start = this->row_start[i];
-    i_t row_end   = this->row_start[i + 1];
-    for (i_t p = row_start; p < row_end; ++p) {
-      i_t q     = workspace[this->j[p]]++;
-      Acol.i[q] = i;
-      Acol.x[q] = this->x[p];
+    const i_t row_end = row_start[i + 1];
+    for (i_t p = row_start[i]; p < row_end; ++p) {
+      const i_t q = workspace[col_index[p]]++;
+      A.i[q]      = i;
+      A.x[q]      = values[p];
     }
   }
-  assert(Acol.col_start[n] == nz);
+  assert(A.col_start[n] == nz);
   return 0;
 }
 
+template <typename i_t, typename f_t>
+i_t csr_matrix_t<i_t, f_t>::to_compressed_col(csc_matrix_t<i_t, f_t>& Acol) const
+{
+  return csr_to_csc(
+    this->m, this->n, this->row_start.data(), this->j.data(), this->x.data(), Acol);
+}
+
 template <typename i_t, typename f_t>
 i_t csc_matrix_t<i_t, f_t>::load_a_column(i_t j, std::vector<f_t>& Aj) const
 {
@@ -957,6 +969,13 @@ template int coo_to_csc<int, double>(const std::vector<int>& Ai,
                                      const std::vector<double>& Ax,
                                      csc_matrix_t<int, double>& A);
 
+template int csr_to_csc<int, double>(int m,
+                                     int n,
+                                     const int* row_start,
+                                     const int* col_index,
+                                     const double* values,
+                                     csc_matrix_t<int, double>& A);
+
 template int scatter<int, double>(const csc_matrix_t<int, double>& A,
                                   int j,
                                   double beta,
@@ -194,6 +194,16 @@ i_t coo_to_csc(const std::vector<i_t>& Ai,
                const std::vector<f_t>& Ax,
                csc_matrix_t<i_t, f_t>& A);
 
+// Builds the CSC form of the m x n CSR matrix given by row_start, col_index and values. The CSR
+// arrays are only read, so they can be borrowed from the caller without a csr_matrix_t copy
+template <typename i_t, typename f_t>
+i_t csr_to_csc(i_t m,
+               i_t n,
+               const i_t* row_start,
+               const i_t* col_index,
+               const f_t* values,
+               csc_matrix_t<i_t, f_t>& A);
+
 template <typename i_t, typename f_t>
 i_t scatter(const csc_matrix_t<i_t, f_t>& A,
             i_t j,
@@ -7,6 +7,8 @@
 
 #include <dual_simplex/triangle_solve.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <optional>
 
 namespace cuopt::linear_programming::dual_simplex {
@@ -151,6 +153,202 @@ i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
   return top;
 }
 
+template <typename i_t, typename f_t>
+void triangle_symbolic_t<i_t, f_t>::analyze(const csc_matrix_t<i_t, f_t>& G,
+                                            bool lo,
+                                            f_t& work_estimate)
+{
+  n     = G.n;
+  nnz   = G.col_start[n];
+  lower = lo;
+  off_diagonal_count.resize(n);
+  for (i_t j = 0; j < n; ++j) {
+    // The diagonal is always stored (first for L, last for U)
+    off_diagonal_count[j] = std::max(G.col_start[j + 1] - G.col_start[j] - 1, i_t(0));
+  }
+  reach_bits.assign((n + 63) / 64, 0);
+  work_estimate += 4 * n + reach_bits.size();
+}
+
+template <typename i_t, typename f_t, bool lo>
+i_t bitset_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
+                          const triangle_symbolic_t<i_t, f_t>& symbolic,
+                          std::vector<i_t>& xi,
+                          const csc_matrix_t<i_t, f_t>& G,
+                          f_t* x,
+                          f_t& work_estimate)
+{
+  const i_t m = G.m;
+  assert(b.n == m);
+  assert(symbolic.n == m);
+  assert(symbolic.lower == lo);
+  std::vector<uint64_t>& bits = symbolic.reach_bits;
+
+  // Mark the reach. The order in which nodes are visited does not matter here,
+  // so a plain stack suffices and no node is ever revisited.
+  i_t* stack    = xi.data() + m;
+  i_t head      = 0;
+  i_t min_word  = symbolic.num_words();
+  i_t max_word  = -1;
+  i_t reach_nz  = 0;
+  i_t edges     = 0;
+  const i_t bnz = b.i.size();
+  for (i_t p = 0; p < bnz; ++p) {
+    const i_t i         = b.i[p];
+    const i_t w         = i >> 6;
+    const uint64_t mask = uint64_t(1) << (i & 63);
+    if (bits[w] & mask) { continue; }
+    bits[w] |= mask;
+    min_word = std::min(min_word, w);
+    max_word = std::max(max_word, w);
+    reach_nz++;
+    if (symbolic.off_diagonal_count[i] > 0) { stack[head++] = i; }
+  }
+  while (head > 0) {
+    const i_t j     = stack[--head];
+    stack[head]     = 0;
+    const i_t start = lo ? G.col_start[j] + 1 : G.col_start[j];
+    const i_t end   = lo ? G.col_start[j + 1] : G.col_start[j + 1] - 1;
+    edges += end - start;
+    for (i_t p = start; p < end; ++p) {
+      const i_t i         = G.i[p];
+      const i_t w         = i >> 6;
+      const uint64_t mask = uint64_t(1) << (i & 63);
+      if (bits[w] & mask) { continue; }
+      bits[w] |= mask;
+      min_word = std::min(min_word, w);
+      max_word = std::max(max_word, w);
+      reach_nz++;
+      if (symbolic.off_diagonal_count[i] > 0) { stack[head++] = i; }
+    }
+  }
+  work_estimate += 4 * bnz + 4 * edges + 3 * reach_nz;
+
+  // Sweep the bitset to emit the reach in topological order. The output is
+  // filled from the back so that xi[top] is the first column to be solved:
+  // the smallest index for a lower triangular G, the largest for an upper.
+  i_t top = m;
+  if constexpr (lo) {
+    for (i_t w = max_word; w >= min_word; --w) {
+      uint64_t word = bits[w];
+      bits[w]       = 0;
+      while (word) {
+        const int bit = 63 - __builtin_clzll(word);
+        xi[--top]     = (w << 6) + bit;
+        word &= ~(uint64_t(1) << bit);
+      }
+    }
+  } else {
+    for (i_t w = min_word; w <= max_word; ++w) {
+      uint64_t word = bits[w];
+      bits[w]       = 0;
+      while (word) {
+        const int bit = __builtin_ctzll(word);
+        xi[--top]     = (w << 6) + bit;
+        word &= word - 1;
+      }
+    }
+  }
+  work_estimate += 2 * std::max(max_word - min_word + 1, i_t(0)) + 2 * reach_nz;
+  assert(m - top == reach_nz);
+
+  for (i_t p = top; p < m; ++p) {
+    x[xi[p]] = 0;  // Clear x vector
+  }
+  for (i_t p = 0; p < bnz; ++p) {
+    x[b.i[p]] = b.x[p];  // Scatter b
+  }
+  work_estimate += 2 * (m - top) + 3 * bnz;
+
+  for (i_t px = top; px < m; ++px) {
+    const i_t j = xi[px];
+    f_t Gjj;
+    i_t p;
+    i_t end;
+    if constexpr (lo) {
+      Gjj = G.x[G.col_start[j]];
+      p   = G.col_start[j] + 1;
+      end = G.col_start[j + 1];
+    } else {
+      Gjj = G.x[G.col_start[j + 1] - 1];
+      p   = G.col_start[j];
+      end = G.col_start[j + 1] - 1;
+    }
+    x[j] /= Gjj;
+    const f_t x_j = x[j];
+    if (x_j == 0.0) { continue; }
+    for (; p < end; ++p) {
+      x[G.i[p]] -= G.x[p] * x_j;
+    }
+  }
+  work_estimate += 4 * edges + 5 * (m - top);
+  return top;
+}
+
+template <typename i_t, typename f_t>
+void triangle_solve_cost_model_t<i_t, f_t>::reset(const triangle_symbolic_t<i_t, f_t>& symbolic)
+{
+  num_calls  = 0;
+  sum_growth = 0.0;
+  n          = static_cast<f_t>(symbolic.n);
+  num_words  = static_cast<f_t>(symbolic.num_words());
+  // Until a method has been measured we use a prior derived from the work
+  // counted by the solve routines and the structure of the new factor.
+  const f_t d = symbolic.average_column_count();
+  if (num_measured[0] == 0) { cost_per_nz[0] = 27.0 + 7.0 * d; }
+  if (num_measured[1] == 0) { cost_per_nz[1] = 14.0 + 8.0 * d; }
+  // The dense cost depends directly on the size of the factor, so it is not
+  // carried over between factorizations
+  dense_cost      = 3.0 * n + 3.0 * static_cast<f_t>(symbolic.nnz);
+  num_measured[2] = 0;
+}
+
+template <typename i_t, typename f_t>
+triangle_solve_method_t triangle_solve_cost_model_t<i_t, f_t>::choose(f_t rhs_nz,
+                                                                      f_t hypersparse_threshold)
+{
+  num_calls++;
+  const f_t average_growth = std::max(1.0, sum_growth / static_cast<f_t>(num_calls));
+  const f_t predicted_nz   = std::min(rhs_nz * average_growth, n);
+  // Solutions predicted to be well beyond hypersparse are always solved densely.
+  // This also avoids the bookkeeping below for the common dense case.
+  if (predicted_nz > 4.0 * hypersparse_threshold * n) { return triangle_solve_method_t::DENSE; }
+
+  const f_t dfs_cost    = cost_per_nz[0] * predicted_nz;
+  const f_t bitset_cost = cost_per_nz[1] * predicted_nz + 2.0 * num_words;
+  if (dfs_cost <= bitset_cost && dfs_cost <= dense_cost) {
+    return triangle_solve_method_t::DFS_REACH;
+  }
+  if (bitset_cost <= dense_cost) { return triangle_solve_method_t::BITSET_REACH; }
+  return triangle_solve_method_t::DENSE;
+}
+
+template <typename i_t, typename f_t>
+void triangle_solve_cost_model_t<i_t, f_t>::record(triangle_solve_method_t method,
+                                                   f_t rhs_nz,
+                                                   f_t solution_nz,
+                                                   f_t work)
+{
+  if (rhs_nz > 0) { sum_growth += solution_nz / rhs_nz; }
+  // Exponential moving average of the measured costs
+  constexpr f_t alpha = 0.1;
+  const i_t k         = static_cast<i_t>(method);
+  f_t measured;
+  f_t* estimate;
+  if (method == triangle_solve_method_t::DENSE) {
+    measured = work;
+    estimate = &dense_cost;
+  } else {
+    if (solution_nz < 1.0) { return; }
+    measured = method == triangle_solve_method_t::BITSET_REACH
+                 ? (work - 2.0 * num_words) / solution_nz
+                 : work / solution_nz;
+    estimate = &cost_per_nz[k];
+  }
+  *estimate = num_measured[k] == 0 ? measured : (1.0 - alpha) * (*estimate) + alpha * measured;
+  num_measured[k]++;
+}
+
 #ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
 
 // NOTE: lower_triangular_solve, lower_triangular_transpose_solve,
@@ -184,6 +382,26 @@ template int sparse_triangle_solve<int, double, false>(const sparse_vector_t<int
                                                        csc_matrix_t<int, double>& G,
                                                        double* x,
                                                        double& work_estimate);
+
+template class triangle_symbolic_t<int, double>;
+
+template int bitset_triangle_solve<int, double, true>(
+  const sparse_vector_t<int, double>& b,
+  const triangle_symbolic_t<int, double>& symbolic,
+  std::vector<int>& xi,
+  const csc_matrix_t<int, double>& G,
+  double* x,
+  double& work_estimate);
+
+template int bitset_triangle_solve<int, double, false>(
+  const sparse_vector_t<int, double>& b,
+  const triangle_symbolic_t<int, double>& symbolic,
+  std::vector<int>& xi,
+  const csc_matrix_t<int, double>& G,
+  double* x,
+  double& work_estimate);
+
+template class triangle_solve_cost_model_t<int, double>;
 #endif
 
 }  // namespace cuopt::linear_programming::dual_simplex
@@ -11,7 +11,9 @@
 #include <dual_simplex/sparse_vector.hpp>
 #include <dual_simplex/types.hpp>
 
+#include <cstdint>
 #include <optional>
+#include <vector>
 
 namespace cuopt::linear_programming::dual_simplex {
 
@@ -171,4 +173,101 @@ i_t sparse_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
                           f_t* x,
                           f_t& work_estimate);
 
+// The three strategies available for solving with a triangular factor
+// DFS_REACH    - Gilbert-Peierls: depth-first search for the reach, then a sparse solve.
+//                Best for hypersparse right-hand sides and solutions.
+// BITSET_REACH - Mark the reach in a bitset and sweep it in the cached topological order.
+//                Avoids the DFS bookkeeping for mid-density solutions.
+// DENSE        - Ordinary dense forward/backward substitution
+enum class triangle_solve_method_t : int8_t { DFS_REACH = 0, BITSET_REACH = 1, DENSE = 2 };
+
+// \brief Symbolic information about a triangular factor G that is computed once
+// per factorization and reused by every solve with G.
+//
+// The factors stored by the basis update are not permuted, so a topological order
+// of the column dependency graph of G is simply its column order: increasing for a
+// lower triangular matrix, decreasing for an upper triangular matrix. We cache
+// that direction, the number of off-diagonal entries in each column (columns with
+// none are leaves that never need to be expanded), and the bitset used to mark
+// the reach.
+template <typename i_t, typename f_t>
+class triangle_symbolic_t {
+ public:
+  triangle_symbolic_t() : n(0), nnz(0), lower(true) {}
+
+  // Analyze the structure of G. lo indicates that G is lower triangular with
+  // the diagonal stored first in each column. Otherwise G is upper triangular
+  // with the diagonal stored last in each column.
+  void analyze(const csc_matrix_t<i_t, f_t>& G, bool lo, f_t& work_estimate);
+
+  // Average number of off-diagonal entries per column
+  f_t average_column_count() const
+  {
+    return n > 0 ? static_cast<f_t>(nnz - n) / static_cast<f_t>(n) : 0.0;
+  }
+
+  i_t num_words() const { return static_cast<i_t>(reach_bits.size()); }
+
+  i_t n;
+  i_t nnz;
+  bool lower;
+  std::vector<i_t> off_diagonal_count;
+  mutable std::vector<uint64_t> reach_bits;  // Always all zero between solves
+};
+
+// \brief Solve G*x = b where G is triangular and b is sparse. The reach of b is
+// marked in a bitset and then emitted in topological order by sweeping the
+// bitset. On output the nonzero pattern of x is stored in xi[top] through
+// xi[m-1], in the same layout as sparse_triangle_solve, so the two are
+// interchangeable.
+// \param[in] b - Sparse vector containing the rhs
+// \param[in] symbolic - Symbolic information about G from triangle_symbolic_t::analyze
+// \param[in, out] xi - An array of size 2*m. xi[m] through xi[2*m-1] are used as
+// a stack and restored to zero on output
+// \param[in] G - The lower triangular matrix L or the upper triangular matrix U
+// \param[out] x - The solution vector
+// \returns top
+template <typename i_t, typename f_t, bool lo>
+i_t bitset_triangle_solve(const sparse_vector_t<i_t, f_t>& b,
+                          const triangle_symbolic_t<i_t, f_t>& symbolic,
+                          std::vector<i_t>& xi,
+                          const csc_matrix_t<i_t, f_t>& G,
+                          f_t* x,
+                          f_t& work_estimate);
+
+// \brief A running cost model used to choose how to solve with a triangular
+// factor. The expected growth from right-hand side nonzeros to solution nonzeros
+// is tracked as a running average (reset every factorization). The cost of each
+// sparse method per solution nonzero and the cost of the dense method are
+// measured from the work performed by previous solves. Costs are measured in
+// work units rather than wall time so that the choice of method, and therefore
+// the floating-point results, are deterministic.
+template <typename i_t, typename f_t>
+class triangle_solve_cost_model_t {
+ public:
+  triangle_solve_cost_model_t() : num_calls(0), sum_growth(0.0), dense_cost(0.0)
+  {
+    cost_per_nz[0] = cost_per_nz[1] = 0.0;
+    num_measured[0] = num_measured[1] = num_measured[2] = 0;
+  }
+
+  // Called after each factorization. Resets the growth estimate and the prior
+  // costs derived from the structure of the factor.
+  void reset(const triangle_symbolic_t<i_t, f_t>& symbolic);
+
+  // Pick the method with the smallest predicted cost for a rhs with rhs_nz nonzeros
+  triangle_solve_method_t choose(f_t rhs_nz, f_t hypersparse_threshold);
+
+  // Record the outcome of a solve
+  void record(triangle_solve_method_t method, f_t rhs_nz, f_t solution_nz, f_t work);
+
+  i_t num_calls;
+  f_t sum_growth;
+  f_t cost_per_nz[2];  // measured work per solution nonzero for DFS_REACH and BITSET_REACH
+  f_t dense_cost;      // measured work of a DENSE solve
+  i_t num_measured[3];
+  f_t n;
+  f_t num_words;
+};
+
 }  // namespace cuopt::linear_programming::dual_simplex
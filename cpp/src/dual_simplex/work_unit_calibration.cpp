@@ -0,0 +1,140 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/work_unit_calibration.hpp>
+
+#include <dual_simplex/presolve.hpp>
+#include <dual_simplex/tic_toc.hpp>
+
+#include <utilities/work_limit_context.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+template <typename i_t, typename f_t>
+lp_status_t work_unit_calibration_t<i_t, f_t>::add_problem(
+  const user_problem_t<i_t, f_t>& user_problem, const simplex_solver_settings_t<i_t, f_t>& settings)
+{
+  lp_problem_t<i_t, f_t> original_lp(user_problem.handle_ptr, 1, 1, 1);
+  std::vector<i_t> new_slacks;
+  dualize_info_t<i_t, f_t> dualize_info;
+  convert_user_problem(user_problem, settings, original_lp, new_slacks, dualize_info);
+  lp_solution_t<i_t, f_t> solution(original_lp.num_rows, original_lp.num_cols);
+  std::vector<variable_status_t> vstatus;
+  std::vector<f_t> edge_norms;
+
+  // The context is not deterministic: the samples are observed without advancing any work clock
+  work_limit_context_t context("work_unit_calibration");
+  f_t last_sample_time         = tic();
+  context.work_sample_callback = [&](const work_counts_t& counts) {
+    const f_t now = tic();
+    counts_.push_back(counts);
+    seconds_.push_back(now - last_sample_time);
+    last_sample_time = now;
+  };
+  return solve_linear_program_advanced(original_lp,
+                                       last_sample_time,
+                                       settings,
+                                       solution,
+                                       vstatus,
+                                       edge_norms,
+                                       &context);
+}
+
+template <typename i_t, typename f_t>
+double work_unit_calibration_t<i_t, f_t>::relative_error(const work_unit_model_t& model) const
+{
+  double error = 0.0;
+  for (size_t k = 0; k < counts_.size(); ++k) {
+    error += std::abs(model.work_units(counts_[k]) - seconds_[k]);
+  }
+  const double total = total_seconds();
+  return total > 0.0 ? error / total : 0.0;
+}
+
+template <typename i_t, typename f_t>
+double work_unit_calibration_t<i_t, f_t>::total_seconds() const
+{
+  double total = 0.0;
+  for (double seconds : seconds_) {
+    total += seconds;
+  }
+  return total;
+}
+
+template <typename i_t, typename f_t>
+user_problem_t<i_t, f_t> random_calibration_problem(i_t m, i_t n, f_t density, uint64_t seed)
+{
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<f_t> value(0.1, 1.0);
+  std::uniform_int_distribution<i_t> row(0, m - 1);
+  const i_t col_nz = std::max<i_t>(1, static_cast<i_t>(std::ceil(density * m)));
+
+  user_problem_t<i_t, f_t> problem(nullptr);
+  problem.num_rows = m;
+  problem.num_cols = n;
+  problem.A.m      = m;
+  problem.A.n      = n;
+  problem.A.col_start.assign(n + 1, 0);
+  problem.A.i.clear();
+  problem.A.x.clear();
+
+  // Random nonnegative matrix, a point strictly inside the bounds and rows that it satisfies with
+  // a positive slack, so the problem is feasible. The bounds on the columns make it bounded
+  std::vector<f_t> interior(n);
+  std::vector<f_t> activity(m, 0.0);
+  std::vector<char> in_column(m, 0);
+  for (i_t j = 0; j < n; ++j) {
+    interior[j] = 0.5 * value(gen);
+    for (i_t k = 0; k < col_nz; ++k) {
+      const i_t i = row(gen);
+      if (in_column[i]) { continue; }
+      in_column[i]   = 1;
+      const f_t a_ij = value(gen);
+      problem.A.i.push_back(i);
+      problem.A.x.push_back(a_ij);
+      activity[i] += a_ij * interior[j];
+    }
+    for (i_t p = problem.A.col_start[j]; p < static_cast<i_t>(problem.A.i.size()); ++p) {
+      in_column[problem.A.i[p]] = 0;
+    }
+    problem.A.col_start[j + 1] = problem.A.i.size();
+  }
+  problem.A.nz_max = problem.A.i.size();
+
+  problem.objective.resize(n);
+  for (i_t j = 0; j < n; ++j) {
+    problem.objective[j] = -value(gen);
+  }
+  problem.rhs.resize(m);
+  for (i_t i = 0; i < m; ++i) {
+    problem.rhs[i] = activity[i] + value(gen);
+  }
+  problem.row_sense.assign(m, 'L');
+  problem.lower.assign(n, 0.0);
+  problem.upper.assign(n, 1.0);
+  problem.num_range_rows = 0;
+  problem.var_types.assign(n, variable_type_t::CONTINUOUS);
+  problem.problem_name = "work_unit_calibration";
+  return problem;
+}
+
+#ifdef DUAL_SIMPLEX_INSTANTIATE_DOUBLE
+
+template class work_unit_calibration_t<int, double>;
+
+template user_problem_t<int, double> random_calibration_problem(int m,
+                                                                int n,
+                                                                double density,
+                                                                uint64_t seed);
+
+#endif
+
+}  // namespace cuopt::linear_programming::dual_simplex
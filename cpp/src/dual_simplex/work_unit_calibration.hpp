@@ -0,0 +1,50 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <utilities/work_unit_model.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex {
+
+// Collects (operation counts, wall time) samples from dual simplex solves and fits the weights of
+// the work unit model to them. Each sample covers the work recorded between two calls of the work
+// unit context, i.e. a few simplex iterations, and the time elapsed between those calls
+template <typename i_t, typename f_t>
+class work_unit_calibration_t {
+ public:
+  // Solves the LP with the dual simplex method and records its samples
+  lp_status_t add_problem(const user_problem_t<i_t, f_t>& user_problem,
+                          const simplex_solver_settings_t<i_t, f_t>& settings);
+
+  work_unit_model_t fit() const { return work_unit_model_t::fit(counts_, seconds_); }
+
+  // Relative difference between the work units of the model and the measured time, over all the
+  // samples
+  double relative_error(const work_unit_model_t& model) const;
+
+  size_t num_samples() const { return counts_.size(); }
+  double total_seconds() const;
+
+ private:
+  std::vector<work_counts_t> counts_;
+  std::vector<double> seconds_;
+};
+
+// Random feasible and bounded LP with m inequality rows, n bounded columns and about density * m
+// nonzeros per column, used to calibrate when no representative problems are given
+template <typename i_t, typename f_t>
+user_problem_t<i_t, f_t> random_calibration_problem(i_t m, i_t n, f_t density, uint64_t seed);
+
+}  // namespace cuopt::linear_programming::dual_simplex
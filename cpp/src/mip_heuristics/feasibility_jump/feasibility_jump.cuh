@@ -18,6 +18,7 @@
 #include <mip_heuristics/utils.cuh>
 
 #include <utilities/event_handler.cuh>
+#include <utilities/memory_instrumentation.hpp>
 
 #define FJ_DEBUG_LOAD_BALANCING 0
 #define FJ_SINGLE_STEP          0
@@ -188,7 +189,7 @@ struct fj_move_candidate_t {
   f_t delta;
 };
 
-template <typename i_t, typename f_t>
+template <typename i_t, typename f_t, typename memory_policy_t = default_memory_policy_t>
 struct fj_cpu_climber_t;
 
 template <typename i_t, typename f_t>
@@ -202,7 +203,9 @@ class fj_t {
   ~fj_t();
   void reset_cuda_graph();
   i_t solve(solution_t<i_t, f_t>& solution);
-  std::unique_ptr<fj_cpu_climber_t<i_t, f_t>> create_cpu_climber(
+  // memory_policy_t selects whether the climber counts its memory accesses
+  template <typename memory_policy_t = default_memory_policy_t>
+  std::unique_ptr<fj_cpu_climber_t<i_t, f_t, memory_policy_t>> create_cpu_climber(
     solution_t<i_t, f_t>& solution,
     const std::vector<f_t>& left_weights,
     const std::vector<f_t>& right_weights,
@@ -210,7 +213,8 @@ class fj_t {
     std::atomic<bool>& preemption_flag,
     fj_settings_t settings = fj_settings_t{},
     bool randomize_params  = false);
-  bool cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+  template <typename memory_policy_t>
+  bool cpu_solve(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                  f_t time_limit = +std::numeric_limits<f_t>::infinity());
   i_t alloc_max_climbers(i_t desired_climbers);
   void resize_vectors(const raft::handle_t* handle_ptr);
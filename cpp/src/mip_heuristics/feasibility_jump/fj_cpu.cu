@@ -10,6 +10,7 @@
 #include "feasibility_jump.cuh"
 #include "feasibility_jump_impl_common.cuh"
 #include "fj_cpu.cuh"
+#include "fj_cpu_host.hpp"
 
 #include <utilities/seed_generator.cuh>
 
@@ -21,6 +22,7 @@
 #include <random>
 #include <sstream>
 #include <thread>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -223,8 +225,16 @@ class timing_raii_t {
   std::chrono::high_resolution_clock::time_point start_time_;
 };
 
-template <typename i_t, typename f_t>
-static void print_timing_stats(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static f_t get_user_objective(const fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                              f_t solver_objective)
+{
+  const auto& pb = fj_cpu.view.pb;
+  return pb.objective_scaling_factor * (solver_objective + pb.objective_offset);
+}
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void print_timing_stats(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   auto compute_avg_and_total = [](const std::vector<double>& times) -> std::pair<double, double> {
     if (times.empty()) return {0.0, 0.0};
@@ -279,8 +289,8 @@ static void print_timing_stats(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   CUOPT_LOG_TRACE("========================================");
 }
 
-template <typename i_t, typename f_t>
-static void precompute_problem_features(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void precompute_problem_features(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   fj_cpu.n_binary_vars  = 0;
   fj_cpu.n_integer_vars = 0;
@@ -338,8 +348,8 @@ static void precompute_problem_features(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   fj_cpu.problem_density = (double)total_nnz / ((double)n_vars * n_cstrs);
 }
 
-template <typename i_t, typename f_t>
-static void log_regression_features(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void log_regression_features(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                                     double time_window_ms,
                                     double total_time_ms,
                                     size_t mem_loads_bytes,
@@ -485,41 +495,56 @@ static void log_regression_features(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   fj_cpu.unique_vars_accessed_window.clear();
 }
 
-template <typename i_t, typename f_t>
-static inline std::pair<i_t, i_t> reverse_range_for_var(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
-                                                        i_t var_idx)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline std::pair<i_t, i_t> reverse_range_for_var(
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t var_idx)
 {
   cuopt_assert(var_idx >= 0 && var_idx < fj_cpu.view.pb.n_variables,
                "Variable should be within the range");
   return std::make_pair(fj_cpu.h_reverse_offsets[var_idx], fj_cpu.h_reverse_offsets[var_idx + 1]);
 }
 
-template <typename i_t, typename f_t>
-static inline std::pair<i_t, i_t> range_for_constraint(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
-                                                       i_t cstr_idx)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline std::pair<i_t, i_t> range_for_constraint(
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t cstr_idx)
 {
   return std::make_pair(fj_cpu.h_offsets[cstr_idx], fj_cpu.h_offsets[cstr_idx + 1]);
 }
 
-template <typename i_t, typename f_t>
-static inline bool check_variable_within_bounds(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+// Element reads that give a value for both memory policies, the counting ins_vector returns a proxy
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline typename type_2<f_t>::type get_var_bounds(
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t var_idx)
+{
+  return fj_cpu.h_var_bounds[var_idx];
+}
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline std::pair<f_t, f_t> get_cached_cstr_bounds(
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t i)
+{
+  return fj_cpu.cached_cstr_bounds[i];
+}
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline bool check_variable_within_bounds(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                                                 i_t var_idx,
                                                 f_t val)
 {
   const f_t int_tol  = fj_cpu.view.pb.tolerances.integrality_tolerance;
-  auto bounds        = fj_cpu.h_var_bounds[var_idx].get();
+  auto bounds        = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
   bool within_bounds = val <= (get_upper(bounds) + int_tol) && val >= (get_lower(bounds) - int_tol);
   return within_bounds;
 }
 
-template <typename i_t, typename f_t>
-static inline bool is_integer_var(fj_cpu_climber_t<i_t, f_t>& fj_cpu, i_t var_idx)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline bool is_integer_var(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t var_idx)
 {
   return var_t::INTEGER == fj_cpu.h_var_types[var_idx];
 }
 
-template <typename i_t, typename f_t>
-static inline bool tabu_check(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline bool tabu_check(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                               i_t var_idx,
                               f_t delta,
                               bool localmin = false)
@@ -533,8 +558,8 @@ static inline bool tabu_check(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   }
 }
 
-template <typename i_t, typename f_t>
-static bool check_variable_feasibility(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+template <typename i_t, typename f_t, typename memory_policy_t>
+static bool check_variable_feasibility(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                                        bool check_integer = true)
 {
   for (i_t var_idx = 0; var_idx < fj_cpu.view.pb.n_variables; var_idx += 1) {
@@ -549,10 +574,9 @@ static bool check_variable_feasibility(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   return true;
 }
 
-template <typename i_t, typename f_t>
-static inline std::pair<fj_staged_score_t, f_t> compute_score(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
-                                                              i_t var_idx,
-                                                              f_t delta)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static inline std::pair<fj_staged_score_t, f_t> compute_score(
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t var_idx, f_t delta)
 {
   // timing_raii_t<i_t, f_t> timer(fj_cpu.compute_score_times);
 
@@ -572,7 +596,7 @@ static inline std::pair<fj_staged_score_t, f_t> compute_score(fj_cpu_climber_t<i
     auto cstr_idx = fj_cpu.h_reverse_constraints[i];
     fj_cpu.unique_cstrs_accessed_window.insert(cstr_idx);
     auto cstr_coeff   = fj_cpu.h_reverse_coefficients[i];
-    auto [c_lb, c_ub] = fj_cpu.cached_cstr_bounds[i].get();
+    auto [c_lb, c_ub] = get_cached_cstr_bounds<i_t, f_t>(fj_cpu, i);
 
     cuopt_assert(c_lb <= c_ub, "invalid bounds");
 
@@ -614,8 +638,8 @@ static inline std::pair<fj_staged_score_t, f_t> compute_score(fj_cpu_climber_t<i
   return std::make_pair(score, base_feas_sum);
 }
 
-template <typename i_t, typename f_t>
-static void smooth_weights(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void smooth_weights(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   CPUFJ_NVTX_RANGE("CPUFJ::smooth_weights");
   for (i_t cstr_idx = 0; cstr_idx < fj_cpu.view.pb.n_constraints; cstr_idx++) {
@@ -634,8 +658,8 @@ static void smooth_weights(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   }
 }
 
-template <typename i_t, typename f_t>
-static void update_weights(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void update_weights(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   timing_raii_t<i_t, f_t> timer(fj_cpu.update_weights_times);
   CPUFJ_NVTX_RANGE("CPUFJ::update_weights");
@@ -690,8 +714,8 @@ static void update_weights(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   if (fj_cpu.violated_constraints.empty()) { fj_cpu.h_objective_weight += 1; }
 }
 
-template <typename i_t, typename f_t>
-static void apply_move(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void apply_move(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
                        i_t var_idx,
                        f_t delta,
                        bool localmin = false)
@@ -709,8 +733,8 @@ static void apply_move(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
     new_val = round(new_val);
   }
   // clamp to var bounds
-  new_val = std::min(std::max(new_val, get_lower(fj_cpu.h_var_bounds[var_idx].get())),
-                     get_upper(fj_cpu.h_var_bounds[var_idx].get()));
+  auto bounds = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
+  new_val     = std::min(std::max(new_val, get_lower(bounds)), get_upper(bounds));
   delta   = new_val - old_val;
   cuopt_assert(isfinite(new_val), "assignment is not finite");
   cuopt_assert(isfinite(delta), "applied delta is not finite");
@@ -728,7 +752,7 @@ static void apply_move(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
 
   for (auto i = offset_begin; i < offset_end; i++) {
     cuopt_assert(i < (i_t)fj_cpu.h_reverse_constraints.size(), "");
-    auto [c_lb, c_ub] = fj_cpu.cached_cstr_bounds[i].get();
+    auto [c_lb, c_ub] = get_cached_cstr_bounds<i_t, f_t>(fj_cpu, i);
 
     auto cstr_idx = fj_cpu.h_reverse_constraints[i];
     fj_cpu.unique_cstrs_accessed_window.insert(cstr_idx);
@@ -791,7 +815,7 @@ static void apply_move(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
       fj_cpu.iterations_since_best = 0;
       CUOPT_LOG_TRACE("%sCPUFJ: new best objective: %g",
                       fj_cpu.log_prefix.c_str(),
-                      fj_cpu.pb_ptr->get_user_obj_from_solver_obj(fj_cpu.h_incumbent_objective));
+                      get_user_objective(fj_cpu, fj_cpu.h_incumbent_objective));
       if (fj_cpu.improvement_callback) {
         double current_work_units = fj_cpu.work_units_elapsed.load(std::memory_order_acquire);
         fj_cpu.improvement_callback(
@@ -821,12 +845,13 @@ static void apply_move(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   fj_cpu.iter_mtm_vars.clear();
 }
 
-template <typename i_t, typename f_t, MTMMoveType move_type>
+template <typename i_t, typename f_t, MTMMoveType move_type, typename memory_policy_t>
 static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move(
-  fj_cpu_climber_t<i_t, f_t>& fj_cpu, const std::vector<i_t>& target_cstrs, bool localmin = false)
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+  const std::vector<i_t>& target_cstrs,
+  bool localmin = false)
 {
   CPUFJ_NVTX_RANGE("CPUFJ::find_mtm_move");
-  auto& problem = *fj_cpu.pb_ptr;
 
   raft::random::PCGenerator rng(fj_cpu.settings.seed + fj_cpu.iterations, 0, 0);
 
@@ -914,10 +939,9 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move(
           new_val = val + delta;
         }
         // fallback
-        if (new_val < get_lower(fj_cpu.h_var_bounds[var_idx].get()) ||
-            new_val > get_upper(fj_cpu.h_var_bounds[var_idx].get())) {
-          new_val = cstr_coeff * sign > 0 ? get_lower(fj_cpu.h_var_bounds[var_idx].get())
-                                          : get_upper(fj_cpu.h_var_bounds[var_idx].get());
+        auto bounds = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
+        if (new_val < get_lower(bounds) || new_val > get_upper(bounds)) {
+          new_val = cstr_coeff * sign > 0 ? get_lower(bounds) : get_upper(bounds);
         }
       }
       if (!isfinite(new_val)) continue;
@@ -984,9 +1008,9 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move(
   return thrust::make_tuple(best_move, best_score);
 }
 
-template <typename i_t, typename f_t>
+template <typename i_t, typename f_t, typename memory_policy_t>
 static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move_viol(
-  fj_cpu_climber_t<i_t, f_t>& fj_cpu, i_t sample_size = 100, bool localmin = false)
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t sample_size = 100, bool localmin = false)
 {
   timing_raii_t<i_t, f_t> timer(fj_cpu.find_mtm_move_viol_times);
   CPUFJ_NVTX_RANGE("CPUFJ::find_mtm_move_viol");
@@ -1002,9 +1026,9 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move_viol(
   return find_mtm_move<i_t, f_t, MTMMoveType::FJ_MTM_VIOLATED>(fj_cpu, sampled_cstrs, localmin);
 }
 
-template <typename i_t, typename f_t>
+template <typename i_t, typename f_t, typename memory_policy_t>
 static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move_sat(
-  fj_cpu_climber_t<i_t, f_t>& fj_cpu, i_t sample_size = 100)
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, i_t sample_size = 100)
 {
   timing_raii_t<i_t, f_t> timer(fj_cpu.find_mtm_move_sat_times);
   CPUFJ_NVTX_RANGE("CPUFJ::find_mtm_move_sat");
@@ -1020,17 +1044,17 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_mtm_move_sat(
   return find_mtm_move<i_t, f_t, MTMMoveType::FJ_MTM_SATISFIED>(fj_cpu, sampled_cstrs);
 }
 
-template <typename i_t, typename f_t>
-static void recompute_lhs(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void recompute_lhs(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   CPUFJ_NVTX_RANGE("CPUFJ::recompute_lhs");
   cuopt_assert(fj_cpu.h_lhs.size() == fj_cpu.view.pb.n_constraints, "h_lhs size mismatch");
 
   // clamp to var bounds - defensive; apply_move should already have clamped appropriately
   for (i_t var_idx = 0; var_idx < fj_cpu.view.pb.n_variables; ++var_idx) {
-    fj_cpu.h_assignment[var_idx] = std::min(
-      std::max(fj_cpu.h_assignment[var_idx].get(), get_lower(fj_cpu.h_var_bounds[var_idx].get())),
-      get_upper(fj_cpu.h_var_bounds[var_idx].get()));
+    auto bounds                  = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
+    fj_cpu.h_assignment[var_idx] = std::min<f_t>(
+      std::max<f_t>(fj_cpu.h_assignment[var_idx], get_lower(bounds)), get_upper(bounds));
   }
 
   fj_cpu.violated_constraints.clear();
@@ -1063,9 +1087,9 @@ static void recompute_lhs(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
     fj_cpu.h_assignment.begin(), fj_cpu.h_assignment.end(), fj_cpu.h_obj_coeffs.begin(), 0.);
 }
 
-template <typename i_t, typename f_t>
+template <typename i_t, typename f_t, typename memory_policy_t>
 static thrust::tuple<fj_move_t, fj_staged_score_t> find_lift_move(
-  fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+  fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   timing_raii_t<i_t, f_t> timer(fj_cpu.find_lift_move_times);
   CPUFJ_NVTX_RANGE("CPUFJ::find_lift_move");
@@ -1090,8 +1114,9 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_lift_move(
       // flip move wouldn't improve
       if (delta * obj_coeff >= 0) continue;
     } else {
-      f_t lfd_lb                      = get_lower(fj_cpu.h_var_bounds[var_idx].get()) - val;
-      f_t lfd_ub                      = get_upper(fj_cpu.h_var_bounds[var_idx].get()) - val;
+      auto bounds                     = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
+      f_t lfd_lb                      = get_lower(bounds) - val;
+      f_t lfd_ub                      = get_upper(bounds) - val;
       auto [offset_begin, offset_end] = reverse_range_for_var<i_t, f_t>(fj_cpu, var_idx);
       for (i_t j = offset_begin; j < offset_end; j += 1) {
         auto cstr_idx      = fj_cpu.h_reverse_constraints[j];
@@ -1173,8 +1198,8 @@ static thrust::tuple<fj_move_t, fj_staged_score_t> find_lift_move(
   return thrust::make_tuple(best_move, best_score);
 }
 
-template <typename i_t, typename f_t>
-static void perturb(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void perturb(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   CPUFJ_NVTX_RANGE("CPUFJ::perturb");
   // select N variables, assign them a random value between their bounds
@@ -1187,8 +1212,9 @@ static void perturb(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   raft::random::PCGenerator rng(fj_cpu.settings.seed + fj_cpu.iterations, 0, 0);
 
   for (auto var_idx : sampled_vars) {
-    f_t lb  = std::max(get_lower(fj_cpu.h_var_bounds[var_idx].get()), -1e7);
-    f_t ub  = std::min(get_upper(fj_cpu.h_var_bounds[var_idx].get()), 1e7);
+    auto bounds = get_var_bounds<i_t, f_t>(fj_cpu, var_idx);
+    f_t lb      = std::max(get_lower(bounds), -1e7);
+    f_t ub      = std::min(get_upper(bounds), 1e7);
     f_t val = lb + (ub - lb) * rng.next_double();
     if (is_integer_var<i_t, f_t>(fj_cpu, var_idx)) {
       lb  = std::ceil(lb);
@@ -1205,54 +1231,26 @@ static void perturb(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   recompute_lhs(fj_cpu);
 }
 
-template <typename i_t, typename f_t>
-static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
-                        solution_t<i_t, f_t>& solution,
-                        const std::vector<f_t>& left_weights,
-                        const std::vector<f_t>& right_weights,
-                        f_t objective_weight)
+// Sets up the climber state once the problem is in the host copies and in view.pb
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void init_fj_cpu_state(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                              const std::vector<f_t>& left_weights,
+                              const std::vector<f_t>& right_weights,
+                              f_t objective_weight,
+                              std::vector<f_t> h_assignment)
 {
-  auto& problem   = *solution.problem_ptr;
-  auto handle_ptr = solution.handle_ptr;
-
-  auto sol_copy = solution;
-  clamp_within_var_bounds(sol_copy.assignment, &problem, handle_ptr);
-
-  // build a cpu-based fj_view_t
-  fj_cpu.view    = typename fj_t<i_t, f_t>::climber_data_t::view_t{};
-  fj_cpu.view.pb = problem.view();
-  fj_cpu.pb_ptr  = &problem;
-  // Get host copies of device data
-  fj_cpu.h_reverse_coefficients =
-    cuopt::host_copy(problem.reverse_coefficients, handle_ptr->get_stream());
-  fj_cpu.h_reverse_constraints =
-    cuopt::host_copy(problem.reverse_constraints, handle_ptr->get_stream());
-  fj_cpu.h_reverse_offsets = cuopt::host_copy(problem.reverse_offsets, handle_ptr->get_stream());
-  fj_cpu.h_coefficients    = cuopt::host_copy(problem.coefficients, handle_ptr->get_stream());
-  fj_cpu.h_offsets         = cuopt::host_copy(problem.offsets, handle_ptr->get_stream());
-  fj_cpu.h_variables       = cuopt::host_copy(problem.variables, handle_ptr->get_stream());
-  fj_cpu.h_obj_coeffs = cuopt::host_copy(problem.objective_coefficients, handle_ptr->get_stream());
-  fj_cpu.h_var_bounds = cuopt::host_copy(problem.variable_bounds, handle_ptr->get_stream());
-  fj_cpu.h_cstr_lb    = cuopt::host_copy(problem.constraint_lower_bounds, handle_ptr->get_stream());
-  fj_cpu.h_cstr_ub    = cuopt::host_copy(problem.constraint_upper_bounds, handle_ptr->get_stream());
-  fj_cpu.h_var_types  = cuopt::host_copy(problem.variable_types, handle_ptr->get_stream());
-  fj_cpu.h_is_binary_variable =
-    cuopt::host_copy(problem.is_binary_variable, handle_ptr->get_stream());
-  fj_cpu.h_binary_indices = cuopt::host_copy(problem.binary_indices, handle_ptr->get_stream());
-
   fj_cpu.h_cstr_left_weights  = left_weights;
   fj_cpu.h_cstr_right_weights = right_weights;
   fj_cpu.max_weight           = 1.0;
   fj_cpu.h_objective_weight   = objective_weight;
-  auto h_assignment           = sol_copy.get_host_assignment();
   fj_cpu.h_assignment         = h_assignment;
   fj_cpu.h_best_assignment    = std::move(h_assignment);
-  fj_cpu.h_lhs.resize(fj_cpu.pb_ptr->n_constraints);
-  fj_cpu.h_lhs_sumcomp.resize(fj_cpu.pb_ptr->n_constraints, 0);
-  fj_cpu.h_tabu_nodec_until.resize(fj_cpu.pb_ptr->n_variables, 0);
-  fj_cpu.h_tabu_noinc_until.resize(fj_cpu.pb_ptr->n_variables, 0);
-  fj_cpu.h_tabu_lastdec.resize(fj_cpu.pb_ptr->n_variables, 0);
-  fj_cpu.h_tabu_lastinc.resize(fj_cpu.pb_ptr->n_variables, 0);
+  fj_cpu.h_lhs.resize(fj_cpu.view.pb.n_constraints);
+  fj_cpu.h_lhs_sumcomp.resize(fj_cpu.view.pb.n_constraints, 0);
+  fj_cpu.h_tabu_nodec_until.resize(fj_cpu.view.pb.n_variables, 0);
+  fj_cpu.h_tabu_noinc_until.resize(fj_cpu.view.pb.n_variables, 0);
+  fj_cpu.h_tabu_lastdec.resize(fj_cpu.view.pb.n_variables, 0);
+  fj_cpu.h_tabu_lastinc.resize(fj_cpu.view.pb.n_variables, 0);
   fj_cpu.iterations = 0;
 
   // set pointers to host copies
@@ -1305,10 +1303,10 @@ static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
     raft::device_span<i_t>(fj_cpu.h_reverse_offsets.data(), fj_cpu.h_reverse_offsets.size());
   fj_cpu.view.pb.objective_coefficients =
     raft::device_span<f_t>(fj_cpu.h_obj_coeffs.data(), fj_cpu.h_obj_coeffs.size());
-  fj_cpu.h_objective_vars.resize(problem.n_variables);
+  fj_cpu.h_objective_vars.resize(fj_cpu.view.pb.n_variables);
   auto end = std::copy_if(
     thrust::counting_iterator<i_t>(0),
-    thrust::counting_iterator<i_t>(problem.n_variables),
+    thrust::counting_iterator<i_t>(fj_cpu.view.pb.n_variables),
     fj_cpu.h_objective_vars.begin(),
     [&fj_cpu](i_t idx) { return !fj_cpu.view.pb.integer_equal(fj_cpu.h_obj_coeffs[idx], (f_t)0); });
   fj_cpu.h_objective_vars.resize(end - fj_cpu.h_objective_vars.begin());
@@ -1339,8 +1337,98 @@ static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t>& fj_cpu,
   precompute_problem_features(fj_cpu);
 }
 
-template <typename i_t, typename f_t>
-static void sanity_checks(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                        solution_t<i_t, f_t>& solution,
+                        const std::vector<f_t>& left_weights,
+                        const std::vector<f_t>& right_weights,
+                        f_t objective_weight)
+{
+  auto& problem   = *solution.problem_ptr;
+  auto handle_ptr = solution.handle_ptr;
+
+  auto sol_copy = solution;
+  clamp_within_var_bounds(sol_copy.assignment, &problem, handle_ptr);
+
+  // build a cpu-based fj_view_t
+  fj_cpu.view    = typename fj_t<i_t, f_t>::climber_data_t::view_t{};
+  fj_cpu.view.pb = problem.view();
+  // Get host copies of device data
+  fj_cpu.h_reverse_coefficients =
+    cuopt::host_copy(problem.reverse_coefficients, handle_ptr->get_stream());
+  fj_cpu.h_reverse_constraints =
+    cuopt::host_copy(problem.reverse_constraints, handle_ptr->get_stream());
+  fj_cpu.h_reverse_offsets = cuopt::host_copy(problem.reverse_offsets, handle_ptr->get_stream());
+  fj_cpu.h_coefficients    = cuopt::host_copy(problem.coefficients, handle_ptr->get_stream());
+  fj_cpu.h_offsets         = cuopt::host_copy(problem.offsets, handle_ptr->get_stream());
+  fj_cpu.h_variables       = cuopt::host_copy(problem.variables, handle_ptr->get_stream());
+  fj_cpu.h_obj_coeffs = cuopt::host_copy(problem.objective_coefficients, handle_ptr->get_stream());
+  fj_cpu.h_var_bounds = cuopt::host_copy(problem.variable_bounds, handle_ptr->get_stream());
+  fj_cpu.h_cstr_lb    = cuopt::host_copy(problem.constraint_lower_bounds, handle_ptr->get_stream());
+  fj_cpu.h_cstr_ub    = cuopt::host_copy(problem.constraint_upper_bounds, handle_ptr->get_stream());
+  fj_cpu.h_var_types  = cuopt::host_copy(problem.variable_types, handle_ptr->get_stream());
+  fj_cpu.h_is_binary_variable =
+    cuopt::host_copy(problem.is_binary_variable, handle_ptr->get_stream());
+  fj_cpu.h_binary_indices = cuopt::host_copy(problem.binary_indices, handle_ptr->get_stream());
+
+  init_fj_cpu_state(
+    fj_cpu, left_weights, right_weights, objective_weight, sol_copy.get_host_assignment());
+}
+
+// Same as above from a problem in host memory, with the unit weights of a fresh climber
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void init_fj_cpu(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                        const fj_cpu_host_problem_t<i_t, f_t>& problem,
+                        std::vector<f_t> h_assignment)
+{
+  cuopt_assert((i_t)h_assignment.size() == problem.n_variables, "Size mismatch!");
+  fj_cpu.view    = typename fj_t<i_t, f_t>::climber_data_t::view_t{};
+  fj_cpu.view.pb = typename problem_t<i_t, f_t>::view_t{};
+
+  auto& pb                            = fj_cpu.view.pb;
+  pb.n_variables                      = problem.n_variables;
+  pb.n_constraints                    = problem.n_constraints;
+  pb.tolerances.absolute_tolerance    = problem.absolute_tolerance;
+  pb.tolerances.relative_tolerance    = problem.relative_tolerance;
+  pb.tolerances.integrality_tolerance = problem.integrality_tolerance;
+  pb.objective_offset                 = problem.objective_offset;
+  pb.objective_scaling_factor         = problem.objective_scaling_factor;
+
+  fj_cpu.h_reverse_coefficients = problem.reverse_coefficients;
+  fj_cpu.h_reverse_constraints  = problem.reverse_constraints;
+  fj_cpu.h_reverse_offsets      = problem.reverse_offsets;
+  fj_cpu.h_coefficients         = problem.coefficients;
+  fj_cpu.h_offsets              = problem.offsets;
+  fj_cpu.h_variables            = problem.variables;
+  fj_cpu.h_obj_coeffs           = problem.objective_coefficients;
+  fj_cpu.h_cstr_lb              = problem.constraint_lower_bounds;
+  fj_cpu.h_cstr_ub              = problem.constraint_upper_bounds;
+  fj_cpu.h_var_bounds.resize(problem.n_variables);
+  fj_cpu.h_var_types.resize(problem.n_variables);
+  fj_cpu.h_is_binary_variable.resize(problem.n_variables);
+  fj_cpu.h_binary_indices.clear();
+  const f_t int_tol = problem.integrality_tolerance;
+  for (i_t j = 0; j < problem.n_variables; ++j) {
+    const f_t lower = problem.variable_lower_bounds[j];
+    const f_t upper = problem.variable_upper_bounds[j];
+    const bool is_binary =
+      problem.is_integer[j] && std::abs(lower) <= int_tol && std::abs(upper - 1) <= int_tol;
+    fj_cpu.h_var_bounds[j]         = typename type_2<f_t>::type{lower, upper};
+    fj_cpu.h_var_types[j]          = problem.is_integer[j] ? var_t::INTEGER : var_t::CONTINUOUS;
+    fj_cpu.h_is_binary_variable[j] = is_binary;
+    if (is_binary) { fj_cpu.h_binary_indices.push_back(j); }
+    h_assignment[j] = std::min(std::max(h_assignment[j], lower), upper);
+  }
+
+  init_fj_cpu_state(fj_cpu,
+                    std::vector<f_t>(problem.n_constraints, 1.),
+                    std::vector<f_t>(problem.n_constraints, 1.),
+                    (f_t)0,
+                    std::move(h_assignment));
+}
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void sanity_checks(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu)
 {
   // Check that each variable is within its bounds
   for (i_t var_idx = 0; var_idx < fj_cpu.view.pb.n_variables; ++var_idx) {
@@ -1385,8 +1473,20 @@ static void sanity_checks(fj_cpu_climber_t<i_t, f_t>& fj_cpu)
   cuopt_assert(fj_cpu.h_objective_weight >= 0, "Objective weight should be positive or zero");
 }
 
+template <typename i_t, typename f_t, typename memory_policy_t>
+static void randomize_sampling_params(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                                      int seed)
+{
+  auto rng                = std::mt19937(seed);
+  fj_cpu.mtm_viol_samples = std::uniform_int_distribution<i_t>(15, 50)(rng);
+  fj_cpu.mtm_sat_samples  = std::uniform_int_distribution<i_t>(10, 30)(rng);
+  fj_cpu.nnz_samples      = std::uniform_int_distribution<i_t>(2000, 15000)(rng);
+  fj_cpu.perturb_interval = std::uniform_int_distribution<i_t>(50, 500)(rng);
+}
+
 template <typename i_t, typename f_t>
-std::unique_ptr<fj_cpu_climber_t<i_t, f_t>> fj_t<i_t, f_t>::create_cpu_climber(
+template <typename memory_policy_t>
+std::unique_ptr<fj_cpu_climber_t<i_t, f_t, memory_policy_t>> fj_t<i_t, f_t>::create_cpu_climber(
   solution_t<i_t, f_t>& solution,
   const std::vector<f_t>& left_weights,
   const std::vector<f_t>& right_weights,
@@ -1397,24 +1497,20 @@ std::unique_ptr<fj_cpu_climber_t<i_t, f_t>> fj_t<i_t, f_t>::create_cpu_climber(
 {
   raft::common::nvtx::range scope("fj_cpu_init");
 
-  auto fj_cpu = std::make_unique<fj_cpu_climber_t<i_t, f_t>>(preemption_flag);
+  auto fj_cpu = std::make_unique<fj_cpu_climber_t<i_t, f_t, memory_policy_t>>(preemption_flag);
 
   // Initialize fj_cpu with all the data
   init_fj_cpu(*fj_cpu, solution, left_weights, right_weights, objective_weight);
   fj_cpu->settings = settings;
   if (randomize_params) {
-    auto rng                 = std::mt19937(cuopt::seed_generator::get_seed());
-    fj_cpu->mtm_viol_samples = std::uniform_int_distribution<i_t>(15, 50)(rng);
-    fj_cpu->mtm_sat_samples  = std::uniform_int_distribution<i_t>(10, 30)(rng);
-    fj_cpu->nnz_samples      = std::uniform_int_distribution<i_t>(2000, 15000)(rng);
-    fj_cpu->perturb_interval = std::uniform_int_distribution<i_t>(50, 500)(rng);
+    randomize_sampling_params(*fj_cpu, cuopt::seed_generator::get_seed());
   }
   fj_cpu->settings.seed = cuopt::seed_generator::get_seed();
   return fj_cpu;  // move
 }
 
-template <typename i_t, typename f_t>
-bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu, f_t in_time_limit)
+template <typename i_t, typename f_t, typename memory_policy_t>
+static bool cpu_solve_loop(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu, f_t in_time_limit)
 {
   raft::common::nvtx::range scope("fj_cpu");
 
@@ -1527,7 +1623,7 @@ bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu, f_t in_time_l
           ? fj_cpu.settings.iteration_limit
           : -1,
         local_mins,
-        fj_cpu.pb_ptr->get_user_obj_from_solver_obj(fj_cpu.h_best_objective),
+        get_user_objective(fj_cpu, fj_cpu.h_best_objective),
         fj_cpu.violated_constraints.size(),
         fj_cpu.h_objective_weight,
         fj_cpu.max_weight);
@@ -1546,18 +1642,21 @@ bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu, f_t in_time_l
     }
 #endif
 
-    if (fj_cpu.iterations % 100 == 0 && fj_cpu.iterations > 0) {
-      // Collect memory statistics
-      auto [loads, stores] = fj_cpu.memory_aggregator.collect();
+    // Only the counting climbers measure their work, the passthrough counters stay at zero
+    if constexpr (std::is_same_v<memory_policy_t, memory_counting_t>) {
+      if (fj_cpu.iterations % 100 == 0 && fj_cpu.iterations > 0) {
+        // Collect memory statistics
+        auto [loads, stores] = fj_cpu.memory_aggregator.collect();
 
-      double biased_work = (loads + stores) * fj_cpu.work_unit_bias / 1e10;
-      fj_cpu.work_units_elapsed += biased_work;
+        double biased_work = (loads + stores) * fj_cpu.work_unit_bias / 1e10;
+        fj_cpu.work_units_elapsed += biased_work;
 
-      if (fj_cpu.producer_sync != nullptr) { fj_cpu.producer_sync->notify_progress(); }
+        if (fj_cpu.producer_sync != nullptr) { fj_cpu.producer_sync->notify_progress(); }
 
-      CUOPT_LOG_TRACE("CPUFJ work units: %f incumbent %g",
-                      fj_cpu.work_units_elapsed.load(std::memory_order_relaxed),
-                      fj_cpu.pb_ptr->get_user_obj_from_solver_obj(fj_cpu.h_best_objective));
+        CUOPT_LOG_TRACE("CPUFJ work units: %f incumbent %g",
+                        fj_cpu.work_units_elapsed.load(std::memory_order_relaxed),
+                        get_user_objective(fj_cpu, fj_cpu.h_best_objective));
+      }
     }
 
     cuopt_func_call(sanity_checks(fj_cpu));
@@ -1582,45 +1681,114 @@ bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t>& fj_cpu, f_t in_time_l
 }
 
 template <typename i_t, typename f_t>
-cpu_fj_thread_t<i_t, f_t>::~cpu_fj_thread_t()
+template <typename memory_policy_t>
+bool fj_t<i_t, f_t>::cpu_solve(fj_cpu_climber_t<i_t, f_t, memory_policy_t>& fj_cpu,
+                               f_t in_time_limit)
+{
+  return cpu_solve_loop(fj_cpu, in_time_limit);
+}
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+cpu_fj_thread_t<i_t, f_t, memory_policy_t>::~cpu_fj_thread_t()
 {
   this->request_termination();
 }
 
-template <typename i_t, typename f_t>
-void cpu_fj_thread_t<i_t, f_t>::run_worker()
+template <typename i_t, typename f_t, typename memory_policy_t>
+void cpu_fj_thread_t<i_t, f_t, memory_policy_t>::run_worker()
 {
   bool solution_found   = fj_ptr->cpu_solve(*fj_cpu, time_limit);
   cpu_fj_solution_found = solution_found;
 }
 
-template <typename i_t, typename f_t>
-void cpu_fj_thread_t<i_t, f_t>::on_terminate()
+template <typename i_t, typename f_t, typename memory_policy_t>
+void cpu_fj_thread_t<i_t, f_t, memory_policy_t>::on_terminate()
 {
   if (fj_cpu) fj_cpu->halted = true;
 }
 
-template <typename i_t, typename f_t>
-void cpu_fj_thread_t<i_t, f_t>::on_start()
+template <typename i_t, typename f_t, typename memory_policy_t>
+void cpu_fj_thread_t<i_t, f_t, memory_policy_t>::on_start()
 {
   cuopt_assert(fj_cpu != nullptr, "fj_cpu must not be null");
   fj_cpu->halted = false;
 }
 
-template <typename i_t, typename f_t>
-void cpu_fj_thread_t<i_t, f_t>::stop_cpu_solver()
+template <typename i_t, typename f_t, typename memory_policy_t>
+void cpu_fj_thread_t<i_t, f_t, memory_policy_t>::stop_cpu_solver()
 {
   fj_cpu->halted = true;
 }
 
+template <typename i_t, typename f_t>
+fj_cpu_host_climber_t<i_t, f_t>::fj_cpu_host_climber_t(
+  const fj_cpu_host_problem_t<i_t, f_t>& problem,
+  const std::vector<f_t>& initial_assignment,
+  int seed,
+  bool randomize_params,
+  callback_t improvement_callback)
+  : climber_(std::make_unique<fj_cpu_climber_t<i_t, f_t, memory_passthrough_t>>(preemption_flag_))
+{
+  init_fj_cpu(*climber_, problem, initial_assignment);
+  if (randomize_params) { randomize_sampling_params(*climber_, seed); }
+  climber_->settings.seed = seed;
+  if (improvement_callback) {
+    climber_->improvement_callback =
+      [callback = std::move(improvement_callback)](
+        f_t objective, const std::vector<f_t>& assignment, double) {
+        callback(objective, assignment);
+      };
+  }
+}
+
+template <typename i_t, typename f_t>
+fj_cpu_host_climber_t<i_t, f_t>::~fj_cpu_host_climber_t() = default;
+
+template <typename i_t, typename f_t>
+bool fj_cpu_host_climber_t<i_t, f_t>::solve(f_t time_limit)
+{
+  return cpu_solve_loop(*climber_, time_limit);
+}
+
+template <typename i_t, typename f_t>
+void fj_cpu_host_climber_t<i_t, f_t>::stop()
+{
+  climber_->halted = true;
+}
+
+template <typename i_t, typename f_t>
+int64_t fj_cpu_host_climber_t<i_t, f_t>::num_iterations() const
+{
+  return climber_->iterations;
+}
+
+#define INSTANTIATE_CPU_FJ(F_TYPE, MEMORY_POLICY)                                        \
+  template std::unique_ptr<fj_cpu_climber_t<int, F_TYPE, MEMORY_POLICY>>                \
+  fj_t<int, F_TYPE>::create_cpu_climber<MEMORY_POLICY>(solution_t<int, F_TYPE>&,        \
+                                                       const std::vector<F_TYPE>&,      \
+                                                       const std::vector<F_TYPE>&,      \
+                                                       F_TYPE,                          \
+                                                       std::atomic<bool>&,              \
+                                                       fj_settings_t,                   \
+                                                       bool);                           \
+  template bool fj_t<int, F_TYPE>::cpu_solve<MEMORY_POLICY>(                            \
+    fj_cpu_climber_t<int, F_TYPE, MEMORY_POLICY>&, F_TYPE);                             \
+  template class cpu_fj_thread_t<int, F_TYPE, MEMORY_POLICY>;
+
 #if MIP_INSTANTIATE_FLOAT
 template class fj_t<int, float>;
-template class cpu_fj_thread_t<int, float>;
+template class fj_cpu_host_climber_t<int, float>;
+INSTANTIATE_CPU_FJ(float, memory_counting_t)
+INSTANTIATE_CPU_FJ(float, memory_passthrough_t)
 #endif
 
 #if MIP_INSTANTIATE_DOUBLE
 template class fj_t<int, double>;
-template class cpu_fj_thread_t<int, double>;
+template class fj_cpu_host_climber_t<int, double>;
+INSTANTIATE_CPU_FJ(double, memory_counting_t)
+INSTANTIATE_CPU_FJ(double, memory_passthrough_t)
 #endif
 
+#undef INSTANTIATE_CPU_FJ
+
 }  // namespace cuopt::linear_programming::detail
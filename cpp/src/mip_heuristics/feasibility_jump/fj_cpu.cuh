@@ -25,7 +25,10 @@ namespace cuopt::linear_programming::detail {
 
 // NOTE: this seems an easy pick for reflection/xmacros once this is available (C++26?)
 // Maintaining a single source of truth for all members would be nice
-template <typename i_t, typename f_t>
+// memory_policy_t selects whether the accesses to the ins_vector members are counted, see
+// utilities/memory_instrumentation.hpp. The counts drive the work units of the deterministic
+// mode; the other climbers use the passthrough variant.
+template <typename i_t, typename f_t, typename memory_policy_t>
 struct fj_cpu_climber_t {
   fj_cpu_climber_t(std::atomic<bool>& preemption_flag) : preemption_flag(preemption_flag)
   {
@@ -62,43 +65,42 @@ struct fj_cpu_climber_t {
 
 #undef ADD_INSTRUMENTED
   }
-  fj_cpu_climber_t(const fj_cpu_climber_t<i_t, f_t>& other)                      = delete;
-  fj_cpu_climber_t<i_t, f_t>& operator=(const fj_cpu_climber_t<i_t, f_t>& other) = delete;
+  fj_cpu_climber_t(const fj_cpu_climber_t& other)            = delete;
+  fj_cpu_climber_t& operator=(const fj_cpu_climber_t& other) = delete;
 
-  fj_cpu_climber_t(fj_cpu_climber_t<i_t, f_t>&& other)                      = default;
-  fj_cpu_climber_t<i_t, f_t>& operator=(fj_cpu_climber_t<i_t, f_t>&& other) = default;
+  fj_cpu_climber_t(fj_cpu_climber_t&& other)            = default;
+  fj_cpu_climber_t& operator=(fj_cpu_climber_t&& other) = default;
 
-  problem_t<i_t, f_t>* pb_ptr;
   fj_settings_t settings;
   typename fj_t<i_t, f_t>::climber_data_t::view_t view;
   // Host copies of device data as struct members
-  ins_vector<f_t> h_reverse_coefficients;
-  ins_vector<i_t> h_reverse_constraints;
-  ins_vector<i_t> h_reverse_offsets;
-  ins_vector<f_t> h_coefficients;
-  ins_vector<i_t> h_offsets;
-  ins_vector<i_t> h_variables;
-  ins_vector<f_t> h_obj_coeffs;
-  ins_vector<typename type_2<f_t>::type> h_var_bounds;
-  ins_vector<f_t> h_cstr_lb;
-  ins_vector<f_t> h_cstr_ub;
-  ins_vector<var_t> h_var_types;
-  ins_vector<i_t> h_is_binary_variable;
-  ins_vector<i_t> h_objective_vars;
-  ins_vector<i_t> h_binary_indices;
-
-  ins_vector<i_t> h_tabu_nodec_until;
-  ins_vector<i_t> h_tabu_noinc_until;
-  ins_vector<i_t> h_tabu_lastdec;
-  ins_vector<i_t> h_tabu_lastinc;
-
-  ins_vector<f_t> h_lhs;
-  ins_vector<f_t> h_lhs_sumcomp;
-  ins_vector<f_t> h_cstr_left_weights;
-  ins_vector<f_t> h_cstr_right_weights;
+  ins_vector<f_t, memory_policy_t> h_reverse_coefficients;
+  ins_vector<i_t, memory_policy_t> h_reverse_constraints;
+  ins_vector<i_t, memory_policy_t> h_reverse_offsets;
+  ins_vector<f_t, memory_policy_t> h_coefficients;
+  ins_vector<i_t, memory_policy_t> h_offsets;
+  ins_vector<i_t, memory_policy_t> h_variables;
+  ins_vector<f_t, memory_policy_t> h_obj_coeffs;
+  ins_vector<typename type_2<f_t>::type, memory_policy_t> h_var_bounds;
+  ins_vector<f_t, memory_policy_t> h_cstr_lb;
+  ins_vector<f_t, memory_policy_t> h_cstr_ub;
+  ins_vector<var_t, memory_policy_t> h_var_types;
+  ins_vector<i_t, memory_policy_t> h_is_binary_variable;
+  ins_vector<i_t, memory_policy_t> h_objective_vars;
+  ins_vector<i_t, memory_policy_t> h_binary_indices;
+
+  ins_vector<i_t, memory_policy_t> h_tabu_nodec_until;
+  ins_vector<i_t, memory_policy_t> h_tabu_noinc_until;
+  ins_vector<i_t, memory_policy_t> h_tabu_lastdec;
+  ins_vector<i_t, memory_policy_t> h_tabu_lastinc;
+
+  ins_vector<f_t, memory_policy_t> h_lhs;
+  ins_vector<f_t, memory_policy_t> h_lhs_sumcomp;
+  ins_vector<f_t, memory_policy_t> h_cstr_left_weights;
+  ins_vector<f_t, memory_policy_t> h_cstr_right_weights;
   f_t max_weight;
-  ins_vector<f_t> h_assignment;
-  ins_vector<f_t> h_best_assignment;
+  ins_vector<f_t, memory_policy_t> h_assignment;
+  ins_vector<f_t, memory_policy_t> h_best_assignment;
   f_t h_objective_weight;
   f_t h_incumbent_objective;
   f_t h_best_objective;
@@ -132,10 +134,10 @@ struct fj_cpu_climber_t {
 
   // CSC (transposed!) nnz-offset-indexed constraint bounds (lb, ub)
   // std::pair<f_t, f_t> better compile down to 16 bytes!! GCC do your job!
-  ins_vector<std::pair<f_t, f_t>> cached_cstr_bounds;
+  ins_vector<std::pair<f_t, f_t>, memory_policy_t> cached_cstr_bounds;
 
   std::vector<bool> var_bitmap;
-  ins_vector<i_t> iter_mtm_vars;
+  ins_vector<i_t, memory_policy_t> iter_mtm_vars;
 
   i_t mtm_viol_samples{25};
   i_t mtm_sat_samples{15};
@@ -193,8 +195,9 @@ struct fj_cpu_climber_t {
   std::atomic<bool>& preemption_flag;
 };
 
-template <typename i_t, typename f_t>
-struct cpu_fj_thread_t : public cpu_worker_thread_base_t<cpu_fj_thread_t<i_t, f_t>> {
+template <typename i_t, typename f_t, typename memory_policy_t = default_memory_policy_t>
+struct cpu_fj_thread_t
+  : public cpu_worker_thread_base_t<cpu_fj_thread_t<i_t, f_t, memory_policy_t>> {
   ~cpu_fj_thread_t();
 
   void run_worker();
@@ -206,7 +209,7 @@ struct cpu_fj_thread_t : public cpu_worker_thread_base_t<cpu_fj_thread_t<i_t, f_
 
   std::atomic<bool> cpu_fj_solution_found{false};
   f_t time_limit{+std::numeric_limits<f_t>::infinity()};
-  std::unique_ptr<fj_cpu_climber_t<i_t, f_t>> fj_cpu;
+  std::unique_ptr<fj_cpu_climber_t<i_t, f_t, memory_policy_t>> fj_cpu;
   fj_t<i_t, f_t>* fj_ptr{nullptr};
 };
 
@@ -0,0 +1,84 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <utilities/memory_instrumentation.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cuopt::linear_programming::detail {
+
+template <typename i_t, typename f_t, typename memory_policy_t>
+struct fj_cpu_climber_t;
+
+// Problem of a CPU climber in host memory, for the callers that do not have a problem_t, e.g.,
+// the B&B of dual_simplex::solve on machines without a GPU. The layout is the one of problem_t:
+// the constraints are lower <= a'x <= upper, and the objective is minimized.
+template <typename i_t, typename f_t>
+struct fj_cpu_host_problem_t {
+  i_t n_variables{0};
+  i_t n_constraints{0};
+
+  // Rows (CSR) and columns (CSC) of the constraint matrix
+  std::vector<i_t> offsets;
+  std::vector<i_t> variables;
+  std::vector<f_t> coefficients;
+  std::vector<i_t> reverse_offsets;
+  std::vector<i_t> reverse_constraints;
+  std::vector<f_t> reverse_coefficients;
+
+  std::vector<f_t> constraint_lower_bounds;
+  std::vector<f_t> constraint_upper_bounds;
+  std::vector<f_t> variable_lower_bounds;
+  std::vector<f_t> variable_upper_bounds;
+  std::vector<bool> is_integer;
+  std::vector<f_t> objective_coefficients;
+
+  // The user objective is objective_scaling_factor * (c'x + objective_offset)
+  f_t objective_offset{0};
+  f_t objective_scaling_factor{1};
+
+  f_t absolute_tolerance{1e-6};
+  f_t relative_tolerance{1e-12};
+  f_t integrality_tolerance{1e-5};
+};
+
+// fj_cpu_climber_t started from an assignment of a host problem. Only uses host memory, and its
+// interface does not need the CUDA headers.
+template <typename i_t, typename f_t>
+class fj_cpu_host_climber_t {
+ public:
+  // Receives the objective, in the sense of c'x, and the assignment of every improving solution
+  using callback_t = std::function<void(f_t, const std::vector<f_t>&)>;
+
+  // The climber copies `problem`. `seed` drives its moves, and its sampling parameters too when
+  // `randomize_params` is set, which diversifies the climbers run side by side.
+  fj_cpu_host_climber_t(const fj_cpu_host_problem_t<i_t, f_t>& problem,
+                        const std::vector<f_t>& initial_assignment,
+                        int seed,
+                        bool randomize_params,
+                        callback_t improvement_callback);
+  ~fj_cpu_host_climber_t();
+
+  // Runs until `stop` is called or the time limit, in seconds, is reached. Returns true if a
+  // feasible solution was found.
+  bool solve(f_t time_limit);
+  void stop();
+
+  int64_t num_iterations() const;
+
+ private:
+  std::atomic<bool> preemption_flag_{false};
+  std::unique_ptr<fj_cpu_climber_t<i_t, f_t, memory_passthrough_t>> climber_;
+};
+
+}  // namespace cuopt::linear_programming::detail
@@ -161,7 +161,8 @@ void local_search_t<i_t, f_t>::start_cpufj_deterministic(
   solution.clamp_within_bounds();
 
   deterministic_cpu_fj.fj_ptr = &fj;
-  deterministic_cpu_fj.fj_cpu = fj.create_cpu_climber(solution,
+  deterministic_cpu_fj.fj_cpu =
+    fj.template create_cpu_climber<memory_counting_t>(solution,
                                                       default_weights,
                                                       default_weights,
                                                       0.,
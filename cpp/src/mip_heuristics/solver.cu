@@ -219,7 +219,8 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
     }
     branch_and_bound_settings.mixed_integer_gomory_cuts =
       context.settings.mixed_integer_gomory_cuts;
-    branch_and_bound_settings.knapsack_cuts = context.settings.knapsack_cuts;
+    branch_and_bound_settings.knapsack_cuts   = context.settings.knapsack_cuts;
+    branch_and_bound_settings.flow_cover_cuts = context.settings.flow_cover_cuts;
     branch_and_bound_settings.strong_chvatal_gomory_cuts =
       context.settings.strong_chvatal_gomory_cuts;
     branch_and_bound_settings.reduced_cost_strengthening =
@@ -228,6 +229,11 @@ solution_t<i_t, f_t> mip_solver_t<i_t, f_t>::run_solver()
     branch_and_bound_settings.cut_min_orthogonality = context.settings.cut_min_orthogonality;
     branch_and_bound_settings.mip_batch_pdlp_strong_branching =
       context.settings.mip_batch_pdlp_strong_branching;
+    branch_and_bound_settings.tree_trace_file     = context.settings.tree_trace_file;
+    branch_and_bound_settings.node_memory_limit   = context.settings.node_memory_limit;
+    branch_and_bound_settings.checkpoint_file     = context.settings.checkpoint_file;
+    branch_and_bound_settings.checkpoint_interval = context.settings.checkpoint_interval;
+    branch_and_bound_settings.resume_file         = context.settings.resume_file;
 
     if (context.settings.num_cpu_threads < 0) {
       branch_and_bound_settings.num_threads = std::max(1, omp_get_max_threads() - 1);
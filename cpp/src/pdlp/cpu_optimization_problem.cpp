@@ -563,6 +563,32 @@ std::vector<var_t> cpu_optimization_problem_t<i_t, f_t>::get_variable_types_host
   return variable_types_;
 }
 
+template <typename i_t, typename f_t>
+typename cpu_optimization_problem_t<i_t, f_t>::view_t cpu_optimization_problem_t<i_t, f_t>::view()
+  const
+{
+  cpu_optimization_problem_t<i_t, f_t>::view_t v;
+  v.n_vars                  = get_n_variables();
+  v.n_constraints           = get_n_constraints();
+  v.A                       = raft::host_span<const f_t>{A_.data(), A_.size()};
+  v.A_indices               = raft::host_span<const i_t>{A_indices_.data(), A_indices_.size()};
+  v.A_offsets               = raft::host_span<const i_t>{A_offsets_.data(), A_offsets_.size()};
+  v.b                       = raft::host_span<const f_t>{b_.data(), b_.size()};
+  v.row_types               = raft::host_span<const char>{row_types_.data(), row_types_.size()};
+  v.c                       = raft::host_span<const f_t>{c_.data(), c_.size()};
+  v.variable_lower_bounds   = raft::host_span<const f_t>{variable_lower_bounds_.data(),
+                                                       variable_lower_bounds_.size()};
+  v.variable_upper_bounds   = raft::host_span<const f_t>{variable_upper_bounds_.data(),
+                                                       variable_upper_bounds_.size()};
+  v.variable_types          = raft::host_span<const var_t>{variable_types_.data(),
+                                                         variable_types_.size()};
+  v.constraint_lower_bounds = raft::host_span<const f_t>{constraint_lower_bounds_.data(),
+                                                         constraint_lower_bounds_.size()};
+  v.constraint_upper_bounds = raft::host_span<const f_t>{constraint_upper_bounds_.data(),
+                                                         constraint_upper_bounds_.size()};
+  return v;
+}
+
 // ==============================================================================
 // Conversion to optimization_problem_t
 // ==============================================================================
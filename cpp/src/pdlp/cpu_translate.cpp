@@ -0,0 +1,187 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/cpu_translate.hpp>
+
+#include <dual_simplex/sparse_matrix.hpp>
+
+#include <cuopt/error.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace cuopt::linear_programming {
+
+namespace {
+
+template <typename T>
+std::vector<T> to_vector(raft::host_span<const T> values)
+{
+  return std::vector<T>(values.data(), values.data() + values.size());
+}
+
+}  // namespace
+
+template <typename i_t, typename f_t>
+void check_cpu_problem_representation(const cpu_optimization_problem_t<i_t, f_t>& problem)
+{
+  const auto view = problem.view();
+  const i_t m     = view.n_constraints;
+  const i_t n     = view.n_vars;
+
+  cuopt_expects(view.A.size() == view.A_indices.size(),
+                error_type_t::ValidationError,
+                "A_values and A_indices must have the same size");
+  if (!view.A_offsets.empty()) {
+    cuopt_expects(static_cast<i_t>(view.A_offsets.size()) == m + 1,
+                  error_type_t::ValidationError,
+                  "A_offsets must have one more entry than the number of constraints");
+    cuopt_expects(view.A_offsets[0] == 0,
+                  error_type_t::ValidationError,
+                  "A_offsets first value should be 0");
+    cuopt_expects(std::is_sorted(view.A_offsets.begin(), view.A_offsets.end()),
+                  error_type_t::ValidationError,
+                  "A_offsets values must be in an increasing order");
+    cuopt_expects(static_cast<size_t>(view.A_offsets[m]) == view.A_indices.size(),
+                  error_type_t::ValidationError,
+                  "The last A_offsets value must be the number of nonzeros");
+  } else {
+    cuopt_expects(view.A_indices.empty(),
+                  error_type_t::ValidationError,
+                  "A_offsets must be set when the matrix has nonzeros");
+  }
+  cuopt_expects(std::all_of(view.A_indices.begin(),
+                            view.A_indices.end(),
+                            [n](i_t j) { return j >= 0 && j < n; }),
+                error_type_t::ValidationError,
+                "A_indices values must be nonnegative and lower than the number of variables");
+
+  cuopt_expects(static_cast<i_t>(view.c.size()) == n,
+                error_type_t::ValidationError,
+                "Sizes for vectors related to the variables are not the same");
+  for (const auto& bounds : {view.variable_lower_bounds, view.variable_upper_bounds}) {
+    cuopt_expects(bounds.empty() || static_cast<i_t>(bounds.size()) == n,
+                  error_type_t::ValidationError,
+                  "Sizes for vectors related to the variables are not the same");
+  }
+  cuopt_expects(view.variable_types.empty() || static_cast<i_t>(view.variable_types.size()) == n,
+                error_type_t::ValidationError,
+                "Sizes for vectors related to the variables are not the same");
+  for (const auto& bounds : {view.constraint_lower_bounds, view.constraint_upper_bounds}) {
+    cuopt_expects(bounds.empty() || static_cast<i_t>(bounds.size()) == m,
+                  error_type_t::ValidationError,
+                  "Sizes for vectors related to the constraints are not the same");
+  }
+}
+
+template <typename i_t, typename f_t>
+dual_simplex::user_problem_t<i_t, f_t> cpu_problem_to_simplex_problem(
+  const cpu_optimization_problem_t<i_t, f_t>& problem)
+{
+  constexpr f_t inf = std::numeric_limits<f_t>::infinity();
+
+  cuopt_expects(problem.get_quadratic_objective_values().empty(),
+                error_type_t::ValidationError,
+                "Quadratic objectives are not supported by the dual simplex solvers");
+
+  dual_simplex::user_problem_t<i_t, f_t> user_problem(nullptr);
+  const auto view = problem.view();
+  const i_t m     = view.n_constraints;
+  const i_t n     = view.n_vars;
+
+  if (view.A_offsets.empty()) {
+    user_problem.A.resize(m, n, 0);
+    std::fill(user_problem.A.col_start.begin(), user_problem.A.col_start.end(), 0);
+  } else {
+    dual_simplex::csr_to_csc(
+      m, n, view.A_offsets.data(), view.A_indices.data(), view.A.data(), user_problem.A);
+  }
+
+  const bool maximize       = problem.get_sense();
+  user_problem.num_rows     = m;
+  user_problem.num_cols     = n;
+  user_problem.objective    = to_vector(view.c);
+  user_problem.obj_scale    = problem.get_objective_scaling_factor();
+  user_problem.obj_constant = problem.get_objective_offset();
+  if (maximize) {
+    for (auto& c : user_problem.objective) {
+      c = -c;
+    }
+    user_problem.obj_scale    = -user_problem.obj_scale;
+    user_problem.obj_constant = -user_problem.obj_constant;
+  }
+
+  const bool has_constraint_bounds =
+    !view.constraint_lower_bounds.empty() && !view.constraint_upper_bounds.empty();
+  if (!has_constraint_bounds) {
+    cuopt_expects(static_cast<i_t>(view.b.size()) == m &&
+                    static_cast<i_t>(view.row_types.size()) == m,
+                  error_type_t::ValidationError,
+                  "Constraint bounds or a right-hand side with row types must be set");
+  }
+
+  user_problem.rhs.resize(m);
+  user_problem.row_sense.resize(m);
+  for (i_t i = 0; i < m; ++i) {
+    f_t constraint_lower;
+    f_t constraint_upper;
+    if (has_constraint_bounds) {
+      constraint_lower = view.constraint_lower_bounds[i];
+      constraint_upper = view.constraint_upper_bounds[i];
+    } else {
+      const char row_type = view.row_types[i];
+      cuopt_expects(row_type == 'E' || row_type == 'L' || row_type == 'G',
+                    error_type_t::ValidationError,
+                    "Row type must be 'E', 'L' or 'G'");
+      constraint_lower = row_type == 'L' ? -inf : view.b[i];
+      constraint_upper = row_type == 'G' ? inf : view.b[i];
+    }
+
+    if (constraint_lower == constraint_upper) {
+      user_problem.row_sense[i] = 'E';
+      user_problem.rhs[i]       = constraint_lower;
+    } else if (constraint_upper == inf) {
+      user_problem.row_sense[i] = 'G';
+      user_problem.rhs[i]       = constraint_lower;
+    } else if (constraint_lower == -inf) {
+      user_problem.row_sense[i] = 'L';
+      user_problem.rhs[i]       = constraint_upper;
+    } else {
+      // This is range row
+      user_problem.row_sense[i] = 'E';
+      user_problem.rhs[i]       = constraint_lower;
+      user_problem.range_rows.push_back(i);
+      user_problem.range_value.push_back(constraint_upper - constraint_lower);
+    }
+  }
+  user_problem.num_range_rows = user_problem.range_rows.size();
+
+  user_problem.lower = view.variable_lower_bounds.empty() ? std::vector<f_t>(n, 0.0)
+                                                          : to_vector(view.variable_lower_bounds);
+  user_problem.upper = view.variable_upper_bounds.empty() ? std::vector<f_t>(n, inf)
+                                                          : to_vector(view.variable_upper_bounds);
+
+  user_problem.var_types.assign(n, dual_simplex::variable_type_t::CONTINUOUS);
+  for (i_t j = 0; j < static_cast<i_t>(view.variable_types.size()) && j < n; ++j) {
+    if (view.variable_types[j] == var_t::INTEGER) {
+      user_problem.var_types[j] = dual_simplex::variable_type_t::INTEGER;
+    }
+  }
+
+  user_problem.problem_name = problem.get_problem_name();
+  user_problem.row_names    = problem.get_row_names();
+  user_problem.col_names    = problem.get_variable_names();
+  return user_problem;
+}
+
+template void check_cpu_problem_representation(
+  const cpu_optimization_problem_t<int, double>& problem);
+
+template dual_simplex::user_problem_t<int, double> cpu_problem_to_simplex_problem(
+  const cpu_optimization_problem_t<int, double>& problem);
+
+}  // namespace cuopt::linear_programming
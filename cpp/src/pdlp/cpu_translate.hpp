@@ -0,0 +1,31 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/cpu_optimization_problem.hpp>
+
+#include <dual_simplex/user_problem.hpp>
+
+namespace cuopt::linear_programming {
+
+// Host counterpart of problem_checking_t::check_problem_representation: checks the sizes of the
+// problem arrays and that the CSR matrix is well formed, so that the conversion below can index
+// it safely. Throws a ValidationError otherwise.
+template <typename i_t, typename f_t>
+void check_cpu_problem_representation(const cpu_optimization_problem_t<i_t, f_t>& problem);
+
+// Converts the host problem to the form used by the dual simplex, barrier and branch and bound
+// solvers. Follows cuopt_problem_to_simplex_problem, including the default variable bounds of
+// [0, inf) and the negated objective of a maximization problem. The problem arrays are borrowed
+// through its view, so the conversion makes a single copy of the constraint matrix, in CSC form.
+// The solvers still make their own copies: each branch and bound worker owns one for its leaf LP.
+template <typename i_t, typename f_t>
+dual_simplex::user_problem_t<i_t, f_t> cpu_problem_to_simplex_problem(
+  const cpu_optimization_problem_t<i_t, f_t>& problem);
+
+}  // namespace cuopt::linear_programming
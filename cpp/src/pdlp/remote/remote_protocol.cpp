@@ -0,0 +1,377 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/remote/remote_protocol.hpp>
+
+#include <cuopt/error.hpp>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+namespace cuopt::linear_programming::remote {
+
+const uint8_t* byte_reader_t::consume(size_t bytes)
+{
+  cuopt_expects(bytes <= size_ - offset_,
+                error_type_t::ValidationError,
+                "Remote message is truncated: need %zu bytes at offset %zu of %zu",
+                bytes,
+                offset_,
+                size_);
+  const uint8_t* start = data_ + offset_;
+  offset_ += bytes;
+  return start;
+}
+
+void byte_reader_t::check_count(uint64_t count, size_t element_size) const
+{
+  // Reject counts that cannot fit in the rest of the payload before allocating for them
+  cuopt_expects(count <= (size_ - offset_) / element_size,
+                error_type_t::ValidationError,
+                "Remote message is truncated: array of %llu elements at offset %zu of %zu",
+                static_cast<unsigned long long>(count),
+                offset_,
+                size_);
+}
+
+template <typename i_t, typename f_t>
+void serialize_problem(const cpu_optimization_problem_t<i_t, f_t>& problem, byte_writer_t& out)
+{
+  // The arrays are borrowed through the problem view and the buffer is sized up front, so
+  // the request is the only extra copy of the problem
+  const auto view = problem.view();
+  const size_t problem_bytes =
+    (view.A.size() + view.b.size() + view.c.size() + view.constraint_lower_bounds.size() +
+     view.constraint_upper_bounds.size() + view.variable_lower_bounds.size() +
+     view.variable_upper_bounds.size()) *
+      sizeof(f_t) +
+    (view.A_indices.size() + view.A_offsets.size()) * sizeof(i_t) + view.row_types.size() +
+    view.variable_types.size() * sizeof(var_t);
+  out.buffer.reserve(out.buffer.size() + problem_bytes);
+
+  out.write<uint8_t>(problem.get_sense());
+  out.write<int8_t>(static_cast<int8_t>(problem.get_problem_category()));
+  out.write<f_t>(problem.get_objective_scaling_factor());
+  out.write<f_t>(problem.get_objective_offset());
+  out.write_span(view.c);
+  out.write_span(view.A);
+  out.write_span(view.A_indices);
+  out.write_span(view.A_offsets);
+  out.write_span(view.b);
+  out.write_span(view.row_types);
+  out.write_span(view.constraint_lower_bounds);
+  out.write_span(view.constraint_upper_bounds);
+  out.write_span(view.variable_lower_bounds);
+  out.write_span(view.variable_upper_bounds);
+  out.write_span(view.variable_types);
+  out.write_vector(problem.get_quadratic_objective_values());
+  out.write_vector(problem.get_quadratic_objective_indices());
+  out.write_vector(problem.get_quadratic_objective_offsets());
+  out.write_string(problem.get_objective_name());
+  out.write_string(problem.get_problem_name());
+  out.write_strings(problem.get_variable_names());
+  out.write_strings(problem.get_row_names());
+}
+
+template <typename i_t, typename f_t>
+void deserialize_problem(byte_reader_t& in, cpu_optimization_problem_t<i_t, f_t>& problem)
+{
+  // Every array is handed to the problem as soon as it is read, so only one temporary array is
+  // alive at a time instead of a second copy of the whole problem
+  problem.set_maximize(in.read<uint8_t>() != 0);
+  const auto category = static_cast<problem_category_t>(in.read<int8_t>());
+  problem.set_objective_scaling_factor(in.read<f_t>());
+  problem.set_objective_offset(in.read<f_t>());
+  {
+    const auto c = in.read_vector<f_t>();
+    if (!c.empty()) { problem.set_objective_coefficients(c.data(), c.size()); }
+  }
+  {
+    const auto A_values  = in.read_vector<f_t>();
+    const auto A_indices = in.read_vector<i_t>();
+    const auto A_offsets = in.read_vector<i_t>();
+    if (!A_offsets.empty()) {
+      problem.set_csr_constraint_matrix(A_values.data(),
+                                        A_values.size(),
+                                        A_indices.data(),
+                                        A_indices.size(),
+                                        A_offsets.data(),
+                                        A_offsets.size());
+    }
+  }
+  {
+    const auto b = in.read_vector<f_t>();
+    if (!b.empty()) { problem.set_constraint_bounds(b.data(), b.size()); }
+  }
+  {
+    const auto row_types = in.read_vector<char>();
+    if (!row_types.empty()) { problem.set_row_types(row_types.data(), row_types.size()); }
+  }
+  {
+    const auto constraint_l = in.read_vector<f_t>();
+    problem.set_constraint_lower_bounds(constraint_l.data(), constraint_l.size());
+  }
+  {
+    const auto constraint_u = in.read_vector<f_t>();
+    problem.set_constraint_upper_bounds(constraint_u.data(), constraint_u.size());
+  }
+  {
+    const auto variable_l = in.read_vector<f_t>();
+    problem.set_variable_lower_bounds(variable_l.data(), variable_l.size());
+  }
+  {
+    const auto variable_u = in.read_vector<f_t>();
+    problem.set_variable_upper_bounds(variable_u.data(), variable_u.size());
+  }
+  {
+    const auto var_types = in.read_vector<var_t>();
+    if (!var_types.empty()) { problem.set_variable_types(var_types.data(), var_types.size()); }
+  }
+  {
+    const auto Q_values  = in.read_vector<f_t>();
+    const auto Q_indices = in.read_vector<i_t>();
+    const auto Q_offsets = in.read_vector<i_t>();
+    if (!Q_values.empty()) {
+      problem.set_quadratic_objective_matrix(Q_values.data(),
+                                             Q_values.size(),
+                                             Q_indices.data(),
+                                             Q_indices.size(),
+                                             Q_offsets.data(),
+                                             Q_offsets.size());
+    }
+  }
+  problem.set_problem_category(category);
+  problem.set_objective_name(in.read_string());
+  problem.set_problem_name(in.read_string());
+  problem.set_variable_names(in.read_strings());
+  problem.set_row_names(in.read_strings());
+}
+
+template <typename i_t, typename f_t>
+void serialize_lp_settings(const lp_request_settings_t<i_t, f_t>& settings, byte_writer_t& out)
+{
+  out.write(settings);
+}
+
+template <typename i_t, typename f_t>
+lp_request_settings_t<i_t, f_t> deserialize_lp_settings(byte_reader_t& in)
+{
+  return in.read<lp_request_settings_t<i_t, f_t>>();
+}
+
+template <typename i_t, typename f_t>
+void serialize_mip_settings(const mip_request_settings_t<i_t, f_t>& settings, byte_writer_t& out)
+{
+  out.write(settings);
+}
+
+template <typename i_t, typename f_t>
+mip_request_settings_t<i_t, f_t> deserialize_mip_settings(byte_reader_t& in)
+{
+  return in.read<mip_request_settings_t<i_t, f_t>>();
+}
+
+template <typename i_t, typename f_t>
+void serialize_lp_result(const lp_result_t<i_t, f_t>& result, byte_writer_t& out)
+{
+  out.write(result.termination_status);
+  out.write(result.error_type);
+  out.write_string(result.error_message);
+  out.write_vector(result.primal_solution);
+  out.write_vector(result.dual_solution);
+  out.write_vector(result.reduced_cost);
+  out.write(result.primal_objective);
+  out.write(result.dual_objective);
+  out.write(result.l2_primal_residual);
+  out.write(result.l2_dual_residual);
+  out.write(result.gap);
+  out.write(result.solve_time);
+  out.write(result.num_iterations);
+  out.write(result.solved_by_pdlp);
+}
+
+template <typename i_t, typename f_t>
+lp_result_t<i_t, f_t> deserialize_lp_result(byte_reader_t& in)
+{
+  lp_result_t<i_t, f_t> result;
+  result.termination_status = in.read<int32_t>();
+  result.error_type         = in.read<int32_t>();
+  result.error_message      = in.read_string();
+  result.primal_solution    = in.read_vector<f_t>();
+  result.dual_solution      = in.read_vector<f_t>();
+  result.reduced_cost       = in.read_vector<f_t>();
+  result.primal_objective   = in.read<f_t>();
+  result.dual_objective     = in.read<f_t>();
+  result.l2_primal_residual = in.read<f_t>();
+  result.l2_dual_residual   = in.read<f_t>();
+  result.gap                = in.read<f_t>();
+  result.solve_time         = in.read<double>();
+  result.num_iterations     = in.read<i_t>();
+  result.solved_by_pdlp     = in.read<uint8_t>();
+  return result;
+}
+
+template <typename i_t, typename f_t>
+void serialize_mip_result(const mip_result_t<i_t, f_t>& result, byte_writer_t& out)
+{
+  out.write(result.termination_status);
+  out.write(result.error_type);
+  out.write_string(result.error_message);
+  out.write_vector(result.solution);
+  out.write(result.objective);
+  out.write(result.mip_gap);
+  out.write(result.solution_bound);
+  out.write(result.total_solve_time);
+  out.write(result.presolve_time);
+  out.write(result.max_constraint_violation);
+  out.write(result.max_int_violation);
+  out.write(result.max_variable_bound_violation);
+  out.write(result.num_nodes);
+  out.write(result.num_simplex_iterations);
+}
+
+template <typename i_t, typename f_t>
+mip_result_t<i_t, f_t> deserialize_mip_result(byte_reader_t& in)
+{
+  mip_result_t<i_t, f_t> result;
+  result.termination_status           = in.read<int32_t>();
+  result.error_type                   = in.read<int32_t>();
+  result.error_message                = in.read_string();
+  result.solution                     = in.read_vector<f_t>();
+  result.objective                    = in.read<f_t>();
+  result.mip_gap                      = in.read<f_t>();
+  result.solution_bound               = in.read<f_t>();
+  result.total_solve_time             = in.read<double>();
+  result.presolve_time                = in.read<double>();
+  result.max_constraint_violation     = in.read<f_t>();
+  result.max_int_violation            = in.read<f_t>();
+  result.max_variable_bound_violation = in.read<f_t>();
+  result.num_nodes                    = in.read<i_t>();
+  result.num_simplex_iterations       = in.read<i_t>();
+  return result;
+}
+
+template <typename i_t, typename f_t>
+void serialize_incumbent(const incumbent_t<i_t, f_t>& incumbent, byte_writer_t& out)
+{
+  out.write(incumbent.objective);
+  out.write(incumbent.solution_bound);
+  out.write_vector(incumbent.solution);
+}
+
+template <typename i_t, typename f_t>
+incumbent_t<i_t, f_t> deserialize_incumbent(byte_reader_t& in)
+{
+  incumbent_t<i_t, f_t> incumbent;
+  incumbent.objective      = in.read<f_t>();
+  incumbent.solution_bound = in.read<f_t>();
+  incumbent.solution       = in.read_vector<f_t>();
+  return incumbent;
+}
+
+namespace {
+
+bool send_all(int fd, const uint8_t* data, size_t size)
+{
+  while (size > 0) {
+    const ssize_t sent = ::send(fd, data, size, MSG_NOSIGNAL);
+    if (sent < 0 && errno == EINTR) { continue; }
+    if (sent <= 0) { return false; }
+    data += sent;
+    size -= sent;
+  }
+  return true;
+}
+
+bool receive_all(int fd, uint8_t* data, size_t size)
+{
+  while (size > 0) {
+    const ssize_t received = ::recv(fd, data, size, 0);
+    if (received < 0 && errno == EINTR) { continue; }
+    if (received <= 0) { return false; }
+    data += received;
+    size -= received;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool send_message(int fd, message_type_t type, const std::vector<uint8_t>& payload)
+{
+  message_header_t header;
+  header.magic   = protocol_magic;
+  header.version = protocol_version;
+  header.type    = static_cast<uint16_t>(type);
+  header.size    = payload.size();
+  return send_all(fd, reinterpret_cast<const uint8_t*>(&header), sizeof(header)) &&
+         send_all(fd, payload.data(), payload.size());
+}
+
+bool receive_message(int fd,
+                     message_type_t& type,
+                     std::vector<uint8_t>& payload,
+                     uint64_t max_size)
+{
+  message_header_t header;
+  if (!receive_all(fd, reinterpret_cast<uint8_t*>(&header), sizeof(header))) { return false; }
+  if (header.magic != protocol_magic || header.version != protocol_version) { return false; }
+  if (header.size > max_size) { return false; }
+  type = static_cast<message_type_t>(header.type);
+  payload.resize(header.size);
+  return receive_all(fd, payload.data(), payload.size());
+}
+
+int connect_to_server(const std::string& host, const std::string& port, std::string& error_message)
+{
+  addrinfo hints{};
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* addresses{nullptr};
+  const int status = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+  if (status != 0) {
+    error_message = "Unable to resolve " + host + ":" + port + ": " + gai_strerror(status);
+    return -1;
+  }
+  int fd = -1;
+  for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+    fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (fd < 0) { continue; }
+    if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) { break; }
+    ::close(fd);
+    fd = -1;
+  }
+  ::freeaddrinfo(addresses);
+  if (fd < 0) {
+    error_message = "Unable to connect to remote solver at " + host + ":" + port;
+    return -1;
+  }
+  const int no_delay = 1;
+  ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+  return fd;
+}
+
+template void serialize_problem(const cpu_optimization_problem_t<int, double>&, byte_writer_t&);
+template void deserialize_problem(byte_reader_t&, cpu_optimization_problem_t<int, double>&);
+template void serialize_lp_settings(const lp_request_settings_t<int, double>&, byte_writer_t&);
+template lp_request_settings_t<int, double> deserialize_lp_settings<int, double>(byte_reader_t&);
+template void serialize_mip_settings(const mip_request_settings_t<int, double>&, byte_writer_t&);
+template mip_request_settings_t<int, double> deserialize_mip_settings<int, double>(byte_reader_t&);
+template void serialize_lp_result(const lp_result_t<int, double>&, byte_writer_t&);
+template lp_result_t<int, double> deserialize_lp_result<int, double>(byte_reader_t&);
+template void serialize_mip_result(const mip_result_t<int, double>&, byte_writer_t&);
+template mip_result_t<int, double> deserialize_mip_result<int, double>(byte_reader_t&);
+template void serialize_incumbent(const incumbent_t<int, double>&, byte_writer_t&);
+template incumbent_t<int, double> deserialize_incumbent<int, double>(byte_reader_t&);
+
+}  // namespace cuopt::linear_programming::remote
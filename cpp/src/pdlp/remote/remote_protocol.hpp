@@ -0,0 +1,293 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <cuopt/linear_programming/cpu_optimization_problem.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cuopt::linear_programming::remote {
+
+// Wire protocol between solve_lp_remote / solve_mip_remote and remote_server_t.
+//
+// Every message is a fixed size message_header_t followed by `size` bytes of payload. Scalars
+// and arrays are written in host byte order; the magic number lets the receiver reject a peer
+// with a different byte order or a different protocol. A client sends exactly one SOLVE_LP or
+// SOLVE_MIP request per connection and then reads LOG and INCUMBENT messages until it receives
+// the final LP_RESULT, MIP_RESULT or ERROR message.
+
+constexpr uint32_t protocol_magic   = 0x54504f43;  // "COPT"
+constexpr uint16_t protocol_version = 1;
+
+// Largest payload accepted by receive_message unless the caller passes another limit
+constexpr uint64_t default_max_message_size = uint64_t{16} << 30;  // 16 GiB
+
+enum class message_type_t : uint16_t {
+  SOLVE_LP   = 1,  // client -> server: problem and LP settings
+  SOLVE_MIP  = 2,  // client -> server: problem and MIP settings
+  LOG        = 3,  // server -> client: one line of solver output
+  INCUMBENT  = 4,  // server -> client: improved MIP solution
+  LP_RESULT  = 5,  // server -> client: final LP solution
+  MIP_RESULT = 6,  // server -> client: final MIP solution
+  ERROR      = 7   // server -> client: the request could not be solved
+};
+
+struct message_header_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t type;
+  uint64_t size;
+};
+
+// Appends scalars, arrays and strings to a growing byte buffer
+class byte_writer_t {
+ public:
+  template <typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  template <typename T>
+  void write_array(const T* data, size_t count)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    write<uint64_t>(count);
+    if (count == 0) { return; }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + count * sizeof(T));
+  }
+
+  template <typename T>
+  void write_vector(const std::vector<T>& values)
+  {
+    write_array(values.data(), values.size());
+  }
+
+  template <typename T>
+  void write_span(raft::host_span<const T> values)
+  {
+    write_array(values.data(), values.size());
+  }
+
+  void write_string(const std::string& value) { write_array(value.data(), value.size()); }
+
+  void write_strings(const std::vector<std::string>& values)
+  {
+    write<uint64_t>(values.size());
+    for (const auto& value : values) {
+      write_string(value);
+    }
+  }
+
+  std::vector<uint8_t> buffer;
+};
+
+// Reads back what byte_writer_t wrote. Throws a ValidationError if the payload is truncated
+class byte_reader_t {
+ public:
+  byte_reader_t(const uint8_t* data, size_t size) : data_(data), size_(size), offset_(0) {}
+
+  template <typename T>
+  T read()
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  std::vector<T> read_vector()
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const uint64_t count = read<uint64_t>();
+    check_count(count, sizeof(T));
+    std::vector<T> values(count);
+    if (count > 0) { std::memcpy(values.data(), consume(count * sizeof(T)), count * sizeof(T)); }
+    return values;
+  }
+
+  std::string read_string()
+  {
+    const uint64_t count = read<uint64_t>();
+    check_count(count, 1);
+    const auto* bytes = reinterpret_cast<const char*>(consume(count));
+    return std::string(bytes, count);
+  }
+
+  std::vector<std::string> read_strings()
+  {
+    const uint64_t count = read<uint64_t>();
+    check_count(count, sizeof(uint64_t));
+    std::vector<std::string> values(count);
+    for (auto& value : values) {
+      value = read_string();
+    }
+    return values;
+  }
+
+  bool at_end() const { return offset_ == size_; }
+
+ private:
+  const uint8_t* consume(size_t bytes);
+  void check_count(uint64_t count, size_t element_size) const;
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_;
+};
+
+// The subset of pdlp_solver_settings_t that is meaningful to a remote solver
+template <typename i_t, typename f_t>
+struct lp_request_settings_t {
+  f_t absolute_dual_tolerance{1.0e-4};
+  f_t relative_dual_tolerance{1.0e-4};
+  f_t absolute_primal_tolerance{1.0e-4};
+  f_t relative_primal_tolerance{1.0e-4};
+  f_t absolute_gap_tolerance{1.0e-4};
+  f_t relative_gap_tolerance{1.0e-4};
+  f_t time_limit{std::numeric_limits<f_t>::infinity()};
+  i_t iteration_limit{std::numeric_limits<i_t>::max()};
+  int32_t method{0};
+  int32_t presolver{0};
+  i_t folding{-1};
+  i_t augmented{-1};
+  i_t dualize{-1};
+  i_t ordering{-1};
+  i_t cpu_barrier{-1};
+  i_t barrier_dual_initial_point{-1};
+  i_t parallel_crossover{0};
+  uint8_t crossover{0};
+  uint8_t eliminate_dense_columns{1};
+  uint8_t detect_infeasibility{0};
+  uint8_t dual_postsolve{1};
+  uint8_t problem_checking{1};
+  uint8_t use_pdlp_solver_mode{1};
+};
+
+// The subset of mip_solver_settings_t that is meaningful to a remote solver
+template <typename i_t, typename f_t>
+struct mip_request_settings_t {
+  f_t absolute_tolerance{1.0e-6};
+  f_t relative_tolerance{1.0e-12};
+  f_t integrality_tolerance{1.0e-5};
+  f_t absolute_mip_gap{1.0e-10};
+  f_t relative_mip_gap{1.0e-4};
+  f_t time_limit{std::numeric_limits<f_t>::infinity()};
+  f_t work_limit{std::numeric_limits<f_t>::infinity()};
+  f_t cut_change_threshold{1e-3};
+  f_t cut_min_orthogonality{0.5};
+  i_t node_limit{std::numeric_limits<i_t>::max()};
+  i_t reliability_branching{-1};
+  i_t num_cpu_threads{-1};
+  i_t max_cut_passes{10};
+  i_t mir_cuts{-1};
+  i_t mixed_integer_gomory_cuts{-1};
+  i_t knapsack_cuts{-1};
+  i_t flow_cover_cuts{-1};
+  i_t strong_chvatal_gomory_cuts{-1};
+  i_t reduced_cost_strengthening{-1};
+  int32_t determinism_mode{0};
+  i_t seed{-1};
+  uint8_t stream_incumbents{0};  // true if the client registered a get-solution callback
+};
+
+template <typename i_t, typename f_t>
+struct lp_result_t {
+  int32_t termination_status{0};  // pdlp_termination_status_t
+  int32_t error_type{0};          // cuopt::error_type_t
+  std::string error_message;
+  std::vector<f_t> primal_solution;
+  std::vector<f_t> dual_solution;
+  std::vector<f_t> reduced_cost;
+  f_t primal_objective{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t dual_objective{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t l2_primal_residual{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t l2_dual_residual{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t gap{std::numeric_limits<f_t>::quiet_NaN()};
+  double solve_time{0.0};
+  i_t num_iterations{0};
+  uint8_t solved_by_pdlp{0};
+};
+
+template <typename i_t, typename f_t>
+struct mip_result_t {
+  int32_t termination_status{0};  // mip_termination_status_t
+  int32_t error_type{0};          // cuopt::error_type_t
+  std::string error_message;
+  std::vector<f_t> solution;
+  f_t objective{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t mip_gap{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t solution_bound{std::numeric_limits<f_t>::quiet_NaN()};
+  double total_solve_time{0.0};
+  double presolve_time{0.0};
+  f_t max_constraint_violation{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t max_int_violation{std::numeric_limits<f_t>::quiet_NaN()};
+  f_t max_variable_bound_violation{std::numeric_limits<f_t>::quiet_NaN()};
+  i_t num_nodes{0};
+  i_t num_simplex_iterations{0};
+};
+
+template <typename i_t, typename f_t>
+struct incumbent_t {
+  f_t objective;
+  f_t solution_bound;
+  std::vector<f_t> solution;
+};
+
+template <typename i_t, typename f_t>
+void serialize_problem(const cpu_optimization_problem_t<i_t, f_t>& problem, byte_writer_t& out);
+template <typename i_t, typename f_t>
+void deserialize_problem(byte_reader_t& in, cpu_optimization_problem_t<i_t, f_t>& problem);
+
+template <typename i_t, typename f_t>
+void serialize_lp_settings(const lp_request_settings_t<i_t, f_t>& settings, byte_writer_t& out);
+template <typename i_t, typename f_t>
+lp_request_settings_t<i_t, f_t> deserialize_lp_settings(byte_reader_t& in);
+
+template <typename i_t, typename f_t>
+void serialize_mip_settings(const mip_request_settings_t<i_t, f_t>& settings, byte_writer_t& out);
+template <typename i_t, typename f_t>
+mip_request_settings_t<i_t, f_t> deserialize_mip_settings(byte_reader_t& in);
+
+template <typename i_t, typename f_t>
+void serialize_lp_result(const lp_result_t<i_t, f_t>& result, byte_writer_t& out);
+template <typename i_t, typename f_t>
+lp_result_t<i_t, f_t> deserialize_lp_result(byte_reader_t& in);
+
+template <typename i_t, typename f_t>
+void serialize_mip_result(const mip_result_t<i_t, f_t>& result, byte_writer_t& out);
+template <typename i_t, typename f_t>
+mip_result_t<i_t, f_t> deserialize_mip_result(byte_reader_t& in);
+
+template <typename i_t, typename f_t>
+void serialize_incumbent(const incumbent_t<i_t, f_t>& incumbent, byte_writer_t& out);
+template <typename i_t, typename f_t>
+incumbent_t<i_t, f_t> deserialize_incumbent(byte_reader_t& in);
+
+// Blocking socket helpers. They return false if the peer closed the connection or on an I/O
+// error; receive_message also returns false on a header with the wrong magic or version, or
+// announcing a payload larger than max_size, before allocating it
+bool send_message(int fd, message_type_t type, const std::vector<uint8_t>& payload);
+bool receive_message(int fd,
+                     message_type_t& type,
+                     std::vector<uint8_t>& payload,
+                     uint64_t max_size = default_max_message_size);
+
+// Opens a TCP connection to host:port. Returns -1 and sets error_message on failure
+int connect_to_server(const std::string& host, const std::string& port, std::string& error_message);
+
+}  // namespace cuopt::linear_programming::remote
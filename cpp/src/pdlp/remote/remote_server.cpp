@@ -0,0 +1,572 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <pdlp/cpu_translate.hpp>
+#include <pdlp/remote/remote_protocol.hpp>
+#include <pdlp/remote/remote_server.hpp>
+
+#include <branch_and_bound/branch_and_bound.hpp>
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/solution.hpp>
+#include <dual_simplex/solve.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+#include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/user_problem.hpp>
+
+#include <cuopt/error.hpp>
+#include <cuopt/linear_programming/constants.h>
+#include <utilities/logger.hpp>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace cuopt::linear_programming::remote {
+
+namespace {
+
+using i_t = int;
+using f_t = double;
+
+constexpr f_t inf = std::numeric_limits<f_t>::infinity();
+
+// Serializes sends on one connection: the solver may log and report incumbents from several
+// threads while the request is being solved
+class connection_t {
+ public:
+  explicit connection_t(int fd) : fd_(fd) {}
+
+  bool send(message_type_t type, const std::vector<uint8_t>& payload)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (broken_) { return false; }
+    broken_ = !send_message(fd_, type, payload);
+    return !broken_;
+  }
+
+  void send_log(const char* line)
+  {
+    byte_writer_t out;
+    out.write_string(line);
+    send(message_type_t::LOG, out.buffer);
+  }
+
+  void send_error(error_type_t error_type, const std::string& message)
+  {
+    byte_writer_t out;
+    out.write<int32_t>(static_cast<int32_t>(error_type));
+    out.write_string(message);
+    send(message_type_t::ERROR, out.buffer);
+  }
+
+ private:
+  int fd_;
+  bool broken_{false};
+  std::mutex mutex_;
+};
+
+int32_t to_termination_status(dual_simplex::lp_status_t status)
+{
+  switch (status) {
+    case dual_simplex::lp_status_t::OPTIMAL: return CUOPT_TERIMINATION_STATUS_OPTIMAL;
+    case dual_simplex::lp_status_t::INFEASIBLE: return CUOPT_TERIMINATION_STATUS_INFEASIBLE;
+    case dual_simplex::lp_status_t::UNBOUNDED: return CUOPT_TERIMINATION_STATUS_UNBOUNDED;
+    case dual_simplex::lp_status_t::TIME_LIMIT: return CUOPT_TERIMINATION_STATUS_TIME_LIMIT;
+    case dual_simplex::lp_status_t::ITERATION_LIMIT:
+      return CUOPT_TERIMINATION_STATUS_ITERATION_LIMIT;
+    case dual_simplex::lp_status_t::CONCURRENT_LIMIT:
+      return CUOPT_TERIMINATION_STATUS_CONCURRENT_LIMIT;
+    default: return CUOPT_TERIMINATION_STATUS_NUMERICAL_ERROR;
+  }
+}
+
+int32_t to_termination_status(dual_simplex::mip_status_t status, bool has_incumbent)
+{
+  switch (status) {
+    case dual_simplex::mip_status_t::OPTIMAL: return CUOPT_TERIMINATION_STATUS_OPTIMAL;
+    case dual_simplex::mip_status_t::INFEASIBLE: return CUOPT_TERIMINATION_STATUS_INFEASIBLE;
+    case dual_simplex::mip_status_t::UNBOUNDED: return CUOPT_TERIMINATION_STATUS_UNBOUNDED;
+    case dual_simplex::mip_status_t::TIME_LIMIT:
+    case dual_simplex::mip_status_t::NODE_LIMIT:
+      return has_incumbent ? CUOPT_TERIMINATION_STATUS_FEASIBLE_FOUND
+                           : CUOPT_TERIMINATION_STATUS_TIME_LIMIT;
+    case dual_simplex::mip_status_t::WORK_LIMIT:
+      return has_incumbent ? CUOPT_TERIMINATION_STATUS_FEASIBLE_FOUND
+                           : CUOPT_TERIMINATION_STATUS_WORK_LIMIT;
+    default:
+      return has_incumbent ? CUOPT_TERIMINATION_STATUS_FEASIBLE_FOUND
+                           : CUOPT_TERIMINATION_STATUS_NO_TERMINATION;
+  }
+}
+
+f_t user_objective(const dual_simplex::user_problem_t<i_t, f_t>& user_problem, f_t objective)
+{
+  return user_problem.obj_scale * (objective + user_problem.obj_constant);
+}
+
+// Same definition as compute_rel_mip_gap
+f_t relative_mip_gap(f_t user_obj, f_t solution_bound)
+{
+  if (std::abs(user_obj) <= 1e-6) { return std::abs(solution_bound) <= 1e-6 ? 0.0 : inf; }
+  return std::abs(user_obj - solution_bound) / std::abs(user_obj);
+}
+
+// The server solves LPs with dual simplex or the CPU barrier. Settings that only PDLP or the GPU
+// presolvers use are rejected rather than ignored, so a client does not get an answer computed
+// with settings other than the ones it asked for
+void check_lp_request(const lp_request_settings_t<i_t, f_t>& request)
+{
+  cuopt_expects(request.method != CUOPT_METHOD_PDLP,
+                error_type_t::ValidationError,
+                "PDLP is not available on the remote server, use dual simplex or barrier");
+  cuopt_expects(
+    request.presolver == CUOPT_PRESOLVE_DEFAULT || request.presolver == CUOPT_PRESOLVE_OFF,
+    error_type_t::ValidationError,
+    "Presolver %d is not available on the remote server",
+    request.presolver);
+  const lp_request_settings_t<i_t, f_t> defaults;
+  cuopt_expects(request.absolute_dual_tolerance == defaults.absolute_dual_tolerance &&
+                  request.absolute_primal_tolerance == defaults.absolute_primal_tolerance &&
+                  request.absolute_gap_tolerance == defaults.absolute_gap_tolerance,
+                error_type_t::ValidationError,
+                "Absolute tolerances are only used by PDLP, which is not available on the remote "
+                "server");
+}
+
+lp_result_t<i_t, f_t> solve_lp(const dual_simplex::user_problem_t<i_t, f_t>& user_problem,
+                               bool maximize,
+                               f_t start_time,
+                               const lp_request_settings_t<i_t, f_t>& request,
+                               std::atomic<int>* halt,
+                               connection_t& connection)
+{
+
+  dual_simplex::simplex_solver_settings_t<i_t, f_t> settings;
+  settings.time_limit         = request.time_limit;
+  settings.iteration_limit    = request.iteration_limit;
+  settings.concurrent_halt    = halt;
+  settings.log.log_to_console = false;
+  settings.log.log_callback   = [&connection](const char* line) { connection.send_log(line); };
+
+  dual_simplex::lp_solution_t<i_t, f_t> solution(user_problem.num_rows, user_problem.num_cols);
+  dual_simplex::lp_status_t status;
+  if (request.method == CUOPT_METHOD_BARRIER) {
+    settings.barrier                             = true;
+    settings.cpu_barrier                         = 1;
+    settings.folding                             = request.folding;
+    settings.augmented                           = request.augmented;
+    settings.dualize                             = request.dualize;
+    settings.ordering                            = request.ordering;
+    settings.barrier_dual_initial_point          = request.barrier_dual_initial_point;
+    settings.crossover                           = request.crossover;
+    settings.parallel_crossover                  = request.parallel_crossover;
+    settings.eliminate_dense_columns             = request.eliminate_dense_columns;
+    settings.barrier_relaxed_feasibility_tol     = request.relative_primal_tolerance;
+    settings.barrier_relaxed_optimality_tol      = request.relative_dual_tolerance;
+    settings.barrier_relaxed_complementarity_tol = request.relative_gap_tolerance;
+    status = dual_simplex::solve_linear_program_with_barrier(user_problem, settings, solution);
+  } else {
+    if (request.method == CUOPT_METHOD_CONCURRENT) {
+      connection.send_log("Concurrent runs dual simplex only on the remote server\n");
+    }
+    status = dual_simplex::solve_linear_program(user_problem, settings, solution);
+  }
+
+  lp_result_t<i_t, f_t> result;
+  result.termination_status = to_termination_status(status);
+  result.error_type         = static_cast<int32_t>(error_type_t::Success);
+  result.primal_solution    = std::move(solution.x);
+  result.dual_solution      = std::move(solution.y);
+  result.reduced_cost       = std::move(solution.z);
+  if (maximize) {
+    // Negate dual variables and reduced costs for maximization problems
+    for (auto& y : result.dual_solution) {
+      y = -y;
+    }
+    for (auto& z : result.reduced_cost) {
+      z = -z;
+    }
+  }
+  result.primal_objective   = solution.user_objective;
+  result.dual_objective     = solution.user_objective;
+  result.l2_primal_residual = solution.l2_primal_residual;
+  result.l2_dual_residual   = solution.l2_dual_residual;
+  result.gap                = 0.0;
+  result.solve_time         = dual_simplex::toc(start_time);
+  result.num_iterations     = solution.iterations;
+  result.solved_by_pdlp     = false;
+  return result;
+}
+
+// Maximum violations of the constraints, integrality and variable bounds of x
+void compute_violations(const dual_simplex::user_problem_t<i_t, f_t>& user_problem,
+                        const std::vector<f_t>& x,
+                        mip_result_t<i_t, f_t>& result)
+{
+  std::vector<f_t> Ax(user_problem.num_rows, 0.0);
+  dual_simplex::matrix_vector_multiply(user_problem.A, 1.0, x, 0.0, Ax);
+
+  std::vector<f_t> range(user_problem.num_rows, 0.0);
+  for (i_t k = 0; k < user_problem.num_range_rows; ++k) {
+    range[user_problem.range_rows[k]] = user_problem.range_value[k];
+  }
+  f_t constraint_violation = 0.0;
+  for (i_t i = 0; i < user_problem.num_rows; ++i) {
+    const char sense = user_problem.row_sense[i];
+    const f_t rhs    = user_problem.rhs[i];
+    const f_t lower  = sense == 'L' ? -inf : rhs;
+    const f_t upper  = sense == 'G' ? inf : rhs + range[i];
+    constraint_violation = std::max({constraint_violation, lower - Ax[i], Ax[i] - upper});
+  }
+
+  f_t int_violation   = 0.0;
+  f_t bound_violation = 0.0;
+  for (i_t j = 0; j < user_problem.num_cols; ++j) {
+    bound_violation =
+      std::max({bound_violation, user_problem.lower[j] - x[j], x[j] - user_problem.upper[j]});
+    if (user_problem.var_types[j] == dual_simplex::variable_type_t::INTEGER) {
+      int_violation = std::max(int_violation, std::abs(x[j] - std::round(x[j])));
+    }
+  }
+  result.max_constraint_violation     = constraint_violation;
+  result.max_int_violation            = int_violation;
+  result.max_variable_bound_violation = bound_violation;
+}
+
+mip_result_t<i_t, f_t> solve_mip(const dual_simplex::user_problem_t<i_t, f_t>& user_problem,
+                                 bool maximize,
+                                 f_t start_time,
+                                 const mip_request_settings_t<i_t, f_t>& request,
+                                 connection_t& connection)
+{
+
+  dual_simplex::simplex_solver_settings_t<i_t, f_t> settings;
+  settings.time_limit                 = request.time_limit;
+  settings.node_limit                 = request.node_limit;
+  settings.print_presolve_stats       = false;
+  settings.absolute_mip_gap_tol       = request.absolute_mip_gap;
+  settings.relative_mip_gap_tol       = request.relative_mip_gap;
+  settings.integer_tol                = request.integrality_tolerance;
+  settings.reliability_branching      = request.reliability_branching;
+  settings.max_cut_passes             = request.max_cut_passes;
+  settings.mir_cuts                   = request.mir_cuts;
+  settings.mixed_integer_gomory_cuts  = request.mixed_integer_gomory_cuts;
+  settings.knapsack_cuts              = request.knapsack_cuts;
+  settings.flow_cover_cuts            = request.flow_cover_cuts;
+  settings.strong_chvatal_gomory_cuts = request.strong_chvatal_gomory_cuts;
+  settings.reduced_cost_strengthening = request.reduced_cost_strengthening;
+  settings.cut_change_threshold       = request.cut_change_threshold;
+  settings.cut_min_orthogonality      = request.cut_min_orthogonality;
+  settings.deterministic              = request.determinism_mode == CUOPT_MODE_DETERMINISTIC;
+  settings.work_limit = settings.deterministic ? request.work_limit : inf;
+  if (request.seed >= 0) { settings.random_seed = request.seed; }
+  if (request.num_cpu_threads < 0) {
+    settings.num_threads = std::max(1, omp_get_max_threads() - 1);
+  } else {
+    settings.num_threads = std::max(1, request.num_cpu_threads);
+  }
+  settings.log.log_to_console = false;
+  settings.log.log_callback   = [&connection](const char* line) { connection.send_log(line); };
+
+  // The solution bound streamed with each incumbent is the latest bound reported by branch and
+  // bound, in the user's objective sense
+  std::atomic<f_t> user_bound{maximize ? inf : -inf};
+  if (request.stream_incumbents) {
+    settings.solution_callback = [&](std::vector<f_t>& x, f_t objective) {
+      incumbent_t<i_t, f_t> incumbent;
+      incumbent.objective      = user_objective(user_problem, objective);
+      incumbent.solution_bound = user_bound.load();
+      incumbent.solution       = x;
+      byte_writer_t out;
+      serialize_incumbent(incumbent, out);
+      connection.send(message_type_t::INCUMBENT, out.buffer);
+    };
+  }
+
+  dual_simplex::branch_and_bound_t<i_t, f_t> branch_and_bound(user_problem, settings, start_time);
+  branch_and_bound.set_user_bound_callback([&user_bound](f_t bound) { user_bound = bound; });
+  dual_simplex::mip_solution_t<i_t, f_t> solution(user_problem.num_cols);
+  const dual_simplex::mip_status_t status = branch_and_bound.solve(solution);
+
+  mip_result_t<i_t, f_t> result;
+  result.termination_status     = to_termination_status(status, solution.has_incumbent);
+  result.error_type             = static_cast<int32_t>(error_type_t::Success);
+  result.total_solve_time       = dual_simplex::toc(start_time);
+  result.presolve_time          = 0.0;
+  result.num_nodes              = solution.nodes_explored;
+  result.num_simplex_iterations = solution.simplex_iterations;
+  if (solution.has_incumbent) {
+    result.objective      = user_objective(user_problem, solution.objective);
+    result.solution_bound = status == dual_simplex::mip_status_t::OPTIMAL
+                              ? result.objective
+                              : user_objective(user_problem, solution.lower_bound);
+    result.mip_gap = relative_mip_gap(result.objective, result.solution_bound);
+    compute_violations(user_problem, solution.x, result);
+    result.solution = std::move(solution.x);
+  } else {
+    result.solution_bound = user_objective(user_problem, solution.lower_bound);
+    result.solution.assign(user_problem.num_cols, 0.0);
+  }
+  return result;
+}
+
+}  // namespace
+
+remote_server_t::remote_server_t(int port,
+                                 int max_concurrent_solves,
+                                 uint64_t max_request_size,
+                                 const std::string& host)
+  : host_(host),
+    port_(port),
+    max_concurrent_solves_(std::max(1, max_concurrent_solves)),
+    max_request_size_(max_request_size),
+    listen_fd_(-1),
+    running_(false),
+    stopping_(false),
+    active_solves_(0)
+{
+}
+
+remote_server_t::~remote_server_t() { stop(); }
+
+int remote_server_t::start()
+{
+  addrinfo hints{};
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags    = AI_PASSIVE | AI_NUMERICSERV;
+  addrinfo* addresses = nullptr;
+  const std::string port_string = std::to_string(port_);
+  const int rc = ::getaddrinfo(host_.c_str(), port_string.c_str(), &hints, &addresses);
+  cuopt_expects(rc == 0,
+                error_type_t::RuntimeError,
+                "Unable to resolve %s: %s",
+                host_.c_str(),
+                ::gai_strerror(rc));
+
+  for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+    listen_fd_ = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (listen_fd_ < 0) { continue; }
+    const int enable  = 1;
+    const int disable = 0;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    // "::" accepts both IPv4 and IPv6 clients
+    if (address->ai_family == AF_INET6) {
+      ::setsockopt(listen_fd_, IPPROTO_IPV6, IPV6_V6ONLY, &disable, sizeof(disable));
+    }
+    if (::bind(listen_fd_, address->ai_addr, address->ai_addrlen) == 0 &&
+        ::listen(listen_fd_, SOMAXCONN) == 0) {
+      break;
+    }
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+  }
+  ::freeaddrinfo(addresses);
+  cuopt_expects(listen_fd_ >= 0,
+                error_type_t::RuntimeError,
+                "Unable to listen on %s port %d",
+                host_.c_str(),
+                port_);
+
+  sockaddr_storage bound{};
+  socklen_t length = sizeof(bound);
+  ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&bound), &length);
+  port_ = ntohs(bound.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+                                            : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = false;
+  }
+  running_       = true;
+  accept_thread_ = std::thread(&remote_server_t::accept_loop, this);
+  CUOPT_LOG_INFO("Remote server listening on %s port %d (max concurrent solves %d)",
+                 host_.c_str(),
+                 port_,
+                 max_concurrent_solves_);
+  return port_;
+}
+
+void remote_server_t::stop()
+{
+  if (running_.exchange(false)) {
+    // Unblocks accept()
+    ::shutdown(listen_fd_, SHUT_RDWR);
+    accept_thread_.join();
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+  }
+  std::list<connection_thread_t> connections;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+    // A client that connected but never sends its request would block stop() forever
+    for (const int fd : receiving_fds_) {
+      ::shutdown(fd, SHUT_RDWR);
+    }
+    for (std::atomic<int>* halt : solve_halts_) {
+      *halt = 1;
+    }
+    // The threads only touch their own list entry, which splice() does not move
+    connections.splice(connections.end(), connections_);
+  }
+  slot_available_.notify_all();
+  for (auto& connection : connections) {
+    connection.thread.join();
+  }
+}
+
+void remote_server_t::accept_loop()
+{
+  while (running_) {
+    const int fd = ::accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      if (running_ && errno == EINTR) { continue; }
+      if (!running_) { break; }
+      CUOPT_LOG_INFO("Remote server accept failed: %s", std::strerror(errno));
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    join_finished_connections();
+    receiving_fds_.insert(fd);
+    connection_thread_t& entry = connections_.emplace_back();
+    // The thread marks itself done under mutex_, which is held until entry.thread is assigned
+    entry.thread = std::thread([this, fd, &entry] {
+      handle_connection(fd);
+      std::lock_guard<std::mutex> lock(mutex_);
+      receiving_fds_.erase(fd);
+      ::close(fd);
+      entry.done = true;
+    });
+  }
+}
+
+// Called with mutex_ held. A thread marked done no longer takes the mutex, so it can be joined
+void remote_server_t::join_finished_connections()
+{
+  for (auto it = connections_.begin(); it != connections_.end();) {
+    if (it->done) {
+      it->thread.join();
+      it = connections_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void remote_server_t::acquire_solve_slot(std::atomic<int>* halt)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  slot_available_.wait(lock,
+                       [this] { return stopping_ || active_solves_ < max_concurrent_solves_; });
+  cuopt_expects(
+    !stopping_, error_type_t::RuntimeError, "The remote server is shutting down");
+  ++active_solves_;
+  if (halt != nullptr) { solve_halts_.insert(halt); }
+}
+
+void remote_server_t::release_solve_slot(std::atomic<int>* halt)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --active_solves_;
+    if (halt != nullptr) { solve_halts_.erase(halt); }
+  }
+  slot_available_.notify_one();
+}
+
+void remote_server_t::handle_connection(int fd)
+{
+  connection_t connection(fd);
+  // Set by stop() to interrupt an LP solve. Branch and bound does not check it
+  std::atomic<int> halt{0};
+  std::atomic<int>* slot_halt = nullptr;
+  bool holds_slot             = false;
+  try {
+    message_type_t type;
+    std::vector<uint8_t> payload;
+    const bool received = receive_message(fd, type, payload, max_request_size_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      receiving_fds_.erase(fd);
+    }
+    if (!received) { return; }
+
+    cuopt_expects(type == message_type_t::SOLVE_LP || type == message_type_t::SOLVE_MIP,
+                  error_type_t::ValidationError,
+                  "Expected a solve request, received message type %d",
+                  static_cast<int>(type));
+    const f_t start_time = dual_simplex::tic();
+    bool maximize;
+    dual_simplex::user_problem_t<i_t, f_t> user_problem(nullptr);
+    lp_request_settings_t<i_t, f_t> lp_settings;
+    mip_request_settings_t<i_t, f_t> mip_settings;
+    {
+      // The request and the host problem are released once the solver input is built, so at
+      // most one copy of the constraint matrix is alive during the solve
+      byte_reader_t in(payload.data(), payload.size());
+      cpu_optimization_problem_t<i_t, f_t> problem;
+      deserialize_problem(in, problem);
+      if (type == message_type_t::SOLVE_LP) {
+        lp_settings = deserialize_lp_settings<i_t, f_t>(in);
+        check_lp_request(lp_settings);
+        slot_halt = &halt;
+      } else {
+        mip_settings = deserialize_mip_settings<i_t, f_t>(in);
+      }
+      std::vector<uint8_t>().swap(payload);
+      // The problem came over the network, so it is checked even when the client turned
+      // problem_checking off: a malformed matrix must not bring the server down
+      check_cpu_problem_representation(problem);
+      maximize     = problem.get_sense();
+      user_problem = cpu_problem_to_simplex_problem(problem);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (active_solves_ >= max_concurrent_solves_) {
+        connection.send_log("Waiting for a free solver slot on the remote server\n");
+      }
+    }
+    acquire_solve_slot(slot_halt);
+    holds_slot = true;
+
+    byte_writer_t out;
+    if (type == message_type_t::SOLVE_LP) {
+      serialize_lp_result(
+        solve_lp(user_problem, maximize, start_time, lp_settings, &halt, connection), out);
+      release_solve_slot(slot_halt);
+      holds_slot = false;
+      connection.send(message_type_t::LP_RESULT, out.buffer);
+    } else {
+      serialize_mip_result(solve_mip(user_problem, maximize, start_time, mip_settings, connection),
+                           out);
+      release_solve_slot(slot_halt);
+      holds_slot = false;
+      connection.send(message_type_t::MIP_RESULT, out.buffer);
+    }
+  } catch (const cuopt::logic_error& e) {
+    if (holds_slot) { release_solve_slot(slot_halt); }
+    connection.send_error(e.get_error_type(), e.what());
+  } catch (const std::bad_alloc& e) {
+    if (holds_slot) { release_solve_slot(slot_halt); }
+    connection.send_error(error_type_t::OutOfMemoryError, e.what());
+  } catch (const std::exception& e) {
+    if (holds_slot) { release_solve_slot(slot_halt); }
+    connection.send_error(error_type_t::RuntimeError, e.what());
+  }
+}
+
+}  // namespace cuopt::linear_programming::remote
@@ -0,0 +1,86 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <pdlp/remote/remote_protocol.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+namespace cuopt::linear_programming::remote {
+
+// Reference implementation of the remote solve service.
+//
+// Accepts SOLVE_LP and SOLVE_MIP requests (see remote_protocol.hpp) and answers them with the
+// host solvers: dual simplex or the CPU barrier for LPs and branch and bound for MIPs, so the
+// server itself needs no GPU. Every connection is served on its own thread; at most
+// max_concurrent_solves requests are solved at the same time and the others wait for a slot.
+// Solver log lines and improved MIP incumbents are streamed to the client while it waits.
+// Requests larger than max_request_size bytes are rejected before they are read. Requests with
+// settings the host solvers cannot honor, such as the PDLP method, are rejected with an error.
+//
+// The server does not authenticate its clients. It listens on the loopback interface unless it
+// is given another host address to bind, such as "0.0.0.0" or "::" for every interface.
+class remote_server_t {
+ public:
+  static constexpr const char* default_host = "127.0.0.1";
+
+  remote_server_t(int port,
+                  int max_concurrent_solves,
+                  uint64_t max_request_size = default_max_message_size,
+                  const std::string& host   = default_host);
+  ~remote_server_t();
+
+  // Binds and starts accepting connections on a background thread. Returns the bound port,
+  // which is useful when the server was created with port 0
+  int start();
+
+  // Stops accepting connections, closes the connections that have not sent their request yet,
+  // interrupts the LP solves in flight and rejects the requests waiting for a slot. MIP solves
+  // cannot be interrupted and run to their limits. Returns once every connection thread is joined
+  void stop();
+
+ private:
+  struct connection_thread_t {
+    std::thread thread;
+    bool done{false};
+  };
+
+  void accept_loop();
+  void join_finished_connections();
+  void handle_connection(int fd);
+  void acquire_solve_slot(std::atomic<int>* halt);
+  void release_solve_slot(std::atomic<int>* halt);
+
+  std::string host_;
+  int port_;
+  int max_concurrent_solves_;
+  uint64_t max_request_size_;
+  int listen_fd_;
+  std::atomic<bool> running_;
+  std::thread accept_thread_;
+
+  std::mutex mutex_;
+  std::condition_variable slot_available_;
+  bool stopping_;
+  int active_solves_;
+  std::list<connection_thread_t> connections_;
+  // Connections still waiting for their request, shut down by stop() to unblock their recv()
+  std::unordered_set<int> receiving_fds_;
+  // Halt flags of the LP solves in flight, set by stop(). Each solve has its own flag because
+  // the solvers also set it when they finish
+  std::unordered_set<std::atomic<int>*> solve_halts_;
+};
+
+}  // namespace cuopt::linear_programming::remote
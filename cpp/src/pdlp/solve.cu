@@ -392,6 +392,7 @@ optimization_problem_solution_t<i_t, f_t> convert_dual_simplex_sol(
   info[0].gap                             = 0.0;
   info[0].relative_gap                    = 0.0;
   info[0].solve_time                      = duration;
+  info[0].crossover_time                  = solution.crossover_time;
   info[0].number_of_steps_taken           = solution.iterations;
   info[0].total_number_of_attempted_steps = solution.iterations;
   info[0].l2_primal_residual              = solution.l2_primal_residual;
@@ -443,9 +444,11 @@ run_barrier(dual_simplex::user_problem_t<i_t, f_t>& user_problem,
   barrier_settings.augmented                       = settings.augmented;
   barrier_settings.dualize                         = settings.dualize;
   barrier_settings.ordering                        = settings.ordering;
+  barrier_settings.cpu_barrier                     = settings.cpu_barrier;
   barrier_settings.barrier_dual_initial_point      = settings.barrier_dual_initial_point;
   barrier_settings.barrier                         = true;
   barrier_settings.crossover                       = settings.crossover;
+  barrier_settings.parallel_crossover              = settings.parallel_crossover;
   barrier_settings.eliminate_dense_columns         = settings.eliminate_dense_columns;
   barrier_settings.cudss_deterministic             = settings.cudss_deterministic;
   barrier_settings.barrier_relaxed_feasibility_tol = settings.tolerances.relative_primal_tolerance;
@@ -663,6 +666,7 @@ static optimization_problem_solution_t<i_t, double> run_pdlp_solver_in_fp32(
     di.max_dual_ray_infeasibility      = static_cast<double>(fi.max_dual_ray_infeasibility);
     di.dual_ray_linear_objective       = static_cast<double>(fi.dual_ray_linear_objective);
     di.solve_time                      = fi.solve_time;
+    di.crossover_time                  = fi.crossover_time;
     di.solved_by_pdlp                  = fi.solved_by_pdlp;
     term_infos.push_back(di);
   }
@@ -761,9 +765,10 @@ optimization_problem_solution_t<i_t, f_t> run_pdlp(detail::problem_t<i_t, f_t>&
       dual_simplex::lp_solution_t<i_t, f_t> initial_solution(1, 1);
       translate_to_crossover_problem(problem, sol, lp, initial_solution);
       dual_simplex::simplex_solver_settings_t<i_t, f_t> dual_simplex_settings;
-      dual_simplex_settings.time_limit      = settings.time_limit;
-      dual_simplex_settings.iteration_limit = settings.iteration_limit;
-      dual_simplex_settings.concurrent_halt = settings.concurrent_halt;
+      dual_simplex_settings.time_limit         = settings.time_limit;
+      dual_simplex_settings.iteration_limit    = settings.iteration_limit;
+      dual_simplex_settings.concurrent_halt    = settings.concurrent_halt;
+      dual_simplex_settings.parallel_crossover = settings.parallel_crossover;
       dual_simplex::lp_solution_t<i_t, f_t> vertex_solution(lp.num_rows, lp.num_cols);
       std::vector<dual_simplex::variable_status_t> vstatus(lp.num_cols);
       dual_simplex::crossover_status_t crossover_status =
@@ -815,7 +820,8 @@ optimization_problem_solution_t<i_t, f_t> run_pdlp(detail::problem_t<i_t, f_t>&
       auto crossover_end            = std::chrono::high_resolution_clock::now();
       auto crossover_duration =
         std::chrono::duration_cast<std::chrono::milliseconds>(crossover_end - start_solver);
-      info[0].solve_time = crossover_duration.count() / 1000.0;
+      info[0].solve_time     = crossover_duration.count() / 1000.0;
+      info[0].crossover_time = vertex_solution.crossover_time;
       auto sol_crossover = optimization_problem_solution_t<i_t, f_t>(final_primal_solution,
                                                                      final_dual_solution,
                                                                      final_reduced_cost,
@@ -825,8 +831,10 @@ optimization_problem_solution_t<i_t, f_t> run_pdlp(detail::problem_t<i_t, f_t>&
                                                                      std::move(info),
                                                                      {termination_status});
       sol.copy_from(problem.handle_ptr, sol_crossover);
-      CUOPT_LOG_CONDITIONAL_INFO(
-        !settings.inside_mip, "Crossover status %s", sol.get_termination_status_string().c_str());
+      CUOPT_LOG_CONDITIONAL_INFO(!settings.inside_mip,
+                                 "Crossover status %s   Crossover time: %.3fs",
+                                 sol.get_termination_status_string().c_str(),
+                                 vertex_solution.crossover_time);
     }
     if (settings.method == method_t::Concurrent && settings.concurrent_halt != nullptr &&
         crossover_info == 0 && sol.get_termination_status() == pdlp_termination_status_t::Optimal) {
@@ -5,18 +5,149 @@
  */
 /* clang-format on */
 
+#include <cuopt/error.hpp>
 #include <cuopt/linear_programming/cpu_optimization_problem.hpp>
 #include <cuopt/linear_programming/cpu_optimization_problem_solution.hpp>
-#include <cuopt/linear_programming/cpu_pdlp_warm_start_data.hpp>
 #include <cuopt/linear_programming/solve.hpp>
+#include <pdlp/remote/remote_protocol.hpp>
 #include <utilities/logger.hpp>
 
+#include <unistd.h>
+
+#include <cstdlib>
+#include <functional>
+#include <string>
+
 namespace cuopt::linear_programming {
 
 // ============================================================================
-// Remote execution stubs (placeholder implementations)
+// Remote execution client (see pdlp/remote/remote_protocol.hpp for the protocol)
 // ============================================================================
 
+namespace {
+
+// Closes the connection when the request is finished
+class remote_connection_t {
+ public:
+  remote_connection_t()
+  {
+    const char* host = std::getenv("CUOPT_REMOTE_HOST");
+    const char* port = std::getenv("CUOPT_REMOTE_PORT");
+    cuopt_expects(host != nullptr && port != nullptr,
+                  error_type_t::ValidationError,
+                  "CUOPT_REMOTE_HOST and CUOPT_REMOTE_PORT must be set for remote execution");
+    std::string error_message;
+    fd_ = remote::connect_to_server(host, port, error_message);
+    cuopt_expects(fd_ >= 0, error_type_t::RuntimeError, "%s", error_message.c_str());
+  }
+  ~remote_connection_t() { ::close(fd_); }
+
+  remote_connection_t(const remote_connection_t&)            = delete;
+  remote_connection_t& operator=(const remote_connection_t&) = delete;
+
+  // Sends the request, forwards LOG messages to the logger and INCUMBENT messages to
+  // on_incumbent until the final result arrives. Throws if the server reports an error or the
+  // connection is lost
+  std::vector<uint8_t> solve(remote::message_type_t request_type,
+                             const std::vector<uint8_t>& request,
+                             remote::message_type_t result_type,
+                             const std::function<void(remote::byte_reader_t&)>& on_incumbent)
+  {
+    cuopt_expects(remote::send_message(fd_, request_type, request),
+                  error_type_t::RuntimeError,
+                  "Lost connection to the remote solver while sending the problem");
+    remote::message_type_t type;
+    std::vector<uint8_t> payload;
+    while (remote::receive_message(fd_, type, payload)) {
+      remote::byte_reader_t in(payload.data(), payload.size());
+      if (type == result_type) { return payload; }
+      if (type == remote::message_type_t::LOG) {
+        std::string line = in.read_string();
+        if (!line.empty() && line.back() == '\n') { line.pop_back(); }
+        CUOPT_LOG_INFO("%s", line.c_str());
+      } else if (type == remote::message_type_t::INCUMBENT) {
+        if (on_incumbent) { on_incumbent(in); }
+      } else if (type == remote::message_type_t::ERROR) {
+        const auto error_type = static_cast<error_type_t>(in.read<int32_t>());
+        throw cuopt::logic_error(in.read_string(), error_type);
+      } else {
+        cuopt_expects(false,
+                      error_type_t::RuntimeError,
+                      "Unexpected message type %d from the remote solver",
+                      static_cast<int>(type));
+      }
+    }
+    cuopt_expects(
+      false, error_type_t::RuntimeError, "Lost connection to the remote solver before the result");
+    return {};
+  }
+
+ private:
+  int fd_;
+};
+
+template <typename i_t, typename f_t>
+remote::lp_request_settings_t<i_t, f_t> to_request_settings(
+  pdlp_solver_settings_t<i_t, f_t> const& settings, bool problem_checking, bool use_pdlp_solver_mode)
+{
+  remote::lp_request_settings_t<i_t, f_t> request;
+  request.absolute_dual_tolerance    = settings.tolerances.absolute_dual_tolerance;
+  request.relative_dual_tolerance    = settings.tolerances.relative_dual_tolerance;
+  request.absolute_primal_tolerance  = settings.tolerances.absolute_primal_tolerance;
+  request.relative_primal_tolerance  = settings.tolerances.relative_primal_tolerance;
+  request.absolute_gap_tolerance     = settings.tolerances.absolute_gap_tolerance;
+  request.relative_gap_tolerance     = settings.tolerances.relative_gap_tolerance;
+  request.time_limit                 = settings.time_limit;
+  request.iteration_limit            = settings.iteration_limit;
+  request.method                     = static_cast<int32_t>(settings.method);
+  request.presolver                  = static_cast<int32_t>(settings.presolver);
+  request.folding                    = settings.folding;
+  request.augmented                  = settings.augmented;
+  request.dualize                    = settings.dualize;
+  request.ordering                   = settings.ordering;
+  request.cpu_barrier                = settings.cpu_barrier;
+  request.barrier_dual_initial_point = settings.barrier_dual_initial_point;
+  request.parallel_crossover         = settings.parallel_crossover;
+  request.crossover                  = settings.crossover;
+  request.eliminate_dense_columns    = settings.eliminate_dense_columns;
+  request.detect_infeasibility       = settings.detect_infeasibility;
+  request.dual_postsolve             = settings.dual_postsolve;
+  request.problem_checking           = problem_checking;
+  request.use_pdlp_solver_mode       = use_pdlp_solver_mode;
+  return request;
+}
+
+template <typename i_t, typename f_t>
+remote::mip_request_settings_t<i_t, f_t> to_request_settings(
+  mip_solver_settings_t<i_t, f_t> const& settings)
+{
+  remote::mip_request_settings_t<i_t, f_t> request;
+  request.absolute_tolerance         = settings.tolerances.absolute_tolerance;
+  request.relative_tolerance         = settings.tolerances.relative_tolerance;
+  request.integrality_tolerance      = settings.tolerances.integrality_tolerance;
+  request.absolute_mip_gap           = settings.tolerances.absolute_mip_gap;
+  request.relative_mip_gap           = settings.tolerances.relative_mip_gap;
+  request.time_limit                 = settings.time_limit;
+  request.work_limit                 = settings.work_limit;
+  request.cut_change_threshold       = settings.cut_change_threshold;
+  request.cut_min_orthogonality      = settings.cut_min_orthogonality;
+  request.node_limit                 = settings.node_limit;
+  request.reliability_branching      = settings.reliability_branching;
+  request.num_cpu_threads            = settings.num_cpu_threads;
+  request.max_cut_passes             = settings.max_cut_passes;
+  request.mir_cuts                   = settings.mir_cuts;
+  request.mixed_integer_gomory_cuts  = settings.mixed_integer_gomory_cuts;
+  request.knapsack_cuts              = settings.knapsack_cuts;
+  request.flow_cover_cuts            = settings.flow_cover_cuts;
+  request.strong_chvatal_gomory_cuts = settings.strong_chvatal_gomory_cuts;
+  request.reduced_cost_strengthening = settings.reduced_cost_strengthening;
+  request.determinism_mode           = settings.determinism_mode;
+  request.seed                       = settings.seed;
+  return request;
+}
+
+}  // namespace
+
 template <typename i_t, typename f_t>
 std::unique_ptr<lp_solution_interface_t<i_t, f_t>> solve_lp_remote(
   cpu_optimization_problem_t<i_t, f_t> const& cpu_problem,
@@ -25,55 +156,40 @@ std::unique_ptr<lp_solution_interface_t<i_t, f_t>> solve_lp_remote(
   bool use_pdlp_solver_mode)
 {
   init_logger_t log(settings.log_file, settings.log_to_console);
-  CUOPT_LOG_INFO(
-    "solve_lp_remote (CPU problem) stub called - returning dummy solution for testing");
-
-  // TODO: Implement actual remote LP solving via gRPC
-  // For now, return a dummy solution with fake data (allows testing the full flow)
-  i_t n_vars        = cpu_problem.get_n_variables();
-  i_t n_constraints = cpu_problem.get_n_constraints();
-
-  std::vector<f_t> primal_solution(n_vars, 0.0);
-  std::vector<f_t> dual_solution(n_constraints, 0.0);
-  std::vector<f_t> reduced_cost(n_vars, 0.0);
-
-  // Create fake warm start data struct with recognizable non-zero values for testing
-  cpu_pdlp_warm_start_data_t<i_t, f_t> warmstart;
-  warmstart.current_primal_solution_                  = std::vector<f_t>(n_vars, 1.1);
-  warmstart.current_dual_solution_                    = std::vector<f_t>(n_constraints, 2.2);
-  warmstart.initial_primal_average_                   = std::vector<f_t>(n_vars, 3.3);
-  warmstart.initial_dual_average_                     = std::vector<f_t>(n_constraints, 4.4);
-  warmstart.current_ATY_                              = std::vector<f_t>(n_vars, 5.5);
-  warmstart.sum_primal_solutions_                     = std::vector<f_t>(n_vars, 6.6);
-  warmstart.sum_dual_solutions_                       = std::vector<f_t>(n_constraints, 7.7);
-  warmstart.last_restart_duality_gap_primal_solution_ = std::vector<f_t>(n_vars, 8.8);
-  warmstart.last_restart_duality_gap_dual_solution_   = std::vector<f_t>(n_constraints, 9.9);
-  warmstart.initial_primal_weight_                    = 99.1;
-  warmstart.initial_step_size_                        = 99.2;
-  warmstart.total_pdlp_iterations_                    = 100;
-  warmstart.total_pdhg_iterations_                    = 200;
-  warmstart.last_candidate_kkt_score_                 = 99.3;
-  warmstart.last_restart_kkt_score_                   = 99.4;
-  warmstart.sum_solution_weight_                      = 99.5;
-  warmstart.iterations_since_last_restart_            = 10;
-
-  auto solution = std::make_unique<cpu_lp_solution_t<i_t, f_t>>(
-    std::move(primal_solution),
-    std::move(dual_solution),
-    std::move(reduced_cost),
-    pdlp_termination_status_t::Optimal,  // Fake optimal status
-    0.0,                                 // Primal objective (zero solution)
-    0.0,                                 // Dual objective (zero solution)
-    0.01,                                // Dummy solve time
-    0.001,                               // l2_primal_residual
-    0.002,                               // l2_dual_residual
-    0.003,                               // gap
-    42,                                  // num_iterations
-    true,                                // solved_by_pdlp
-    std::move(warmstart)                 // warmstart data
-  );
-
-  return solution;
+  try {
+    remote::byte_writer_t request;
+    remote::serialize_problem(cpu_problem, request);
+    remote::serialize_lp_settings(
+      to_request_settings(settings, problem_checking, use_pdlp_solver_mode), request);
+
+    remote_connection_t connection;
+    CUOPT_LOG_INFO("Solving LP on remote solver %s:%s",
+                   std::getenv("CUOPT_REMOTE_HOST"),
+                   std::getenv("CUOPT_REMOTE_PORT"));
+    const auto payload = connection.solve(remote::message_type_t::SOLVE_LP,
+                                          request.buffer,
+                                          remote::message_type_t::LP_RESULT,
+                                          nullptr);
+    remote::byte_reader_t in(payload.data(), payload.size());
+    auto result = remote::deserialize_lp_result<i_t, f_t>(in);
+    return std::make_unique<cpu_lp_solution_t<i_t, f_t>>(
+      std::move(result.primal_solution),
+      std::move(result.dual_solution),
+      std::move(result.reduced_cost),
+      static_cast<pdlp_termination_status_t>(result.termination_status),
+      result.primal_objective,
+      result.dual_objective,
+      result.solve_time,
+      result.l2_primal_residual,
+      result.l2_dual_residual,
+      result.gap,
+      result.num_iterations,
+      result.solved_by_pdlp != 0);
+  } catch (const cuopt::logic_error& e) {
+    CUOPT_LOG_ERROR("Remote LP solve failed: %s", e.what());
+    return std::make_unique<cpu_lp_solution_t<i_t, f_t>>(pdlp_termination_status_t::NumericalError,
+                                                          e);
+  }
 }
 
 template <typename i_t, typename f_t>
@@ -82,32 +198,62 @@ std::unique_ptr<mip_solution_interface_t<i_t, f_t>> solve_mip_remote(
   mip_solver_settings_t<i_t, f_t> const& settings)
 {
   init_logger_t log(settings.log_file, settings.log_to_console);
-  CUOPT_LOG_INFO(
-    "solve_mip_remote (CPU problem) stub called - returning dummy solution for testing");
-
-  // TODO: Implement actual remote MIP solving via gRPC
-  // For now, return a dummy solution with fake data (allows testing the full flow)
-  i_t n_vars = cpu_problem.get_n_variables();
-
-  std::vector<f_t> solution(n_vars, 0.0);
-  auto mip_solution = std::make_unique<cpu_mip_solution_t<i_t, f_t>>(
-    std::move(solution),
-    mip_termination_status_t::Optimal,  // Fake optimal status
-    0.0,                                // Objective value (zero solution)
-    0.0,                                // MIP gap
-    0.0,                                // Solution bound
-    0.01,                               // Total solve time
-    0.0,                                // Presolve time
-    0.0,                                // Max constraint violation
-    0.0,                                // Max int violation
-    0.0,                                // Max variable bound violation
-    0,                                  // Number of nodes
-    0);                                 // Number of simplex iterations
-
-  return mip_solution;
+  try {
+    std::vector<internals::get_solution_callback_t*> get_solution_callbacks;
+    for (auto callback : settings.get_mip_callbacks()) {
+      if (callback->get_type() == internals::base_solution_callback_type::GET_SOLUTION) {
+        get_solution_callbacks.push_back(static_cast<internals::get_solution_callback_t*>(callback));
+      }
+    }
+
+    auto request_settings              = to_request_settings(settings);
+    request_settings.stream_incumbents = !get_solution_callbacks.empty();
+    remote::byte_writer_t request;
+    remote::serialize_problem(cpu_problem, request);
+    remote::serialize_mip_settings(request_settings, request);
+
+    // Incumbents arrive on this thread, so the callbacks are never invoked concurrently
+    auto on_incumbent = [&get_solution_callbacks](remote::byte_reader_t& in) {
+      auto incumbent = remote::deserialize_incumbent<i_t, f_t>(in);
+      for (auto callback : get_solution_callbacks) {
+        callback->get_solution(incumbent.solution.data(),
+                               &incumbent.objective,
+                               &incumbent.solution_bound,
+                               callback->get_user_data());
+      }
+    };
+
+    remote_connection_t connection;
+    CUOPT_LOG_INFO("Solving MIP on remote solver %s:%s",
+                   std::getenv("CUOPT_REMOTE_HOST"),
+                   std::getenv("CUOPT_REMOTE_PORT"));
+    const auto payload = connection.solve(remote::message_type_t::SOLVE_MIP,
+                                          request.buffer,
+                                          remote::message_type_t::MIP_RESULT,
+                                          on_incumbent);
+    remote::byte_reader_t in(payload.data(), payload.size());
+    auto result = remote::deserialize_mip_result<i_t, f_t>(in);
+    return std::make_unique<cpu_mip_solution_t<i_t, f_t>>(
+      std::move(result.solution),
+      static_cast<mip_termination_status_t>(result.termination_status),
+      result.objective,
+      result.mip_gap,
+      result.solution_bound,
+      result.total_solve_time,
+      result.presolve_time,
+      result.max_constraint_violation,
+      result.max_int_violation,
+      result.max_variable_bound_violation,
+      result.num_nodes,
+      result.num_simplex_iterations);
+  } catch (const cuopt::logic_error& e) {
+    CUOPT_LOG_ERROR("Remote MIP solve failed: %s", e.what());
+    return std::make_unique<cpu_mip_solution_t<i_t, f_t>>(mip_termination_status_t::NoTermination,
+                                                           e);
+  }
 }
 
-// Explicit template instantiations for remote execution stubs
+// Explicit template instantiations for remote execution
 template std::unique_ptr<lp_solution_interface_t<int, double>> solve_lp_remote(
   cpu_optimization_problem_t<int, double> const&,
   pdlp_solver_settings_t<int, double> const&,
@@ -19,7 +19,8 @@
 #include <memory>
 #include <numeric>
 #include <queue>
-#include <stack>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace cuopt {
@@ -33,30 +34,37 @@ namespace distance_engine {
       func(predecessor_matrix32_, __VA_ARGS__); \
   } while (false)
 
-template <typename pm_t, typename i_t>
-static void add_path(pm_t& predecessor_matrix,
-                     typename pm_t::value_type::value_type src_matrix_id,
-                     typename pm_t::value_type::value_type dst_graph_id,
-                     std::vector<i_t>& paths_list,
-                     i_t i,
-                     std::vector<i_t>& paths_offsets)
+// Number of vertices on the path from the source of a shortest path tree to dst_graph_id, both
+// ends included
+template <typename predecessors_t, typename i_t>
+static i_t path_length(predecessors_t const& predecessors,
+                       std::vector<i_t> const& edge_sources,
+                       i_t dst_graph_id)
 {
-  std::stack<i_t> s;
-  std::size_t path_size;
+  using edge_id_t = typename predecessors_t::value_type;
 
-  do {
-    s.emplace(dst_graph_id);
-    dst_graph_id = predecessor_matrix[src_matrix_id][dst_graph_id];
-  } while (dst_graph_id != static_cast<typename pm_t::value_type::value_type>(-1));
+  i_t length = 1;
+  for (edge_id_t edge = predecessors[dst_graph_id]; edge != static_cast<edge_id_t>(-1);
+       edge           = predecessors[edge_sources[edge]])
+    ++length;
+  return length;
+}
 
-  path_size = s.size();
+// Write the path to dst_graph_id backward from path_end so no intermediate stack is needed
+template <typename predecessors_t, typename i_t>
+static void write_path(predecessors_t const& predecessors,
+                       std::vector<i_t> const& edge_sources,
+                       i_t dst_graph_id,
+                       i_t* path_end)
+{
+  using edge_id_t = typename predecessors_t::value_type;
 
-  while (!s.empty()) {
-    paths_list.emplace_back(s.top());
-    s.pop();
+  *--path_end = dst_graph_id;
+  for (edge_id_t edge = predecessors[dst_graph_id]; edge != static_cast<edge_id_t>(-1);
+       edge           = predecessors[dst_graph_id]) {
+    dst_graph_id = edge_sources[edge];
+    *--path_end  = dst_graph_id;
   }
-
-  paths_offsets[i] = path_size + paths_offsets[i - 1];
 }
 
 template <typename i_t, typename f_t>
@@ -77,18 +85,26 @@ void waypoint_matrix_t<i_t, f_t>::dijkstra(pm_t& predecessor_matrix,
                                            i_t src,
                                            i_t const* target_locations,
                                            i_t n_target_locations,
-                                           i_t id_src)
+                                           i_t id_src,
+                                           std::vector<f_t const*> const& secondary_weights,
+                                           std::vector<std::vector<f_t>>& secondary_matrices)
 {
   using node_t = std::pair<f_t, i_t>;
 
   constexpr f_t unset_val = 1.0e+30;
 
   std::vector<f_t> dist(n_vertices_, unset_val);
+  // Secondary metrics follow the tree of the primary one: their value at a vertex is the sum of
+  // their weights along the current shortest path to it
+  std::vector<std::vector<f_t>> secondary_dist(secondary_weights.size(),
+                                               std::vector<f_t>(n_vertices_, unset_val));
   std::priority_queue<node_t, std::vector<node_t>, std::greater<node_t>> min_q;
 
   // Init src in dist array and in priority queue
   min_q.emplace(static_cast<f_t>(0), src);
   dist[src] = static_cast<f_t>(0);
+  for (auto& metric_dist : secondary_dist)
+    metric_dist[src] = static_cast<f_t>(0);
 
   while (!min_q.empty()) {
     // Get node with minimum distance node out of the priority queue
@@ -106,9 +122,12 @@ void waypoint_matrix_t<i_t, f_t>::dijkstra(pm_t& predecessor_matrix,
       const auto new_distance = distance + weights_[nbr_offset];
       // Update dist array and priority queue structure if new path is smaller
       if (new_distance < dist[v]) {
-        // Store offset & edge id for easier time matrix computation
-        predecessor_matrix[id_src][v] = u;
+        // Store the edge id so the path and any other metric can be recovered without searching
+        // the neighbor lists
+        predecessor_matrix[id_src][v] = nbr_offset;
         dist[v]                       = new_distance;
+        for (std::size_t k = 0; k != secondary_weights.size(); ++k)
+          secondary_dist[k][v] = secondary_dist[k][u] + secondary_weights[k][nbr_offset];
         min_q.emplace(new_distance, v);
       }
     }
@@ -116,30 +135,48 @@ void waypoint_matrix_t<i_t, f_t>::dijkstra(pm_t& predecessor_matrix,
 
   // Write in cost matrix
   write_cost_matrix(cost_matrix, id_src, dist, target_locations, n_target_locations);
+  for (std::size_t k = 0; k != secondary_weights.size(); ++k)
+    write_cost_matrix(
+      secondary_matrices[k], id_src, secondary_dist[k], target_locations, n_target_locations);
 }
 
 template <typename i_t, typename f_t>
-std::vector<f_t> waypoint_matrix_t<i_t, f_t>::mpsp(i_t const* target_locations,
-                                                   i_t n_target_locations)
+std::vector<f_t> waypoint_matrix_t<i_t, f_t>::mpsp(
+  i_t const* target_locations,
+  i_t n_target_locations,
+  std::vector<f_t const*> const& secondary_weights,
+  std::vector<std::vector<f_t>>& secondary_matrices)
 {
   // TODO : data is not pinned, passing buffer to vector is not really easy so at worst just use
   // regular ptr
   std::vector<f_t> cost_matrix(n_target_locations * n_target_locations);
+  secondary_matrices.assign(secondary_weights.size(),
+                            std::vector<f_t>(n_target_locations * n_target_locations));
 
-  if (n_vertices_ < std::numeric_limits<uint16_t>::max()) {
+  // Predecessors are edge ids, uint16_t::max is kept for the "no predecessor" value
+  is_int16_ = offsets_[n_vertices_] < std::numeric_limits<uint16_t>::max();
+  if (is_int16_) {
     // -1 gets round up to uint16_t::max
     predecessor_matrix16_ = std::vector<std::vector<uint16_t>>(
       n_target_locations, std::vector<uint16_t>(n_vertices_, -1));
-    is_int16_ = true;
+    predecessor_matrix32_.clear();
   } else {
     predecessor_matrix32_ =
       std::vector<std::vector<int32_t>>(n_target_locations, std::vector<int32_t>(n_vertices_, -1));
+    predecessor_matrix16_.clear();
   }
 
 // Run n_target_locations dijkstras in parallel with each target as source
 #pragma omp parallel for
   for (std::size_t i = 0; i < n_target_locations; ++i)
-    dispatch(dijkstra, cost_matrix, target_locations[i], target_locations, n_target_locations, i);
+    dispatch(dijkstra,
+             cost_matrix,
+             target_locations[i],
+             target_locations,
+             n_target_locations,
+             i,
+             secondary_weights,
+             secondary_matrices);
 
   return cost_matrix;
 }
@@ -212,6 +249,10 @@ waypoint_matrix_t<i_t, f_t>::waypoint_matrix_t(raft::handle_t const& handle,
   n_vertices_ = n_vertices;
   indices_    = indices;
   weights_    = weights;
+
+  edge_sources_.resize(offsets[n_vertices]);
+  for (i_t u = 0; u != n_vertices; ++u)
+    std::fill(edge_sources_.begin() + offsets[u], edge_sources_.begin() + offsets[u + 1], u);
 }
 
 // Negative values, out of bounds (more than vertices)
@@ -232,6 +273,17 @@ template <typename i_t, typename f_t>
 void waypoint_matrix_t<i_t, f_t>::compute_cost_matrix(f_t* d_cost_matrix,
                                                       i_t const* target_locations,
                                                       i_t n_target_locations)
+{
+  compute_cost_matrix(d_cost_matrix, target_locations, n_target_locations, nullptr, nullptr, 0);
+}
+
+template <typename i_t, typename f_t>
+void waypoint_matrix_t<i_t, f_t>::compute_cost_matrix(f_t* d_cost_matrix,
+                                                      i_t const* target_locations,
+                                                      i_t n_target_locations,
+                                                      f_t const* const* secondary_weights,
+                                                      f_t* const* d_secondary_matrices,
+                                                      i_t n_secondary_weights)
 {
   cuopt_expects(
     d_cost_matrix != nullptr, error_type_t::ValidationError, "Cost matrix input cannot be null.");
@@ -240,14 +292,233 @@ void waypoint_matrix_t<i_t, f_t>::compute_cost_matrix(f_t* d_cost_matrix,
   cuopt_expects(n_target_locations > 0,
                 error_type_t::ValidationError,
                 "Number of target locations should be positive.");
+  cuopt_expects(n_secondary_weights >= 0,
+                error_type_t::ValidationError,
+                "Number of secondary weights cannot be negative.");
+  if (n_secondary_weights > 0) {
+    cuopt_expects(secondary_weights != nullptr && d_secondary_matrices != nullptr,
+                  error_type_t::ValidationError,
+                  "Secondary weights and matrices inputs cannot be null.");
+  }
 
   // Target locations validity checks
   check_target_locations(target_locations, n_target_locations, n_vertices_);
 
-  std::vector<f_t> cost_matrix = mpsp(target_locations, n_target_locations);
+  std::vector<f_t const*> weight_sets(n_secondary_weights);
+  for (i_t k = 0; k < n_secondary_weights; ++k) {
+    cuopt_expects(secondary_weights[k] != nullptr,
+                  error_type_t::ValidationError,
+                  "Secondary weights input cannot be null.");
+    cuopt_expects(d_secondary_matrices[k] != nullptr,
+                  error_type_t::ValidationError,
+                  "Secondary matrix input cannot be null.");
+    check_weights(secondary_weights[k], offsets_[n_vertices_]);
+    weight_sets[k] = secondary_weights[k];
+  }
+
+  std::vector<std::vector<f_t>> secondary_matrices;
+  std::vector<f_t> cost_matrix =
+    mpsp(target_locations, n_target_locations, weight_sets, secondary_matrices);
 
   raft::copy(d_cost_matrix, cost_matrix.data(), cost_matrix.size(), stream_view_);
+  for (i_t k = 0; k < n_secondary_weights; ++k)
+    raft::copy(d_secondary_matrices[k],
+               secondary_matrices[k].data(),
+               secondary_matrices[k].size(),
+               stream_view_);
   stream_view_.synchronize();
+
+  target_locations_.assign(target_locations, target_locations + n_target_locations);
+  cost_matrix_ = std::move(cost_matrix);
+}
+
+template <typename i_t, typename f_t>
+void waypoint_matrix_t<i_t, f_t>::build_reverse_graph()
+{
+  if (!reverse_offsets_.empty()) return;
+
+  const i_t n_edges = offsets_[n_vertices_];
+  reverse_offsets_.assign(n_vertices_ + 1, 0);
+  for (i_t e = 0; e != n_edges; ++e)
+    ++reverse_offsets_[indices_[e] + 1];
+  std::partial_sum(reverse_offsets_.begin(), reverse_offsets_.end(), reverse_offsets_.begin());
+
+  reverse_edges_.resize(n_edges);
+  std::vector<i_t> next(reverse_offsets_.begin(), reverse_offsets_.end() - 1);
+  for (i_t e = 0; e != n_edges; ++e)
+    reverse_edges_[next[indices_[e]]++] = e;
+}
+
+// Same search as dijkstra on the reverse graph: dist[v] is the cost of the shortest path from v
+// to dst. It stops once all the sources are settled
+template <typename i_t, typename f_t>
+void waypoint_matrix_t<i_t, f_t>::reverse_dijkstra(i_t dst,
+                                                   i_t const* sources,
+                                                   i_t n_sources,
+                                                   f_t* out_costs) const
+{
+  using node_t = std::pair<f_t, i_t>;
+
+  constexpr f_t unset_val = 1.0e+30;
+
+  std::vector<f_t> dist(n_vertices_, unset_val);
+  std::vector<bool> is_source(n_vertices_, false);
+  i_t n_unsettled = 0;
+  for (i_t k = 0; k != n_sources; ++k) {
+    if (!is_source[sources[k]]) ++n_unsettled;
+    is_source[sources[k]] = true;
+  }
+  std::priority_queue<node_t, std::vector<node_t>, std::greater<node_t>> min_q;
+
+  min_q.emplace(static_cast<f_t>(0), dst);
+  dist[dst] = static_cast<f_t>(0);
+
+  while (!min_q.empty() && n_unsettled > 0) {
+    const auto [distance, v] = min_q.top();
+    min_q.pop();
+
+    if (distance > dist[v]) continue;
+    if (is_source[v]) {
+      is_source[v] = false;
+      --n_unsettled;
+    }
+
+    // Loop through the edges entering v
+    for (auto r = reverse_offsets_[v]; r != reverse_offsets_[v + 1]; ++r) {
+      const auto edge         = reverse_edges_[r];
+      const auto u            = edge_sources_[edge];
+      const auto new_distance = distance + weights_[edge];
+      if (new_distance < dist[u]) {
+        dist[u] = new_distance;
+        min_q.emplace(new_distance, u);
+      }
+    }
+  }
+
+  for (i_t k = 0; k != n_sources; ++k)
+    out_costs[k] = dist[sources[k]];
+}
+
+template <typename i_t, typename f_t>
+template <typename pm_t>
+std::vector<f_t> waypoint_matrix_t<i_t, f_t>::update_mpsp(pm_t& predecessor_matrix,
+                                                          i_t const* target_locations,
+                                                          i_t n_target_locations,
+                                                          std::vector<i_t> const& previous_ids)
+{
+  using edge_id_t = typename pm_t::value_type::value_type;
+
+  const i_t n_previous = target_locations_.size();
+  std::vector<f_t> cost_matrix(n_target_locations * n_target_locations);
+
+  // Kept targets move their shortest path tree to their new row, added ones start empty
+  pm_t updated_predecessor_matrix(n_target_locations);
+  std::vector<i_t> kept_ids;
+  std::vector<i_t> added_ids;
+  std::vector<i_t> added_graph_ids;
+  for (i_t i = 0; i != n_target_locations; ++i) {
+    if (previous_ids[i] >= 0) {
+      updated_predecessor_matrix[i] = std::move(predecessor_matrix[previous_ids[i]]);
+      kept_ids.push_back(i);
+    } else {
+      updated_predecessor_matrix[i].assign(n_vertices_, static_cast<edge_id_t>(-1));
+      added_ids.push_back(i);
+      added_graph_ids.push_back(target_locations[i]);
+    }
+  }
+  predecessor_matrix = std::move(updated_predecessor_matrix);
+
+  const i_t n_kept  = kept_ids.size();
+  const i_t n_added = added_ids.size();
+
+  // Rows of the added targets need a search
+  const std::vector<f_t const*> no_secondary_weights;
+  std::vector<std::vector<f_t>> no_secondary_matrices;
+#pragma omp parallel for
+  for (i_t j = 0; j < n_added; ++j)
+    dijkstra(predecessor_matrix,
+             cost_matrix,
+             target_locations[added_ids[j]],
+             target_locations,
+             n_target_locations,
+             added_ids[j],
+             no_secondary_weights,
+             no_secondary_matrices);
+
+  // Previous costs between kept targets
+#pragma omp parallel for
+  for (i_t k = 0; k < n_kept; ++k) {
+    const i_t i = kept_ids[k];
+    f_t* row    = cost_matrix.data() + i * n_target_locations;
+    for (const i_t j : kept_ids)
+      row[j] = cost_matrix_[previous_ids[i] * n_previous + previous_ids[j]];
+  }
+
+  // Costs from the kept targets to the added ones, one reverse search per added target
+  std::vector<i_t> kept_graph_ids(n_kept);
+  for (i_t k = 0; k != n_kept; ++k)
+    kept_graph_ids[k] = target_locations[kept_ids[k]];
+  if (n_kept > 0 && n_added > 0) build_reverse_graph();
+#pragma omp parallel
+  {
+    std::vector<f_t> column(n_kept);
+#pragma omp for
+    for (i_t j = 0; j < n_added; ++j) {
+      reverse_dijkstra(added_graph_ids[j], kept_graph_ids.data(), n_kept, column.data());
+      for (i_t k = 0; k != n_kept; ++k)
+        cost_matrix[kept_ids[k] * n_target_locations + added_ids[j]] = column[k];
+    }
+  }
+
+  return cost_matrix;
+}
+
+template <typename i_t, typename f_t>
+void waypoint_matrix_t<i_t, f_t>::update_cost_matrix(f_t* d_cost_matrix,
+                                                     i_t const* target_locations,
+                                                     i_t n_target_locations)
+{
+  if (target_locations_.empty()) {
+    compute_cost_matrix(d_cost_matrix, target_locations, n_target_locations);
+    return;
+  }
+
+  cuopt_expects(
+    d_cost_matrix != nullptr, error_type_t::ValidationError, "Cost matrix input cannot be null.");
+  cuopt_expects(
+    target_locations != nullptr, error_type_t::ValidationError, "Target locations cannot be null.");
+  cuopt_expects(n_target_locations > 0,
+                error_type_t::ValidationError,
+                "Number of target locations should be positive.");
+
+  // Target locations validity checks
+  check_target_locations(target_locations, n_target_locations, n_vertices_);
+
+  // Match each target with an unused previous occurrence of the same vertex, -1 when added
+  std::unordered_map<i_t, std::vector<i_t>> previous_occurrences;
+  for (i_t i = target_locations_.size(); i-- > 0;)
+    previous_occurrences[target_locations_[i]].push_back(i);
+  std::vector<i_t> previous_ids(n_target_locations, -1);
+  for (i_t i = 0; i != n_target_locations; ++i) {
+    auto it = previous_occurrences.find(target_locations[i]);
+    if (it == previous_occurrences.end() || it->second.empty()) continue;
+    previous_ids[i] = it->second.back();
+    it->second.pop_back();
+  }
+
+  std::vector<f_t> cost_matrix;
+  if (is_int16_)
+    cost_matrix =
+      update_mpsp(predecessor_matrix16_, target_locations, n_target_locations, previous_ids);
+  else
+    cost_matrix =
+      update_mpsp(predecessor_matrix32_, target_locations, n_target_locations, previous_ids);
+
+  raft::copy(d_cost_matrix, cost_matrix.data(), cost_matrix.size(), stream_view_);
+  stream_view_.synchronize();
+
+  target_locations_.assign(target_locations, target_locations + n_target_locations);
+  cost_matrix_ = std::move(cost_matrix);
 }
 
 // Location values are greater or equal to n_target_locations
@@ -263,11 +534,10 @@ static void check_locations(i_t const* locations, i_t n_locations, i_t n_target_
 }
 
 template <typename i_t, typename f_t>
-std::pair<std::unique_ptr<rmm::device_buffer>, std::unique_ptr<rmm::device_buffer>>
-waypoint_matrix_t<i_t, f_t>::compute_waypoint_sequence(i_t const* target_locations,
-                                                       i_t n_target_locations,
-                                                       i_t const* locations,
-                                                       i_t n_locations)
+std::vector<i_t> waypoint_matrix_t<i_t, f_t>::get_host_locations(i_t const* target_locations,
+                                                                 i_t n_target_locations,
+                                                                 i_t const* locations,
+                                                                 i_t n_locations) const
 {
   cuopt_expects(
     target_locations != nullptr, error_type_t::ValidationError, "Offset input cannot be null.");
@@ -297,23 +567,69 @@ waypoint_matrix_t<i_t, f_t>::compute_waypoint_sequence(i_t const* target_locatio
   // Locations validity checks
   check_locations(h_locations.data(), n_locations, n_target_locations);
 
-  std::vector<i_t> paths_offsets(n_locations);
-  std::vector<i_t> paths_list;
+  return h_locations;
+}
 
-  /* Full path could be computed in parallel :
-  ** Compute each path in parallel and store the path length in an array
-  ** Do an exclusive sum scan over this array to the each final offset
-  ** Create the array knowing its full size (thanks to the final offset)
-  ** Insert in parallel nodes in the array
-  **
-  ** Currently the computation is fast enough
-  */
-  paths_offsets[0] = 0;
-  for (i_t i = 1; i != n_locations; ++i) {
-    const auto src_matrix_id = h_locations[i - 1];
-    const auto dst_graph_id  = target_locations[h_locations[i]];
-    dispatch(add_path, src_matrix_id, dst_graph_id, paths_list, i, paths_offsets);
+template <typename i_t, typename f_t>
+template <typename pm_t>
+void waypoint_matrix_t<i_t, f_t>::reconstruct_legs(pm_t const& predecessor_matrix,
+                                                   i_t const* target_locations,
+                                                   i_t const* locations,
+                                                   i_t first_leg,
+                                                   i_t n_legs,
+                                                   std::vector<i_t>& legs_offsets,
+                                                   std::vector<i_t>& waypoints) const
+{
+  // Leg j goes from locations[first_leg + j - 1] to locations[first_leg + j]
+  legs_offsets.assign(n_legs + 1, 0);
+
+#pragma omp parallel for
+  for (i_t j = 0; j < n_legs; ++j) {
+    const i_t leg       = first_leg + j;
+    legs_offsets[j + 1] = path_length(
+      predecessor_matrix[locations[leg - 1]], edge_sources_, target_locations[locations[leg]]);
+  }
+
+  std::partial_sum(legs_offsets.begin(), legs_offsets.end(), legs_offsets.begin());
+  waypoints.resize(legs_offsets[n_legs]);
+
+#pragma omp parallel for
+  for (i_t j = 0; j < n_legs; ++j) {
+    const i_t leg = first_leg + j;
+    write_path(predecessor_matrix[locations[leg - 1]],
+               edge_sources_,
+               target_locations[locations[leg]],
+               waypoints.data() + legs_offsets[j + 1]);
   }
+}
+
+template <typename i_t, typename f_t>
+void waypoint_matrix_t<i_t, f_t>::reconstruct_legs(i_t const* target_locations,
+                                                   i_t const* locations,
+                                                   i_t first_leg,
+                                                   i_t n_legs,
+                                                   std::vector<i_t>& legs_offsets,
+                                                   std::vector<i_t>& waypoints) const
+{
+  dispatch(
+    reconstruct_legs, target_locations, locations, first_leg, n_legs, legs_offsets, waypoints);
+}
+
+template <typename i_t, typename f_t>
+std::pair<std::unique_ptr<rmm::device_buffer>, std::unique_ptr<rmm::device_buffer>>
+waypoint_matrix_t<i_t, f_t>::compute_waypoint_sequence(i_t const* target_locations,
+                                                       i_t n_target_locations,
+                                                       i_t const* locations,
+                                                       i_t n_locations)
+{
+  std::vector<i_t> h_locations =
+    get_host_locations(target_locations, n_target_locations, locations, n_locations);
+
+  // paths_offsets[i] is the end of the path from location i - 1 to location i
+  std::vector<i_t> paths_offsets;
+  std::vector<i_t> paths_list;
+  reconstruct_legs(
+    target_locations, h_locations.data(), 1, n_locations - 1, paths_offsets, paths_list);
 
   rmm::device_uvector<i_t> paths_offsets_out(paths_offsets.size(), stream_view_);
   rmm::device_uvector<i_t> paths_list_out(paths_list.size(), stream_view_);
@@ -327,37 +643,101 @@ waypoint_matrix_t<i_t, f_t>::compute_waypoint_sequence(i_t const* target_locatio
 }
 
 template <typename i_t, typename f_t>
-template <typename pm_t>
-void waypoint_matrix_t<i_t, f_t>::compute_secondary_cost(
-  pm_t& predecessor_matrix,
-  typename pm_t::value_type::value_type src_matrix_id,
-  typename pm_t::value_type::value_type dst_graph_id,
-  f_t const* weights,
-  f_t& out_cost)
+waypoint_sequence_stream_t<i_t, f_t> waypoint_matrix_t<i_t, f_t>::stream_waypoint_sequence(
+  i_t const* target_locations,
+  i_t n_target_locations,
+  i_t const* locations,
+  i_t n_locations,
+  i_t legs_per_chunk) const
 {
-  f_t cost = 0;
+  cuopt_expects(legs_per_chunk > 0,
+                error_type_t::ValidationError,
+                "Number of legs per chunk should be positive.");
 
-  auto previous = predecessor_matrix[src_matrix_id][dst_graph_id];
-  do {
-    const auto nbr_offsets     = offsets_[previous];
-    const auto nbr_offset_last = offsets_[previous + 1];
+  return waypoint_sequence_stream_t<i_t, f_t>(
+    *this,
+    target_locations,
+    get_host_locations(target_locations, n_target_locations, locations, n_locations),
+    legs_per_chunk);
+}
 
-    // Loop through neighbor vertices
-    for (auto nbr_offset = nbr_offsets; nbr_offset != nbr_offset_last; ++nbr_offset) {
-      const auto v = indices_[nbr_offset];
-      if (v == dst_graph_id)  // Found next node in neighbor list
-      {
-        cost += weights[nbr_offset];
+template <typename i_t, typename f_t>
+waypoint_sequence_stream_t<i_t, f_t>::waypoint_sequence_stream_t(
+  waypoint_matrix_t<i_t, f_t> const& waypoint_matrix,
+  i_t const* target_locations,
+  std::vector<i_t>&& locations,
+  i_t legs_per_chunk)
+  : waypoint_matrix_(&waypoint_matrix),
+    target_locations_(target_locations),
+    locations_(std::move(locations)),
+    legs_per_chunk_(legs_per_chunk)
+{
+}
+
+template <typename i_t, typename f_t>
+bool waypoint_sequence_stream_t<i_t, f_t>::next(chunk_t& chunk)
+{
+  const i_t n_locations = locations_.size();
+  if (next_leg_ >= n_locations) return false;
+
+  const i_t n_legs     = std::min(legs_per_chunk_, n_locations - next_leg_);
+  chunk.first_location = next_leg_;
+  waypoint_matrix_->reconstruct_legs(
+    target_locations_, locations_.data(), next_leg_, n_legs, chunk.offsets, chunk.waypoints);
+  next_leg_ += n_legs;
+  return true;
+}
+
+template <typename i_t, typename f_t>
+template <typename pm_t>
+void waypoint_matrix_t<i_t, f_t>::compute_secondary_costs(pm_t& predecessor_matrix,
+                                                          i_t src_matrix_id,
+                                                          i_t src_graph_id,
+                                                          i_t const* target_locations,
+                                                          i_t n_target_locations,
+                                                          f_t const* weights,
+                                                          std::vector<f_t>& tree_costs,
+                                                          std::vector<i_t>& stack,
+                                                          f_t* out_costs)
+{
+  using edge_id_t = typename pm_t::value_type::value_type;
+
+  constexpr f_t unset_val = 1.0e+30;
+  // Weights are positive, a negative cost marks a vertex not reached yet
+  constexpr f_t unknown = -1;
+
+  auto const& predecessors = predecessor_matrix[src_matrix_id];
+  tree_costs[src_graph_id] = 0;
+
+  // Climb the shortest path tree from each target until a vertex with a known cost, then walk
+  // back down. Paths to different targets share their prefix, so each tree vertex is visited once
+  for (i_t dst = 0; dst != n_target_locations; ++dst) {
+    const std::size_t path_begin = stack.size();
+    i_t v                        = target_locations[dst];
+    while (tree_costs[v] == unknown) {
+      stack.push_back(v);
+      const edge_id_t edge = predecessors[v];
+      if (edge == static_cast<edge_id_t>(-1)) {
+        // Not reachable from the source
+        tree_costs[v] = unset_val;
         break;
       }
+      v = edge_sources_[edge];
     }
+    for (std::size_t j = stack.size(); j-- > path_begin;) {
+      const i_t w = stack[j];
+      if (tree_costs[w] != unknown) continue;
+      const edge_id_t edge = predecessors[w];
+      tree_costs[w]        = tree_costs[edge_sources_[edge]] + weights[edge];
+    }
+    out_costs[dst] = tree_costs[target_locations[dst]];
+  }
 
-    // Climb up
-    dst_graph_id = previous;
-    previous     = predecessor_matrix[src_matrix_id][dst_graph_id];
-  } while (previous != static_cast<typename pm_t::value_type::value_type>(-1));
-
-  out_cost = cost;
+  // Only reset what this source touched
+  for (const i_t v : stack)
+    tree_costs[v] = unknown;
+  tree_costs[src_graph_id] = unknown;
+  stack.clear();
 }
 
 template <typename i_t, typename f_t>
@@ -366,15 +746,21 @@ std::vector<f_t> waypoint_matrix_t<i_t, f_t>::_compute_shortest_path_costs(
 {
   std::vector<f_t> shortest_path_matrix(n_target_locations * n_target_locations);
 
-#pragma omp parallel for
-  for (std::size_t i = 0; i < n_target_locations * n_target_locations; ++i) {
-    const auto src = i / n_target_locations;
-    const auto dst = i % n_target_locations;
-    if (src == dst)
-      shortest_path_matrix[i] = 0.0f;
-    else
-      dispatch(
-        compute_secondary_cost, src, target_locations[dst], weights, shortest_path_matrix[i]);
+#pragma omp parallel
+  {
+    std::vector<f_t> tree_costs(n_vertices_, -1);
+    std::vector<i_t> stack;
+#pragma omp for
+    for (i_t src = 0; src < n_target_locations; ++src)
+      dispatch(compute_secondary_costs,
+               src,
+               target_locations[src],
+               target_locations,
+               n_target_locations,
+               weights,
+               tree_costs,
+               stack,
+               shortest_path_matrix.data() + src * n_target_locations);
   }
 
   return shortest_path_matrix;
@@ -409,6 +795,7 @@ void waypoint_matrix_t<i_t, f_t>::compute_shortest_path_costs(f_t* d_custom_matr
 }
 
 template class waypoint_matrix_t<int, float>;
+template class waypoint_sequence_stream_t<int, float>;
 
 }  // namespace distance_engine
 }  // namespace cuopt
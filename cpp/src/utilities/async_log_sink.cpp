@@ -0,0 +1,228 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <utilities/async_log_sink.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace cuopt {
+
+namespace {
+
+std::atomic<uint64_t> next_sink_id{0};
+
+// The background thread also wakes up on its own, in case a wake up was missed
+constexpr auto drain_interval = std::chrono::milliseconds(50);
+
+}  // namespace
+
+async_log_sink_t::async_log_sink_t(overflow_policy_t policy, size_t records_per_thread)
+  : id_(++next_sink_id),
+    capacity_(std::bit_ceil(std::max<size_t>(records_per_thread, 2))),
+    policy_(policy),
+    thread_([this]() { run(); })
+{
+}
+
+async_log_sink_t::~async_log_sink_t()
+{
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_one();
+  thread_.join();
+}
+
+async_log_sink_t::ring_t& async_log_sink_t::thread_ring()
+{
+  struct thread_ring_t {
+    uint64_t sink_id;
+    ring_t* ring;
+    std::weak_ptr<ring_t> owner;
+  };
+  // Ring buffers of the calling thread, for each sink it wrote to. The ids are never reused.
+  // The ring buffers are retired when the thread exits, unless their sink is already gone.
+  struct thread_rings_t {
+    std::vector<thread_ring_t> rings;
+    ~thread_rings_t()
+    {
+      for (auto& entry : rings) {
+        auto ring = entry.owner.lock();
+        if (ring) { ring->retired.store(true, std::memory_order_release); }
+      }
+    }
+  };
+  thread_local thread_rings_t thread_rings;
+  for (const auto& entry : thread_rings.rings) {
+    if (entry.sink_id == id_) { return *entry.ring; }
+  }
+
+  // Forget the ring buffers of the sinks that were destroyed
+  auto& rings = thread_rings.rings;
+  rings.erase(std::remove_if(rings.begin(),
+                             rings.end(),
+                             [](const thread_ring_t& entry) { return entry.owner.expired(); }),
+              rings.end());
+  auto ring = std::make_shared<ring_t>(capacity_);
+  {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    rings_.push_back(ring);
+  }
+  rings.push_back({id_, ring.get(), ring});
+  return *ring;
+}
+
+size_t async_log_sink_t::num_rings()
+{
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  return rings_.size();
+}
+
+void async_log_sink_t::write(std::FILE* file, const char* message, size_t length)
+{
+  if (file == nullptr || length == 0) { return; }
+  // A message longer than the ring buffer is queued in pieces that fit
+  const size_t max_length = capacity_ * record_text_size;
+  while (length > max_length) {
+    write(file, message, max_length);
+    message += max_length;
+    length -= max_length;
+  }
+  ring_t& ring = thread_ring();
+  const uint64_t num_records = (length + record_text_size - 1) / record_text_size;
+
+  const uint64_t head = ring.head.load(std::memory_order_relaxed);
+  uint64_t tail       = ring.tail.load(std::memory_order_acquire);
+  while (head + num_records - tail > capacity_) {
+    if (policy_.load(std::memory_order_relaxed) == overflow_policy_t::drop) {
+      num_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    wake_.notify_one();
+    std::this_thread::yield();
+    tail = ring.tail.load(std::memory_order_acquire);
+  }
+
+  const uint64_t sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+  for (uint64_t k = 0; k < num_records; ++k) {
+    record_t& record    = ring.records[(head + k) & (capacity_ - 1)];
+    const size_t offset = k * record_text_size;
+    record.sequence     = sequence;
+    record.file         = file;
+    record.length       = std::min(length - offset, record_text_size);
+    std::memcpy(record.text, message + offset, record.length);
+  }
+  ring.head.store(head + num_records, std::memory_order_release);
+
+  // Only the first message after a drain wakes the background thread up
+  if (!pending_.exchange(true, std::memory_order_acq_rel)) { wake_.notify_one(); }
+}
+
+void async_log_sink_t::flush()
+{
+  std::unique_lock<std::mutex> lock(wake_mutex_);
+  // Wait for a drain that starts after this call
+  const uint64_t target = num_started_ + 1;
+  pending_              = true;
+  wake_.notify_one();
+  drained_.wait(lock, [&]() { return num_drains_ >= target; });
+}
+
+void async_log_sink_t::run()
+{
+  bool stop = false;
+  while (!stop) {
+    {
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_.wait_for(lock, drain_interval, [&]() { return stop_ || pending_.load(); });
+      stop = stop_;
+      num_started_++;
+      pending_ = false;
+    }
+    while (drain()) {}
+    {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      num_drains_++;
+    }
+    drained_.notify_all();
+  }
+}
+
+bool async_log_sink_t::drain()
+{
+  batch_.clear();
+  {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    size_t num_kept = 0;
+    for (auto& ring : rings_) {
+      // Read before the head, so a retired ring buffer has no message left once drained
+      const bool retired  = ring->retired.load(std::memory_order_acquire);
+      const uint64_t head = ring->head.load(std::memory_order_acquire);
+      const uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+      for (uint64_t k = tail; k < head; ++k) {
+        batch_.push_back(ring->records[k & (capacity_ - 1)]);
+      }
+      ring->tail.store(head, std::memory_order_release);
+      if (!retired) { rings_[num_kept++] = std::move(ring); }
+    }
+    rings_.resize(num_kept);
+  }
+  if (batch_.empty()) { return false; }
+
+  // The records of a message are consecutive in its ring buffer and share its sequence number
+  std::stable_sort(batch_.begin(), batch_.end(), [](const record_t& a, const record_t& b) {
+    return a.sequence < b.sequence;
+  });
+
+  std::vector<std::FILE*> files;
+  std::string text;
+  for (size_t k = 0; k < batch_.size();) {
+    std::FILE* file = batch_[k].file;
+    text.clear();
+    for (; k < batch_.size() && batch_[k].file == file; ++k) {
+      text.append(batch_[k].text, batch_[k].length);
+    }
+    std::fwrite(text.data(), 1, text.size(), file);
+    if (std::find(files.begin(), files.end(), file) == files.end()) { files.push_back(file); }
+  }
+  for (std::FILE* file : files) {
+    std::fflush(file);
+  }
+  return true;
+}
+
+namespace {
+
+std::mutex solver_sink_mutex;
+std::atomic<async_log_sink_t*> solver_sink{nullptr};
+
+}  // namespace
+
+async_log_sink_t* async_log_sink() { return solver_sink.load(std::memory_order_acquire); }
+
+void set_async_logging(bool enable, async_log_sink_t::overflow_policy_t policy)
+{
+  std::lock_guard<std::mutex> lock(solver_sink_mutex);
+  // Other threads may still hold the sink after it is turned off, so it lives until the exit
+  static std::unique_ptr<async_log_sink_t> sink;
+  if (enable) {
+    if (!sink) { sink = std::make_unique<async_log_sink_t>(policy); }
+    sink->set_overflow_policy(policy);
+    solver_sink.store(sink.get(), std::memory_order_release);
+  } else if (sink) {
+    solver_sink.store(nullptr, std::memory_order_release);
+    sink->flush();
+  }
+}
+
+}  // namespace cuopt
@@ -0,0 +1,124 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cuopt {
+
+/**
+ * @brief Asynchronous sink for the solver logs.
+ *
+ * The threads that log copy their preformatted messages into a ring buffer of their own, without
+ * taking a lock or calling into the C library. A background thread drains the ring buffers,
+ * writes the messages in batches and flushes each file once per batch, so that a slow terminal or
+ * file system no longer stalls the solver threads.
+ *
+ * The messages of a thread are written in order. The messages of different threads are ordered
+ * by the time they were queued, except when a message is queued while the background thread is
+ * draining the others.
+ *
+ * The memory is bounded by the number of records per thread. When the ring buffer of a thread is
+ * full, the message is either dropped and counted, or the thread waits for the background thread
+ * to make room. A thread retires its ring buffer when it exits, and the background thread frees
+ * the ring buffer once its last messages are written, so only the running threads hold memory.
+ */
+class async_log_sink_t {
+ public:
+  enum class overflow_policy_t { block, drop };
+
+  // Bytes of message text per record. Longer messages take several consecutive records.
+  static constexpr size_t record_text_size = 240;
+
+  explicit async_log_sink_t(overflow_policy_t policy = overflow_policy_t::block,
+                            size_t records_per_thread  = 512);
+  // Writes the queued messages and stops the background thread
+  ~async_log_sink_t();
+
+  async_log_sink_t(const async_log_sink_t&)            = delete;
+  async_log_sink_t& operator=(const async_log_sink_t&) = delete;
+
+  // Queues the first `length` bytes of `message` to be written to `file`
+  void write(std::FILE* file, const char* message, size_t length);
+
+  // Returns once every message queued before the call has been written and flushed
+  void flush();
+
+  void set_overflow_policy(overflow_policy_t policy) { policy_ = policy; }
+  // Number of messages dropped because a ring buffer was full
+  int64_t num_dropped() const { return num_dropped_; }
+  // Number of ring buffers not freed yet, one for each thread that wrote to the sink and is still
+  // running or has messages to write
+  size_t num_rings();
+
+ private:
+  struct record_t {
+    uint64_t sequence;
+    std::FILE* file;
+    uint32_t length;
+    char text[record_text_size];
+  };
+
+  // Single producer, single consumer ring buffer of records
+  struct ring_t {
+    explicit ring_t(size_t capacity) : records(capacity) {}
+    std::vector<record_t> records;
+    alignas(64) std::atomic<uint64_t> head{0};  // next record written by the producer
+    alignas(64) std::atomic<uint64_t> tail{0};  // next record read by the consumer
+    std::atomic<bool> retired{false};           // the producer exited, set after its last write
+  };
+
+  ring_t& thread_ring();
+  void run();
+  // Writes every record published in the ring buffers. Returns false if they were all empty.
+  bool drain();
+
+  const uint64_t id_;
+  const size_t capacity_;  // records per ring buffer, a power of 2
+  std::atomic<overflow_policy_t> policy_;
+  std::atomic<uint64_t> next_sequence_{0};
+  std::atomic<int64_t> num_dropped_{0};
+
+  std::mutex rings_mutex_;  // only taken to register a thread and by the background thread
+  // The sink owns the ring buffers, the threads only keep a weak reference to retire them
+  std::vector<std::shared_ptr<ring_t>> rings_;
+
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  std::condition_variable drained_;
+  uint64_t num_started_{0};  // drains started, protected by wake_mutex_
+  uint64_t num_drains_{0};   // drains finished, protected by wake_mutex_
+  bool stop_{false};         // protected by wake_mutex_
+  std::atomic<bool> pending_{false};
+
+  std::vector<record_t> batch_;  // only used by the background thread
+  std::thread thread_;
+};
+
+/**
+ * @brief Returns the sink of the solver logs, or nullptr if the logs are written synchronously.
+ *
+ * init_logger_t turns the sink on when the environment variable CUOPT_ASYNC_LOG is set to 1 or
+ * `block`, or to `drop` to drop the messages instead of waiting when a ring buffer is full.
+ */
+async_log_sink_t* async_log_sink();
+
+// Turns the sink of the solver logs on or off. Turning it off writes the queued messages.
+void set_async_logging(bool enable,
+                       async_log_sink_t::overflow_policy_t policy =
+                         async_log_sink_t::overflow_policy_t::block);
+
+}  // namespace cuopt
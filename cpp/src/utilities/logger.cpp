@@ -5,9 +5,14 @@
  */
 /* clang-format on */
 
+#include <utilities/async_log_sink.hpp>
 #include <utilities/logger.hpp>
 #include <utilities/version_info.hpp>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 namespace cuopt {
 
 struct buffered_entry {
@@ -137,9 +142,58 @@ void reset_default_logger()
   default_logger().flush_on(rapids_logger::level_enum::debug);
 }
 
+// File of the default logger when the logs are asynchronous
+static std::FILE* g_async_log_file = nullptr;
+
+static void async_log(std::FILE* file, const char* msg)
+{
+  if (file == nullptr || msg == nullptr) { return; }
+  auto* sink = async_log_sink();
+  if (sink != nullptr) {
+    sink->write(file, msg, std::strlen(msg));
+  } else {
+    std::fputs(msg, file);
+  }
+}
+
+// Callback functions for the sinks that queue the messages in the asynchronous sink
+static void async_console_log_callback(int, const char* msg) { async_log(stdout, msg); }
+static void async_file_log_callback(int, const char* msg) { async_log(g_async_log_file, msg); }
+
+/**
+ * @brief Returns true if the environment variable `CUOPT_ASYNC_LOG` asks for asynchronous logs.
+ *
+ * `1` or `block` waits for room when the ring buffer of a thread is full, `drop` drops the
+ * message instead.
+ */
+static bool async_log_requested(async_log_sink_t::overflow_policy_t& policy)
+{
+  const char* env_value = std::getenv("CUOPT_ASYNC_LOG");
+  if (env_value == nullptr) { return false; }
+  const std::string value(env_value);
+  if (value == "1" || value == "block") {
+    policy = async_log_sink_t::overflow_policy_t::block;
+    return true;
+  }
+  if (value == "drop") {
+    policy = async_log_sink_t::overflow_policy_t::drop;
+    return true;
+  }
+  return false;
+}
+
 // Guard object whose destructor resets the logger
 struct logger_config_guard {
-  ~logger_config_guard() { cuopt::reset_default_logger(); }
+  ~logger_config_guard()
+  {
+    cuopt::reset_default_logger();
+    // Write the queued messages before closing the file
+    set_async_logging(false);
+    if (g_async_log_file != nullptr) {
+      std::fclose(g_async_log_file);
+      g_async_log_file = nullptr;
+    }
+  }
 };
 
 // Weak reference to detect if any init_logger_t instance is still alive
@@ -159,15 +213,31 @@ init_logger_t::init_logger_t(std::string log_file, bool log_to_console)
 
   cuopt::default_logger().sinks().clear();
 
+  auto policy      = async_log_sink_t::overflow_policy_t::block;
+  const bool async = async_log_requested(policy);
+  if (async) { set_async_logging(true, policy); }
+
   // re-initialize sinks
   if (log_to_console) {
-    cuopt::default_logger().sinks().push_back(
-      std::make_shared<rapids_logger::ostream_sink_mt>(std::cout));
+    if (async) {
+      cuopt::default_logger().sinks().push_back(
+        std::make_shared<rapids_logger::callback_sink_mt>(async_console_log_callback));
+    } else {
+      cuopt::default_logger().sinks().push_back(
+        std::make_shared<rapids_logger::ostream_sink_mt>(std::cout));
+    }
   }
   if (!log_file.empty()) {
-    cuopt::default_logger().sinks().push_back(
-      std::make_shared<rapids_logger::basic_file_sink_mt>(log_file, true));
-    cuopt::default_logger().flush_on(rapids_logger::level_enum::debug);
+    if (async) {
+      // The background thread of the asynchronous sink flushes the file
+      g_async_log_file = std::fopen(log_file.c_str(), "w");
+      cuopt::default_logger().sinks().push_back(
+        std::make_shared<rapids_logger::callback_sink_mt>(async_file_log_callback));
+    } else {
+      cuopt::default_logger().sinks().push_back(
+        std::make_shared<rapids_logger::basic_file_sink_mt>(log_file, true));
+      cuopt::default_logger().flush_on(rapids_logger::level_enum::debug);
+    }
   }
 
 #if CUOPT_LOG_ACTIVE_LEVEL >= RAPIDS_LOGGER_LOG_LEVEL_INFO
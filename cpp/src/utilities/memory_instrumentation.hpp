@@ -11,17 +11,21 @@
  *
  * This file provides wrapper classes for tracking memory reads and writes.
  *
- * Usage:
- *   - Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to enable tracking
- *   - When undefined, all instrumentation becomes zero-overhead passthrough
- *     (record_*() calls inline away, no counter storage overhead)
+ * The policy of a wrapper selects what happens on each access:
+ *   - memory_counting_t: loads and stores are counted, e.g. to measure work in deterministic mode
+ *   - memory_passthrough_t: zero-overhead passthrough to the underlying container, the counters
+ *     of the wrapper stay at zero
+ * A hot kernel templated on the policy can then be instantiated in both variants. Containers
+ * without an explicit policy use memory_passthrough_t, or memory_counting_t if
+ * CUOPT_ENABLE_MEMORY_INSTRUMENTATION is defined to 1.
  *
  * Example:
- *   ins_vector<int> vec;  // Instrumented std::vector<int>
+ *   ins_vector<int, memory_counting_t> vec;  // Instrumented std::vector<int>
  *   vec.push_back(42);
  *   auto val = vec[0];
- *   // When enabled: tracking occurs, counters accumulate
- *   // When disabled: direct passthrough, compiler optimizes away all overhead
+ *   // vec.byte_loads == sizeof(int), vec.byte_stores == sizeof(int)
+ *   ins_vector<int, memory_passthrough_t> fast_vec;
+ *   // Direct passthrough, the compiler optimizes away all overhead
  */
 
 #pragma once
@@ -34,7 +38,11 @@
 #include <utility>
 #include <vector>
 
-#define CUOPT_ENABLE_MEMORY_INSTRUMENTATION 1
+// Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to 1 to count the accesses of the containers without
+// an explicit policy
+#ifndef CUOPT_ENABLE_MEMORY_INSTRUMENTATION
+#define CUOPT_ENABLE_MEMORY_INSTRUMENTATION 0
+#endif
 
 #ifdef __NVCC__
 #define HDI inline __host__ __device__
@@ -44,12 +52,18 @@
 
 namespace cuopt {
 
-// Define CUOPT_ENABLE_MEMORY_INSTRUMENTATION to 1 to enable memory tracking
-// When 0, instrumentation becomes a zero-overhead passthrough
+// Policies of the instrumented containers
+struct memory_counting_t {};
+struct memory_passthrough_t {};
+
+#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
+using default_memory_policy_t = memory_counting_t;
+#else
+using default_memory_policy_t = memory_passthrough_t;
+#endif
 
 // Base class for memory operation instrumentation
 struct memory_instrumentation_base_t {
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
   HDI void reset_counters() const { byte_loads = byte_stores = 0; }
 
   template <typename T>
@@ -73,26 +87,8 @@ struct memory_instrumentation_base_t {
 
   mutable size_t byte_loads{0};
   mutable size_t byte_stores{0};
-#else
-  // No-op methods when instrumentation is disabled - these inline away to zero overhead
-  HDI void reset_counters() const {}
-  template <typename T>
-  HDI void record_load() const
-  {
-  }
-  template <typename T>
-  HDI void record_store() const
-  {
-  }
-  template <typename T>
-  HDI void record_rmw() const
-  {
-  }
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
 };
 
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // aggregator class to collect statistics from multiple instrumented objects
 class instrumentation_aggregator_t {
  public:
@@ -162,26 +158,6 @@ class instrumentation_aggregator_t {
     instrumented_;
 };
 
-#else
-
-// No-op aggregator when instrumentation is disabled
-class instrumentation_aggregator_t {
- public:
-  instrumentation_aggregator_t() = default;
-  instrumentation_aggregator_t(
-    std::initializer_list<
-      std::pair<std::string, std::reference_wrapper<const memory_instrumentation_base_t>>>)
-  {
-  }
-  void add(const std::string&, const memory_instrumentation_base_t&) {}
-  std::pair<size_t, size_t> collect() { return {0, 0}; }
-  std::vector<std::tuple<std::string, size_t, size_t>> collect_per_wrapper() { return {}; }
-  std::pair<size_t, size_t> collect_and_flush() { return {0, 0}; }
-  void flush() {}
-};
-
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // Helper traits to detect container capabilities
 namespace type_traits_utils {
 
@@ -265,11 +241,13 @@ struct has_back<T, std::void_t<decltype(std::declval<T>().back())>> : std::true_
 
 }  // namespace type_traits_utils
 
-#if CUOPT_ENABLE_MEMORY_INSTRUMENTATION
+template <typename T, typename memory_policy_t = default_memory_policy_t>
+struct memop_instrumentation_wrapper_t;
 
 // Memory operation instrumentation wrapper for container-like types
 template <typename T>
-struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
+struct memop_instrumentation_wrapper_t<T, memory_counting_t>
+  : public memory_instrumentation_base_t {
   // Standard container type traits
   using value_type      = std::remove_reference_t<decltype(std::declval<T>()[0])>;
   using size_type       = std::size_t;
@@ -405,9 +383,7 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
     auto operator*() const
     {
       if constexpr (IsConst) {
-#ifdef CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-        wrapper_->byte_loads += sizeof(value_type);
-#endif
+        wrapper_->template record_load<value_type>();
         return *iter_;
       } else {
         return element_proxy_t(*iter_, *wrapper_);
@@ -711,13 +687,12 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
   T array_;
 };
 
-#else  // !CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
-// Zero-overhead passthrough wrapper when instrumentation is disabled
+// Zero-overhead passthrough wrapper
 // Provides the same interface as the instrumented version but just forwards to the underlying
 // container
 template <typename T>
-struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
+struct memop_instrumentation_wrapper_t<T, memory_passthrough_t>
+  : public memory_instrumentation_base_t {
   using value_type             = typename T::value_type;
   using size_type              = typename T::size_type;
   using difference_type        = typename T::difference_type;
@@ -835,10 +810,8 @@ struct memop_instrumentation_wrapper_t : public memory_instrumentation_base_t {
   T array_;
 };
 
-#endif  // CUOPT_ENABLE_MEMORY_INSTRUMENTATION
-
 // Convenience alias for instrumented std::vector
-template <typename T>
-using ins_vector = memop_instrumentation_wrapper_t<std::vector<T>>;
+template <typename T, typename memory_policy_t = default_memory_policy_t>
+using ins_vector = memop_instrumentation_wrapper_t<std::vector<T>, memory_policy_t>;
 
 }  // namespace cuopt
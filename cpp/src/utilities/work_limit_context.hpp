@@ -17,11 +17,13 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <string>
 
 #include <mip_heuristics/logger.hpp>
 
 #include "timer.hpp"
+#include "work_unit_model.hpp"
 #include "work_unit_scheduler.hpp"
 
 namespace cuopt {
@@ -31,7 +33,15 @@ struct work_limit_context_t {
   double total_sync_time{0.0};  // Total time spent waiting at sync barriers (seconds)
   bool deterministic{false};
   work_unit_scheduler_t* scheduler{nullptr};
+  // Sync points reached by the context and the ones it was released from, which differ while it
+  // runs ahead (see work_unit_scheduler_t::begin_run_ahead)
+  size_t num_syncs_reached{0};
+  size_t num_syncs_released{0};
+  bool running_ahead{false};
   std::string name;
+  // Observes every batch of counted work, deterministic or not. Used to calibrate the work unit
+  // model against wall time
+  std::function<void(const work_counts_t&)> work_sample_callback;
 
   work_limit_context_t(const std::string& name) : name(name) {}
 
@@ -41,6 +51,12 @@ struct work_limit_context_t {
     global_work_units_elapsed += work;
     if (scheduler) { scheduler->on_work_recorded(*this, global_work_units_elapsed); }
   }
+
+  void record_work_counts(const work_counts_t& counts)
+  {
+    if (work_sample_callback) { work_sample_callback(counts); }
+    record_work_sync_on_horizon(work_unit_model_t::active().work_units(counts));
+  }
 };
 
 }  // namespace cuopt
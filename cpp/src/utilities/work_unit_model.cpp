@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "work_unit_model.hpp"
+
+#include <cuopt/error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace cuopt {
+
+namespace {
+
+constexpr double default_work_weight = 1e-8;
+constexpr const char* profile_header = "cuopt_work_unit_profile 1";
+
+constexpr const char* kernel_names[num_work_kernels] = {
+  "simplex_iteration", "basis_solve", "basis_factorization", "ratio_test", "bound_strengthening"};
+
+}  // namespace
+
+const char* work_kernel_name(work_kernel_t kernel)
+{
+  return kernel_names[static_cast<int>(kernel)];
+}
+
+work_unit_model_t::work_unit_model_t() { weights_.fill(default_work_weight); }
+
+double work_unit_model_t::work_units(const work_counts_t& counts) const
+{
+  // Fixed summation order so that the work units only depend on the counts and the weights
+  double work = 0.0;
+  for (int k = 0; k < num_work_kernels; ++k) {
+    work += weights_[k] * counts[k];
+  }
+  return work;
+}
+
+void work_unit_model_t::set_weight(work_kernel_t kernel, double weight)
+{
+  cuopt_expects(std::isfinite(weight) && weight >= 0.0,
+                error_type_t::ValidationError,
+                "Work unit weight of %s must be finite and nonnegative",
+                work_kernel_name(kernel));
+  weights_[static_cast<int>(kernel)] = weight;
+}
+
+void work_unit_model_t::save(const std::string& path) const
+{
+  std::ofstream out(path);
+  cuopt_expects(out.is_open(),
+                error_type_t::RuntimeError,
+                "Could not open work unit profile %s for writing",
+                path.c_str());
+  out << profile_header << "\n";
+  char buffer[64];
+  for (int k = 0; k < num_work_kernels; ++k) {
+    std::snprintf(buffer, sizeof(buffer), "%a", weights_[k]);
+    out << kernel_names[k] << " " << buffer << "\n";
+  }
+  cuopt_expects(out.good(),
+                error_type_t::RuntimeError,
+                "Could not write work unit profile %s",
+                path.c_str());
+}
+
+work_unit_model_t work_unit_model_t::load(const std::string& path)
+{
+  std::ifstream in(path);
+  cuopt_expects(in.is_open(),
+                error_type_t::ValidationError,
+                "Could not open work unit profile %s",
+                path.c_str());
+  std::string line;
+  std::getline(in, line);
+  cuopt_expects(line == profile_header,
+                error_type_t::ValidationError,
+                "%s is not a work unit profile",
+                path.c_str());
+
+  work_unit_model_t model;
+  std::array<bool, num_work_kernels> seen{};
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') { continue; }
+    std::istringstream fields(line);
+    std::string name;
+    std::string value;
+    fields >> name >> value;
+    int k = 0;
+    while (k < num_work_kernels && name != kernel_names[k]) {
+      ++k;
+    }
+    cuopt_expects(k < num_work_kernels,
+                  error_type_t::ValidationError,
+                  "Unknown kernel %s in work unit profile %s",
+                  name.c_str(),
+                  path.c_str());
+    char* end           = nullptr;
+    const double weight = std::strtod(value.c_str(), &end);
+    cuopt_expects(!value.empty() && *end == '\0',
+                  error_type_t::ValidationError,
+                  "Invalid weight for kernel %s in work unit profile %s",
+                  name.c_str(),
+                  path.c_str());
+    model.set_weight(static_cast<work_kernel_t>(k), weight);
+    seen[k] = true;
+  }
+  for (int k = 0; k < num_work_kernels; ++k) {
+    cuopt_expects(seen[k],
+                  error_type_t::ValidationError,
+                  "Missing weight for kernel %s in work unit profile %s",
+                  kernel_names[k],
+                  path.c_str());
+  }
+  return model;
+}
+
+work_unit_model_t work_unit_model_t::fit(const std::vector<work_counts_t>& counts,
+                                         const std::vector<double>& seconds)
+{
+  cuopt_expects(counts.size() == seconds.size() && !counts.empty(),
+                error_type_t::ValidationError,
+                "Work unit calibration needs one measured time per sample");
+
+  // Normal equations of the least squares problem, with the columns scaled to unit norm since
+  // operation counts and times differ by many orders of magnitude
+  constexpr int n = num_work_kernels;
+  std::array<double, n> scale{};
+  for (const auto& sample : counts) {
+    for (int k = 0; k < n; ++k) {
+      scale[k] += sample[k] * sample[k];
+    }
+  }
+  for (int k = 0; k < n; ++k) {
+    scale[k] = scale[k] > 0.0 ? 1.0 / std::sqrt(scale[k]) : 0.0;
+  }
+  std::array<std::array<double, n>, n> gram{};
+  std::array<double, n> rhs{};
+  for (size_t s = 0; s < counts.size(); ++s) {
+    for (int i = 0; i < n; ++i) {
+      const double a_i = counts[s][i] * scale[i];
+      rhs[i] += a_i * seconds[s];
+      for (int j = 0; j < n; ++j) {
+        gram[i][j] += a_i * counts[s][j] * scale[j];
+      }
+    }
+  }
+
+  // Projected coordinate descent keeps the weights nonnegative. The scaled Gram matrix has a unit
+  // diagonal for every kernel present in the samples
+  std::array<double, n> x{};
+  constexpr int max_sweeps = 10000;
+  for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+    double max_change = 0.0;
+    double max_value  = 0.0;
+    for (int i = 0; i < n; ++i) {
+      if (scale[i] == 0.0) { continue; }
+      double residual = rhs[i];
+      for (int j = 0; j < n; ++j) {
+        if (j != i) { residual -= gram[i][j] * x[j]; }
+      }
+      const double value = std::max(0.0, residual / gram[i][i]);
+      max_change         = std::max(max_change, std::abs(value - x[i]));
+      max_value          = std::max(max_value, value);
+      x[i]               = value;
+    }
+    if (max_change <= 1e-13 * std::max(1.0, max_value)) { break; }
+  }
+
+  work_unit_model_t model;
+  for (int k = 0; k < n; ++k) {
+    if (scale[k] > 0.0) { model.weights_[k] = x[k] * scale[k]; }
+  }
+  return model;
+}
+
+const work_unit_model_t& work_unit_model_t::active()
+{
+  static const work_unit_model_t model = [] {
+    const char* path = std::getenv("CUOPT_WORK_UNIT_PROFILE");
+    if (path == nullptr || path[0] == '\0') { return work_unit_model_t{}; }
+    return load(path);
+  }();
+  return model;
+}
+
+}  // namespace cuopt
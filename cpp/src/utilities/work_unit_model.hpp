@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace cuopt {
+
+// Kernels whose operation counts are estimated separately by the solvers
+enum class work_kernel_t : int {
+  SIMPLEX_ITERATION   = 0,  // Pricing, ratio test bookkeeping and updates of phase 2
+  BASIS_SOLVE         = 1,  // Solves and updates with the basis factorization
+  BASIS_FACTORIZATION = 2,  // LU factorization and repair of the basis
+  RATIO_TEST          = 3,  // Bound flipping ratio test
+  BOUND_STRENGTHENING = 4,  // Node bound strengthening in branch and bound
+  NUM_KERNELS         = 5
+};
+
+constexpr int num_work_kernels = static_cast<int>(work_kernel_t::NUM_KERNELS);
+
+// Estimated operation counts, one entry per work kernel
+using work_counts_t = std::array<double, num_work_kernels>;
+
+const char* work_kernel_name(work_kernel_t kernel);
+
+// Counts with a single nonzero kernel
+inline work_counts_t single_kernel_work(work_kernel_t kernel, double count)
+{
+  work_counts_t counts{};
+  counts[static_cast<int>(kernel)] = count;
+  return counts;
+}
+
+// Converts the operation counts estimated by the solvers into work units.
+//
+// Work units are the clock of the deterministic mode: each kernel count is multiplied by a fixed
+// weight, so the same run always produces the same work units whatever the machine load. The
+// default weights (1e-8 per counted operation for every kernel) are the historical uncalibrated
+// values. A calibrated profile fits the weights to wall time measured on a given machine (see
+// cuopt_work_unit_calibrate), so that one work unit is close to one second there; runs using the
+// same profile stay reproducible.
+class work_unit_model_t {
+ public:
+  work_unit_model_t();
+
+  double work_units(const work_counts_t& counts) const;
+
+  double weight(work_kernel_t kernel) const { return weights_[static_cast<int>(kernel)]; }
+  void set_weight(work_kernel_t kernel, double weight);
+
+  // Profile files are text files with one "<kernel name> <weight>" line per kernel. Weights are
+  // written as hexadecimal floating point numbers so that they are read back exactly.
+  void save(const std::string& path) const;
+  static work_unit_model_t load(const std::string& path);
+
+  // Least squares fit of nonnegative weights such that work_units(counts[k]) ~ seconds[k].
+  // Kernels that never appear in the samples keep their default weight
+  static work_unit_model_t fit(const std::vector<work_counts_t>& counts,
+                               const std::vector<double>& seconds);
+
+  // Model used by the solvers. Loaded once from the profile named by the CUOPT_WORK_UNIT_PROFILE
+  // environment variable, the default model otherwise
+  static const work_unit_model_t& active();
+
+ private:
+  std::array<double, num_work_kernels> weights_;
+};
+
+}  // namespace cuopt
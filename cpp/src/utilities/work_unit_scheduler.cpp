@@ -57,13 +57,27 @@ void work_unit_scheduler_t::on_work_recorded(work_limit_context_t& ctx, double t
   if (is_shutdown()) return;
 
   if (verbose) {
+    // The generation changes under the lock while contexts run ahead
+    std::lock_guard<std::mutex> lock(mutex_);
     CUOPT_LOG_DEBUG("[%s] Work recorded: %f, sync_target: %f (gen %zu)",
                     ctx.name.c_str(),
                     total_work,
-                    current_sync_target(),
+                    run_ahead_ ? next_sync_target(ctx) : current_sync_target(),
                     barrier_generation_);
   }
 
+  if (run_ahead_) {
+    while (total_work >= next_sync_target(ctx)) {
+      // At most one horizon ahead. The sync that signals the shutdown is always waited for, so no
+      // context arrives at a sync point that the others left.
+      wait_for_release(ctx);
+      if (is_shutdown()) { return; }
+      arrive_at_sync_point(ctx, next_sync_target(ctx));
+      if (!ctx.running_ahead) { wait_for_release(ctx); }
+    }
+    return;
+  }
+
   // Loop to handle large work increments that cross multiple sync points
   while (total_work >= current_sync_target() && !is_shutdown()) {
     wait_at_sync_point(ctx, current_sync_target());
@@ -75,23 +89,66 @@ void work_unit_scheduler_t::set_sync_callback(sync_callback_t callback)
   sync_callback_ = std::move(callback);
 }
 
+void work_unit_scheduler_t::set_arrival_callback(context_callback_t callback)
+{
+  arrival_callback_ = std::move(callback);
+}
+
+void work_unit_scheduler_t::set_release_callback(context_callback_t callback)
+{
+  release_callback_ = std::move(callback);
+}
+
 void work_unit_scheduler_t::wait_for_next_sync(work_limit_context_t& ctx)
 {
   if (is_shutdown()) return;
 
+  if (run_ahead_) {
+    wait_for_release(ctx);
+    if (is_shutdown()) { return; }
+    const double next_sync        = next_sync_target(ctx);
+    ctx.global_work_units_elapsed = next_sync;
+    arrive_at_sync_point(ctx, next_sync);
+    wait_for_release(ctx);
+    return;
+  }
+
   double next_sync              = current_sync_target();
   ctx.global_work_units_elapsed = next_sync;
   wait_at_sync_point(ctx, next_sync);
 }
 
+void work_unit_scheduler_t::begin_run_ahead(work_limit_context_t& ctx) { ctx.running_ahead = true; }
+
+void work_unit_scheduler_t::end_run_ahead(work_limit_context_t& ctx)
+{
+  ctx.running_ahead = false;
+  wait_for_release(ctx);
+}
+
 double work_unit_scheduler_t::current_sync_target() const
 {
   if (sync_interval_ <= 0) return std::numeric_limits<double>::infinity();
   return (barrier_generation_ + 1) * sync_interval_;
 }
 
+void work_unit_scheduler_t::resume_at_sync(size_t num_syncs)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  barrier_generation_  = num_syncs;
+  current_sync_target_ = num_syncs * sync_interval_;
+  num_arrived_         = 0;
+  for (work_limit_context_t& ctx : contexts_) {
+    ctx.num_syncs_reached  = num_syncs;
+    ctx.num_syncs_released = num_syncs;
+  }
+}
+
 void work_unit_scheduler_t::wait_at_sync_point(work_limit_context_t& ctx, double sync_target)
 {
+  // Done before waiting so that it overlaps with the contexts that have not arrived yet
+  if (arrival_callback_) { arrival_callback_(ctx, sync_target); }
+
   auto wait_start = std::chrono::high_resolution_clock::now();
 
   if (verbose) {
@@ -107,8 +164,11 @@ void work_unit_scheduler_t::wait_at_sync_point(work_limit_context_t& ctx, double
   // One thread executes the sync callback
 #pragma omp single
   {
-    current_sync_target_ = sync_target;
-    barrier_generation_++;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      current_sync_target_ = sync_target;
+      barrier_generation_++;
+    }
 
     if (verbose) {
       CUOPT_LOG_DEBUG("All contexts arrived at sync point %.2f, new generation %zu",
@@ -125,6 +185,8 @@ void work_unit_scheduler_t::wait_at_sync_point(work_limit_context_t& ctx, double
   double wait_secs = std::chrono::duration<double>(wait_end - wait_start).count();
   ctx.total_sync_time += wait_secs;
 
+  if (release_callback_) { release_callback_(ctx, sync_target); }
+
   if (verbose) {
     CUOPT_LOG_DEBUG("[%s] Sync complete at %.2f, waited %.2f ms",
                     ctx.name.c_str(),
@@ -133,4 +195,57 @@ void work_unit_scheduler_t::wait_at_sync_point(work_limit_context_t& ctx, double
   }
 }
 
+double work_unit_scheduler_t::next_sync_target(const work_limit_context_t& ctx) const
+{
+  if (sync_interval_ <= 0) return std::numeric_limits<double>::infinity();
+  return (ctx.num_syncs_reached + 1) * sync_interval_;
+}
+
+void work_unit_scheduler_t::arrive_at_sync_point(work_limit_context_t& ctx, double sync_target)
+{
+  if (arrival_callback_) { arrival_callback_(ctx, sync_target); }
+
+  if (verbose) {
+    CUOPT_LOG_DEBUG("[%s] Arrived at sync point %.2f%s",
+                    ctx.name.c_str(),
+                    sync_target,
+                    ctx.running_ahead ? ", running ahead" : "");
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  ++ctx.num_syncs_reached;
+  if (++num_arrived_ < contexts_.size()) { return; }
+
+  // The last context to arrive executes the sync callback. The others wait for it or only touch
+  // their own state, and none of them arrives at the next sync point before it is done.
+  num_arrived_          = 0;
+  current_sync_target_ = sync_target;
+  lock.unlock();
+  if (sync_callback_) { sync_callback_(sync_target); }
+  lock.lock();
+  barrier_generation_++;
+  if (verbose) {
+    CUOPT_LOG_DEBUG("All contexts arrived at sync point %.2f, new generation %zu",
+                    sync_target,
+                    barrier_generation_);
+  }
+  sync_done_.notify_all();
+}
+
+void work_unit_scheduler_t::wait_for_release(work_limit_context_t& ctx)
+{
+  if (ctx.num_syncs_released == ctx.num_syncs_reached) { return; }
+
+  auto wait_start = std::chrono::high_resolution_clock::now();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    sync_done_.wait(lock, [&] { return barrier_generation_ >= ctx.num_syncs_reached; });
+  }
+  auto wait_end = std::chrono::high_resolution_clock::now();
+  ctx.total_sync_time += std::chrono::duration<double>(wait_end - wait_start).count();
+  ctx.num_syncs_released = ctx.num_syncs_reached;
+
+  if (release_callback_) { release_callback_(ctx, ctx.num_syncs_reached * sync_interval_); }
+}
+
 }  // namespace cuopt
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <vector>
 
 namespace cuopt {
@@ -39,11 +41,35 @@ class work_unit_scheduler_t {
   using sync_callback_t = std::function<void(double sync_target)>;
   void set_sync_callback(sync_callback_t callback);
 
+  // Per-context hooks around the sync callback, so that only the merge itself runs serially.
+  // The arrival callback is executed by each context as soon as it reaches the sync point, while
+  // slower contexts are still working: it may only touch the arriving context's own buffers
+  // (e.g. sort its outputs so the merge is linear). The release callback is executed by every
+  // context in parallel once the sync callback is done (e.g. copy the merged state).
+  using context_callback_t = std::function<void(work_limit_context_t& ctx, double sync_target)>;
+  void set_arrival_callback(context_callback_t callback);
+  void set_release_callback(context_callback_t callback);
+
   // Wait for next sync point (for idle workers with no work)
   void wait_for_next_sync(work_limit_context_t& ctx);
 
+  // Bounded run-ahead. Between `begin_run_ahead` and `end_run_ahead`, a context only touches its
+  // own state, e.g. while a worker solves the LP of a node. A context that reaches a sync point
+  // there arrives without waiting for the others and keeps working into the next horizon. It waits
+  // for the sync to complete when it leaves the section, or before it arrives at the next sync
+  // point, so it is never more than one horizon ahead. The work done ahead does not depend on the
+  // outcome of the sync, so the results are the same as without run-ahead. The sync callback then
+  // runs on the thread of the last context to arrive, while the others may still be running ahead.
+  void set_run_ahead(bool enable) { run_ahead_ = enable; }
+  void begin_run_ahead(work_limit_context_t& ctx);
+  void end_run_ahead(work_limit_context_t& ctx);
+
   double current_sync_target() const;
 
+  // Continues from the state after `num_syncs` sync points, e.g. when resuming a checkpoint. Called
+  // before the contexts start, once they are registered.
+  void resume_at_sync(size_t num_syncs);
+
   void signal_shutdown() { shutdown_.store(true, std::memory_order_release); }
   bool is_shutdown() const { return shutdown_.load(std::memory_order_acquire); }
 
@@ -53,6 +79,12 @@ class work_unit_scheduler_t {
  private:
   void wait_at_sync_point(work_limit_context_t& ctx, double sync_target);
 
+  // Run-ahead mode: the sync points of each context are counted in the context, since a context
+  // running ahead is one sync point past the others
+  double next_sync_target(const work_limit_context_t& ctx) const;
+  void arrive_at_sync_point(work_limit_context_t& ctx, double sync_target);
+  void wait_for_release(work_limit_context_t& ctx);
+
   double sync_interval_;
   std::vector<std::reference_wrapper<work_limit_context_t>> contexts_;
 
@@ -61,9 +93,35 @@ class work_unit_scheduler_t {
 
   // Sync callback - executed when all contexts reach sync point
   sync_callback_t sync_callback_;
+  context_callback_t arrival_callback_;
+  context_callback_t release_callback_;
 
   // Shutdown flag - prevents threads from entering barriers after termination is signaled
   std::atomic<bool> shutdown_{false};
+
+  bool run_ahead_{false};
+  std::mutex mutex_;
+  std::condition_variable sync_done_;
+  size_t num_arrived_{0};  // contexts that reached the pending sync point
+};
+
+// RAII helper for a run-ahead section of a context, see `work_unit_scheduler_t::begin_run_ahead`
+class scoped_run_ahead_t {
+ public:
+  scoped_run_ahead_t(work_unit_scheduler_t& scheduler, work_limit_context_t& ctx)
+    : scheduler_(scheduler), ctx_(ctx)
+  {
+    scheduler_.begin_run_ahead(ctx_);
+  }
+
+  ~scoped_run_ahead_t() { scheduler_.end_run_ahead(ctx_); }
+
+  scoped_run_ahead_t(const scoped_run_ahead_t&)            = delete;
+  scoped_run_ahead_t& operator=(const scoped_run_ahead_t&) = delete;
+
+ private:
+  work_unit_scheduler_t& scheduler_;
+  work_limit_context_t& ctx_;
 };
 
 // RAII helper for registering multiple contexts with automatic cleanup
@@ -86,6 +86,41 @@ class waypoint_matrix_waypoints_sequence_test_t
       EXPECT_EQ(h_full_path[i], expected_full_path[i]);
   }
 
+  void test_stream_waypoint_sequence()
+  {
+    auto stream = this->handle.get_stream();
+
+    rmm::device_uvector<f_t> d_cost_matrix(
+      this->target_locations.size() * this->target_locations.size(), stream);
+
+    this->waypoint_matrix.compute_cost_matrix(
+      d_cost_matrix.data(), this->target_locations.data(), this->target_locations.size());
+
+    // Chunks put back together give the full path, whatever their size
+    for (i_t legs_per_chunk : {1, 2, 1000}) {
+      auto sequence_stream =
+        this->waypoint_matrix.stream_waypoint_sequence(this->target_locations.data(),
+                                                       this->target_locations.size(),
+                                                       this->locations.data(),
+                                                       this->locations.size(),
+                                                       legs_per_chunk);
+
+      typename waypoint_sequence_stream_t<i_t, f_t>::chunk_t chunk;
+      std::vector<i_t> sequence_offsets{0};
+      std::vector<i_t> full_path;
+      while (sequence_stream.next(chunk)) {
+        EXPECT_EQ(chunk.first_location, static_cast<i_t>(sequence_offsets.size()));
+        EXPECT_LE(chunk.offsets.size(), static_cast<size_t>(legs_per_chunk) + 1);
+        for (size_t j = 1; j != chunk.offsets.size(); ++j)
+          sequence_offsets.push_back(full_path.size() + chunk.offsets[j]);
+        full_path.insert(full_path.end(), chunk.waypoints.begin(), chunk.waypoints.end());
+      }
+
+      EXPECT_EQ(sequence_offsets, expected_sequence_offsets);
+      EXPECT_EQ(full_path, expected_full_path);
+    }
+  }
+
   void test_compute_waypoint_sequence_no_matrix_call()
   {
     auto stream = this->handle.get_stream();
@@ -160,6 +195,41 @@ class waypoint_matrix_shortest_path_cost_t
       EXPECT_EQ(h_custom_matrix[i], ref_custom_matrix[i]);
   }
 
+  void test_compute_secondary_matrices()
+  {
+    auto stream            = this->handle.get_stream();
+    const auto matrix_size = this->target_locations.size() * this->target_locations.size();
+
+    rmm::device_uvector<f_t> d_cost_matrix(matrix_size, stream);
+    rmm::device_uvector<f_t> d_custom_matrix(matrix_size, stream);
+    rmm::device_uvector<f_t> d_weights_matrix(matrix_size, stream);
+
+    // Secondary matrices are accumulated along the paths of the cost matrix, so passing the
+    // primary weights again must give back the cost matrix
+    f_t const* secondary_weights[] = {this->custom_weights.data(), this->weights.data()};
+    f_t* secondary_matrices[]      = {d_custom_matrix.data(), d_weights_matrix.data()};
+    this->waypoint_matrix.compute_cost_matrix(d_cost_matrix.data(),
+                                              this->target_locations.data(),
+                                              this->target_locations.size(),
+                                              secondary_weights,
+                                              secondary_matrices,
+                                              2);
+
+    std::vector<f_t> h_cost_matrix(matrix_size);
+    std::vector<f_t> h_custom_matrix(matrix_size);
+    std::vector<f_t> h_weights_matrix(matrix_size);
+
+    raft::copy(h_cost_matrix.data(), d_cost_matrix.data(), matrix_size, stream);
+    raft::copy(h_custom_matrix.data(), d_custom_matrix.data(), matrix_size, stream);
+    raft::copy(h_weights_matrix.data(), d_weights_matrix.data(), matrix_size, stream);
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    for (size_t i = 0; i != matrix_size; ++i) {
+      EXPECT_NEAR(h_custom_matrix[i], ref_custom_matrix[i], 0.001f);
+      EXPECT_NEAR(h_weights_matrix[i], h_cost_matrix[i], 0.001f);
+    }
+  }
+
  private:
   std::vector<i_t> offsets;
   std::vector<i_t> indices;
@@ -213,6 +283,33 @@ class waypoint_matrix_cost_matrix_test_t
       EXPECT_NEAR(h_cost_matrix[i], this->ref_cost_matrix[i], 0.001f);
   }
 
+  void test_update_cost_matrix()
+  {
+    auto stream         = this->handle.get_stream();
+    const auto n_target = this->target_locations.size();
+
+    // Start from the last targets in reverse order plus a duplicate that is removed, then update
+    // to the full list: kept, added and removed targets are all exercised
+    std::vector<i_t> previous_targets(this->target_locations.rbegin(),
+                                      this->target_locations.rbegin() + n_target / 2);
+    previous_targets.push_back(this->target_locations.back());
+    rmm::device_uvector<f_t> d_previous_matrix(previous_targets.size() * previous_targets.size(),
+                                               stream);
+    this->waypoint_matrix.compute_cost_matrix(
+      d_previous_matrix.data(), previous_targets.data(), previous_targets.size());
+
+    rmm::device_uvector<f_t> d_cost_matrix(n_target * n_target, stream);
+    this->waypoint_matrix.update_cost_matrix(
+      d_cost_matrix.data(), this->target_locations.data(), n_target);
+
+    std::vector<f_t> h_cost_matrix(n_target * n_target);
+    raft::copy(h_cost_matrix.data(), d_cost_matrix.data(), h_cost_matrix.size(), stream);
+    RAFT_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    for (size_t i = 0; i != h_cost_matrix.size(); ++i)
+      EXPECT_NEAR(h_cost_matrix[i], this->ref_cost_matrix[i], 0.001f);
+  }
+
  private:
   std::vector<f_t> ref_cost_matrix{};
   std::vector<i_t> offsets;
@@ -235,6 +332,11 @@ TEST_P(float_waypoint_matrix_waypoints_sequence_test_t, compute_waypoint_sequenc
   test_compute_waypoint_sequence_no_matrix_call();
 }
 
+TEST_P(float_waypoint_matrix_waypoints_sequence_test_t, stream_waypoint_sequence)
+{
+  test_stream_waypoint_sequence();
+}
+
 INSTANTIATE_TEST_SUITE_P(test_waypoint_sequence,
                          float_waypoint_matrix_waypoints_sequence_test_t,
                          ::testing::ValuesIn(parse_data_models(first_input_, second_input_)));
@@ -244,6 +346,11 @@ TEST_P(float_waypoint_matrix_shortest_path_cost_t, compute_shortest_path_costs)
   test_compute_shortest_path_costs();
 }
 
+TEST_P(float_waypoint_matrix_shortest_path_cost_t, compute_secondary_matrices)
+{
+  test_compute_secondary_matrices();
+}
+
 INSTANTIATE_TEST_SUITE_P(test_shortest_path_cost,
                          float_waypoint_matrix_shortest_path_cost_t,
                          ::testing::ValuesIn(parse_data_models_custom_weight(first_input_)));
@@ -253,6 +360,11 @@ TEST_P(float_waypoint_matrix_cost_matrix_test_t, compute_cost_matrix)
   test_compute_cost_matrix();
 }
 
+TEST_P(float_waypoint_matrix_cost_matrix_test_t, update_cost_matrix)
+{
+  test_update_cost_matrix();
+}
+
 INSTANTIATE_TEST_SUITE_P(
   test_waypoint_matrix,
   float_waypoint_matrix_cost_matrix_test_t,
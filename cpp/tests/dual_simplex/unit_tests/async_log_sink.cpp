@@ -0,0 +1,234 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/logger.hpp>
+#include <utilities/async_log_sink.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+std::vector<std::string> read_lines(std::FILE* file)
+{
+  std::rewind(file);
+  std::vector<std::string> lines;
+  std::string line;
+  for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+    if (c == '\n') {
+      lines.push_back(line);
+      line.clear();
+    } else {
+      line.push_back(static_cast<char>(c));
+    }
+  }
+  return lines;
+}
+
+// Writes `num_messages` lines "<thread> <k>" from each of `num_threads` threads
+void write_from_threads(async_log_sink_t& sink, std::FILE* file, int num_threads, int num_messages)
+{
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int k = 0; k < num_messages; ++k) {
+        const std::string message = std::to_string(t) + " " + std::to_string(k) + "\n";
+        sink.write(file, message.c_str(), message.size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  sink.flush();
+}
+
+}  // namespace
+
+TEST(async_log_sink, block)
+{
+  constexpr int num_threads  = 4;
+  constexpr int num_messages = 2000;
+  std::FILE* file            = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  {
+    async_log_sink_t sink(async_log_sink_t::overflow_policy_t::block, 8);
+    write_from_threads(sink, file, num_threads, num_messages);
+    EXPECT_EQ(sink.num_dropped(), 0);
+  }
+
+  // Every message is written once, in order for each thread
+  const auto lines = read_lines(file);
+  ASSERT_EQ(lines.size(), static_cast<size_t>(num_threads * num_messages));
+  std::vector<int> next(num_threads, 0);
+  for (const auto& line : lines) {
+    int t, k;
+    std::istringstream(line) >> t >> k;
+    ASSERT_GE(t, 0);
+    ASSERT_LT(t, num_threads);
+    EXPECT_EQ(k, next[t]++);
+  }
+  std::fclose(file);
+}
+
+TEST(async_log_sink, drop)
+{
+  constexpr int num_threads  = 4;
+  constexpr int num_messages = 2000;
+  std::FILE* file            = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  async_log_sink_t sink(async_log_sink_t::overflow_policy_t::drop, 2);
+  write_from_threads(sink, file, num_threads, num_messages);
+
+  // The messages that were not dropped are written in order for each thread
+  const auto lines = read_lines(file);
+  EXPECT_EQ(static_cast<int64_t>(lines.size()) + sink.num_dropped(), num_threads * num_messages);
+  std::vector<int> last(num_threads, -1);
+  for (const auto& line : lines) {
+    int t, k;
+    std::istringstream(line) >> t >> k;
+    EXPECT_GT(k, last[t]);
+    last[t] = k;
+  }
+  std::fclose(file);
+}
+
+TEST(async_log_sink, retire_rings)
+{
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  async_log_sink_t sink(async_log_sink_t::overflow_policy_t::block, 8);
+  // The ring buffers of the threads that exited are freed once their messages are written
+  for (int round = 0; round < 10; ++round) {
+    write_from_threads(sink, file, 4, 20);
+    EXPECT_EQ(sink.num_rings(), size_t{0});
+  }
+  sink.write(file, "end\n", 4);
+  sink.flush();
+  EXPECT_EQ(sink.num_rings(), size_t{1});
+
+  const auto lines = read_lines(file);
+  ASSERT_EQ(lines.size(), size_t{10 * 4 * 20 + 1});
+  EXPECT_EQ(lines.back(), "end");
+  std::fclose(file);
+}
+
+TEST(async_log_sink, long_message)
+{
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  async_log_sink_t sink(async_log_sink_t::overflow_policy_t::block, 4);
+  std::string message;
+  for (int k = 0; message.size() < 3 * async_log_sink_t::record_text_size; ++k) {
+    message += std::to_string(k) + ",";
+  }
+  sink.write(file, (message + "\n").c_str(), message.size() + 1);
+  sink.write(file, "end\n", 4);
+  sink.flush();
+
+  const auto lines = read_lines(file);
+  ASSERT_EQ(lines.size(), size_t{2});
+  EXPECT_EQ(lines[0], message);
+  EXPECT_EQ(lines[1], "end");
+  std::fclose(file);
+}
+
+TEST(async_log_sink, message_longer_than_ring)
+{
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  async_log_sink_t sink(async_log_sink_t::overflow_policy_t::block, 4);
+  const std::string message(10 * async_log_sink_t::record_text_size, 'x');
+  sink.write(file, (message + "\n").c_str(), message.size() + 1);
+  sink.flush();
+
+  const auto lines = read_lines(file);
+  ASSERT_EQ(lines.size(), size_t{1});
+  EXPECT_EQ(lines[0], message);
+  std::fclose(file);
+}
+
+TEST(async_log_sink, logger_long_line)
+{
+  const auto filename =
+    std::filesystem::temp_directory_path() / "cuopt_async_log_sink_long_line_test.log";
+  const std::string long_line(5000, 'y');
+  set_async_logging(true);
+  logger_t log;
+  log.log_to_console = false;
+  log.set_log_file(filename.string());
+  log.printf("%s\n", long_line.c_str());
+  log.printf("end\n");
+  log.close_log_file();
+  set_async_logging(false);
+
+  std::ifstream input(filename);
+  std::string line;
+  ASSERT_TRUE(std::getline(input, line));
+  EXPECT_EQ(line, long_line);
+  ASSERT_TRUE(std::getline(input, line));
+  EXPECT_EQ(line, "end");
+  std::filesystem::remove(filename);
+}
+
+TEST(async_log_sink, logger_format_error)
+{
+  const auto filename =
+    std::filesystem::temp_directory_path() / "cuopt_async_log_sink_format_error_test.log";
+  set_async_logging(true);
+  logger_t log;
+  log.log_to_console = false;
+  log.set_log_file(filename.string());
+  // A character that cannot be converted in the C locale makes vsnprintf fail
+  log.printf("%ls\n", L"\u00e9");
+  log.printf("end\n");
+  log.close_log_file();
+  set_async_logging(false);
+
+  std::ifstream input(filename);
+  std::string line;
+  ASSERT_TRUE(std::getline(input, line));
+  EXPECT_EQ(line, "end");
+  EXPECT_FALSE(std::getline(input, line));
+  std::filesystem::remove(filename);
+}
+
+TEST(async_log_sink, logger)
+{
+  const auto filename = std::filesystem::temp_directory_path() / "cuopt_async_log_sink_test.log";
+  set_async_logging(true);
+  logger_t log;
+  log.log_to_console = false;
+  log.set_log_file(filename.string());
+  for (int k = 0; k < 100; ++k) {
+    log.printf("iteration %d\n", k);
+  }
+  // Closing the file writes the queued messages
+  log.close_log_file();
+  set_async_logging(false);
+  EXPECT_EQ(async_log_sink(), nullptr);
+
+  std::ifstream input(filename);
+  std::string line;
+  int k = 0;
+  while (std::getline(input, line)) {
+    EXPECT_EQ(line, "iteration " + std::to_string(k++));
+  }
+  EXPECT_EQ(k, 100);
+  std::filesystem::remove(filename);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
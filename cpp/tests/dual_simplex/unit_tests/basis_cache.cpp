@@ -0,0 +1,158 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/basis_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+constexpr int num_rows = 2;
+constexpr int num_cols = 5;
+
+std::vector<variable_status_t> make_vstatus(const std::vector<int>& basic_list)
+{
+  std::vector<variable_status_t> vstatus(num_cols, variable_status_t::NONBASIC_LOWER);
+  for (int j : basic_list) {
+    vstatus[j] = variable_status_t::BASIC;
+  }
+  return vstatus;
+}
+
+std::vector<int> make_nonbasic_list(const std::vector<int>& basic_list)
+{
+  const auto vstatus = make_vstatus(basic_list);
+  std::vector<int> nonbasic_list;
+  for (int j = 0; j < num_cols; ++j) {
+    if (vstatus[j] != variable_status_t::BASIC) { nonbasic_list.push_back(j); }
+  }
+  return nonbasic_list;
+}
+
+csc_matrix_t<int, double> identity(int n)
+{
+  csc_matrix_t<int, double> I(n, n, n);
+  for (int j = 0; j < n; ++j) {
+    I.col_start[j] = j;
+    I.i[j]         = j;
+    I.x[j]         = 1.0;
+  }
+  I.col_start[n] = n;
+  return I;
+}
+
+}  // namespace
+
+TEST(basis_cache, find)
+{
+  basis_cache_t<int, double> cache(2);
+  basis_update_mpf_t<int, double> factors(num_rows, 100);
+  std::vector<int> basic_list;
+  std::vector<int> nonbasic_list;
+  EXPECT_FALSE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+
+  cache.insert(factors, {3, 1}, make_nonbasic_list({1, 3}));
+  EXPECT_EQ(cache.size(), 1);
+
+  // The order of the basic columns does not matter, the cached order is returned
+  EXPECT_TRUE(cache.find(make_vstatus({1, 3}), factors, basic_list, nonbasic_list));
+  EXPECT_EQ(basic_list, (std::vector<int>{3, 1}));
+  EXPECT_EQ(nonbasic_list, (std::vector<int>{0, 2, 4}));
+
+  EXPECT_FALSE(cache.find(make_vstatus({1, 2}), factors, basic_list, nonbasic_list));
+  EXPECT_FALSE(cache.find(make_vstatus({1, 3, 4}), factors, basic_list, nonbasic_list));
+
+  // Inserting the same basis again replaces its entry
+  cache.insert(factors, {1, 3}, make_nonbasic_list({1, 3}));
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_TRUE(cache.find(make_vstatus({1, 3}), factors, basic_list, nonbasic_list));
+  EXPECT_EQ(basic_list, (std::vector<int>{1, 3}));
+}
+
+TEST(basis_cache, evict_least_recently_used)
+{
+  basis_cache_t<int, double> cache(2);
+  basis_update_mpf_t<int, double> factors(num_rows, 100);
+  std::vector<int> basic_list;
+  std::vector<int> nonbasic_list;
+  cache.insert(factors, {0, 1}, make_nonbasic_list({0, 1}));
+  cache.insert(factors, {2, 3}, make_nonbasic_list({2, 3}));
+
+  // Using {0, 1} makes {2, 3} the least recently used one
+  EXPECT_TRUE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+  cache.insert(factors, {3, 4}, make_nonbasic_list({3, 4}));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+  EXPECT_TRUE(cache.find(make_vstatus({3, 4}), factors, basic_list, nonbasic_list));
+  EXPECT_FALSE(cache.find(make_vstatus({2, 3}), factors, basic_list, nonbasic_list));
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+}
+
+TEST(basis_cache, rollback)
+{
+  basis_cache_t<int, double> cache(4);
+  basis_update_mpf_t<int, double> factors(num_rows, 100);
+  factors.reset(identity(num_rows), identity(num_rows), {0, 1});
+  std::vector<int> basic_list;
+  std::vector<int> nonbasic_list;
+  cache.insert(factors, {0, 1}, make_nonbasic_list({0, 1}));
+
+  // Column 2 = (2, 0) replaces column 0 of B = I, then column 3 = (0, 4) replaces column 1
+  ASSERT_EQ(factors.update(std::vector<double>{2.0, 0.0}, std::vector<double>{1.0, 0.0}, 0), 0);
+  cache.insert(factors, {2, 1}, make_nonbasic_list({1, 2}));
+  ASSERT_EQ(factors.update(std::vector<double>{0.0, 4.0}, std::vector<double>{0.0, 1.0}, 1), 0);
+  EXPECT_EQ(factors.num_updates(), 2);
+  std::vector<double> x(num_rows);
+  factors.b_solve(std::vector<double>{2.0, 4.0}, x);
+  EXPECT_NEAR(x[0], 1.0, 1e-12);
+  EXPECT_NEAR(x[1], 1.0, 1e-12);
+
+  // Going back to the first basis discards both updates and the basis that needed them
+  EXPECT_TRUE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+  EXPECT_EQ(factors.num_updates(), 0);
+  EXPECT_EQ(basic_list, (std::vector<int>{0, 1}));
+  factors.b_solve(std::vector<double>{2.0, 4.0}, x);
+  EXPECT_NEAR(x[0], 2.0, 1e-12);
+  EXPECT_NEAR(x[1], 4.0, 1e-12);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_FALSE(cache.find(make_vstatus({1, 2}), factors, basic_list, nonbasic_list));
+
+  // The updates continue from the restored basis
+  ASSERT_EQ(factors.update(std::vector<double>{0.0, 4.0}, std::vector<double>{0.0, 1.0}, 1), 0);
+  cache.insert(factors, {0, 3}, make_nonbasic_list({0, 3}));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.find(make_vstatus({0, 3}), factors, basic_list, nonbasic_list));
+  EXPECT_EQ(factors.num_updates(), 1);
+  factors.b_solve(std::vector<double>{2.0, 4.0}, x);
+  EXPECT_NEAR(x[0], 2.0, 1e-12);
+  EXPECT_NEAR(x[1], 1.0, 1e-12);
+
+  // A new factorization invalidates every entry
+  factors.reset();
+  EXPECT_FALSE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(basis_cache, disabled)
+{
+  basis_cache_t<int, double> cache(0);
+  basis_update_mpf_t<int, double> factors(num_rows, 100);
+  std::vector<int> basic_list;
+  std::vector<int> nonbasic_list;
+  cache.insert(factors, {0, 1}, make_nonbasic_list({0, 1}));
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.find(make_vstatus({0, 1}), factors, basic_list, nonbasic_list));
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
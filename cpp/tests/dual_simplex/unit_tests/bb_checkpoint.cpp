@@ -0,0 +1,219 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_checkpoint.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+constexpr int num_cols = 10;
+
+std::unique_ptr<mip_node_t<int, double>> make_child(mip_node_t<int, double>& parent,
+                                                    int branch_var,
+                                                    rounding_direction_t branch_dir,
+                                                    double lower_bound)
+{
+  auto child                = std::make_unique<mip_node_t<int, double>>();
+  child->parent             = &parent;
+  child->depth              = parent.depth + 1;
+  child->branch_var         = branch_var;
+  child->branch_dir         = branch_dir;
+  child->fractional_val     = 0.5;
+  child->branch_var_lower   = branch_dir == rounding_direction_t::DOWN ? 0.0 : 1.0;
+  child->branch_var_upper   = branch_dir == rounding_direction_t::DOWN ? 0.0 : 1.0;
+  child->lower_bound        = lower_bound;
+  child->objective_estimate = lower_bound + 1.0;
+  child->integer_infeasible = 3;
+  return child;
+}
+
+// root -> (d: x0 <= 0) -> (dd: x1 <= 0, fathomed), (du: x1 >= 1, pending)
+//      -> (u: x0 >= 1, pending and spilled)
+void build_tree(search_tree_t<int, double>& tree, const std::vector<variable_status_t>& root_basis)
+{
+  auto down         = make_child(tree.root, 0, rounding_direction_t::DOWN, 1.0);
+  auto up           = make_child(tree.root, 0, rounding_direction_t::UP, 2.0);
+  auto down_down    = make_child(*down, 1, rounding_direction_t::DOWN, 5.0);
+  auto down_up      = make_child(*down, 1, rounding_direction_t::UP, 1.5);
+  down->status      = node_status_t::HAS_CHILDREN;
+  down_down->status = node_status_t::FATHOMED;
+
+  down_up->vstatus    = root_basis;
+  down_up->vstatus[2] = variable_status_t::BASIC;
+  down_up->vstatus[7] = variable_status_t::NONBASIC_UPPER;
+  down->add_children(std::move(down_down), std::move(down_up));
+  tree.root.add_children(std::move(down), std::move(up));
+  tree.root.vstatus = root_basis;
+}
+
+bb_checkpoint_t<int, double> make_checkpoint(const search_tree_t<int, double>& tree,
+                                             const std::vector<variable_status_t>& root_basis)
+{
+  bb_checkpoint_t<int, double> checkpoint;
+  checkpoint.problem_hash      = 1234;
+  checkpoint.num_original_cols = num_cols;
+  checkpoint.lp_hash           = 5678;
+  checkpoint.root_vstatus      = root_basis;
+  checkpoint.incumbent.assign(num_cols, 1.0);
+  checkpoint.pseudo_cost_sum_down.assign(num_cols, 0.5);
+  checkpoint.pseudo_cost_sum_up.assign(num_cols, 1.5);
+  checkpoint.pseudo_cost_num_down.assign(num_cols, 2);
+  checkpoint.pseudo_cost_num_up.assign(num_cols, 3);
+  checkpoint.nodes_explored = 42;
+
+  // x0 + x3 >= 1
+  checkpoint.cuts           = csr_matrix_t<int, double>(1, num_cols, 2);
+  checkpoint.cuts.row_start = {0, 2};
+  checkpoint.cuts.j         = {0, 3};
+  checkpoint.cuts.x         = {1.0, 1.0};
+  checkpoint.cut_rhs        = {1.0};
+  checkpoint.cut_types      = {cut_type_t::KNAPSACK};
+  checkpoint.save_tree(tree);
+  return checkpoint;
+}
+
+std::string checkpoint_path(const std::string& name)
+{
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}  // namespace
+
+TEST(bb_checkpoint, save_and_restore_tree)
+{
+  const std::vector<variable_status_t> root_basis(num_cols, variable_status_t::NONBASIC_LOWER);
+  search_tree_t<int, double> tree;
+  build_tree(tree, root_basis);
+  const auto checkpoint = make_checkpoint(tree, root_basis);
+
+  // The fathomed node is dropped, its parent is kept as the ancestor of a pending node
+  ASSERT_EQ(checkpoint.nodes.size(), 3);
+  EXPECT_EQ(checkpoint.num_open_nodes(), 2);
+  EXPECT_FALSE(checkpoint.nodes[0].is_open);
+  EXPECT_TRUE(checkpoint.nodes[1].has_basis);
+  EXPECT_FALSE(checkpoint.nodes[2].has_basis);
+
+  search_tree_t<int, double> restored;
+  const std::vector<variable_status_t> new_root_basis(num_cols, variable_status_t::BASIC);
+  restored.root.vstatus = new_root_basis;
+  const auto built      = checkpoint.restore_tree(restored, true);
+  ASSERT_EQ(built.size(), 3);
+  for (auto node : built) {
+    ASSERT_NE(node, nullptr);
+  }
+  EXPECT_TRUE(restored.root.vstatus.empty());
+
+  mip_node_t<int, double>* down    = restored.root.get_down_child();
+  mip_node_t<int, double>* up      = restored.root.get_up_child();
+  mip_node_t<int, double>* down_up = down->get_up_child();
+  EXPECT_EQ(down->status, node_status_t::HAS_CHILDREN);
+  EXPECT_EQ(down->get_down_child(), nullptr);
+  EXPECT_EQ(down_up->status, node_status_t::PENDING);
+  EXPECT_EQ(down_up->parent, down);
+  EXPECT_EQ(down_up->depth, 2);
+  EXPECT_EQ(down_up->branch_var, 1);
+  EXPECT_EQ(down_up->branch_var_lower, 1.0);
+  EXPECT_EQ(down_up->lower_bound, 1.5);
+  EXPECT_EQ(down_up->vstatus, tree.root.get_down_child()->get_up_child()->vstatus);
+  // The spilled node starts from the basis of the new root
+  EXPECT_EQ(up->status, node_status_t::PENDING);
+  EXPECT_EQ(up->lower_bound, 2.0);
+  EXPECT_EQ(up->vstatus, new_root_basis);
+
+  // Without the bases, every open node starts from the new root
+  search_tree_t<int, double> without_bases;
+  without_bases.root.vstatus = new_root_basis;
+  checkpoint.restore_tree(without_bases, false);
+  EXPECT_EQ(without_bases.root.get_down_child()->get_up_child()->vstatus, new_root_basis);
+}
+
+TEST(bb_checkpoint, write_and_read)
+{
+  const std::vector<variable_status_t> root_basis(num_cols, variable_status_t::NONBASIC_LOWER);
+  search_tree_t<int, double> tree;
+  build_tree(tree, root_basis);
+  const auto checkpoint  = make_checkpoint(tree, root_basis);
+  const std::string path = checkpoint_path("cuopt_bb_checkpoint_test.bin");
+
+  const int64_t size = write_bb_checkpoint(path, checkpoint);
+  ASSERT_GT(size, 0);
+  EXPECT_EQ(static_cast<int64_t>(std::filesystem::file_size(path)), size);
+
+  bb_checkpoint_t<int, double> read;
+  ASSERT_TRUE(read_bb_checkpoint(path, read));
+  EXPECT_EQ(read.problem_hash, checkpoint.problem_hash);
+  EXPECT_EQ(read.lp_hash, checkpoint.lp_hash);
+  EXPECT_EQ(read.root_vstatus, checkpoint.root_vstatus);
+  EXPECT_EQ(read.incumbent, checkpoint.incumbent);
+  EXPECT_EQ(read.pseudo_cost_sum_up, checkpoint.pseudo_cost_sum_up);
+  EXPECT_EQ(read.pseudo_cost_num_down, checkpoint.pseudo_cost_num_down);
+  EXPECT_EQ(read.cuts.row_start, checkpoint.cuts.row_start);
+  EXPECT_EQ(read.cuts.j, checkpoint.cuts.j);
+  EXPECT_EQ(read.cut_rhs, checkpoint.cut_rhs);
+  EXPECT_EQ(read.cut_types, checkpoint.cut_types);
+  EXPECT_EQ(read.nodes_explored, 42);
+  ASSERT_EQ(read.nodes.size(), checkpoint.nodes.size());
+  for (size_t k = 0; k < read.nodes.size(); ++k) {
+    EXPECT_EQ(read.nodes[k].parent, checkpoint.nodes[k].parent);
+    EXPECT_EQ(read.nodes[k].branch_dir, checkpoint.nodes[k].branch_dir);
+    EXPECT_EQ(read.nodes[k].lower_bound, checkpoint.nodes[k].lower_bound);
+    EXPECT_EQ(read.nodes[k].basis, checkpoint.nodes[k].basis);
+  }
+
+  // A damaged or truncated checkpoint is rejected
+  std::FILE* file = std::fopen(path.c_str(), "r+b");
+  ASSERT_NE(file, nullptr);
+  std::fseek(file, size / 2, SEEK_SET);
+  const int byte = std::fgetc(file);
+  std::fseek(file, size / 2, SEEK_SET);
+  std::fputc(byte ^ 0x10, file);
+  std::fclose(file);
+  EXPECT_FALSE(read_bb_checkpoint(path, read));
+  std::filesystem::resize_file(path, size / 2);
+  EXPECT_FALSE(read_bb_checkpoint(path, read));
+  std::filesystem::remove(path);
+  EXPECT_FALSE(read_bb_checkpoint(path, read));
+}
+
+TEST(bb_checkpoint, writer)
+{
+  const std::vector<variable_status_t> root_basis(num_cols, variable_status_t::NONBASIC_LOWER);
+  search_tree_t<int, double> tree;
+  build_tree(tree, root_basis);
+  const std::string path = checkpoint_path("cuopt_bb_checkpoint_writer_test.bin");
+  {
+    bb_checkpoint_writer_t<int, double> writer(path);
+    for (int k = 0; k < 3; ++k) {
+      auto checkpoint            = std::make_unique<bb_checkpoint_t<int, double>>();
+      *checkpoint                = make_checkpoint(tree, root_basis);
+      checkpoint->nodes_explored = k;
+      writer.write(std::move(checkpoint));
+    }
+    writer.wait();
+    EXPECT_FALSE(writer.busy());
+    EXPECT_GE(writer.num_written(), 1);
+    EXPECT_EQ(writer.num_failed(), 0);
+  }
+
+  // The last checkpoint is the one on disk
+  bb_checkpoint_t<int, double> read;
+  ASSERT_TRUE(read_bb_checkpoint(path, read));
+  EXPECT_EQ(read.nodes_explored, 2);
+  EXPECT_EQ(read.num_open_nodes(), 2);
+  std::filesystem::remove(path);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,188 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/bb_trace.hpp>
+#include <branch_and_bound/branch_and_bound_worker.hpp>
+
+#include <cuopt/error.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+bb_trace_record_t make_record(bb_trace_record_type_t type,
+                              int worker,
+                              int strategy,
+                              double wall_time,
+                              double objective,
+                              double incumbent)
+{
+  bb_trace_record_t record{};
+  record.wall_time       = wall_time;
+  record.objective       = objective;
+  record.incumbent       = incumbent;
+  record.branch_var      = -1;
+  record.worker_id       = worker;
+  record.type            = static_cast<uint8_t>(type);
+  record.search_strategy = strategy;
+  return record;
+}
+
+constexpr double inf = std::numeric_limits<double>::infinity();
+
+bb_trace_record_t make_node(
+  bb_trace_record_type_t type, int worker, int strategy, double wall_time, int depth)
+{
+  auto record          = make_record(type, worker, strategy, wall_time, 1.0, inf);
+  record.depth         = depth;
+  record.lp_iterations = 10;
+  record.duration      = 0.5;
+  return record;
+}
+
+bb_trace_record_t make_task(int worker, int strategy, double wall_time, double duration, int nodes)
+{
+  auto record     = make_record(bb_trace_record_type_t::TASK, worker, strategy, wall_time, 0, inf);
+  record.duration = duration;
+  record.node_id  = nodes;
+  return record;
+}
+
+}  // namespace
+
+TEST(bb_trace, write_read_and_profile)
+{
+  using type                                   = bb_trace_record_type_t;
+  const std::vector<bb_trace_record_t> written = {
+    make_record(type::BOUNDS, -1, 0, 1.0, 0.0, inf),
+    // Worker 0 plunges from the root
+    make_node(type::NODE_BRANCHED, 0, BEST_FIRST, 1.5, 0),
+    make_node(type::NODE_BRANCHED, 0, BEST_FIRST, 2.0, 1),
+    make_node(type::NODE_FATHOMED, 0, BEST_FIRST, 2.5, 2),
+    make_task(0, BEST_FIRST, 2.5, 1.5, 3),
+    // Worker 1 dives twice, the second dive finds a solution
+    make_node(type::NODE_INFEASIBLE, 1, GUIDED_DIVING, 3.0, 2),
+    make_task(1, GUIDED_DIVING, 3.0, 0.5, 1),
+    make_node(type::NODE_BRANCHED, 1, GUIDED_DIVING, 3.5, 2),
+    make_node(type::NODE_INTEGER, 1, GUIDED_DIVING, 4.0, 3),
+    make_task(1, GUIDED_DIVING, 4.0, 1.0, 2),
+    make_record(type::BOUNDS, -1, 0, 4.5, 0.5, 2.0),
+    make_record(type::BOUNDS, -1, 0, 5.0, 0.5, 2.0),
+    make_record(type::BOUNDS, -1, 0, 5.0, 2.0, 2.0),
+  };
+
+  const std::string path = ::testing::TempDir() + "bb_trace.bin";
+  {
+    bb_trace_writer_t writer(path, 2, false, 1.0);
+    ASSERT_TRUE(writer.is_open());
+    for (const auto& record : written) {
+      writer.write(record);
+    }
+  }
+
+  bb_trace_header_t header;
+  std::vector<bb_trace_record_t> records;
+  read_bb_trace(path, header, records);
+  std::remove(path.c_str());
+  EXPECT_EQ(header.num_workers, 2);
+  EXPECT_EQ(header.deterministic, 0);
+  EXPECT_EQ(header.search_start_time, 1.0);
+  ASSERT_EQ(records.size(), written.size());
+  for (size_t k = 0; k < records.size(); ++k) {
+    EXPECT_EQ(records[k].wall_time, written[k].wall_time);
+    EXPECT_EQ(records[k].type, written[k].type);
+    EXPECT_EQ(records[k].worker_id, written[k].worker_id);
+  }
+
+  const auto profile = profile_bb_trace(header, records);
+  EXPECT_DOUBLE_EQ(profile.search_time, 4.0);
+  EXPECT_EQ(profile.nodes_by_type[static_cast<int>(type::NODE_BRANCHED)], 3);
+  EXPECT_EQ(profile.nodes_by_type[static_cast<int>(type::NODE_INTEGER)], 1);
+  EXPECT_EQ(profile.tree_nodes, 3);
+  EXPECT_EQ(profile.dive_nodes, 3);
+  EXPECT_EQ(profile.tree_nodes_per_depth, (std::vector<int64_t>{1, 1, 1}));
+
+  ASSERT_EQ(profile.workers.size(), 2);
+  EXPECT_EQ(profile.workers[0].tasks, 1);
+  EXPECT_EQ(profile.workers[0].nodes, 3);
+  EXPECT_EQ(profile.workers[0].lp_iterations, 30);
+  EXPECT_DOUBLE_EQ(profile.workers[0].lp_time, 1.5);
+  EXPECT_DOUBLE_EQ(profile.workers[0].idle_time, 2.5);
+  EXPECT_EQ(profile.workers[1].tasks, 2);
+  EXPECT_DOUBLE_EQ(profile.workers[1].busy_time, 1.5);
+
+  const auto& guided = profile.dives_per_strategy[GUIDED_DIVING];
+  EXPECT_EQ(guided.dives, 2);
+  EXPECT_EQ(guided.successful, 1);
+  EXPECT_EQ(guided.nodes, 3);
+  EXPECT_EQ(profile.dives_per_strategy[BEST_FIRST].dives, 0);
+
+  // The curve starts at the first bounds and only keeps changes
+  ASSERT_EQ(profile.bound_curve.size(), 3);
+  EXPECT_EQ(profile.bound_curve[0].bound, 0.0);
+  EXPECT_EQ(profile.bound_curve[0].incumbent, inf);
+  EXPECT_EQ(profile.bound_curve[1].wall_time, 4.5);
+  EXPECT_EQ(profile.bound_curve[1].incumbent, 2.0);
+  EXPECT_EQ(profile.bound_curve[2].bound, 2.0);
+}
+
+TEST(bb_trace, profile_skips_unknown_workers)
+{
+  using type                                   = bb_trace_record_type_t;
+  const std::vector<bb_trace_record_t> records = {
+    make_node(type::NODE_BRANCHED, 0, BEST_FIRST, 1.5, 0),
+    make_node(type::NODE_BRANCHED, -5, BEST_FIRST, 2.0, 1),
+    make_node(type::NODE_INTEGER, 5, GUIDED_DIVING, 2.5, 2),
+    make_task(-1, GUIDED_DIVING, 2.5, 1.0, 1),
+    make_task(2, GUIDED_DIVING, 3.0, 1.0, 1),
+    make_task(0, BEST_FIRST, 3.0, 1.5, 1),
+    make_record(type::BOUNDS, -1, 0, 3.5, 1.0, 2.0),
+  };
+  bb_trace_header_t header{};
+  header.num_workers       = 2;
+  header.search_start_time = 1.0;
+
+  const auto profile = profile_bb_trace(header, records);
+  EXPECT_EQ(profile.skipped_records, 4);
+  ASSERT_EQ(profile.workers.size(), 2);
+  EXPECT_EQ(profile.workers[0].nodes, 1);
+  EXPECT_EQ(profile.workers[0].tasks, 1);
+  EXPECT_EQ(profile.workers[1].tasks, 0);
+  EXPECT_EQ(profile.tree_nodes, 1);
+  EXPECT_EQ(profile.dive_nodes, 0);
+  EXPECT_EQ(profile.dives_per_strategy[GUIDED_DIVING].dives, 0);
+}
+
+TEST(bb_trace, rejects_other_files)
+{
+  const std::string path = ::testing::TempDir() + "not_a_bb_trace.bin";
+  {
+    std::ofstream out(path);
+    out << "this is not a branch-and-bound trace, only some text\n";
+  }
+  bb_trace_header_t header;
+  std::vector<bb_trace_record_t> records;
+  EXPECT_THROW(read_bb_trace(path, header, records), cuopt::logic_error);
+  std::remove(path.c_str());
+  EXPECT_THROW(read_bb_trace(path, header, records), cuopt::logic_error);
+
+  // A trace that cannot be created is disabled instead of stopping the solve
+  bb_trace_writer_t writer(::testing::TempDir() + "missing_dir/trace.bin", 1, false, 0.0);
+  EXPECT_FALSE(writer.is_open());
+  writer.write(bb_trace_record_t{});
+  writer.flush();
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
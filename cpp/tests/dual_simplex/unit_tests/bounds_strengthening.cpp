@@ -0,0 +1,137 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/bounds_strengthening.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// Random problem with integer coefficients and integer variables in [0, 5], so the bounds
+// strengthening fixed point does not depend on the order in which the rows are visited
+lp_problem_t<int, double> random_integer_problem(int m, int n, std::mt19937& gen)
+{
+  std::uniform_int_distribution<int> coeff(-4, 4);
+  std::uniform_int_distribution<int> rhs(0, 12);
+  std::bernoulli_distribution nonzero(0.5);
+
+  lp_problem_t<int, double> problem(nullptr, m, n, m * n);
+  int nz = 0;
+  for (int j = 0; j < n; ++j) {
+    problem.A.col_start[j] = nz;
+    for (int i = 0; i < m; ++i) {
+      const int a = coeff(gen);
+      if (a == 0 || !nonzero(gen)) { continue; }
+      problem.A.i[nz] = i;
+      problem.A.x[nz] = a;
+      ++nz;
+    }
+    problem.lower[j] = 0.0;
+    problem.upper[j] = 5.0;
+  }
+  problem.A.col_start[n] = nz;
+  for (int i = 0; i < m; ++i) {
+    problem.rhs[i] = rhs(gen);
+  }
+  return problem;
+}
+
+}  // namespace
+
+TEST(bounds_strengthening, incremental_matches_full_and_backtracks)
+{
+  constexpr int m = 6;
+  constexpr int n = 10;
+  simplex_solver_settings_t<int, double> settings;
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> var(0, n - 1);
+  std::bernoulli_distribution down(0.5);
+
+  int num_infeasible = 0;
+  for (int trial = 0; trial < 50; ++trial) {
+    const auto problem = random_integer_problem(m, n, gen);
+    csr_matrix_t<int, double> Arow(m, n, 0);
+    problem.A.to_compressed_row(Arow);
+    const std::vector<char> row_sense(m, 'L');
+    const std::vector<variable_type_t> var_types(n, variable_type_t::INTEGER);
+
+    bounds_strengthening_t<int, double> full(problem, Arow, row_sense, var_types);
+    incremental_bounds_strengthening_t<int, double> incremental(
+      problem, Arow, row_sense, var_types);
+
+    std::vector<double> lower = problem.lower;
+    std::vector<double> upper = problem.upper;
+    incremental.reset({}, lower, upper);
+    bool feasible = incremental.propagate(settings, lower, upper);
+
+    std::vector<size_t> marks;
+    std::vector<std::vector<double>> path_lower;
+    std::vector<std::vector<double>> path_upper;
+    while (feasible && marks.size() < 6) {
+      const int j = var(gen);
+      if (lower[j] == upper[j]) { continue; }
+      const double mid = std::floor((lower[j] + upper[j]) / 2);
+      marks.push_back(incremental.mark());
+      path_lower.push_back(lower);
+      path_upper.push_back(upper);
+
+      std::vector<double> branch_lower = lower;
+      std::vector<double> branch_upper = upper;
+      if (down(gen)) {
+        branch_upper[j] = mid;
+      } else {
+        branch_lower[j] = mid + 1;
+      }
+      incremental.tighten_bounds(j, branch_lower[j], branch_upper[j], lower, upper);
+      feasible = incremental.propagate(settings, lower, upper);
+
+      // Strengthening the bounds of the branch from scratch gives the same bounds
+      const bool full_feasible =
+        full.bounds_strengthening(settings, {}, branch_lower, branch_upper);
+      ASSERT_EQ(feasible, full_feasible);
+      if (feasible) {
+        EXPECT_EQ(lower, branch_lower);
+        EXPECT_EQ(upper, branch_upper);
+      }
+    }
+    if (!feasible) { ++num_infeasible; }
+
+    // Backtracking restores the bounds and the activities of every node on the path
+    while (!marks.empty()) {
+      incremental.backtrack(marks.back(), lower, upper);
+      EXPECT_EQ(lower, path_lower.back());
+      EXPECT_EQ(upper, path_upper.back());
+
+      // Fixing a variable after backtracking still matches a strengthening from scratch
+      const int j = var(gen);
+      std::vector<double> fixed_lower = lower;
+      std::vector<double> fixed_upper = upper;
+      fixed_upper[j]                  = fixed_lower[j];
+      incremental.tighten_bounds(j, lower[j], lower[j], lower, upper);
+      const bool fixed_feasible = incremental.propagate(settings, lower, upper);
+      ASSERT_EQ(fixed_feasible, full.bounds_strengthening(settings, {}, fixed_lower, fixed_upper));
+      if (fixed_feasible) {
+        EXPECT_EQ(lower, fixed_lower);
+        EXPECT_EQ(upper, fixed_upper);
+      }
+      incremental.backtrack(marks.back(), lower, upper);
+      marks.pop_back();
+      path_lower.pop_back();
+      path_upper.pop_back();
+    }
+  }
+  // Some of the paths end on an infeasible node
+  EXPECT_GT(num_infeasible, 0);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,193 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/conflict_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+TEST(conflict_pool, conflict_from_proof)
+{
+  simplex_solver_settings_t<int, double> settings;
+  // x0 + x1 + x2 + 0.5 y = 1 with binaries x and a continuous y in [0, 1]
+  const std::vector<int> index     = {0, 1, 2, 3};
+  const std::vector<double> coeff  = {1.0, 1.0, 1.0, 0.5};
+  const std::vector<double> global_lower(4, 0.0);
+  const std::vector<double> global_upper(4, 1.0);
+  const std::vector<variable_type_t> var_types = {variable_type_t::BINARY,
+                                                  variable_type_t::BINARY,
+                                                  variable_type_t::BINARY,
+                                                  variable_type_t::CONTINUOUS};
+  std::vector<conflict_literal_t<int, double>> conflict;
+
+  // x0 = 1 and x1 = 1 cannot hold together, x2 = 1 is not needed
+  std::vector<double> lower = {1.0, 1.0, 1.0, 0.0};
+  std::vector<double> upper = {1.0, 1.0, 1.0, 1.0};
+  ASSERT_TRUE(conflict_from_proof(
+    index, coeff, 1.0, lower, upper, global_lower, global_upper, var_types, settings, 10, conflict));
+  ASSERT_EQ(conflict.size(), 2);
+  for (const auto& literal : conflict) {
+    EXPECT_FALSE(literal.is_upper);
+    EXPECT_EQ(literal.bound, 1.0);
+  }
+  EXPECT_NE(conflict[0].j, conflict[1].j);
+  EXPECT_LT(conflict[0].j, 3);
+  EXPECT_LT(conflict[1].j, 3);
+
+  // Too many literals
+  EXPECT_FALSE(conflict_from_proof(
+    index, coeff, 1.0, lower, upper, global_lower, global_upper, var_types, settings, 1, conflict));
+
+  // The infeasibility needs the bound on the continuous variable
+  lower = {0.0, 0.0, 0.0, 0.6};
+  upper = {0.0, 0.0, 0.0, 1.0};
+  EXPECT_FALSE(conflict_from_proof(
+    index, coeff, 0.2, lower, upper, global_lower, global_upper, var_types, settings, 10, conflict));
+
+  // Whatever the value of the continuous variable, two of the bounds x <= 0 are enough to stay
+  // below the right-hand side
+  lower = {0.0, 0.0, 0.0, 0.0};
+  ASSERT_TRUE(conflict_from_proof(
+    index, coeff, 2.0, lower, upper, global_lower, global_upper, var_types, settings, 10, conflict));
+  ASSERT_EQ(conflict.size(), 2);
+  EXPECT_TRUE(conflict[0].is_upper);
+  EXPECT_EQ(conflict[0].bound, 0.0);
+
+  // Feasible bounds are not a proof
+  upper = {1.0, 1.0, 0.0, 1.0};
+  EXPECT_FALSE(conflict_from_proof(
+    index, coeff, 1.0, lower, upper, global_lower, global_upper, var_types, settings, 10, conflict));
+}
+
+TEST(conflict_pool, propagate_and_age)
+{
+  conflict_pool_t<int, double> pool(4, 2);
+  // Not both x0 >= 1 and x1 <= 0
+  pool.add_conflict({{0, 1.0, false}, {1, 0.0, true}});
+
+  std::vector<conflict_literal_t<int, double>> implied;
+  std::vector<double> lower = {1.0, 0.0, 0.0};
+  std::vector<double> upper = {1.0, 0.0, 1.0};
+  EXPECT_FALSE(pool.propagate(lower, upper, implied));
+  EXPECT_EQ(pool.num_pruned(), 1);
+
+  // x0 = 1 implies x1 >= 1
+  upper[1] = 1.0;
+  EXPECT_TRUE(pool.propagate(lower, upper, implied));
+  ASSERT_EQ(implied.size(), 1);
+  EXPECT_EQ(implied[0].j, 1);
+  EXPECT_EQ(implied[0].bound, 1.0);
+  EXPECT_FALSE(implied[0].is_upper);
+
+  // x0 = 0 satisfies the conflict
+  implied.clear();
+  lower[0] = 0.0;
+  upper[0] = 0.0;
+  EXPECT_TRUE(pool.propagate(lower, upper, implied));
+  EXPECT_TRUE(implied.empty());
+
+  // When the pool is full, the conflicts not used recently are dropped first
+  for (int k = 0; k < 3; ++k) {
+    pool.add_conflict({{2, 1.0, false}});
+  }
+  EXPECT_EQ(pool.size(), 4);
+  lower[0] = 1.0;
+  upper[0] = 1.0;
+  upper[1] = 0.0;
+  EXPECT_FALSE(pool.propagate(lower, upper, implied));
+  pool.add_conflict({{2, 0.0, true}});
+  EXPECT_EQ(pool.size(), 3);
+  EXPECT_EQ(pool.num_added(), 5);
+  // The first conflict was used by the last propagation, so it is still in the pool
+  EXPECT_FALSE(pool.propagate(lower, upper, implied));
+}
+
+TEST(conflict_pool, watches)
+{
+  // The watches find the same prunings and implications as checking every conflict
+  constexpr int n = 30;
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> var(0, n - 1);
+  std::uniform_int_distribution<int> coin(0, 1);
+  std::uniform_int_distribution<int> num_literals(1, 4);
+
+  conflict_pool_t<int, double> pool(1000, 1000);
+  std::vector<std::vector<conflict_literal_t<int, double>>> conflicts;
+  for (int c = 0; c < 200; ++c) {
+    std::vector<conflict_literal_t<int, double>> literals;
+    const int size = c < 5 ? 1 : num_literals(rng) + 1;
+    for (int k = 0; k < size; ++k) {
+      const bool is_upper = coin(rng);
+      literals.push_back({var(rng), is_upper ? 0.0 : 1.0, is_upper});
+    }
+    pool.add_conflict(literals);
+    conflicts.push_back(literals);
+  }
+
+  int num_pruned = 0;
+  for (int trial = 0; trial < 500; ++trial) {
+    std::vector<double> lower(n, 0.0);
+    std::vector<double> upper(n, 1.0);
+    for (int k = 0; k < 8; ++k) {
+      const int j = var(rng);
+      if (coin(rng)) {
+        lower[j] = 1.0;
+      } else {
+        upper[j] = 0.0;
+      }
+      if (lower[j] > upper[j]) { lower[j] = upper[j]; }
+    }
+
+    bool feasible = true;
+    std::vector<std::tuple<int, double, bool>> expected;
+    for (const auto& literals : conflicts) {
+      int num_open   = 0;
+      int open       = -1;
+      bool redundant = false;
+      for (int k = 0; k < static_cast<int>(literals.size()); ++k) {
+        const auto& l = literals[k];
+        if (l.is_upper ? upper[l.j] <= l.bound : lower[l.j] >= l.bound) { continue; }
+        if ((l.is_upper ? lower[l.j] > l.bound : upper[l.j] < l.bound) || ++num_open > 1) {
+          redundant = true;
+          break;
+        }
+        open = k;
+      }
+      if (redundant) { continue; }
+      if (open < 0) {
+        feasible = false;
+        break;
+      }
+      const auto& l = literals[open];
+      expected.emplace_back(l.j, l.is_upper ? l.bound + 1 : l.bound - 1, !l.is_upper);
+    }
+
+    std::vector<conflict_literal_t<int, double>> implied;
+    ASSERT_EQ(pool.propagate(lower, upper, implied), feasible);
+    if (!feasible) {
+      ++num_pruned;
+      continue;
+    }
+    std::vector<std::tuple<int, double, bool>> found;
+    for (const auto& l : implied) {
+      found.emplace_back(l.j, l.bound, l.is_upper);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+  }
+  EXPECT_GT(num_pruned, 0);
+  EXPECT_LT(num_pruned, 500);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,160 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuts/cuts.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// Builds the problem A x + s = rhs, with one slack s_i in [0, inf] per row after the columns of A
+lp_problem_t<int, double> problem_with_slacks(const std::vector<std::vector<double>>& A,
+                                              const std::vector<double>& rhs,
+                                              const std::vector<double>& upper,
+                                              std::vector<int>& new_slacks)
+{
+  const int m = A.size();
+  const int n = upper.size();
+  lp_problem_t<int, double> problem(nullptr, m, n + m, m * n + m);
+  int nz = 0;
+  for (int j = 0; j < n + m; ++j) {
+    problem.A.col_start[j] = nz;
+    for (int i = 0; i < m; ++i) {
+      const double a = j < n ? A[i][j] : (j - n == i ? 1.0 : 0.0);
+      if (a == 0.0) { continue; }
+      problem.A.i[nz] = i;
+      problem.A.x[nz] = a;
+      ++nz;
+    }
+    problem.lower[j] = 0.0;
+    problem.upper[j] = j < n ? upper[j] : inf;
+  }
+  problem.A.col_start[n + m] = nz;
+  problem.A.i.resize(nz);
+  problem.A.x.resize(nz);
+  problem.rhs = rhs;
+  new_slacks.clear();
+  for (int i = 0; i < m; ++i) {
+    new_slacks.push_back(n + i);
+  }
+  return problem;
+}
+
+}  // namespace
+
+TEST(cover_cuts, lifted_flow_cover)
+{
+  simplex_solver_settings_t<int, double> settings;
+  // y0 + y1 + y2 <= 7 and y_j <= 5 x_j, with continuous y in [0, 10] and binaries x
+  std::vector<int> new_slacks;
+  const auto problem = problem_with_slacks({{1, 1, 1, 0, 0, 0},
+                                            {1, 0, 0, -5, 0, 0},
+                                            {0, 1, 0, 0, -5, 0},
+                                            {0, 0, 1, 0, 0, -5}},
+                                           {7, 0, 0, 0},
+                                           {10, 10, 10, 1, 1, 1},
+                                           new_slacks);
+  std::vector<variable_type_t> var_types(problem.num_cols, variable_type_t::CONTINUOUS);
+  for (int j = 3; j < 6; ++j) {
+    var_types[j] = variable_type_t::INTEGER;
+  }
+  csr_matrix_t<int, double> Arow(problem.num_rows, problem.num_cols, 0);
+  problem.A.to_compressed_row(Arow);
+
+  flow_cover_generation_t<int, double> flow_cover(problem, settings, Arow, new_slacks, var_types);
+  ASSERT_EQ(flow_cover.num_flow_rows(), 1);
+  EXPECT_EQ(flow_cover.get_flow_rows()[0], 0);
+
+  // The cover {0, 1} has lambda = 3. The flow y2 is lifted with F(5) = 3, which gives
+  // y0 + y1 + y2 - 2 x0 - 2 x1 - 2 x2 <= 3
+  const std::vector<double> xstar = {5, 1, 1, 1, 0.2, 0.2, 0, 0, 0, 0};
+  sparse_vector_t<int, double> cut(problem.num_cols, 0);
+  double cut_rhs;
+  ASSERT_EQ(flow_cover.generate_flow_cover_cut(
+              problem, settings, Arow, var_types, xstar, 0, 1, cut, cut_rhs),
+            0);
+  EXPECT_LT(cut.dot(xstar), cut_rhs);
+  ASSERT_EQ(cut.i.size(), 6);
+  EXPECT_DOUBLE_EQ(cut_rhs, -3.0);
+  for (int k = 0; k < 6; ++k) {
+    EXPECT_DOUBLE_EQ(cut.x[k], cut.i[k] < 3 ? -1.0 : 2.0);
+  }
+
+  // The cut holds at every integer point of the flow set
+  std::vector<double> x(problem.num_cols, 0.0);
+  for (int mask = 0; mask < 8; ++mask) {
+    for (int y0 = 0; y0 <= 5; ++y0) {
+      for (int y1 = 0; y1 <= 5; ++y1) {
+        for (int y2 = 0; y2 <= 5; ++y2) {
+          x[0] = y0;
+          x[1] = y1;
+          x[2] = y2;
+          for (int j = 0; j < 3; ++j) {
+            x[3 + j] = (mask >> j) & 1;
+          }
+          if (y0 + y1 + y2 > 7 || y0 > 5 * x[3] || y1 > 5 * x[4] || y2 > 5 * x[5]) { continue; }
+          EXPECT_GE(cut.dot(x), cut_rhs - 1e-9);
+        }
+      }
+    }
+  }
+
+  // The row has no finite lower bound, so it cannot be read as a >= inequality
+  EXPECT_NE(flow_cover.generate_flow_cover_cut(
+              problem, settings, Arow, var_types, xstar, 0, -1, cut, cut_rhs),
+            0);
+  // A relaxation that respects the cover inequality gives no cut
+  const std::vector<double> integer_xstar = {5, 2, 0, 1, 1, 0, 0, 0, 3, 0};
+  EXPECT_NE(flow_cover.generate_flow_cover_cut(
+              problem, settings, Arow, var_types, integer_xstar, 0, 1, cut, cut_rhs),
+            0);
+}
+
+TEST(cover_cuts, lifted_knapsack_cover)
+{
+  simplex_solver_settings_t<int, double> settings;
+  // 3 x0 + 3 x1 + 3 x2 + 6 x3 <= 7 with binaries x
+  std::vector<int> new_slacks;
+  const auto problem = problem_with_slacks({{3, 3, 3, 6}}, {7}, {1, 1, 1, 1}, new_slacks);
+  std::vector<variable_type_t> var_types(problem.num_cols, variable_type_t::CONTINUOUS);
+  for (int j = 0; j < 4; ++j) {
+    var_types[j] = variable_type_t::INTEGER;
+  }
+  csr_matrix_t<int, double> Arow(problem.num_rows, problem.num_cols, 0);
+  problem.A.to_compressed_row(Arow);
+
+  knapsack_generation_t<int, double> knapsack(problem, settings, Arow, new_slacks, var_types);
+  ASSERT_EQ(knapsack.num_knapsack_constraints(), 1);
+
+  // The cover {0, 1, 2} is lifted to x0 + x1 + x2 + 2 x3 <= 2
+  const std::vector<double> xstar = {1, 1, 1.0 / 3.0, 0, 0};
+  sparse_vector_t<int, double> cut(problem.num_cols, 0);
+  double cut_rhs;
+  ASSERT_EQ(knapsack.generate_knapsack_cuts(
+              problem, settings, Arow, new_slacks, var_types, xstar, 0, cut, cut_rhs),
+            0);
+  EXPECT_DOUBLE_EQ(cut_rhs, -2.0);
+  ASSERT_EQ(cut.i.size(), 4);
+  EXPECT_EQ(cut.i[3], 3);
+  EXPECT_DOUBLE_EQ(cut.x[3], -2.0);
+
+  for (int mask = 0; mask < 16; ++mask) {
+    std::vector<double> x(problem.num_cols, 0.0);
+    double weight = 0.0;
+    for (int j = 0; j < 4; ++j) {
+      x[j] = (mask >> j) & 1;
+      weight += problem.A.x[problem.A.col_start[j]] * x[j];
+    }
+    if (weight <= 7) { EXPECT_GE(cut.dot(x), cut_rhs); }
+  }
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,58 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <cuts/cuts.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+TEST(cut_pool, get_violated_cuts)
+{
+  simplex_solver_settings_t<int, double> settings;
+  cut_pool_t<int, double> pool(3, settings);
+
+  auto make_cut = [](const std::vector<int>& index, const std::vector<double>& coeff) {
+    sparse_vector_t<int, double> cut(3, 0);
+    cut.i = index;
+    cut.x = coeff;
+    return cut;
+  };
+  // x0 + x1 >= 1, 2 x0 + 2 x1 >= 2 (parallel to the first one) and x2 >= 1
+  pool.add_cut(cut_type_t::KNAPSACK, make_cut({0, 1}, {1.0, 1.0}), 1.0);
+  pool.add_cut(cut_type_t::MIXED_INTEGER_ROUNDING, make_cut({0, 1}, {2.0, 2.0}), 2.0);
+  pool.add_cut(cut_type_t::MIXED_INTEGER_GOMORY, make_cut({2}, {1.0}), 1.0);
+
+  csr_matrix_t<int, double> cuts(0, 3, 0);
+  std::vector<double> rhs;
+  std::vector<cut_type_t> types;
+
+  // Only x2 >= 1 is violated
+  EXPECT_EQ(pool.get_violated_cuts({0.5, 0.5, 0.5}, 10, cuts, rhs, types), 1);
+  ASSERT_EQ(cuts.m, 1);
+  EXPECT_EQ(types[0], cut_type_t::MIXED_INTEGER_GOMORY);
+  // The cuts are returned as -x2 <= -1
+  EXPECT_EQ(rhs[0], -1.0);
+  EXPECT_EQ(cuts.x[0], -1.0);
+
+  // The parallel cut is skipped, and x0 + x1 >= 1 is the most violated one
+  EXPECT_EQ(pool.get_violated_cuts({0.0, 0.0, 0.9}, 10, cuts, rhs, types), 2);
+  EXPECT_EQ(cuts.m, 2);
+  EXPECT_NE(types[0], types[1]);
+  EXPECT_NE(types[0], cut_type_t::MIXED_INTEGER_GOMORY);
+
+  EXPECT_EQ(pool.get_violated_cuts({0.0, 0.0, 0.0}, 1, cuts, rhs, types), 1);
+  EXPECT_EQ(pool.get_violated_cuts({1.0, 0.0, 1.0}, 10, cuts, rhs, types), 0);
+  EXPECT_EQ(cuts.m, 0);
+
+  // The pool is unchanged
+  EXPECT_EQ(pool.pool_size(), 3);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,151 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/feasibility_jump.hpp>
+#include <dual_simplex/tic_toc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <omp.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// Assignment of 3 workers to 3 jobs, x_ij binary, with sum_j x_ij = 1 and sum_i x_ij = 1. The
+// range row 1 <= x_00 + x_11 + x_22 <= 2 excludes the identity and the assignments without a
+// diagonal entry.
+user_problem_t<int, double> assignment_problem(const std::vector<double>& cost)
+{
+  constexpr int k = 3;
+  const int m     = 2 * k + 1;
+  const int n     = k * k;
+  user_problem_t<int, double> problem(nullptr);
+  problem.num_rows  = m;
+  problem.num_cols  = n;
+  problem.objective = cost;
+  problem.A.m       = m;
+  problem.A.n       = n;
+  problem.A.nz_max  = 2 * n + k;
+  problem.A.reallocate(problem.A.nz_max);
+  problem.A.col_start.resize(n + 1);
+  int nz = 0;
+  for (int j = 0; j < n; ++j) {
+    problem.A.col_start[j] = nz;
+    const int worker       = j / k;
+    const int job          = j % k;
+    problem.A.i[nz]        = worker;
+    problem.A.x[nz++]      = 1.0;
+    problem.A.i[nz]        = k + job;
+    problem.A.x[nz++]      = 1.0;
+    if (worker == job) {
+      problem.A.i[nz]   = 2 * k;
+      problem.A.x[nz++] = 1.0;
+    }
+  }
+  problem.A.col_start[n] = nz;
+  problem.rhs.assign(m, 1.0);
+  problem.row_sense.assign(m, 'E');
+  problem.row_sense[2 * k] = 'G';
+  problem.num_range_rows   = 1;
+  problem.range_rows       = {2 * k};
+  problem.range_value      = {1.0};
+  problem.lower.assign(n, 0.0);
+  problem.upper.assign(n, 1.0);
+  problem.var_types.assign(n, variable_type_t::INTEGER);
+  problem.problem_name = "assignment";
+  problem.row_names.resize(m);
+  problem.col_names.resize(n);
+  return problem;
+}
+
+}  // namespace
+
+TEST(feasibility_jump, assignment)
+{
+  // The cheapest assignment is the identity, which the range row excludes
+  const std::vector<double> cost = {1, 4, 6, 5, 1, 4, 6, 4, 1};
+  const auto problem             = assignment_problem(cost);
+  simplex_solver_settings_t<int, double> settings;
+  settings.time_limit = 10.0;
+
+  feasibility_jump_t<int, double> feasibility_jump(problem, settings, tic());
+  std::vector<double> objectives;
+  bool all_feasible = true;
+  feasibility_jump.start(2, [&](const std::vector<double>& x) {
+    double objective = 0.0;
+    for (int j = 0; j < problem.num_cols; ++j) {
+      objective += cost[j] * x[j];
+      all_feasible = all_feasible && (x[j] == 0.0 || x[j] == 1.0);
+    }
+    std::vector<double> activity(problem.num_rows, 0.0);
+    for (int j = 0; j < problem.num_cols; ++j) {
+      for (int p = problem.A.col_start[j]; p < problem.A.col_start[j + 1]; ++p) {
+        activity[problem.A.i[p]] += problem.A.x[p] * x[j];
+      }
+    }
+    const int range_row = problem.num_rows - 1;
+    for (int i = 0; i < range_row; ++i) {
+      all_feasible = all_feasible && std::abs(activity[i] - 1.0) < 1e-9;
+    }
+    all_feasible = all_feasible && activity[range_row] >= 1.0 && activity[range_row] <= 2.0;
+    objectives.push_back(objective);
+  });
+  // x_00 = x_12 = x_21 = 1 costs 9
+  const double start_time = tic();
+  while (feasibility_jump.get_best_objective() > 9.0 && toc(start_time) < settings.time_limit) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  feasibility_jump.stop();
+
+  EXPECT_TRUE(all_feasible);
+  ASSERT_FALSE(objectives.empty());
+  EXPECT_EQ(feasibility_jump.num_solutions(), static_cast<int>(objectives.size()));
+  EXPECT_DOUBLE_EQ(feasibility_jump.get_best_objective(), 9.0);
+  // Each solution improves on the previous one
+  for (size_t k = 1; k < objectives.size(); ++k) {
+    EXPECT_LT(objectives[k], objectives[k - 1]);
+  }
+}
+
+TEST(feasibility_jump, num_climbers)
+{
+  auto problem = assignment_problem(std::vector<double>(9, 1.0));
+  simplex_solver_settings_t<int, double> settings;
+  auto num_climbers = [&]() {
+    return feasibility_jump_t<int, double>(problem, settings, tic()).num_climbers();
+  };
+  settings.feasibility_jump_climbers = 3;
+  EXPECT_EQ(num_climbers(), 3);
+  // The automatic mode only uses the threads left by B&B
+  settings.feasibility_jump_climbers = -1;
+  settings.num_threads               = omp_get_max_threads();
+  EXPECT_EQ(num_climbers(), 0);
+  settings.num_threads = omp_get_max_threads() - 2;
+  EXPECT_EQ(num_climbers(), 2);
+  settings.num_threads = omp_get_max_threads() - 10;
+  EXPECT_EQ(num_climbers(), 4);
+  settings.feasibility_jump_climbers = 0;
+  EXPECT_EQ(num_climbers(), 0);
+
+  // The climbers are not deterministic
+  settings.feasibility_jump_climbers = 3;
+  settings.deterministic             = true;
+  EXPECT_EQ(num_climbers(), 0);
+
+  // Nothing to do without integer variables
+  settings.deterministic = false;
+  problem.var_types.assign(problem.num_cols, variable_type_t::CONTINUOUS);
+  EXPECT_EQ(num_climbers(), 0);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
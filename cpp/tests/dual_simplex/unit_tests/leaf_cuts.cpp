@@ -0,0 +1,214 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/branch_and_bound_worker.hpp>
+#include <branch_and_bound/mip_node.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+constexpr int m = 4;
+constexpr int n = 8;
+
+lp_problem_t<int, double> random_problem(std::mt19937& gen)
+{
+  std::uniform_int_distribution<int> coeff(-3, 3);
+  lp_problem_t<int, double> problem(nullptr, m, n, m * n);
+  int nz = 0;
+  for (int j = 0; j < n; ++j) {
+    problem.A.col_start[j] = nz;
+    for (int i = 0; i < m; ++i) {
+      const int a = coeff(gen);
+      if (a == 0) { continue; }
+      problem.A.i[nz] = i;
+      problem.A.x[nz] = a;
+      ++nz;
+    }
+    problem.objective[j] = coeff(gen);
+    problem.lower[j]     = 0.0;
+    problem.upper[j]     = 4.0;
+  }
+  problem.A.col_start[n] = nz;
+  problem.A.resize(m, n, nz);
+  for (int i = 0; i < m; ++i) {
+    problem.rhs[i] = 10.0;
+  }
+  return problem;
+}
+
+// `num_cuts` dense cuts over the columns of the leaf problem of their parent, i.e., over the
+// variables and the slacks of the cuts of the ancestors
+std::shared_ptr<const node_cuts_t<int, double>> make_cuts(
+  std::shared_ptr<const node_cuts_t<int, double>> parent, int num_cuts, std::mt19937& gen)
+{
+  std::uniform_int_distribution<int> coeff(1, 5);
+  const int num_parent_cuts = parent != nullptr ? parent->num_cuts : 0;
+  const int cols            = n + num_parent_cuts;
+  csr_matrix_t<int, double> rows(num_cuts, cols, num_cuts * cols);
+  std::vector<double> rhs(num_cuts);
+  int nz = 0;
+  for (int i = 0; i < num_cuts; ++i) {
+    rows.row_start[i] = nz;
+    for (int j = 0; j < cols; ++j) {
+      rows.j[nz] = j;
+      rows.x[nz] = coeff(gen);
+      ++nz;
+    }
+    rhs[i] = 20.0 + i;
+  }
+  rows.row_start[num_cuts] = nz;
+  return std::make_shared<const node_cuts_t<int, double>>(
+    node_cuts_t<int, double>{parent, rows, rhs, num_parent_cuts + num_cuts});
+}
+
+std::vector<std::vector<double>> to_dense(const csc_matrix_t<int, double>& A)
+{
+  std::vector<std::vector<double>> dense(A.m, std::vector<double>(A.n, 0.0));
+  for (int j = 0; j < A.n; ++j) {
+    for (int p = A.col_start[j]; p < A.col_start[j + 1]; ++p) {
+      dense[A.i[p]][j] += A.x[p];
+    }
+  }
+  return dense;
+}
+
+// The leaf problem of a node built independently of the worker: the rows of the global LP followed
+// by the cuts of the chain, from the oldest to the newest, each with its slack
+void expected_leaf(const lp_problem_t<int, double>& problem,
+                   const node_cuts_t<int, double>* cuts,
+                   std::vector<std::vector<double>>& dense,
+                   std::vector<double>& rhs)
+{
+  std::vector<const node_cuts_t<int, double>*> chain;
+  for (; cuts != nullptr; cuts = cuts->parent.get()) {
+    chain.insert(chain.begin(), cuts);
+  }
+  const int num_cuts = chain.empty() ? 0 : chain.back()->num_cuts;
+  dense              = to_dense(problem.A);
+  rhs                = problem.rhs;
+  for (auto& row : dense) {
+    row.resize(n + num_cuts, 0.0);
+  }
+  for (const auto* link : chain) {
+    for (int i = 0; i < link->rows.m; ++i) {
+      std::vector<double> row(n + num_cuts, 0.0);
+      for (int p = link->rows.row_start[i]; p < link->rows.row_start[i + 1]; ++p) {
+        row[link->rows.j[p]] += link->rows.x[p];
+      }
+      row[dense.size() - m + n] = 1.0;
+      dense.push_back(row);
+      rhs.push_back(link->rhs[i]);
+    }
+  }
+}
+
+void expect_leaf_matches(const branch_and_bound_worker_t<int, double>& worker,
+                         const lp_problem_t<int, double>& problem,
+                         const mip_node_t<int, double>& node,
+                         bool rows_changed)
+{
+  std::vector<std::vector<double>> dense;
+  std::vector<double> rhs;
+  expected_leaf(problem, node.cuts.get(), dense, rhs);
+  const int num_cuts = node.cuts != nullptr ? node.cuts->num_cuts : 0;
+
+  const auto& leaf = worker.leaf_problem;
+  EXPECT_EQ(worker.leaf_cuts, node.cuts);
+  EXPECT_EQ(leaf.num_rows, m + num_cuts);
+  EXPECT_EQ(leaf.num_cols, n + num_cuts);
+  EXPECT_EQ(leaf.A.m, leaf.num_rows);
+  EXPECT_EQ(leaf.A.n, leaf.num_cols);
+  EXPECT_EQ(to_dense(leaf.A), dense);
+  EXPECT_EQ(leaf.rhs, rhs);
+
+  // The slacks of the cuts are nonnegative and do not appear in the objective
+  ASSERT_EQ(leaf.objective.size(), static_cast<size_t>(leaf.num_cols));
+  ASSERT_EQ(leaf.lower.size(), static_cast<size_t>(leaf.num_cols));
+  ASSERT_EQ(leaf.upper.size(), static_cast<size_t>(leaf.num_cols));
+  for (int j = n; j < leaf.num_cols; ++j) {
+    EXPECT_EQ(leaf.objective[j], 0.0);
+    EXPECT_EQ(leaf.lower[j], 0.0);
+    EXPECT_EQ(leaf.upper[j], std::numeric_limits<double>::infinity());
+  }
+
+  EXPECT_EQ(worker.basic_list.size(), static_cast<size_t>(leaf.num_rows));
+  EXPECT_EQ(worker.leaf_solution.x.size(), static_cast<size_t>(leaf.num_cols));
+  EXPECT_EQ(worker.leaf_solution.y.size(), static_cast<size_t>(leaf.num_rows));
+  EXPECT_EQ(worker.leaf_solution.z.size(), static_cast<size_t>(leaf.num_cols));
+  // The basis of the previous node does not fit new rows, so it is rebuilt for this one. The
+  // cached factorizations are for the old rows as well.
+  if (rows_changed) {
+    EXPECT_TRUE(worker.recompute_basis);
+    EXPECT_EQ(worker.basis_cache.size(), 0);
+  } else {
+    EXPECT_FALSE(worker.recompute_basis);
+  }
+}
+
+}  // namespace
+
+// Moves a worker between siblings and cousins whose local cuts form different chains
+//
+//              root
+//            /      \
+//     a {A: 2}      b {B: 1}
+//      /    \            \
+//    a1     a2 {A2: 1}    b1 {B1: 2}
+TEST(leaf_cuts, sibling_and_cousin_moves)
+{
+  std::mt19937 gen(5);
+  const auto problem = random_problem(gen);
+  csr_matrix_t<int, double> Arow(m, n, 0);
+  problem.A.to_compressed_row(Arow);
+  const std::vector<variable_type_t> var_types(n, variable_type_t::INTEGER);
+  simplex_solver_settings_t<int, double> settings;
+
+  const std::vector<variable_status_t> basis(n, variable_status_t::NONBASIC_LOWER);
+  mip_node_t<int, double> root(0.0, basis);
+  auto child = [&](mip_node_t<int, double>* parent, int id, int var, rounding_direction_t dir) {
+    return std::make_unique<mip_node_t<int, double>>(problem, parent, id, var, dir, 1.5, 1, basis);
+  };
+  root.add_children(child(&root, 1, 0, rounding_direction_t::DOWN),
+                    child(&root, 2, 0, rounding_direction_t::UP));
+  mip_node_t<int, double>* a = root.get_down_child();
+  mip_node_t<int, double>* b = root.get_up_child();
+  a->cuts                    = make_cuts(nullptr, 2, gen);
+  b->cuts                    = make_cuts(nullptr, 1, gen);
+  a->add_children(child(a, 3, 1, rounding_direction_t::DOWN),
+                  child(a, 4, 1, rounding_direction_t::UP));
+  b->add_children(child(b, 5, 2, rounding_direction_t::DOWN),
+                  child(b, 6, 2, rounding_direction_t::UP));
+  mip_node_t<int, double>* a1 = a->get_down_child();
+  mip_node_t<int, double>* a2 = a->get_up_child();
+  mip_node_t<int, double>* b1 = b->get_up_child();
+  a2->cuts                    = make_cuts(a->cuts, 1, gen);
+  b1->cuts                    = make_cuts(b->cuts, 2, gen);
+
+  branch_and_bound_worker_t<int, double> worker(0, problem, Arow, var_types, settings);
+  worker.init_best_first(a, problem);
+
+  // Down the tree, to a parent with the same cuts, to siblings that add or drop cuts and to
+  // cousins that share no cuts with the previous node
+  const std::vector<mip_node_t<int, double>*> path = {a, a2, a1, a, a2, b1, a2, b, a1, b};
+  for (mip_node_t<int, double>* node : path) {
+    SCOPED_TRACE(node->node_id);
+    const bool rows_changed = node->cuts != worker.leaf_cuts;
+    worker.recompute_basis  = false;
+    worker.set_lp_variable_bounds(node, settings);
+    expect_leaf_matches(worker, problem, *node, rows_changed);
+  }
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
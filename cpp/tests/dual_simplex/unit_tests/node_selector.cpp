@@ -0,0 +1,111 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/node_queue.hpp>
+#include <branch_and_bound/node_selector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+TEST(node_selector, pop_best_estimate)
+{
+  // The lower bounds and the estimates are in opposite orders
+  std::vector<mip_node_t<int, double>> nodes(4);
+  node_queue_t<int, double> queue;
+  for (int k = 0; k < 4; ++k) {
+    nodes[k].lower_bound        = k;
+    nodes[k].objective_estimate = 10 - k;
+    queue.push(&nodes[k]);
+  }
+
+  EXPECT_EQ(queue.pop_best_estimate().value(), &nodes[3]);
+  EXPECT_EQ(queue.pop_best_estimate().value(), &nodes[2]);
+  EXPECT_EQ(queue.best_first_queue_size(), 2);
+  EXPECT_EQ(queue.get_lower_bound(), 0.0);
+
+  // The nodes taken by their estimate are skipped by the best-first pops, and conversely
+  EXPECT_EQ(queue.pop_best_first().value(), &nodes[0]);
+  EXPECT_EQ(queue.get_lower_bound(), 1.0);
+  EXPECT_EQ(queue.pop_best_estimate().value(), &nodes[1]);
+  EXPECT_EQ(queue.best_first_queue_size(), 0);
+  EXPECT_FALSE(queue.pop_best_first().has_value());
+  EXPECT_FALSE(queue.pop_best_estimate().has_value());
+}
+
+TEST(node_selector, disabled)
+{
+  simplex_solver_settings_t<int, double> settings;
+  settings.adaptive_node_selection = 0;
+  node_selector_t<int, double> selector;
+  selector.init(settings);
+
+  for (int k = 0; k < 10; ++k) {
+    EXPECT_EQ(selector.next_rule(1.0, false), node_rule_t::BEST_BOUND);
+    selector.record_dive();
+  }
+  EXPECT_TRUE(selector.continue_plunge(100, 10.0, 0.0, 1.0));
+  EXPECT_EQ(selector.dive_node_limit(), settings.diving_settings.node_limit);
+  EXPECT_EQ(selector.dive_backtrack_limit(), settings.diving_settings.backtrack_limit);
+}
+
+TEST(node_selector, node_rule)
+{
+  simplex_solver_settings_t<int, double> settings;
+  node_selector_t<int, double> selector;
+  selector.init(settings);
+
+  // Without an incumbent, 3 nodes out of 4 are picked by their estimate
+  int num_estimate = 0;
+  for (int k = 0; k < 100; ++k) {
+    num_estimate += selector.next_rule(1.0, false) == node_rule_t::BEST_ESTIMATE;
+  }
+  EXPECT_EQ(num_estimate, 75);
+
+  // Once the gap is closed, only by their lower bound
+  for (int k = 0; k < 100; ++k) {
+    EXPECT_EQ(selector.next_rule(0.0, true), node_rule_t::BEST_BOUND);
+  }
+}
+
+TEST(node_selector, plunge_and_dive_limits)
+{
+  simplex_solver_settings_t<int, double> settings;
+  node_selector_t<int, double> selector;
+  selector.init(settings);
+
+  // Without an incumbent, the plunges go down to the leaves
+  EXPECT_TRUE(selector.continue_plunge(1000, 10.0, 0.0, inf));
+  // The first levels are always explored
+  EXPECT_TRUE(selector.continue_plunge(1, 10.0, 0.0, 1.0));
+  // Further down, the node must be close to the global lower bound
+  EXPECT_TRUE(selector.continue_plunge(5, 0.1, 0.0, 1.0));
+  EXPECT_FALSE(selector.continue_plunge(5, 0.9, 0.0, 1.0));
+  EXPECT_FALSE(selector.continue_plunge(1000, 0.1, 0.0, 1.0));
+  EXPECT_EQ(selector.num_plunges_stopped(), 2);
+
+  // Starting new plunges is expensive, so the plunges go deeper
+  for (int k = 0; k < 100; ++k) {
+    selector.record_node_lp(true, 1.0);
+    selector.record_node_lp(false, 0.25);
+  }
+  EXPECT_TRUE(selector.continue_plunge(30, 0.9, 0.0, 1.0));
+
+  // The dives are shorter when they do not find solutions
+  for (int k = 0; k < 100; ++k) {
+    selector.record_dive();
+  }
+  EXPECT_LT(selector.dive_node_limit(), settings.diving_settings.node_limit);
+  for (int k = 0; k < 100; ++k) {
+    selector.record_dive_incumbent();
+  }
+  EXPECT_GT(selector.dive_node_limit(), settings.diving_settings.node_limit);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
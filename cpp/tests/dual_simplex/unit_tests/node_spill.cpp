@@ -0,0 +1,185 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <branch_and_bound/node_queue.hpp>
+#include <branch_and_bound/node_spill.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+constexpr int num_cols = 1000;
+
+std::vector<variable_status_t> random_basis(std::mt19937& gen,
+                                            const std::vector<variable_status_t>& reference)
+{
+  std::uniform_int_distribution<int> column(0, num_cols - 1);
+  std::uniform_int_distribution<int> status(-1, 4);
+  std::vector<variable_status_t> basis = reference;
+  for (int k = 0; k < 20; ++k) {
+    basis[column(gen)] = static_cast<variable_status_t>(status(gen));
+  }
+  return basis;
+}
+
+}  // namespace
+
+TEST(node_spill, spill_and_reload)
+{
+  const std::vector<variable_status_t> reference(num_cols, variable_status_t::NONBASIC_LOWER);
+  std::mt19937 gen(1);
+  std::vector<mip_node_t<int, double>> nodes(100);
+  std::vector<std::vector<variable_status_t>> bases;
+  for (int k = 0; k < 100; ++k) {
+    nodes[k].lower_bound = (k * 37) % 100;
+    nodes[k].vstatus     = random_basis(gen, reference);
+    bases.push_back(nodes[k].vstatus);
+  }
+
+  node_spill_t<int, double> spill;
+  ASSERT_TRUE(spill.open(reference));
+  for (auto& node : nodes) {
+    ASSERT_EQ(spill.spill(&node), spill_status_t::SPILLED);
+    EXPECT_TRUE(node.vstatus.empty());
+  }
+  EXPECT_EQ(spill.size(), 100);
+  // The bases are stored as their differences with the reference
+  EXPECT_LT(spill.bytes_written(), 100 * num_cols / 10);
+
+  // The nodes come back by increasing lower bound, with their basis
+  for (int k = 0; k < 100; ++k) {
+    EXPECT_EQ(spill.lower_bound(), k);
+    mip_node_t<int, double>* node = spill.reload();
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->lower_bound, k);
+    EXPECT_EQ(node->vstatus, bases[node - nodes.data()]);
+  }
+  EXPECT_TRUE(spill.empty());
+  EXPECT_EQ(spill.reload(), nullptr);
+}
+
+TEST(node_spill, prune_and_compact)
+{
+  const std::vector<variable_status_t> reference(num_cols, variable_status_t::NONBASIC_LOWER);
+  // Bases that differ from the reference everywhere, so the file grows past the compaction size
+  std::vector<mip_node_t<int, double>> nodes(1000);
+  for (int k = 0; k < 1000; ++k) {
+    nodes[k].lower_bound = k;
+    nodes[k].vstatus.assign(num_cols, variable_status_t::BASIC);
+    nodes[k].vstatus[k % num_cols] = variable_status_t::NONBASIC_UPPER;
+  }
+
+  node_spill_t<int, double> spill;
+  ASSERT_TRUE(spill.open(reference));
+  for (auto& node : nodes) {
+    ASSERT_EQ(spill.spill(&node), spill_status_t::SPILLED);
+  }
+  const int64_t file_size = spill.file_size();
+  EXPECT_GT(file_size, 1 << 20);
+
+  // The nodes cut off by the upper bound are dropped without being read back
+  std::vector<mip_node_t<int, double>*> pruned;
+  EXPECT_EQ(spill.prune(599.5, pruned), 400);
+  EXPECT_EQ(pruned.size(), size_t{400});
+  for (auto node : pruned) {
+    EXPECT_GT(node->lower_bound, 599.5);
+  }
+  EXPECT_EQ(spill.size(), size_t{600});
+  EXPECT_EQ(spill.num_compactions(), 0);
+  EXPECT_EQ(spill.file_size(), file_size);
+
+  // Once most of the file is dead, it is compacted
+  pruned.clear();
+  EXPECT_EQ(spill.prune(299.5, pruned), 300);
+  EXPECT_EQ(spill.num_pruned(), 700);
+  EXPECT_EQ(spill.num_compactions(), 1);
+  EXPECT_EQ(spill.file_size(), spill.live_bytes());
+  EXPECT_LT(spill.file_size(), file_size / 3);
+
+  for (int k = 0; k < 300; ++k) {
+    mip_node_t<int, double>* node = spill.reload();
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->lower_bound, k);
+    EXPECT_EQ(node->vstatus[k % num_cols], variable_status_t::NONBASIC_UPPER);
+    EXPECT_EQ(node->vstatus[(k + 1) % num_cols], variable_status_t::BASIC);
+  }
+  EXPECT_TRUE(spill.empty());
+  EXPECT_EQ(spill.file_size(), 0);
+}
+
+TEST(node_spill, node_queue)
+{
+  const std::vector<variable_status_t> reference(num_cols, variable_status_t::NONBASIC_LOWER);
+  std::mt19937 gen(2);
+  std::vector<mip_node_t<int, double>> nodes(1000);
+  std::vector<std::vector<variable_status_t>> bases;
+  node_queue_t<int, double> queue;
+  // Room for about 100 nodes
+  ASSERT_TRUE(queue.set_memory_limit(0.11, reference));
+  for (int k = 0; k < 1000; ++k) {
+    nodes[k].lower_bound        = (k * 379) % 1000;
+    nodes[k].objective_estimate = nodes[k].lower_bound;
+    nodes[k].vstatus            = random_basis(gen, reference);
+    bases.push_back(nodes[k].vstatus);
+    queue.push(&nodes[k]);
+    queue.spill_nodes();
+  }
+  EXPECT_GT(queue.spilled_nodes().num_spilled(), 800);
+  EXPECT_EQ(queue.best_first_queue_size(), 1000);
+  EXPECT_EQ(queue.get_lower_bound(), 0.0);
+
+  // Every node is popped once, by increasing lower bound, with its basis
+  for (int k = 0; k < 1000; ++k) {
+    auto node = k % 3 == 0 ? queue.pop_best_estimate() : queue.pop_best_first();
+    ASSERT_TRUE(node.has_value());
+    EXPECT_EQ(node.value()->lower_bound, k);
+    EXPECT_EQ(node.value()->vstatus, bases[node.value() - nodes.data()]);
+    queue.spill_nodes();
+  }
+  EXPECT_EQ(queue.best_first_queue_size(), 0);
+  EXPECT_FALSE(queue.pop_best_first().has_value());
+}
+
+TEST(node_spill, node_queue_mixed_basis_sizes)
+{
+  const std::vector<variable_status_t> reference(num_cols, variable_status_t::NONBASIC_LOWER);
+  std::mt19937 gen(3);
+  std::vector<mip_node_t<int, double>> nodes(1000);
+  std::vector<std::vector<variable_status_t>> bases;
+  node_queue_t<int, double> queue;
+  ASSERT_TRUE(queue.set_memory_limit(0.11, reference));
+  for (int k = 0; k < 1000; ++k) {
+    nodes[k].lower_bound        = (k * 379) % 1000;
+    nodes[k].objective_estimate = nodes[k].lower_bound;
+    nodes[k].vstatus            = random_basis(gen, reference);
+    // Every fourth node has local cuts, whose slacks make its basis longer than the reference
+    if (k % 4 == 0) { nodes[k].vstatus.resize(num_cols + 1 + k % 3, variable_status_t::BASIC); }
+    bases.push_back(nodes[k].vstatus);
+    queue.push(&nodes[k]);
+    queue.spill_nodes();
+  }
+  // The nodes with cuts stay in memory and the others are still spilled
+  EXPECT_GT(queue.spilled_nodes().num_spilled(), 500);
+  EXPECT_LE(queue.spilled_nodes().size(), size_t{750});
+  EXPECT_EQ(queue.best_first_queue_size(), 1000);
+
+  for (int k = 0; k < 1000; ++k) {
+    auto node = k % 3 == 0 ? queue.pop_best_estimate() : queue.pop_best_first();
+    ASSERT_TRUE(node.has_value());
+    EXPECT_EQ(node.value()->lower_bound, k);
+    EXPECT_EQ(node.value()->vstatus, bases[node.value() - nodes.data()]);
+    queue.spill_nodes();
+  }
+  EXPECT_EQ(queue.best_first_queue_size(), 0);
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -5,15 +5,22 @@
  */
 /* clang-format on */
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <filesystem>
+#include <tuple>
 
 #include <utilities/common_utils.hpp>
 
 #include <gtest/gtest.h>
 
+#include <branch_and_bound/bb_checkpoint.hpp>
+#include <branch_and_bound/bb_trace.hpp>
 #include <dual_simplex/presolve.hpp>
 #include <dual_simplex/solve.hpp>
 #include <dual_simplex/tic_toc.hpp>
+#include <dual_simplex/triangle_solve.hpp>
 #include <dual_simplex/user_problem.hpp>
 
 #include <mps_parser/parser.hpp>
@@ -167,6 +174,306 @@ TEST(dual_simplex, burglar)
   EXPECT_NEAR(solution[5], 1, 1e-6);
 }
 
+TEST(dual_simplex, burglar_cpu_concurrent_root)
+{
+  // Same as burglar problem above but with the root LP raced by the concurrent solvers on the CPU
+  constexpr int num_items     = 8;
+  constexpr double max_weight = 102;
+
+  std::vector<double> value({15, 100, 90, 60, 40, 15, 10, 1});
+  std::vector<double> weight({2, 20, 20, 30, 40, 30, 60, 10});
+
+  raft::handle_t handle{};
+  cuopt::linear_programming::dual_simplex::user_problem_t<int, double> user_problem(&handle);
+  constexpr int m  = 1;
+  constexpr int n  = num_items;
+  constexpr int nz = num_items;
+
+  user_problem.num_rows = m;
+  user_problem.num_cols = n;
+  user_problem.objective.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.objective[j] = -value[j];
+  }
+  user_problem.A.m      = m;
+  user_problem.A.n      = n;
+  user_problem.A.nz_max = nz;
+  user_problem.A.reallocate(nz);
+  user_problem.A.col_start.resize(n + 1);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.A.col_start[j] = j;
+    user_problem.A.i[j]         = 0;
+    user_problem.A.x[j]         = weight[j];
+  }
+  user_problem.A.col_start[n] = nz;
+  user_problem.rhs.resize(m);
+  user_problem.rhs[0] = max_weight;
+  user_problem.row_sense.resize(m);
+  user_problem.row_sense[0] = 'L';
+  user_problem.lower.resize(n);
+  user_problem.upper.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.lower[j] = 0.0;
+    user_problem.upper[j] = 1.0;
+  }
+  user_problem.num_range_rows = 0;
+  user_problem.problem_name   = "burglar";
+  user_problem.row_names.resize(m);
+  user_problem.row_names[0] = "weight restriction";
+  user_problem.col_names.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.col_names[j] = "x";
+  }
+  user_problem.obj_constant = 0.0;
+  user_problem.var_types.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.var_types[j] = cuopt::linear_programming::dual_simplex::variable_type_t::INTEGER;
+  }
+
+  cuopt::linear_programming::dual_simplex::simplex_solver_settings_t<int, double> settings;
+  settings.concurrent_root_lp = 1;
+  settings.num_threads        = 3;
+  std::vector<double> solution(num_items);
+  EXPECT_EQ((cuopt::linear_programming::dual_simplex::solve(user_problem, settings, solution)), 0);
+  double objective = 0.0;
+  for (int j = 0; j < num_items; ++j) {
+    objective += value[j] * solution[j];
+  }
+  EXPECT_NEAR(objective, 280, 1e-6);
+  EXPECT_NEAR(solution[0], 1, 1e-6);
+  EXPECT_NEAR(solution[1], 1, 1e-6);
+  EXPECT_NEAR(solution[2], 1, 1e-6);
+  EXPECT_NEAR(solution[3], 1, 1e-6);
+  EXPECT_NEAR(solution[5], 1, 1e-6);
+}
+
+TEST(dual_simplex, burglar_restart)
+{
+  // Same as burglar problem above but started from the optimal solution. The reduced costs then
+  // fix enough items at the root for branch and bound to restart.
+  constexpr int num_items     = 8;
+  constexpr double max_weight = 102;
+
+  std::vector<double> value({15, 100, 90, 60, 40, 15, 10, 1});
+  std::vector<double> weight({2, 20, 20, 30, 40, 30, 60, 10});
+
+  raft::handle_t handle{};
+  cuopt::linear_programming::dual_simplex::user_problem_t<int, double> user_problem(&handle);
+  constexpr int m  = 1;
+  constexpr int n  = num_items;
+  constexpr int nz = num_items;
+
+  user_problem.num_rows = m;
+  user_problem.num_cols = n;
+  user_problem.objective.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.objective[j] = -value[j];
+  }
+  user_problem.A.m      = m;
+  user_problem.A.n      = n;
+  user_problem.A.nz_max = nz;
+  user_problem.A.reallocate(nz);
+  user_problem.A.col_start.resize(n + 1);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.A.col_start[j] = j;
+    user_problem.A.i[j]         = 0;
+    user_problem.A.x[j]         = weight[j];
+  }
+  user_problem.A.col_start[n] = nz;
+  user_problem.rhs.resize(m);
+  user_problem.rhs[0] = max_weight;
+  user_problem.row_sense.resize(m);
+  user_problem.row_sense[0] = 'L';
+  user_problem.lower.resize(n);
+  user_problem.upper.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.lower[j] = 0.0;
+    user_problem.upper[j] = 1.0;
+  }
+  user_problem.num_range_rows = 0;
+  user_problem.problem_name   = "burglar";
+  user_problem.row_names.resize(m);
+  user_problem.row_names[0] = "weight restriction";
+  user_problem.col_names.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.col_names[j] = "x";
+  }
+  user_problem.obj_constant = 0.0;
+  user_problem.var_types.resize(n);
+  for (int j = 0; j < num_items; ++j) {
+    user_problem.var_types[j] = cuopt::linear_programming::dual_simplex::variable_type_t::INTEGER;
+  }
+
+  std::vector<double> guess({1, 1, 1, 1, 0, 1, 0, 0});
+
+  for (int max_restarts : {0, 1}) {
+    cuopt::linear_programming::dual_simplex::simplex_solver_settings_t<int, double> settings;
+    settings.num_threads                = 1;
+    settings.feasibility_jump_climbers  = 0;
+    settings.reduced_cost_strengthening = 0;
+    settings.max_restarts               = max_restarts;
+    settings.restart_fixing_fraction    = 0.01;
+    cuopt::linear_programming::dual_simplex::mip_solution_t<int, double> solution(n);
+    EXPECT_EQ((cuopt::linear_programming::dual_simplex::solve_mip_with_guess(
+                user_problem, settings, guess, solution)),
+              0)
+      << "max_restarts " << max_restarts;
+    EXPECT_EQ(solution.num_restarts, max_restarts);
+    EXPECT_NEAR(solution.objective, -280, 1e-6) << "max_restarts " << max_restarts;
+    double objective = 0.0;
+    for (int j = 0; j < num_items; ++j) {
+      objective += value[j] * solution.x[j];
+    }
+    EXPECT_NEAR(objective, 280, 1e-6) << "max_restarts " << max_restarts;
+  }
+}
+
+TEST(dual_simplex, deterministic_resume)
+{
+  // A deterministic search resumed from one of its checkpoints continues the same trajectory: every
+  // worker solves the same nodes at the same work unit clocks as the search that was not stopped
+  constexpr int num_items = 40;
+  constexpr int m         = 3;
+  constexpr int n         = num_items;
+  constexpr int nz        = m * num_items;
+
+  raft::handle_t handle{};
+  cuopt::linear_programming::dual_simplex::user_problem_t<int, double> user_problem(&handle);
+
+  // Multidimensional knapsack with values correlated to the weights, generated by an LCG so that
+  // the problem is the same on every platform
+  uint64_t state    = 12345;
+  auto random_value = [&state](int range) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<int>((state >> 33) % range);
+  };
+  std::vector<double> total_weight(m, 0.0);
+  user_problem.num_rows = m;
+  user_problem.num_cols = n;
+  user_problem.objective.resize(n);
+  user_problem.A.m      = m;
+  user_problem.A.n      = n;
+  user_problem.A.nz_max = nz;
+  user_problem.A.reallocate(nz);
+  user_problem.A.col_start.resize(n + 1);
+  for (int j = 0; j < n; ++j) {
+    user_problem.A.col_start[j] = m * j;
+    double item_weight          = 0.0;
+    for (int i = 0; i < m; ++i) {
+      const double weight          = 10 + random_value(90);
+      user_problem.A.i[m * j + i]  = i;
+      user_problem.A.x[m * j + i]  = weight;
+      total_weight[i]             += weight;
+      item_weight                 += weight;
+    }
+    user_problem.objective[j] = -(item_weight / m + random_value(20));
+  }
+  user_problem.A.col_start[n] = nz;
+  user_problem.rhs.resize(m);
+  user_problem.row_sense.assign(m, 'L');
+  user_problem.row_names.resize(m);
+  for (int i = 0; i < m; ++i) {
+    user_problem.rhs[i]       = std::floor(total_weight[i] / 2);
+    user_problem.row_names[i] = "capacity";
+  }
+  user_problem.lower.assign(n, 0.0);
+  user_problem.upper.assign(n, 1.0);
+  user_problem.num_range_rows = 0;
+  user_problem.problem_name   = "knapsack";
+  user_problem.col_names.assign(n, "x");
+  user_problem.obj_constant = 0.0;
+  user_problem.var_types.assign(n,
+                                cuopt::linear_programming::dual_simplex::variable_type_t::INTEGER);
+
+  auto temp_path = [](const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+  };
+  const std::string full_trace      = temp_path("cuopt_resume_full.bbt");
+  const std::string full_checkpoint = temp_path("cuopt_resume_full.ckpt");
+  const std::string stop_checkpoint = temp_path("cuopt_resume_stop.ckpt");
+  const std::string resume_trace    = temp_path("cuopt_resume.bbt");
+
+  // A checkpoint file enables the checkpoint boundaries, so all the runs take the same boundaries
+  auto make_settings = [](const std::string& trace, const std::string& checkpoint) {
+    cuopt::linear_programming::dual_simplex::simplex_solver_settings_t<int, double> settings;
+    settings.deterministic              = true;
+    settings.num_threads                = 2;
+    settings.feasibility_jump_climbers  = 0;
+    settings.deterministic_horizon_step = 1e-4;
+    settings.checkpoint_interval        = 1e-2;
+    settings.tree_trace_file            = trace;
+    settings.checkpoint_file            = checkpoint;
+    return settings;
+  };
+
+  cuopt::linear_programming::dual_simplex::mip_solution_t<int, double> full(n);
+  EXPECT_EQ((cuopt::linear_programming::dual_simplex::solve_mip_with_guess(
+              user_problem, make_settings(full_trace, full_checkpoint), {}, full)),
+            0);
+  bb_trace_header_t header;
+  std::vector<bb_trace_record_t> full_records;
+  read_bb_trace(full_trace, header, full_records);
+  double search_work = 0.0;
+  for (const auto& record : full_records) {
+    search_work = std::max(search_work, record.work_timestamp);
+  }
+
+  // Stopped halfway through the search, after a few checkpoints
+  auto stop_settings       = make_settings("", stop_checkpoint);
+  stop_settings.work_limit = search_work / 2;
+  cuopt::linear_programming::dual_simplex::mip_solution_t<int, double> stopped(n);
+  cuopt::linear_programming::dual_simplex::solve_mip_with_guess(
+    user_problem, stop_settings, {}, stopped);
+  bb_checkpoint_t<int, double> checkpoint;
+  ASSERT_TRUE(read_bb_checkpoint(stop_checkpoint, checkpoint));
+  ASSERT_TRUE(checkpoint.is_deterministic());
+  EXPECT_GT(checkpoint.horizon, 0.0);
+  EXPECT_LT(checkpoint.nodes_explored, full.nodes_explored);
+
+  auto resume_settings        = make_settings(resume_trace, stop_checkpoint);
+  resume_settings.resume_file = stop_checkpoint;
+  cuopt::linear_programming::dual_simplex::mip_solution_t<int, double> resumed(n);
+  EXPECT_EQ((cuopt::linear_programming::dual_simplex::solve_mip_with_guess(
+              user_problem, resume_settings, {}, resumed)),
+            0);
+  EXPECT_EQ(resumed.objective, full.objective);
+  EXPECT_EQ(resumed.lower_bound, full.lower_bound);
+  EXPECT_EQ(resumed.nodes_explored, full.nodes_explored);
+  EXPECT_EQ(resumed.simplex_iterations, full.simplex_iterations);
+
+  // The nodes solved after the checkpoint, in the order each worker solved them
+  using node_record_t = std::tuple<double, int, double, int, int, int>;
+  auto node_log       = [&](const std::vector<bb_trace_record_t>& records) {
+    std::vector<std::vector<node_record_t>> log(header.num_workers);
+    for (const auto& record : records) {
+      if (record.type >= static_cast<uint8_t>(bb_trace_record_type_t::TASK) ||
+          record.work_timestamp <= checkpoint.horizon) {
+        continue;
+      }
+      log[record.worker_id].emplace_back(record.work_timestamp,
+                                         record.type,
+                                         record.objective,
+                                         record.lp_iterations,
+                                         record.depth,
+                                         record.branch_var);
+    }
+    return log;
+  };
+  std::vector<bb_trace_record_t> resume_records;
+  read_bb_trace(resume_trace, header, resume_records);
+  const auto full_log   = node_log(full_records);
+  const auto resume_log = node_log(resume_records);
+  ASSERT_EQ(resume_log.size(), full_log.size());
+  for (size_t w = 0; w < full_log.size(); ++w) {
+    EXPECT_FALSE(full_log[w].empty()) << "worker " << w;
+    EXPECT_EQ(resume_log[w], full_log[w]) << "worker " << w;
+  }
+
+  for (const auto& path : {full_trace, full_checkpoint, stop_checkpoint, resume_trace}) {
+    std::filesystem::remove(path);
+  }
+}
+
 TEST(dual_simplex, empty_columns)
 {
   // Same as burglar problem above but with an empty column inserted
@@ -326,4 +633,63 @@ TEST(dual_simplex, dual_variable_greater_than)
   EXPECT_NEAR(solution.z[1], 0.0, 1e-6);
 }
 
+TEST(dual_simplex, bitset_triangle_solve)
+{
+  namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+  // L = [ 2        ]
+  //     [ 1  1     ]
+  //     [ 0  0  4  ]
+  //     [ 0 -1  1  1]
+  constexpr int n = 4;
+  dual_simplex::csc_matrix_t<int, double> L(n, n, 7);
+  L.col_start = {0, 2, 4, 6, 7};
+  L.i         = {0, 1, 1, 3, 2, 3, 3};
+  L.x         = {2.0, 1.0, 1.0, -1.0, 4.0, 1.0, 1.0};
+  dual_simplex::csc_matrix_t<int, double> U(n, n, 1);
+  L.transpose(U);
+
+  double work = 0.0;
+  dual_simplex::triangle_symbolic_t<int, double> L_symbolic;
+  L_symbolic.analyze(L, true, work);
+  dual_simplex::triangle_symbolic_t<int, double> U_symbolic;
+  U_symbolic.analyze(U, false, work);
+
+  for (int k = 0; k < n; ++k) {
+    dual_simplex::sparse_vector_t<int, double> b(n, 1);
+    b.i[0] = k;
+    b.x[0] = 1.0;
+    for (bool lower : {true, false}) {
+      std::vector<int> xi(2 * n, 0);
+      std::vector<double> x(n, 0.0);
+      const int top =
+        lower ? dual_simplex::bitset_triangle_solve<int, double, true>(
+                  b, L_symbolic, xi, L, x.data(), work)
+              : dual_simplex::bitset_triangle_solve<int, double, false>(
+                  b, U_symbolic, xi, U, x.data(), work);
+
+      std::vector<double> expected(n, 0.0);
+      expected[k] = 1.0;
+      if (lower) {
+        dual_simplex::lower_triangular_solve(L, expected, work);
+      } else {
+        dual_simplex::upper_triangular_solve(U, expected, work);
+      }
+      std::vector<double> sparse(n, 0.0);
+      for (int p = top; p < n; ++p) {
+        sparse[xi[p]] = x[xi[p]];
+      }
+      for (int i = 0; i < n; ++i) {
+        EXPECT_NEAR(sparse[i], expected[i], 1e-12);
+      }
+      // The stack and the reach bitset must be left clean for the next solve
+      for (int p = n; p < 2 * n; ++p) {
+        EXPECT_EQ(xi[p], 0);
+      }
+      for (auto word : lower ? L_symbolic.reach_bits : U_symbolic.reach_bits) {
+        EXPECT_EQ(word, 0u);
+      }
+    }
+  }
+}
+
 }  // namespace cuopt::linear_programming::dual_simplex::test
@@ -33,15 +33,11 @@ static void init_handler(const raft::handle_t* handle_ptr)
     handle_ptr->get_cusparse_handle(), CUSPARSE_POINTER_MODE_DEVICE, handle_ptr->get_stream()));
 }
 
-TEST(barrier, chess_set)
+// maximize   5*xs + 20*xl
+// subject to  1*xs +  3*xl <= 200
+//             3*xs +  2*xl <= 160
+static void make_chess_set(user_problem_t<int, double>& user_problem)
 {
-  namespace dual_simplex = cuopt::linear_programming::dual_simplex;
-  raft::handle_t handle{};
-  init_handler(&handle);
-  dual_simplex::user_problem_t<int, double> user_problem(&handle);
-  // maximize   5*xs + 20*xl
-  // subject to  1*xs +  3*xl <= 200
-  //             3*xs +  2*xl <= 160
   constexpr int m  = 2;
   constexpr int n  = 2;
   constexpr int nz = 4;
@@ -77,8 +73,8 @@ TEST(barrier, chess_set)
   user_problem.lower[0] = 0;
   user_problem.lower[1] = 0.0;
   user_problem.upper.resize(n);
-  user_problem.upper[0]       = dual_simplex::inf;
-  user_problem.upper[1]       = dual_simplex::inf;
+  user_problem.upper[0]       = inf;
+  user_problem.upper[1]       = inf;
   user_problem.num_range_rows = 0;
   user_problem.problem_name   = "chess set";
   user_problem.row_names.resize(m);
@@ -89,10 +85,21 @@ TEST(barrier, chess_set)
   user_problem.col_names[1] = "xl";
   user_problem.obj_constant = 0.0;
   user_problem.var_types.resize(n);
-  user_problem.var_types[0] = dual_simplex::variable_type_t::CONTINUOUS;
-  user_problem.var_types[1] = dual_simplex::variable_type_t::CONTINUOUS;
+  user_problem.var_types[0] = variable_type_t::CONTINUOUS;
+  user_problem.var_types[1] = variable_type_t::CONTINUOUS;
+}
+
+// Solves the chess set with barrier. cpu_barrier selects the backend as in the solver settings
+static void solve_chess_set(int cpu_barrier)
+{
+  namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+  raft::handle_t handle{};
+  init_handler(&handle);
+  dual_simplex::user_problem_t<int, double> user_problem(&handle);
+  make_chess_set(user_problem);
 
   dual_simplex::simplex_solver_settings_t<int, double> settings;
+  settings.cpu_barrier = cpu_barrier;
   dual_simplex::lp_solution_t<int, double> solution(user_problem.num_rows, user_problem.num_cols);
   EXPECT_EQ((dual_simplex::solve_linear_program_with_barrier(user_problem, settings, solution)),
             dual_simplex::lp_status_t::OPTIMAL);
@@ -102,6 +109,26 @@ TEST(barrier, chess_set)
   EXPECT_NEAR(solution.x[1], 66.6667, 1e-3);
 }
 
+TEST(barrier, chess_set) { solve_chess_set(-1); }
+
+TEST(barrier, cpu_chess_set) { solve_chess_set(1); }
+
+// Without a handle only the CPU barrier is available, and it does not solve QPs
+TEST(barrier, quadratic_without_handle)
+{
+  namespace dual_simplex = cuopt::linear_programming::dual_simplex;
+  dual_simplex::user_problem_t<int, double> user_problem(nullptr);
+  make_chess_set(user_problem);
+  user_problem.Q_offsets = {0, 1, 2};
+  user_problem.Q_indices = {0, 1};
+  user_problem.Q_values  = {1.0, 1.0};
+
+  dual_simplex::simplex_solver_settings_t<int, double> settings;
+  dual_simplex::lp_solution_t<int, double> solution(user_problem.num_rows, user_problem.num_cols);
+  EXPECT_EQ((dual_simplex::solve_linear_program_with_barrier(user_problem, settings, solution)),
+            dual_simplex::lp_status_t::NUMERICAL_ISSUES);
+}
+
 TEST(barrier, dual_variable_greater_than)
 {
   // minimize   3*x0 + 2 * x1
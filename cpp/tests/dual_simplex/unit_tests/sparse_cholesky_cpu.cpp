@@ -0,0 +1,274 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <barrier/dense_vector.hpp>
+#include <barrier/ordering.hpp>
+#include <barrier/sparse_cholesky_cpu.hpp>
+
+#include <dual_simplex/simplex_solver_settings.hpp>
+#include <dual_simplex/sparse_matrix.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+// Lower triangle of a random sparse SPD matrix: a side x side grid Laplacian plus random
+// off-diagonal entries, made diagonally dominant. The grid gives large supernodes and good
+// separators, the random entries give irregular fill.
+csc_matrix_t<int, double> random_spd_lower(int side, double density, int seed)
+{
+  const int n = side * side;
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::map<std::pair<int, int>, double> entries;  // (column, row) -> value, row > column
+  for (int i = 0; i < n; i++) {
+    if ((i + 1) % side != 0) { entries[{i, i + 1}] = -1.0; }
+    if (i + side < n) { entries[{i, i + side}] = -1.0; }
+    if (uniform(gen) < density) {
+      const int j = static_cast<int>(gen() % n);
+      if (j != i) { entries[{std::min(i, j), std::max(i, j)}] = uniform(gen) - 0.5; }
+    }
+  }
+  std::vector<double> diagonal(n, 1.0);
+  for (const auto& [index, value] : entries) {
+    diagonal[index.first] += std::abs(value);
+    diagonal[index.second] += std::abs(value);
+  }
+  for (int i = 0; i < n; i++) {
+    entries[{i, i}] = diagonal[i] + uniform(gen);
+  }
+
+  csc_matrix_t<int, double> A(n, n, static_cast<int>(entries.size()));
+  int nz = 0;
+  int j  = 0;
+  for (const auto& [index, value] : entries) {
+    while (j <= index.first) {
+      A.col_start[j++] = nz;
+    }
+    A.i[nz] = index.second;
+    A.x[nz] = value;
+    nz++;
+  }
+  while (j <= n) {
+    A.col_start[j++] = nz;
+  }
+  return A;
+}
+
+// Solves A x = b with a dense Cholesky factorization of the full matrix
+std::vector<double> dense_solve(const csc_matrix_t<int, double>& A_lower,
+                                const std::vector<double>& b)
+{
+  const int n = A_lower.n;
+  std::vector<double> L(static_cast<size_t>(n) * n, 0.0);  // row-major
+  for (int j = 0; j < n; j++) {
+    for (int p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      L[static_cast<size_t>(A_lower.i[p]) * n + j] = A_lower.x[p];
+    }
+  }
+  for (int j = 0; j < n; j++) {
+    double* row_j = &L[static_cast<size_t>(j) * n];
+    for (int k = 0; k < j; k++) {
+      row_j[j] -= row_j[k] * row_j[k];
+    }
+    row_j[j] = std::sqrt(row_j[j]);
+    for (int i = j + 1; i < n; i++) {
+      double* row_i = &L[static_cast<size_t>(i) * n];
+      for (int k = 0; k < j; k++) {
+        row_i[j] -= row_i[k] * row_j[k];
+      }
+      row_i[j] /= row_j[j];
+    }
+  }
+  std::vector<double> x = b;
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < i; k++) {
+      x[i] -= L[static_cast<size_t>(i) * n + k] * x[k];
+    }
+    x[i] /= L[static_cast<size_t>(i) * n + i];
+  }
+  for (int i = n - 1; i >= 0; i--) {
+    for (int k = i + 1; k < n; k++) {
+      x[i] -= L[static_cast<size_t>(k) * n + i] * x[k];
+    }
+    x[i] /= L[static_cast<size_t>(i) * n + i];
+  }
+  return x;
+}
+
+// Factorizes A_lower with the given ordering and compares the solution of A x = b with the
+// dense reference
+void check_factorization(const csc_matrix_t<int, double>& A_lower, int ordering, int seed)
+{
+  const int n = A_lower.n;
+  simplex_solver_settings_t<int, double> settings;
+  settings.set_log(false);
+  settings.num_threads = 4;
+  settings.ordering    = ordering;
+
+  sparse_cholesky_cpu_t<int, double> cholesky(settings, n);
+  ASSERT_EQ(cholesky.analyze(A_lower), 0);
+  ASSERT_EQ(cholesky.factorize(A_lower), 0);
+  EXPECT_EQ(cholesky.num_regularized_pivots(), 0);
+  // The grid has chains of columns with nested structure, which must be amalgamated
+  EXPECT_LT(cholesky.num_supernodes(), n);
+  EXPECT_GE(cholesky.nnz_L(), A_lower.col_start[n]);
+
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::vector<double> b(n);
+  for (int i = 0; i < n; i++) {
+    b[i] = uniform(gen);
+  }
+  dense_vector_t<int, double> rhs(n);
+  dense_vector_t<int, double> x(n);
+  for (int i = 0; i < n; i++) {
+    rhs[i] = b[i];
+  }
+  ASSERT_EQ(cholesky.solve(rhs, x), 0);
+
+  const std::vector<double> reference = dense_solve(A_lower, b);
+  for (int i = 0; i < n; i++) {
+    EXPECT_NEAR(x[i], reference[i], 1e-9);
+  }
+}
+
+// Symmetric adjacency structure of A_lower without the diagonal
+void adjacency(const csc_matrix_t<int, double>& A_lower,
+               std::vector<int>& adj_start,
+               std::vector<int>& adj_index)
+{
+  const int n = A_lower.n;
+  std::vector<std::vector<int>> neighbors(n);
+  for (int j = 0; j < n; j++) {
+    for (int p = A_lower.col_start[j]; p < A_lower.col_start[j + 1]; p++) {
+      const int i = A_lower.i[p];
+      if (i == j) { continue; }
+      neighbors[i].push_back(j);
+      neighbors[j].push_back(i);
+    }
+  }
+  adj_start.assign(n + 1, 0);
+  adj_index.clear();
+  for (int i = 0; i < n; i++) {
+    adj_start[i + 1] = adj_start[i] + static_cast<int>(neighbors[i].size());
+    adj_index.insert(adj_index.end(), neighbors[i].begin(), neighbors[i].end());
+  }
+}
+
+void expect_permutation(int n, const std::vector<int>& perm)
+{
+  ASSERT_EQ(static_cast<int>(perm.size()), n);
+  std::vector<int> sorted = perm;
+  std::sort(sorted.begin(), sorted.end());
+  for (int k = 0; k < n; k++) {
+    ASSERT_EQ(sorted[k], k);
+  }
+}
+
+}  // namespace
+
+TEST(sparse_cholesky_cpu, amd_matches_dense)
+{
+  for (int seed = 1; seed <= 3; seed++) {
+    check_factorization(random_spd_lower(20, 0.05, seed), 1, seed);
+  }
+}
+
+TEST(sparse_cholesky_cpu, nested_dissection_matches_dense)
+{
+  // 900 rows is above the leaf size, so the graph is bisected before AMD orders the leaves
+  for (int seed = 1; seed <= 2; seed++) {
+    check_factorization(random_spd_lower(30, 0.02, seed), 0, seed);
+  }
+}
+
+TEST(sparse_cholesky_cpu, refactorize)
+{
+  // A second factorization reuses the symbolic analysis and must only see the new values
+  auto A      = random_spd_lower(15, 0.05, 7);
+  const int n = A.n;
+  simplex_solver_settings_t<int, double> settings;
+  settings.set_log(false);
+  settings.num_threads = 2;
+  sparse_cholesky_cpu_t<int, double> cholesky(settings, n);
+  ASSERT_EQ(cholesky.analyze(A), 0);
+  ASSERT_EQ(cholesky.factorize(A), 0);
+  for (int j = 0; j < n; j++) {
+    for (int p = A.col_start[j]; p < A.col_start[j + 1]; p++) {
+      if (A.i[p] == j) { A.x[p] *= 2.0; }
+    }
+  }
+  ASSERT_EQ(cholesky.factorize(A), 0);
+
+  std::vector<double> b(n, 1.0);
+  dense_vector_t<int, double> rhs(n);
+  dense_vector_t<int, double> x(n);
+  for (int i = 0; i < n; i++) {
+    rhs[i] = b[i];
+  }
+  ASSERT_EQ(cholesky.solve(rhs, x), 0);
+  const std::vector<double> reference = dense_solve(A, b);
+  for (int i = 0; i < n; i++) {
+    EXPECT_NEAR(x[i], reference[i], 1e-9);
+  }
+}
+
+TEST(ordering, valid_permutation)
+{
+  std::vector<int> adj_start;
+  std::vector<int> adj_index;
+  std::vector<int> perm;
+  for (int seed = 1; seed <= 3; seed++) {
+    const auto A = random_spd_lower(25, 0.1, seed);
+    adjacency(A, adj_start, adj_index);
+    approximate_minimum_degree(A.n, adj_start, adj_index, perm);
+    expect_permutation(A.n, perm);
+    nested_dissection(A.n, adj_start, adj_index, 32, perm);
+    expect_permutation(A.n, perm);
+  }
+}
+
+TEST(ordering, disconnected_and_dense_vertices)
+{
+  // Vertex 0 is adjacent to the vertices below 160, more than the dense degree threshold of
+  // 10 * sqrt(200). The vertices from 160 on have no edges.
+  const int n        = 200;
+  const int num_star = 160;
+  std::vector<int> adj_start(n + 1, 0);
+  std::vector<int> adj_index;
+  for (int i = 1; i < num_star; i++) {
+    adj_index.push_back(i);
+  }
+  adj_start[1] = static_cast<int>(adj_index.size());
+  for (int i = 1; i < n; i++) {
+    if (i < num_star) { adj_index.push_back(0); }
+    adj_start[i + 1] = static_cast<int>(adj_index.size());
+  }
+
+  std::vector<int> perm;
+  approximate_minimum_degree(n, adj_start, adj_index, perm);
+  expect_permutation(n, perm);
+  // The dense vertex is ordered last
+  EXPECT_EQ(perm.back(), 0);
+  nested_dissection(n, adj_start, adj_index, 16, perm);
+  expect_permutation(n, perm);
+
+  approximate_minimum_degree(0, std::vector<int>(1, 0), std::vector<int>(), perm);
+  EXPECT_TRUE(perm.empty());
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -0,0 +1,101 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <dual_simplex/work_unit_calibration.hpp>
+#include <utilities/work_unit_model.hpp>
+
+#include <cuopt/error.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+TEST(work_unit_model, fit_recovers_weights)
+{
+  const std::vector<double> weights = {3e-9, 7e-9, 2e-8, 0.0, 5e-10};
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> count(0.0, 1e8);
+  std::vector<work_counts_t> counts;
+  std::vector<double> seconds;
+  for (int s = 0; s < 200; ++s) {
+    work_counts_t sample{};
+    double time = 0.0;
+    for (int k = 0; k < num_work_kernels; ++k) {
+      // The ratio test never appears in the samples and keeps its default weight
+      sample[k] = k == static_cast<int>(work_kernel_t::RATIO_TEST) ? 0.0 : count(gen);
+      time += weights[k] * sample[k];
+    }
+    counts.push_back(sample);
+    seconds.push_back(time);
+  }
+
+  const work_unit_model_t model = work_unit_model_t::fit(counts, seconds);
+  const work_unit_model_t default_model;
+  for (int k = 0; k < num_work_kernels; ++k) {
+    const auto kernel = static_cast<work_kernel_t>(k);
+    if (kernel == work_kernel_t::RATIO_TEST) {
+      EXPECT_EQ(model.weight(kernel), default_model.weight(kernel));
+    } else {
+      EXPECT_NEAR(model.weight(kernel), weights[k], 1e-6 * weights[1]) << work_kernel_name(kernel);
+    }
+  }
+}
+
+TEST(work_unit_model, profile_round_trip)
+{
+  work_unit_model_t model;
+  model.set_weight(work_kernel_t::SIMPLEX_ITERATION, 1.0 / 3.0 * 1e-9);
+  model.set_weight(work_kernel_t::BASIS_SOLVE, 2.718281828459045e-10);
+  model.set_weight(work_kernel_t::BOUND_STRENGTHENING, 0.0);
+  const std::string path = ::testing::TempDir() + "work_unit_profile.txt";
+  model.save(path);
+
+  // Weights are read back exactly, so a profile gives the same work units on every run
+  const work_unit_model_t loaded = work_unit_model_t::load(path);
+  for (int k = 0; k < num_work_kernels; ++k) {
+    const auto kernel = static_cast<work_kernel_t>(k);
+    EXPECT_EQ(loaded.weight(kernel), model.weight(kernel)) << work_kernel_name(kernel);
+  }
+
+  {
+    std::ofstream out(path);
+    out << "cuopt_work_unit_profile 1\nsimplex_iteration 1e-9\n";
+  }
+  EXPECT_THROW(work_unit_model_t::load(path), cuopt::logic_error);
+  {
+    std::ofstream out(path);
+    out << "not a profile\n";
+  }
+  EXPECT_THROW(work_unit_model_t::load(path), cuopt::logic_error);
+  std::remove(path.c_str());
+}
+
+TEST(work_unit_model, calibrate_on_random_lp)
+{
+  simplex_solver_settings_t<int, double> settings;
+  work_unit_calibration_t<int, double> calibration;
+  const auto problem = random_calibration_problem<int, double>(200, 400, 0.02, 7);
+  EXPECT_EQ(calibration.add_problem(problem, settings), lp_status_t::OPTIMAL);
+  ASSERT_GT(calibration.num_samples(), 0u);
+  EXPECT_GT(calibration.total_seconds(), 0.0);
+
+  const work_unit_model_t model = calibration.fit();
+  for (int k = 0; k < num_work_kernels; ++k) {
+    const double weight = model.weight(static_cast<work_kernel_t>(k));
+    EXPECT_TRUE(std::isfinite(weight) && weight >= 0.0);
+  }
+  EXPECT_TRUE(std::isfinite(calibration.relative_error(model)));
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
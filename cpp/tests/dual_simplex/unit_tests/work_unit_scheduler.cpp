@@ -0,0 +1,146 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+#include <utilities/work_limit_context.hpp>
+#include <utilities/work_unit_scheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming::dual_simplex::test {
+
+namespace {
+
+constexpr int num_contexts     = 4;
+constexpr int num_syncs        = 12;
+constexpr double sync_interval = 1.0;
+
+// What a context observed at one sync point
+struct sync_event_t {
+  double sync_target;
+  double work_at_arrival;
+  double merged_at_release;
+
+  bool operator==(const sync_event_t& other) const
+  {
+    return sync_target == other.sync_target && work_at_arrival == other.work_at_arrival &&
+           merged_at_release == other.merged_at_release;
+  }
+};
+
+struct run_log_t {
+  std::vector<double> sync_targets;
+  std::vector<double> merged;
+  std::vector<std::vector<sync_event_t>> events;
+  std::vector<double> final_work;
+};
+
+// Runs `num_contexts` threads that record work in steps of different sizes, every other step in a
+// run-ahead section, and sleep for random times between the steps. The arrival callback publishes
+// the work of a context, the sync callback merges it and the release callback reads the merge.
+run_log_t run_scheduler(unsigned seed)
+{
+  cuopt::work_unit_scheduler_t scheduler(sync_interval);
+  scheduler.set_run_ahead(true);
+
+  std::vector<std::unique_ptr<cuopt::work_limit_context_t>> contexts;
+  for (int c = 0; c < num_contexts; ++c) {
+    contexts.push_back(std::make_unique<cuopt::work_limit_context_t>(std::to_string(c)));
+    contexts.back()->deterministic = true;
+    scheduler.register_context(*contexts.back());
+  }
+
+  run_log_t log;
+  log.events.resize(num_contexts);
+  log.final_work.resize(num_contexts);
+  std::vector<double> published(num_contexts, 0.0);
+  double merged = 0.0;
+
+  scheduler.set_arrival_callback([&](cuopt::work_limit_context_t& ctx, double sync_target) {
+    const int c  = std::stoi(ctx.name);
+    published[c] = ctx.global_work_units_elapsed;
+    log.events[c].push_back({sync_target, ctx.global_work_units_elapsed, 0.0});
+  });
+  scheduler.set_sync_callback([&](double sync_target) {
+    merged = 0.0;
+    for (double work : published) {
+      merged += work;
+    }
+    log.sync_targets.push_back(sync_target);
+    log.merged.push_back(merged);
+  });
+  scheduler.set_release_callback([&](cuopt::work_limit_context_t& ctx, double) {
+    log.events[std::stoi(ctx.name)].back().merged_at_release = merged;
+  });
+
+  std::vector<std::thread> threads;
+  for (int c = 0; c < num_contexts; ++c) {
+    threads.emplace_back([&, c] {
+      auto& ctx = *contexts[c];
+      std::mt19937 gen(seed * 101 + c);
+      std::uniform_int_distribution<int> sleep_us(0, 200);
+      // Steps of a third to about one and a half sync intervals, so that some steps cross two
+      // sync points. The total stays below the last sync point.
+      const double step = (c + 1) * 0.37 * sync_interval;
+      for (int k = 0; ctx.global_work_units_elapsed + step < (num_syncs - 1) * sync_interval;
+           ++k) {
+        std::this_thread::sleep_for(std::chrono::microseconds(sleep_us(gen)));
+        if (k % 2 == 1) {
+          cuopt::scoped_run_ahead_t run_ahead(scheduler, ctx);
+          ctx.record_work_sync_on_horizon(step);
+          std::this_thread::sleep_for(std::chrono::microseconds(sleep_us(gen)));
+        } else {
+          ctx.record_work_sync_on_horizon(step);
+        }
+      }
+      while (ctx.num_syncs_reached < static_cast<size_t>(num_syncs)) {
+        scheduler.wait_for_next_sync(ctx);
+      }
+      log.final_work[c] = ctx.global_work_units_elapsed;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& ctx : contexts) {
+    scheduler.deregister_context(*ctx);
+  }
+  return log;
+}
+
+}  // namespace
+
+TEST(work_unit_scheduler, run_ahead_is_deterministic)
+{
+  const run_log_t first  = run_scheduler(1);
+  const run_log_t second = run_scheduler(2);
+
+  ASSERT_EQ(first.sync_targets.size(), static_cast<size_t>(num_syncs));
+  for (int k = 0; k < num_syncs; ++k) {
+    EXPECT_EQ(first.sync_targets[k], (k + 1) * sync_interval);
+  }
+  EXPECT_EQ(first.sync_targets, second.sync_targets);
+  EXPECT_EQ(first.merged, second.merged);
+  EXPECT_EQ(first.final_work, second.final_work);
+  for (int c = 0; c < num_contexts; ++c) {
+    ASSERT_EQ(first.events[c].size(), static_cast<size_t>(num_syncs)) << "context " << c;
+    EXPECT_EQ(first.events[c], second.events[c]) << "context " << c;
+    // Every context is released from a sync point with the merge of that sync point
+    for (int k = 0; k < num_syncs; ++k) {
+      EXPECT_EQ(first.events[c][k].sync_target, first.sync_targets[k]);
+      EXPECT_EQ(first.events[c][k].merged_at_release, first.merged[k]);
+    }
+  }
+}
+
+}  // namespace cuopt::linear_programming::dual_simplex::test
@@ -1915,7 +1915,9 @@ DONE:
  * This simulates a CPU host without GPU access.
  * Note: Environment variables must be set before calling this function.
  */
-cuopt_int_t test_cpu_only_execution(const char* filename)
+cuopt_int_t test_cpu_only_execution(const char* filename,
+                                    cuopt_int_t* termination_status_ptr,
+                                    cuopt_float_t* objective_ptr)
 {
   cuOptOptimizationProblem problem = NULL;
   cuOptSolverSettings settings     = NULL;
@@ -1928,7 +1930,7 @@ cuopt_int_t test_cpu_only_execution(const char* filename)
   cuopt_int_t num_constraints;
   cuopt_float_t* primal_solution = NULL;
 
-  printf("Testing CPU-only execution (simulated remote mode)...\n");
+  printf("Testing CPU-only execution (remote mode)...\n");
   printf("  CUDA_VISIBLE_DEVICES=%s\n", getenv("CUDA_VISIBLE_DEVICES") ? getenv("CUDA_VISIBLE_DEVICES") : "(not set)");
   printf("  CUOPT_REMOTE_HOST=%s\n", getenv("CUOPT_REMOTE_HOST") ? getenv("CUOPT_REMOTE_HOST") : "(not set)");
 
@@ -1967,7 +1969,7 @@ cuopt_int_t test_cpu_only_execution(const char* filename)
     goto DONE;
   }
 
-  status = cuOptSetIntegerParameter(settings, CUOPT_METHOD, CUOPT_METHOD_PDLP);
+  status = cuOptSetIntegerParameter(settings, CUOPT_METHOD, CUOPT_METHOD_DUAL_SIMPLEX);
   if (status != CUOPT_SUCCESS) {
     printf("Error setting method: %d\n", status);
     goto DONE;
@@ -2012,7 +2014,9 @@ cuopt_int_t test_cpu_only_execution(const char* filename)
     printf("  Primal solution[0]: %f\n", primal_solution[0]);
   }
 
-  status = CUOPT_SUCCESS;
+  *termination_status_ptr = termination_status;
+  *objective_ptr          = objective_value;
+  status                  = CUOPT_SUCCESS;
 
 DONE:
   free(primal_solution);
@@ -2025,7 +2029,9 @@ DONE:
 /**
  * Test CPU-only MIP execution with CUDA_VISIBLE_DEVICES="" and remote execution enabled.
  */
-cuopt_int_t test_cpu_only_mip_execution(const char* filename)
+cuopt_int_t test_cpu_only_mip_execution(const char* filename,
+                                        cuopt_int_t* termination_status_ptr,
+                                        cuopt_float_t* objective_ptr)
 {
   cuOptOptimizationProblem problem = NULL;
   cuOptSolverSettings settings     = NULL;
@@ -2038,7 +2044,7 @@ cuopt_int_t test_cpu_only_mip_execution(const char* filename)
   cuopt_int_t num_variables;
   cuopt_float_t* primal_solution = NULL;
 
-  printf("Testing CPU-only MIP execution (simulated remote mode)...\n");
+  printf("Testing CPU-only MIP execution (remote mode)...\n");
 
   status = cuOptReadProblem(filename, &problem);
   if (status != CUOPT_SUCCESS) {
@@ -2113,7 +2119,9 @@ cuopt_int_t test_cpu_only_mip_execution(const char* filename)
   printf("  MIP gap: %f\n", mip_gap);
   printf("  Solve time: %f\n", solve_time);
 
-  status = CUOPT_SUCCESS;
+  *termination_status_ptr = termination_status;
+  *objective_ptr          = objective_value;
+  status                  = CUOPT_SUCCESS;
 
 DONE:
   free(primal_solution);
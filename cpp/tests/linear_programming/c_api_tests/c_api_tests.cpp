@@ -14,6 +14,7 @@
 
 #include <cuopt/linear_programming/cuopt_c.h>
 #include <pdlp/cuopt_c_internal.hpp>
+#include <pdlp/remote/remote_server.hpp>
 
 #include <utilities/common_utils.hpp>
 #include <utilities/error.hpp>
@@ -323,13 +324,13 @@ TEST(c_api, mip_solution_lp_methods) { EXPECT_EQ(test_mip_solution_lp_methods(),
 // =============================================================================
 // CPU-Only Execution Tests
 // These tests verify that cuOpt can run on a CPU-only host with remote execution
-// enabled. The remote solve stubs return dummy results.
+// enabled. Requests are served by an in-process reference remote server.
 // =============================================================================
 
-// Helper to set environment variables for CPU-only mode
+// Helper to set environment variables for CPU-only mode and serve the remote requests
 class CPUOnlyTestEnvironment {
  public:
-  CPUOnlyTestEnvironment()
+  CPUOnlyTestEnvironment() : server_(0, 1)
   {
     // Save original values
     const char* cuda_visible = getenv("CUDA_VISIBLE_DEVICES");
@@ -346,11 +347,13 @@ class CPUOnlyTestEnvironment {
     // Set CPU-only environment
     setenv("CUDA_VISIBLE_DEVICES", "", 1);
     setenv("CUOPT_REMOTE_HOST", "localhost", 1);
-    setenv("CUOPT_REMOTE_PORT", "12345", 1);
+    setenv("CUOPT_REMOTE_PORT", std::to_string(server_.start()).c_str(), 1);
   }
 
   ~CPUOnlyTestEnvironment()
   {
+    server_.stop();
+
     // Restore original values
     if (cuda_was_set_) {
       setenv("CUDA_VISIBLE_DEVICES", orig_cuda_visible_.c_str(), 1);
@@ -378,25 +381,33 @@ class CPUOnlyTestEnvironment {
   bool cuda_was_set_;
   bool host_was_set_;
   bool port_was_set_;
+  cuopt::linear_programming::remote::remote_server_t server_;
 };
 
-// TODO: Add numerical assertions once gRPC remote solver replaces the stub implementation.
-// Currently validates that the CPU-only C API path completes without errors.
 TEST(c_api_cpu_only, lp_solve)
 {
   CPUOnlyTestEnvironment env;
   const std::string& rapidsDatasetRootDir = cuopt::test::get_rapids_dataset_root_dir();
   std::string lp_file = rapidsDatasetRootDir + "/linear_programming/afiro_original.mps";
-  EXPECT_EQ(test_cpu_only_execution(lp_file.c_str()), CUOPT_SUCCESS);
+  cuopt_int_t termination_status;
+  cuopt_float_t objective;
+  EXPECT_EQ(test_cpu_only_execution(lp_file.c_str(), &termination_status, &objective),
+            CUOPT_SUCCESS);
+  EXPECT_EQ(termination_status, CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_NEAR(objective, -464.7531, 1e-1);
 }
 
-// TODO: Add numerical assertions once gRPC remote solver replaces the stub implementation.
 TEST(c_api_cpu_only, mip_solve)
 {
   CPUOnlyTestEnvironment env;
   const std::string& rapidsDatasetRootDir = cuopt::test::get_rapids_dataset_root_dir();
   std::string mip_file                    = rapidsDatasetRootDir + "/mip/bb_optimality.mps";
-  EXPECT_EQ(test_cpu_only_mip_execution(mip_file.c_str()), CUOPT_SUCCESS);
+  cuopt_int_t termination_status;
+  cuopt_float_t objective;
+  EXPECT_EQ(test_cpu_only_mip_execution(mip_file.c_str(), &termination_status, &objective),
+            CUOPT_SUCCESS);
+  EXPECT_EQ(termination_status, CUOPT_TERIMINATION_STATUS_OPTIMAL);
+  EXPECT_NEAR(objective, 2.0, 1e-6);
 }
 
 // Note: cuopt_cli subprocess tests are in Python (test_cpu_only_execution.py)
@@ -1983,6 +1983,30 @@ TEST(pdlp_class, precision_single_crossover)
     afiro_primal_objective, solution.get_additional_termination_information().primal_objective));
 }
 
+TEST(pdlp_class, parallel_crossover)
+{
+  const raft::handle_t handle_{};
+
+  auto path = make_path_absolute("linear_programming/afiro_original.mps");
+  cuopt::mps_parser::mps_data_model_t<int, double> op_problem =
+    cuopt::mps_parser::parse_mps<int, double>(path, true);
+
+  auto solver_settings               = pdlp_solver_settings_t<int, double>{};
+  solver_settings.method             = cuopt::linear_programming::method_t::PDLP;
+  solver_settings.crossover          = true;
+  solver_settings.parallel_crossover = 1;
+
+  optimization_problem_solution_t<int, double> solution =
+    solve_lp(&handle_, op_problem, solver_settings);
+  EXPECT_EQ((int)solution.get_termination_status(), CUOPT_TERIMINATION_STATUS_OPTIMAL);
+
+  EXPECT_FALSE(is_incorrect_objective(
+    afiro_primal_objective, solution.get_additional_termination_information().primal_objective));
+  EXPECT_GE(solution.get_additional_termination_information().crossover_time, 0.0);
+  EXPECT_LE(solution.get_additional_termination_information().crossover_time,
+            solution.get_additional_termination_information().solve_time);
+}
+
 TEST(pdlp_class, precision_single_concurrent)
 {
   const raft::handle_t handle_{};
